@@ -0,0 +1,62 @@
+//! Sequential SQLi detection against the interleaved batch engine
+//!
+//! For each `corpus_bench` category, `detect_sqli` one input at a time is
+//! compared with `BatchScanner` at 4 and 8 lanes over the same inputs.
+//! Throughput is in inputs/s, since batching is about how many values a
+//! bulk job gets through, not how fast any one of them comes back.
+
+use std::time::Duration;
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkGroup, Criterion, Throughput};
+use criterion::measurement::WallTime;
+use libinjectionrs::batch::BatchScanner;
+use libinjectionrs::detect_sqli;
+use libinjectionrs_benches::corpus::{self, Corpus};
+
+fn bench_lanes<const LANES: usize>(group: &mut BenchmarkGroup<'_, WallTime>, inputs: &[&[u8]]) {
+    let scanner = BatchScanner::<LANES>::new();
+    group.bench_function(format!("batch_{}", LANES), |b| {
+        b.iter(|| {
+            for result in scanner.detect_sqli_many(black_box(inputs)) {
+                black_box(result);
+            }
+        })
+    });
+}
+
+fn bench_category(c: &mut Criterion, corpus: &Corpus) {
+    let inputs: Vec<&[u8]> = corpus.inputs.iter().map(Vec::as_slice).collect();
+
+    let mut group = c.benchmark_group(format!("batch/{}", corpus.name));
+    group.throughput(Throughput::Elements(inputs.len() as u64));
+    group.bench_function("sequential", |b| {
+        b.iter(|| {
+            for input in &inputs {
+                black_box(detect_sqli(black_box(input)));
+            }
+        })
+    });
+    bench_lanes::<4>(&mut group, &inputs);
+    bench_lanes::<8>(&mut group, &inputs);
+    group.finish();
+}
+
+fn bench_batch(c: &mut Criterion) {
+    for corpus in corpus::all() {
+        bench_category(c, &corpus);
+    }
+}
+
+fn config() -> Criterion {
+    Criterion::default()
+        .sample_size(50)
+        .warm_up_time(Duration::from_secs(2))
+        .measurement_time(Duration::from_secs(5))
+}
+
+criterion_group! {
+    name = benches;
+    config = config();
+    targets = bench_batch
+}
+criterion_main!(benches);
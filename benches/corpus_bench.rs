@@ -0,0 +1,138 @@
+//! Throughput per traffic category and per detection stage
+//!
+//! Categories are benign short values, benign long values, SQLi attacks and
+//! XSS attacks (see `corpus`). For each category there is one group for the
+//! full detectors and one per pipeline for its stages (see `stages`), so a
+//! regression shows up in the stage that caused it.
+//!
+//! Throughput is reported in bytes/s. Set `LIBINJECTION_BENCH_UNIT=inputs`
+//! to report inputs/s instead; compare only against a baseline saved with
+//! the same unit.
+
+use std::env;
+use std::time::Duration;
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkGroup, Criterion, Throughput};
+use criterion::measurement::WallTime;
+use libinjectionrs::{detect_sqli, detect_xss};
+use libinjectionrs_benches::corpus::{self, Corpus};
+use libinjectionrs_benches::stages::{self, Folded};
+
+fn throughput(inputs: usize, bytes: u64) -> Throughput {
+    match env::var("LIBINJECTION_BENCH_UNIT").as_deref() {
+        Ok("inputs") => Throughput::Elements(inputs as u64),
+        _ => Throughput::Bytes(bytes),
+    }
+}
+
+fn group<'c>(c: &'c mut Criterion, name: String, corpus: &Corpus) -> BenchmarkGroup<'c, WallTime> {
+    let mut group = c.benchmark_group(name);
+    group.throughput(throughput(corpus.len(), corpus.bytes()));
+    group
+}
+
+fn bench_detect(c: &mut Criterion, corpus: &Corpus) {
+    let mut group = group(c, format!("detect/{}", corpus.name), corpus);
+    group.bench_function("sqli", |b| {
+        b.iter(|| {
+            for input in &corpus.inputs {
+                black_box(detect_sqli(black_box(input)));
+            }
+        })
+    });
+    group.bench_function("xss", |b| {
+        b.iter(|| {
+            for input in &corpus.inputs {
+                black_box(detect_xss(black_box(input)));
+            }
+        })
+    });
+    group.finish();
+}
+
+fn bench_sqli_stages(c: &mut Criterion, corpus: &Corpus) {
+    let mut group = group(c, format!("sqli_stages/{}", corpus.name), corpus);
+    group.bench_function("tokenize", |b| {
+        b.iter(|| {
+            for input in &corpus.inputs {
+                black_box(stages::sqli_tokenize(black_box(input)));
+            }
+        })
+    });
+    group.bench_function("fold", |b| {
+        b.iter(|| {
+            for input in &corpus.inputs {
+                black_box(stages::sqli_fold(black_box(input)));
+            }
+        })
+    });
+
+    let fingerprints: Vec<_> = corpus.inputs.iter().map(|input| stages::sqli_fold(input)).collect();
+    group.bench_function("blacklist", |b| {
+        b.iter(|| {
+            for fingerprint in &fingerprints {
+                black_box(stages::sqli_blacklist(black_box(fingerprint)));
+            }
+        })
+    });
+
+    // Only blacklisted inputs reach the whitelist, so its throughput counts
+    // those alone
+    let mut folded = Vec::new();
+    let mut bytes = 0;
+    for input in &corpus.inputs {
+        if let Some(state) = Folded::blacklisted(input) {
+            folded.push(state);
+            bytes += input.len() as u64;
+        }
+    }
+    if !folded.is_empty() {
+        group.throughput(throughput(folded.len(), bytes));
+        group.bench_function("whitelist", |b| {
+            b.iter(|| {
+                for state in &folded {
+                    black_box(black_box(state).sqli_whitelist());
+                }
+            })
+        });
+    }
+    group.finish();
+}
+
+fn bench_xss_stages(c: &mut Criterion, corpus: &Corpus) {
+    let mut group = group(c, format!("xss_stages/{}", corpus.name), corpus);
+    group.bench_function("html5_tokenize", |b| {
+        b.iter(|| {
+            for input in &corpus.inputs {
+                black_box(stages::html5_tokenize_all(black_box(input)));
+            }
+        })
+    });
+    group.finish();
+}
+
+fn bench_corpus(c: &mut Criterion) {
+    for corpus in corpus::all() {
+        bench_detect(c, &corpus);
+        bench_sqli_stages(c, &corpus);
+        bench_xss_stages(c, &corpus);
+    }
+}
+
+// Long measurements and a tight noise band, so a few percent shows up as a
+// change rather than noise
+fn config() -> Criterion {
+    Criterion::default()
+        .sample_size(50)
+        .warm_up_time(Duration::from_secs(2))
+        .measurement_time(Duration::from_secs(5))
+        .noise_threshold(0.02)
+        .significance_level(0.01)
+}
+
+criterion_group! {
+    name = benches;
+    config = config();
+    targets = bench_corpus
+}
+criterion_main!(benches);
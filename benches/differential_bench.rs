@@ -1,97 +1,111 @@
-use criterion::{black_box, criterion_group, criterion_main, Criterion};
+//! Rust against the C implementation, end to end and stage by stage
+//!
+//! Both sides run over the same corpus (see `corpus`), reading the same
+//! buffers in place: the C calls get a pointer and a length, so nothing is
+//! copied or allocated per call on either side. Each stage has a group per
+//! category with a `rust` and a `c` function, so the ratio between the two
+//! shows where the port is slower and by how much.
+//!
+//! Before timing, every stage's results are compared across the two
+//! implementations; any difference is reported on stderr, since a faster
+//! stage that computes something else is not a fair comparison.
+
+use std::ffi::CStr;
+use std::os::raw::{c_char, c_int};
+
+use criterion::{black_box, criterion_group, criterion_main, Criterion, Throughput};
+use libinjectionrs::sqli::Fingerprint;
 use libinjectionrs::{detect_sqli as rust_detect_sqli, detect_xss as rust_detect_xss};
-use std::ffi::CString;
+use libinjectionrs_benches::corpus::{self, Corpus};
+use libinjectionrs_benches::stages::{self, SQLI_FLAG_BITS, XSS_CONTEXTS};
 
 // Include the generated bindings
 include!(concat!(env!("OUT_DIR"), "/bindings.rs"));
 
-fn call_c_sqli(input: &str) -> bool {
-    let c_input = CString::new(input).unwrap();
-    
-    unsafe {
-        let result = harness_detect_sqli(
-            c_input.as_ptr(),
-            input.len(),
-            0,
-        );
-        
-        result.is_sqli != 0
-    }
+fn c_input(input: &[u8]) -> *const c_char {
+    input.as_ptr().cast()
 }
 
-fn call_c_xss(input: &str) -> bool {
-    let c_input = CString::new(input).unwrap();
-    
-    unsafe {
-        let result = harness_detect_xss(
-            c_input.as_ptr(),
-            input.len(),
-            0,
-        );
-        
-        result.is_xss != 0
-    }
+fn c_detect_sqli(input: &[u8]) -> sqli_result_t {
+    unsafe { harness_detect_sqli(c_input(input), input.len(), 0) }
 }
 
-fn bench_rust_vs_c_sqli(c: &mut Criterion) {
-    let test_cases = vec![
-        "SELECT * FROM users WHERE id = 1",
-        "1' OR '1'='1",
-        "1 UNION SELECT password FROM users",
-        "'; DROP TABLE users; --",
-        "admin'--",
-    ];
+fn c_detect_xss(input: &[u8]) -> bool {
+    unsafe { harness_detect_xss(c_input(input), input.len(), 0).is_xss != 0 }
+}
 
-    let mut group = c.benchmark_group("sqli_rust_vs_c");
-    
-    group.bench_function("rust_sqli", |b| {
-        b.iter(|| {
-            for case in &test_cases {
-                black_box(rust_detect_sqli(black_box(case.as_bytes())));
-            }
-        })
-    });
-    
-    group.bench_function("c_sqli", |b| {
-        b.iter(|| {
-            for case in &test_cases {
-                black_box(call_c_sqli(black_box(case)));
-            }
-        })
-    });
-    
-    group.finish();
+fn c_sqli_tokenize(input: &[u8]) -> usize {
+    unsafe { harness_sqli_tokenize(c_input(input), input.len(), SQLI_FLAG_BITS as c_int) as usize }
+}
+
+fn c_sqli_fold(input: &[u8]) -> sqli_result_t {
+    unsafe { harness_sqli_fold(c_input(input), input.len(), SQLI_FLAG_BITS as c_int) }
 }
 
-fn bench_rust_vs_c_xss(c: &mut Criterion) {
-    let test_cases = vec![
-        "<script>alert('xss')</script>",
-        "<img src=x onerror=alert(1)>",
-        "<iframe src=javascript:alert(1)></iframe>",
-        "javascript:alert('xss')",
-        "Hello world",
-    ];
+fn c_html5_tokenize_all(input: &[u8]) -> usize {
+    XSS_CONTEXTS
+        .iter()
+        .map(|&flags| unsafe { harness_html5_tokenize(c_input(input), input.len(), flags as c_int) as usize })
+        .sum()
+}
 
-    let mut group = c.benchmark_group("xss_rust_vs_c");
-    
-    group.bench_function("rust_xss", |b| {
+fn c_fingerprint(result: &sqli_result_t) -> &str {
+    unsafe { CStr::from_ptr(result.fingerprint.as_ptr()) }.to_str().unwrap_or("")
+}
+
+fn same_fingerprint(rust: &Fingerprint, c: &sqli_result_t) -> bool {
+    rust.as_str() == c_fingerprint(c)
+}
+
+// Times one stage for both implementations over a corpus, after checking
+// that they agree on every input
+fn compare<R, C>(
+    c: &mut Criterion,
+    stage: &str,
+    corpus: &Corpus,
+    rust: impl Fn(&[u8]) -> R,
+    c_side: impl Fn(&[u8]) -> C,
+    agree: impl Fn(&R, &C) -> bool,
+) {
+    let differing = corpus.inputs.iter().filter(|input| !agree(&rust(input), &c_side(input))).count();
+    if differing > 0 {
+        eprintln!("warning: {}/{}: Rust and C differ on {} of {} inputs", stage, corpus.name, differing, corpus.len());
+    }
+
+    let mut group = c.benchmark_group(format!("{}/{}", stage, corpus.name));
+    group.throughput(Throughput::Bytes(corpus.bytes()));
+    group.bench_function("rust", |b| {
         b.iter(|| {
-            for case in &test_cases {
-                black_box(rust_detect_xss(black_box(case.as_bytes())));
+            for input in &corpus.inputs {
+                black_box(rust(black_box(input)));
             }
         })
     });
-    
-    group.bench_function("c_xss", |b| {
+    group.bench_function("c", |b| {
         b.iter(|| {
-            for case in &test_cases {
-                black_box(call_c_xss(black_box(case)));
+            for input in &corpus.inputs {
+                black_box(c_side(black_box(input)));
             }
         })
     });
-    
     group.finish();
 }
 
-criterion_group!(benches, bench_rust_vs_c_sqli, bench_rust_vs_c_xss);
-criterion_main!(benches);
\ No newline at end of file
+fn bench_rust_vs_c(c: &mut Criterion) {
+    for corpus in corpus::all() {
+        compare(c, "detect_sqli", &corpus, rust_detect_sqli, c_detect_sqli, |rust, c| {
+            rust.is_injection() == (c.is_sqli != 0)
+        });
+        compare(c, "detect_xss", &corpus, |input| rust_detect_xss(input).is_injection(), c_detect_xss, |rust, c| {
+            rust == c
+        });
+        compare(c, "sqli_tokenize", &corpus, stages::sqli_tokenize, c_sqli_tokenize, |rust, c| rust == c);
+        compare(c, "sqli_fold", &corpus, stages::sqli_fold, c_sqli_fold, same_fingerprint);
+        compare(c, "html5_tokenize", &corpus, stages::html5_tokenize_all, c_html5_tokenize_all, |rust, c| {
+            rust == c
+        });
+    }
+}
+
+criterion_group!(benches, bench_rust_vs_c);
+criterion_main!(benches);
@@ -0,0 +1,56 @@
+//! The html5 tokenizer on inputs built to make its scans slow
+//!
+//! Each shape opens a comment, CDATA section, `<% %>` block or attribute
+//! value and then repeats a near miss of its terminator, at several
+//! lengths. Throughput is in bytes, so a scan that is linear in its input
+//! shows the same rate at every length of a shape; one that rescans shows
+//! a rate that falls as the input grows.
+
+use criterion::{black_box, criterion_group, criterion_main, BenchmarkId, Criterion, Throughput};
+use libinjectionrs::detect_xss;
+use libinjectionrs_benches::stages;
+
+const LENGTHS: [usize; 3] = [256, 4096, 65536];
+
+// Opening, then the near miss repeated after it
+const SHAPES: [(&str, &[u8], &[u8]); 10] = [
+    ("comment_dash_bang", b"<!--", b"-!"),
+    ("comment_dashes", b"<!--", b"-"),
+    ("comment_dash_nul", b"<!--", b"--\0"),
+    ("comment_gt", b"<!--", b"->"),
+    ("cdata_brackets", b"<![CDATA[", b"]"),
+    ("cdata_bracket_gt", b"<![CDATA[", b"]>"),
+    ("percent_block", b"<%", b"%"),
+    ("value_no_quote", b"<a b=", b"x-"),
+    ("value_double_quote", b"<a b=\"", b"'`-"),
+    ("value_single_quote", b"<a b='", b"\"`-"),
+];
+
+fn shape(open: &[u8], near_miss: &[u8], len: usize) -> Vec<u8> {
+    let mut input = open.to_vec();
+    while input.len() < len {
+        input.extend_from_slice(near_miss);
+    }
+    input.truncate(len);
+    input
+}
+
+fn bench_html5_adversarial(c: &mut Criterion) {
+    for (name, open, near_miss) in SHAPES {
+        let mut group = c.benchmark_group(format!("html5_adversarial/{}", name));
+        for len in LENGTHS {
+            let input = shape(open, near_miss, len);
+            group.throughput(Throughput::Bytes(len as u64));
+            group.bench_with_input(BenchmarkId::new("tokenize", len), &input, |b, input| {
+                b.iter(|| black_box(stages::html5_tokenize_all(black_box(input))))
+            });
+            group.bench_with_input(BenchmarkId::new("detect_xss", len), &input, |b, input| {
+                b.iter(|| black_box(detect_xss(black_box(input))))
+            });
+        }
+        group.finish();
+    }
+}
+
+criterion_group!(benches, bench_html5_adversarial);
+criterion_main!(benches);
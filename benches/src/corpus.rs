@@ -0,0 +1,283 @@
+//! Benchmark inputs by traffic category
+//!
+//! Attacks come from the libinjection-c test files that the unit tests
+//! use (`test-sqli-*`, `test-folding-*`, `test-tokens-*` and
+//! `test-html5-*`), read from `../libinjection-c/tests` or the directory
+//! in `LIBINJECTION_CORPUS`. Without the submodule a small built-in sample
+//! stands in, with a note on stderr, so the numbers are not comparable
+//! with a full run.
+//!
+//! Benign traffic is generated from a fixed seed, so every run sees the
+//! same bytes: short values like ids, names, emails, dates, UUIDs and
+//! tokens, and long values like prose and JSON documents of 1 to 4 KiB.
+
+use std::env;
+use std::fs;
+use std::path::{Path, PathBuf};
+
+/// One category of inputs
+pub struct Corpus {
+    pub name: &'static str,
+    pub inputs: Vec<Vec<u8>>,
+}
+
+impl Corpus {
+    /// Total bytes over all inputs
+    pub fn bytes(&self) -> u64 {
+        self.inputs.iter().map(|input| input.len() as u64).sum()
+    }
+
+    pub fn len(&self) -> usize {
+        self.inputs.len()
+    }
+
+    pub fn is_empty(&self) -> bool {
+        self.inputs.is_empty()
+    }
+}
+
+/// Every category, benign first
+pub fn all() -> Vec<Corpus> {
+    vec![benign_short(), benign_long(), sqli_attacks(), xss_attacks()]
+}
+
+/// The libinjection-c test directory, if present
+pub fn test_dir() -> Option<PathBuf> {
+    let dir = match env::var_os("LIBINJECTION_CORPUS") {
+        Some(dir) => PathBuf::from(dir),
+        None => Path::new(env!("CARGO_MANIFEST_DIR")).join("../libinjection-c/tests"),
+    };
+    dir.is_dir().then_some(dir)
+}
+
+/// SQL inputs from the SQLi, folding and tokenizer tests
+pub fn sqli_attacks() -> Corpus {
+    let inputs = load(&["test-sqli-", "test-folding-", "test-tokens-"], SQLI_SAMPLE);
+    Corpus { name: "sqli_attacks", inputs }
+}
+
+/// HTML inputs from the html5 tokenizer tests
+pub fn xss_attacks() -> Corpus {
+    let inputs = load(&["test-html5-"], XSS_SAMPLE);
+    Corpus { name: "xss_attacks", inputs }
+}
+
+/// Short form fields, query arguments and cookie values
+pub fn benign_short() -> Corpus {
+    let mut rng = Rng(0x5eed_0001);
+    let inputs = (0..2000)
+        .map(|i| match i % 8 {
+            0 => rng.below(1_000_000).to_string().into_bytes(),
+            1 => format!("{}_{}", rng.pick(FIRST_NAMES), rng.pick(LAST_NAMES)).into_bytes(),
+            2 => format!("{} {}", rng.pick(FIRST_NAMES), rng.pick(LAST_NAMES)).into_bytes(),
+            3 => format!("{}.{}@example.com", rng.pick(FIRST_NAMES), rng.pick(LAST_NAMES)).to_lowercase().into_bytes(),
+            4 => format!("2026-{:02}-{:02}", rng.below(12) + 1, rng.below(28) + 1).into_bytes(),
+            5 => rng.uuid().into_bytes(),
+            6 => {
+                let len = 16 + rng.below(24) as usize;
+                rng.token(len).into_bytes()
+            }
+            _ => format!("{} {}", rng.pick(WORDS), rng.pick(WORDS)).into_bytes(),
+        })
+        .collect();
+    Corpus { name: "benign_short", inputs }
+}
+
+/// Long free text and JSON bodies
+pub fn benign_long() -> Corpus {
+    let mut rng = Rng(0x5eed_0002);
+    let inputs = (0..200)
+        .map(|i| {
+            let target = 1024 + rng.below(3 * 1024) as usize;
+            if i % 2 == 0 {
+                rng.prose(target)
+            } else {
+                rng.json(target)
+            }
+        })
+        .collect();
+    Corpus { name: "benign_long", inputs }
+}
+
+// Reads the input of every test file whose name starts with one of
+// `prefixes`, or returns `sample` without the test directory
+fn load(prefixes: &[&str], sample: &[&str]) -> Vec<Vec<u8>> {
+    let mut paths: Vec<PathBuf> = match test_dir().and_then(|dir| fs::read_dir(dir).ok()) {
+        Some(entries) => entries
+            .filter_map(|entry| entry.ok().map(|entry| entry.path()))
+            .filter(|path| {
+                let name = path.file_name().and_then(|name| name.to_str()).unwrap_or("");
+                name.ends_with(".txt") && prefixes.iter().any(|prefix| name.starts_with(prefix))
+            })
+            .collect(),
+        None => Vec::new(),
+    };
+    if paths.is_empty() {
+        eprintln!("note: libinjection-c tests not found, benchmarking a built-in sample for {:?}", prefixes);
+        return sample.iter().map(|input| input.as_bytes().to_vec()).collect();
+    }
+    // Sorted so every run sees the inputs in the same order
+    paths.sort();
+    paths.iter().filter_map(|path| fs::read(path).ok()).filter_map(|file| parse_input(&file)).collect()
+}
+
+/// The `--INPUT--` section of a libinjection-c test file, without the
+/// newline that ends it
+pub fn parse_input(file: &[u8]) -> Option<Vec<u8>> {
+    const START: &[u8] = b"--INPUT--\n";
+    const END: &[u8] = b"\n--EXPECTED--";
+    let start = find(file, START)? + START.len();
+    let rest = &file[start..];
+    let end = find(rest, END).unwrap_or(rest.len());
+    Some(rest[..end].to_vec())
+}
+
+fn find(haystack: &[u8], needle: &[u8]) -> Option<usize> {
+    haystack.windows(needle.len()).position(|window| window == needle)
+}
+
+// Deterministic generator, xorshift64*
+struct Rng(u64);
+
+impl Rng {
+    fn next(&mut self) -> u64 {
+        self.0 ^= self.0 >> 12;
+        self.0 ^= self.0 << 25;
+        self.0 ^= self.0 >> 27;
+        self.0.wrapping_mul(0x2545_f491_4f6c_dd1d)
+    }
+
+    fn below(&mut self, n: u64) -> u64 {
+        self.next() % n
+    }
+
+    fn pick<'a>(&mut self, items: &[&'a str]) -> &'a str {
+        items[self.below(items.len() as u64) as usize]
+    }
+
+    fn uuid(&mut self) -> String {
+        let (a, b) = (self.next(), self.next());
+        format!(
+            "{:08x}-{:04x}-4{:03x}-a{:03x}-{:012x}",
+            a >> 32,
+            (a >> 16) & 0xffff,
+            a & 0xfff,
+            b >> 52,
+            b & 0xffff_ffff_ffff
+        )
+    }
+
+    fn token(&mut self, len: usize) -> String {
+        const ALPHABET: &[u8] = b"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+        (0..len).map(|_| char::from(ALPHABET[self.below(ALPHABET.len() as u64) as usize])).collect()
+    }
+
+    fn sentence(&mut self) -> String {
+        let words = 6 + self.below(12);
+        let mut sentence = String::new();
+        for i in 0..words {
+            if i > 0 {
+                sentence.push_str(if self.below(10) == 0 { ", " } else { " " });
+            }
+            sentence.push_str(self.pick(WORDS));
+        }
+        sentence.push_str(self.pick(&[".", ".", ".", "?", "!"]));
+        sentence
+    }
+
+    fn prose(&mut self, target: usize) -> Vec<u8> {
+        let mut text = String::new();
+        while text.len() < target {
+            if !text.is_empty() {
+                text.push_str(if self.below(6) == 0 { "\n\n" } else { " " });
+            }
+            let sentence = self.sentence();
+            let mut chars = sentence.chars();
+            if let Some(first) = chars.next() {
+                text.extend(first.to_uppercase());
+                text.push_str(chars.as_str());
+            }
+        }
+        text.into_bytes()
+    }
+
+    fn json(&mut self, target: usize) -> Vec<u8> {
+        let mut text = String::from("{\"items\":[");
+        let mut first = true;
+        while text.len() < target {
+            if !first {
+                text.push(',');
+            }
+            first = false;
+            text.push_str(&format!(
+                "{{\"id\":{},\"name\":\"{} {}\",\"email\":\"{}@example.com\",\"active\":{},\"score\":{}.{},\"note\":\"{}\"}}",
+                self.below(100_000),
+                self.pick(FIRST_NAMES),
+                self.pick(LAST_NAMES),
+                self.pick(FIRST_NAMES).to_lowercase(),
+                self.below(2) == 0,
+                self.below(100),
+                self.below(100),
+                self.sentence()
+            ));
+        }
+        text.push_str("]}");
+        text.into_bytes()
+    }
+}
+
+const FIRST_NAMES: &[&str] = &[
+    "James", "Mary", "Wei", "Fatima", "Olga", "Pedro", "Aiko", "Noah", "Priya", "Lars", "Amara", "Jonas", "Sofia",
+    "Kwame", "Elena", "Omar",
+];
+
+const LAST_NAMES: &[&str] = &[
+    "Smith", "Garcia", "Chen", "Okafor", "Ivanova", "Silva", "Tanaka", "Miller", "Patel", "Berg", "Mensah", "Weber",
+    "Rossi", "Novak", "Haddad", "Kim",
+];
+
+// Everyday words, including some that are also SQL keywords
+const WORDS: &[&str] = &[
+    "the", "a", "and", "or", "not", "to", "of", "in", "for", "with", "on", "at", "from", "by", "order", "select",
+    "table", "group", "union", "update", "delete", "like", "between", "new", "shipping", "delivery", "price",
+    "quality", "great", "product", "customer", "support", "return", "size", "color", "blue", "red", "shoes", "shirt",
+    "jacket", "phone", "case", "fast", "slow", "arrived", "yesterday", "today", "week", "would", "recommend", "again",
+    "thanks", "please", "help", "account", "password", "reset", "email", "address", "city", "street", "number",
+    "it's", "don't", "I'm", "50%", "$20", "#1", "(maybe)", "e-mail", "5-star",
+];
+
+// Stand-ins for the SQLi tests, a few of each family
+const SQLI_SAMPLE: &[&str] = &[
+    "1' OR '1'='1",
+    "1 UNION SELECT password FROM users",
+    "1 UNION ALL SELECT NULL,NULL,NULL--",
+    "'; DROP TABLE users; --",
+    "admin'--",
+    "1' AND SLEEP(5)--",
+    "1 AND 1=1",
+    "-1 OR 2>1",
+    "1' AND (SELECT 1 FROM (SELECT COUNT(*),CONCAT(version(),FLOOR(RAND(0)*2))x FROM information_schema.tables GROUP BY x)a)--",
+    "1;WAITFOR DELAY '0:0:5'--",
+    "1 /*!UNION*/ /*!SELECT*/ 1,2,3",
+    "x' AND extractvalue(1,concat(0x7e,(SELECT @@version)))--",
+    "1 INTO OUTFILE '/tmp/x'",
+    "0x414243",
+    "' OR 1=1 UNION SELECT table_name FROM information_schema.tables--",
+    "SELECT * FROM users WHERE id = 1",
+];
+
+// Stand-ins for the html5 tests
+const XSS_SAMPLE: &[&str] = &[
+    "<script>alert(1)</script>",
+    "<img src=x onerror=alert(1)>",
+    "<iframe src=javascript:alert(1)></iframe>",
+    "<svg/onload=alert(1)>",
+    "<a href=\"javascript:alert(1)\">x</a>",
+    "<body onload=alert(1)>",
+    "<div style=\"background:url(javascript:alert(1))\">",
+    "\"><script>alert(document.cookie)</script>",
+    "<!-- comment --><b>bold</b>",
+    "<p class='x'>Hello world</p>",
+    "<input value=\"x\" autofocus onfocus=alert(1)>",
+    "<![CDATA[<script>alert(1)</script>]]>",
+];
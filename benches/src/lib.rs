@@ -1 +1,4 @@
-// Benchmark library for libinjectionrs
\ No newline at end of file
+// Benchmark library for libinjectionrs
+
+pub mod corpus;
+pub mod stages;
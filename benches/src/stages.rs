@@ -0,0 +1,87 @@
+//! The detection pipeline split into stages
+//!
+//! SQLi detection tokenizes, folds the tokens into a fingerprint, looks the
+//! fingerprint up in the blacklist and, on a hit, runs the whitelist rules.
+//! XSS detection runs the html5 tokenizer in each starting context. Each
+//! function here runs one stage on its own so it can be timed on its own;
+//! the fold stage includes the tokenizing it consumes. Every function
+//! returns a value derived from its work so none of it can be optimized away.
+//!
+//! `harness_sqli_tokenize`, `harness_sqli_fold` and `harness_html5_tokenize`
+//! in `ffi-harness` do the same work in the C implementation.
+
+use libinjectionrs::sqli::{blacklist, Fingerprint, SqliTokenizer};
+use libinjectionrs::xss::{Html5Flags, Html5State};
+use libinjectionrs::{SqliFlags, SqliState};
+
+/// Flags of the first SQLi pass of `detect_sqli`, `FLAG_QUOTE_NONE |
+/// FLAG_SQL_ANSI`. The raw tokenizer takes them as given, so they are
+/// spelled out rather than left at 0 for the state to fill in.
+pub const SQLI_FLAG_BITS: u32 = (1 << 0) | (1 << 3);
+
+fn sqli_flags() -> SqliFlags {
+    SqliFlags::new(SQLI_FLAG_BITS)
+}
+
+/// The contexts `detect_xss` tokenizes every input in
+pub const XSS_CONTEXTS: [Html5Flags; 5] = [
+    Html5Flags::DataState,
+    Html5Flags::ValueNoQuote,
+    Html5Flags::ValueSingleQuote,
+    Html5Flags::ValueDoubleQuote,
+    Html5Flags::ValueBackQuote,
+];
+
+/// Tokenizes without folding; returns the token count
+pub fn sqli_tokenize(input: &[u8]) -> usize {
+    let mut tokenizer = SqliTokenizer::new(input, sqli_flags());
+    let mut count = 0;
+    while tokenizer.next_token().is_some() {
+        count += 1;
+    }
+    count
+}
+
+/// Tokenizes and folds into a fingerprint
+pub fn sqli_fold(input: &[u8]) -> Fingerprint {
+    SqliState::new(input, sqli_flags()).detection_fingerprint()
+}
+
+/// Blacklist lookup of a fingerprint from [`sqli_fold`]
+pub fn sqli_blacklist(fingerprint: &Fingerprint) -> bool {
+    blacklist::is_blacklisted(fingerprint.as_str())
+}
+
+/// A folded input ready for the whitelist stage
+pub struct Folded<'a> {
+    state: SqliState<'a>,
+}
+
+impl<'a> Folded<'a> {
+    /// Folds `input`, keeping it only if its fingerprint is blacklisted,
+    /// since only those reach the whitelist
+    pub fn blacklisted(input: &'a [u8]) -> Option<Self> {
+        let mut state = SqliState::new(input, sqli_flags());
+        sqli_blacklist(&state.detection_fingerprint()).then_some(Folded { state })
+    }
+
+    /// The whitelist rules; true if the input still counts as SQLi
+    pub fn sqli_whitelist(&self) -> bool {
+        self.state.is_not_whitelisted()
+    }
+}
+
+/// Runs the html5 tokenizer in one context; returns the token count
+pub fn html5_tokenize(input: &[u8], flags: Html5Flags) -> usize {
+    let mut state = Html5State::new(input, flags);
+    let mut count = 0;
+    while state.next() {
+        count += 1;
+    }
+    count
+}
+
+/// Runs the html5 tokenizer in every context `detect_xss` uses
+pub fn html5_tokenize_all(input: &[u8]) -> usize {
+    XSS_CONTEXTS.iter().map(|&flags| html5_tokenize(input, flags)).sum()
+}
@@ -0,0 +1,127 @@
+#ifndef LIBINJECTIONRS_H
+#define LIBINJECTIONRS_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * C API for the Rust libinjection port
+ *
+ * The single-input functions mirror harness_detect_sqli/harness_detect_xss
+ * in ffi-harness/harness.h, and the result structs have the same layout, so
+ * callers can switch from the C reference implementation function for
+ * function. Inputs are pointer and length; they need no NUL terminator and
+ * may contain NUL bytes. A NULL pointer is only valid with length 0.
+ */
+
+/**
+ * SQL detection flags, the values of the C implementation's FLAG_* enum
+ */
+#define LIBINJECTIONRS_FLAG_NONE          0
+#define LIBINJECTIONRS_FLAG_QUOTE_NONE    (1 << 0)
+#define LIBINJECTIONRS_FLAG_QUOTE_SINGLE  (1 << 1)
+#define LIBINJECTIONRS_FLAG_QUOTE_DOUBLE  (1 << 2)
+#define LIBINJECTIONRS_FLAG_SQL_ANSI      (1 << 3)
+#define LIBINJECTIONRS_FLAG_SQL_MYSQL     (1 << 4)
+
+/**
+ * SQL injection detection result
+ */
+typedef struct {
+    int is_sqli;                    // 1 if SQL injection detected, 0 otherwise
+    char fingerprint[16];           // Fingerprint string (null-terminated)
+} libinjectionrs_sqli_result_t;
+
+/**
+ * XSS detection result
+ */
+typedef struct {
+    int is_xss;                     // 1 if XSS detected, 0 otherwise
+} libinjectionrs_xss_result_t;
+
+/**
+ * One input of a batch
+ */
+typedef struct {
+    const char* data;
+    size_t len;
+} libinjectionrs_input_t;
+
+/**
+ * Reusable detector state, owned by the caller. Holds buffers that would
+ * otherwise be set up again for every input. Not thread-safe: use one state
+ * per thread.
+ */
+typedef struct libinjectionrs_state libinjectionrs_state_t;
+
+/**
+ * Detect SQL injection in input
+ * @param input Input to test
+ * @param input_len Length of input
+ * @param flags Detection flags (0 for default)
+ * @return Detection result
+ */
+libinjectionrs_sqli_result_t libinjectionrs_detect_sqli(const char* input, size_t input_len, int flags);
+
+/**
+ * Detect XSS in input
+ * @param input Input to test
+ * @param input_len Length of input
+ * @param flags Detection flags (currently unused, as in the harness)
+ * @return Detection result
+ */
+libinjectionrs_xss_result_t libinjectionrs_detect_xss(const char* input, size_t input_len, int flags);
+
+/**
+ * Create a detector state
+ * @return New state, to be released with libinjectionrs_state_free
+ */
+libinjectionrs_state_t* libinjectionrs_state_new(void);
+
+/**
+ * Release a detector state. NULL is ignored.
+ */
+void libinjectionrs_state_free(libinjectionrs_state_t* state);
+
+/**
+ * Detect SQL injection in each of count inputs in one call
+ * @param state State to reuse, or NULL to use a temporary one
+ * @param inputs Array of count inputs
+ * @param count Number of inputs
+ * @param flags Detection flags (0 for default), applied to every input
+ * @param results Array of count results, written in input order
+ * @return Number of inputs found to be SQL injection, or -1 if inputs or
+ *         results is NULL while count is not 0 (nothing is written)
+ */
+int libinjectionrs_detect_sqli_batch(libinjectionrs_state_t* state,
+                                     const libinjectionrs_input_t* inputs, size_t count,
+                                     int flags, libinjectionrs_sqli_result_t* results);
+
+/**
+ * Detect XSS in each of count inputs in one call
+ * @param state State to reuse, or NULL to use a temporary one
+ * @param inputs Array of count inputs
+ * @param count Number of inputs
+ * @param flags Detection flags (currently unused)
+ * @param results Array of count results, written in input order
+ * @return Number of inputs found to be XSS, or -1 if inputs or results is
+ *         NULL while count is not 0 (nothing is written)
+ */
+int libinjectionrs_detect_xss_batch(libinjectionrs_state_t* state,
+                                    const libinjectionrs_input_t* inputs, size_t count,
+                                    int flags, libinjectionrs_xss_result_t* results);
+
+/**
+ * Get the libinjectionrs version string
+ * @return Version string
+ */
+const char* libinjectionrs_version(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBINJECTIONRS_H */
@@ -0,0 +1,237 @@
+//! C API for libinjectionrs
+//!
+//! Exports the functions declared in `include/libinjectionrs.h`. The
+//! single-input calls mirror `harness_detect_sqli`/`harness_detect_xss` from
+//! the C reference harness. The batch calls check a whole request's fields
+//! in one crossing and reuse a caller-owned [`Scanner`] between them, so no
+//! memory is allocated per input.
+
+// Raw pointers from C are the point of this crate; every dereference is
+// guarded and commented
+#![allow(unsafe_code)]
+
+use core::ffi::{c_char, c_int};
+use core::slice;
+
+use libinjectionrs::{DetectionResult, Scanner, SqliFlags};
+
+#[cfg(test)]
+mod tests;
+
+/// SQL injection detection result, same layout as the harness's `sqli_result_t`
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct SqliResult {
+    pub is_sqli: c_int,
+    pub fingerprint: [c_char; 16],
+}
+
+/// XSS detection result, same layout as the harness's `xss_result_t`
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub struct XssResult {
+    pub is_xss: c_int,
+}
+
+/// One input of a batch
+#[repr(C)]
+#[derive(Debug, Clone, Copy)]
+pub struct Input {
+    pub data: *const c_char,
+    pub len: usize,
+}
+
+/// Opaque detector state handed to C as `libinjectionrs_state_t*`
+pub struct State {
+    scanner: Scanner<'static>,
+}
+
+static VERSION: &str = concat!(env!("CARGO_PKG_VERSION"), "\0");
+
+impl SqliResult {
+    fn from_detection(result: &DetectionResult) -> Self {
+        let mut fingerprint = [0 as c_char; 16];
+        if let Some(fp) = &result.fingerprint {
+            // The fingerprint is NUL-padded to 8 bytes, so this stays terminated
+            for (dst, &src) in fingerprint.iter_mut().zip(fp.as_bytes().iter().take_while(|&&b| b != 0)) {
+                *dst = src as c_char;
+            }
+        }
+        SqliResult { is_sqli: c_int::from(result.is_injection()), fingerprint }
+    }
+}
+
+// Views a C input as a byte slice. NULL or a zero length is the empty input.
+//
+// SAFETY: unless `data` is NULL, it must point to `len` readable bytes that
+// stay valid and unmodified for the returned lifetime.
+unsafe fn input_bytes<'a>(data: *const c_char, len: usize) -> &'a [u8] {
+    if data.is_null() || len == 0 {
+        return &[];
+    }
+    // SAFETY: guaranteed by the caller, see above
+    unsafe { slice::from_raw_parts(data.cast::<u8>(), len) }
+}
+
+// Views a C array of `count` elements. None if it is NULL while count is not 0.
+//
+// SAFETY: unless NULL, `items` must point to `count` initialized elements.
+unsafe fn array<'a, T>(items: *const T, count: usize) -> Option<&'a [T]> {
+    if count == 0 {
+        return Some(&[]);
+    }
+    if items.is_null() {
+        return None;
+    }
+    // SAFETY: guaranteed by the caller, see above
+    Some(unsafe { slice::from_raw_parts(items, count) })
+}
+
+// Runs `detect` over a batch, writing results in input order and counting
+// the hits. Returns -1 without writing anything if an array is missing.
+//
+// SAFETY: `inputs` and each input as for `array`/`input_bytes`; unless NULL,
+// `results` must be valid for writing `count` elements and `state` must come
+// from `libinjectionrs_state_new`.
+unsafe fn run_batch<R>(
+    state: *mut State,
+    inputs: *const Input,
+    count: usize,
+    results: *mut R,
+    mut detect: impl FnMut(&mut Scanner, &[u8]) -> (R, bool),
+) -> c_int {
+    // SAFETY: guaranteed by the caller
+    let Some(inputs) = (unsafe { array(inputs, count) }) else {
+        return -1;
+    };
+    if results.is_null() && count != 0 {
+        return -1;
+    }
+
+    let mut temporary = None;
+    // SAFETY: a non-NULL state came from libinjectionrs_state_new and is not
+    // used elsewhere during the call
+    let scanner = match unsafe { state.as_mut() } {
+        Some(state) => &mut state.scanner,
+        None => temporary.insert(Scanner::new()),
+    };
+
+    let mut hits: c_int = 0;
+    for (i, input) in inputs.iter().enumerate() {
+        // SAFETY: each input is valid as guaranteed by the caller
+        let bytes = unsafe { input_bytes(input.data, input.len) };
+        let (result, hit) = detect(scanner, bytes);
+        // SAFETY: results has room for count elements and i < count
+        unsafe { results.add(i).write(result) };
+        hits = hits.saturating_add(c_int::from(hit));
+    }
+    hits
+}
+
+/// Detects SQL injection in one input, as `harness_detect_sqli` does for the
+/// C implementation.
+///
+/// # Safety
+///
+/// Unless `input` is NULL, it must point to `input_len` readable bytes.
+#[no_mangle]
+pub unsafe extern "C" fn libinjectionrs_detect_sqli(input: *const c_char, input_len: usize, flags: c_int) -> SqliResult {
+    // SAFETY: guaranteed by the caller
+    let input = unsafe { input_bytes(input, input_len) };
+    let result = libinjectionrs::detect_sqli_with_flags(input, sqli_flags(flags));
+    SqliResult::from_detection(&result)
+}
+
+/// Detects XSS in one input, as `harness_detect_xss` does for the C
+/// implementation. `flags` is unused.
+///
+/// # Safety
+///
+/// Unless `input` is NULL, it must point to `input_len` readable bytes.
+#[no_mangle]
+pub unsafe extern "C" fn libinjectionrs_detect_xss(input: *const c_char, input_len: usize, _flags: c_int) -> XssResult {
+    // SAFETY: guaranteed by the caller
+    let input = unsafe { input_bytes(input, input_len) };
+    XssResult { is_xss: c_int::from(libinjectionrs::detect_xss(input).is_injection()) }
+}
+
+/// Creates a detector state for the batch calls
+#[no_mangle]
+pub extern "C" fn libinjectionrs_state_new() -> *mut State {
+    Box::into_raw(Box::new(State { scanner: Scanner::new() }))
+}
+
+/// Releases a state from `libinjectionrs_state_new`. NULL is ignored.
+///
+/// # Safety
+///
+/// `state` must be NULL or a state from `libinjectionrs_state_new` that has
+/// not been freed yet, and must not be used afterwards.
+#[no_mangle]
+pub unsafe extern "C" fn libinjectionrs_state_free(state: *mut State) {
+    if !state.is_null() {
+        // SAFETY: the pointer came from Box::into_raw and is freed only once
+        drop(unsafe { Box::from_raw(state) });
+    }
+}
+
+/// Detects SQL injection in each of `count` inputs, writing one result per
+/// input. Returns the number of injections, or -1 if an array is NULL.
+///
+/// # Safety
+///
+/// `inputs` must point to `count` inputs, each valid as for
+/// `libinjectionrs_detect_sqli`, and `results` to room for `count` results.
+/// `state` must be NULL or a live state not in use by another thread.
+#[no_mangle]
+pub unsafe extern "C" fn libinjectionrs_detect_sqli_batch(
+    state: *mut State,
+    inputs: *const Input,
+    count: usize,
+    flags: c_int,
+    results: *mut SqliResult,
+) -> c_int {
+    let flags = sqli_flags(flags);
+    // SAFETY: guaranteed by the caller
+    unsafe {
+        run_batch(state, inputs, count, results, |scanner, input| {
+            let result = scanner.detect_sqli_with_flags(input, flags);
+            (SqliResult::from_detection(&result), result.is_injection())
+        })
+    }
+}
+
+/// Detects XSS in each of `count` inputs, writing one result per input.
+/// Returns the number of injections, or -1 if an array is NULL.
+///
+/// # Safety
+///
+/// As for `libinjectionrs_detect_sqli_batch`.
+#[no_mangle]
+pub unsafe extern "C" fn libinjectionrs_detect_xss_batch(
+    state: *mut State,
+    inputs: *const Input,
+    count: usize,
+    _flags: c_int,
+    results: *mut XssResult,
+) -> c_int {
+    // SAFETY: guaranteed by the caller
+    unsafe {
+        run_batch(state, inputs, count, results, |scanner, input| {
+            let is_xss = scanner.detect_xss(input).is_injection();
+            (XssResult { is_xss: c_int::from(is_xss) }, is_xss)
+        })
+    }
+}
+
+/// Returns the library version as a NUL-terminated string
+#[no_mangle]
+pub extern "C" fn libinjectionrs_version() -> *const c_char {
+    VERSION.as_ptr().cast()
+}
+
+fn sqli_flags(flags: c_int) -> SqliFlags {
+    // Flags are a bit set; C passes them through an int
+    SqliFlags::new(flags as u32)
+}
+
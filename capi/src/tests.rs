@@ -0,0 +1,81 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use super::*;
+use core::ffi::CStr;
+use core::ptr;
+
+const INPUTS: &[&[u8]] = &[
+    b"",
+    b"hello world",
+    b"1' OR '1'='1",
+    b"1 UNION SELECT password FROM users",
+    b"<script>alert(1)</script>",
+    b"<img src=x onerror=alert(1)>",
+    b"a\0b' or 1=1 --",
+];
+
+fn fingerprint(result: &SqliResult) -> &str {
+    // SAFETY: the fingerprint array is always NUL-terminated
+    unsafe { CStr::from_ptr(result.fingerprint.as_ptr()) }.to_str().unwrap()
+}
+
+fn c_inputs() -> Vec<Input> {
+    INPUTS.iter().map(|input| Input { data: input.as_ptr().cast(), len: input.len() }).collect()
+}
+
+#[test]
+fn test_single_calls_match_rust_api() {
+    for input in INPUTS {
+        // Default flags, then FLAG_QUOTE_SINGLE | FLAG_SQL_MYSQL
+        for flags in [0u32, (1 << 1) | (1 << 4)] {
+            let expected = libinjectionrs::detect_sqli_with_flags(input, SqliFlags::new(flags));
+            let result = unsafe { libinjectionrs_detect_sqli(input.as_ptr().cast(), input.len(), flags as c_int) };
+            assert_eq!(result.is_sqli != 0, expected.is_injection(), "{:?}", input);
+            assert_eq!(fingerprint(&result), expected.fingerprint.unwrap().as_str(), "{:?}", input);
+        }
+        let xss = unsafe { libinjectionrs_detect_xss(input.as_ptr().cast(), input.len(), 0) };
+        assert_eq!(xss.is_xss != 0, libinjectionrs::detect_xss(input).is_injection(), "{:?}", input);
+    }
+}
+
+#[test]
+fn test_batch_matches_single_calls() {
+    let inputs = c_inputs();
+    let state = libinjectionrs_state_new();
+    for state in [state, ptr::null_mut()] {
+        // Twice through the same state, to exercise reuse
+        for _ in 0..2 {
+            let mut sqli = vec![SqliResult { is_sqli: -1, fingerprint: [0; 16] }; inputs.len()];
+            let hits = unsafe { libinjectionrs_detect_sqli_batch(state, inputs.as_ptr(), inputs.len(), 0, sqli.as_mut_ptr()) };
+            let mut xss = vec![XssResult { is_xss: -1 }; inputs.len()];
+            let xss_hits = unsafe { libinjectionrs_detect_xss_batch(state, inputs.as_ptr(), inputs.len(), 0, xss.as_mut_ptr()) };
+
+            for (i, input) in INPUTS.iter().enumerate() {
+                assert_eq!(sqli[i], unsafe { libinjectionrs_detect_sqli(input.as_ptr().cast(), input.len(), 0) });
+                assert_eq!(xss[i], unsafe { libinjectionrs_detect_xss(input.as_ptr().cast(), input.len(), 0) });
+            }
+            assert_eq!(hits, sqli.iter().filter(|result| result.is_sqli != 0).count() as c_int);
+            assert_eq!(xss_hits, xss.iter().filter(|result| result.is_xss != 0).count() as c_int);
+        }
+    }
+    unsafe { libinjectionrs_state_free(state) };
+}
+
+#[test]
+fn test_null_arguments() {
+    let result = unsafe { libinjectionrs_detect_sqli(ptr::null(), 0, 0) };
+    assert_eq!(result.is_sqli, 0);
+    let hits = unsafe { libinjectionrs_detect_sqli_batch(ptr::null_mut(), ptr::null(), 0, 0, ptr::null_mut()) };
+    assert_eq!(hits, 0);
+    let inputs = c_inputs();
+    let hits = unsafe { libinjectionrs_detect_xss_batch(ptr::null_mut(), inputs.as_ptr(), inputs.len(), 0, ptr::null_mut()) };
+    assert_eq!(hits, -1);
+    unsafe { libinjectionrs_state_free(ptr::null_mut()) };
+
+    let version = unsafe { CStr::from_ptr(libinjectionrs_version()) };
+    assert_eq!(version.to_str().unwrap(), libinjectionrs::version());
+}
@@ -1,12 +1,12 @@
 #![allow(non_camel_case_types)] // Allow C naming conventions in generated bindings
 
 use anyhow::{Context, Result};
-use clap::{Parser, Subcommand};
+use clap::{Parser, Subcommand, ValueEnum};
+use libinjectionrs::records::{records, RecordFormat};
 use libinjectionrs::{detect_sqli as rust_detect_sqli, detect_xss as rust_detect_xss};
+use memmap2::Mmap;
 use serde::{Deserialize, Serialize};
-use std::ffi::CString;
 use std::fs;
-use std::io::{BufRead, BufReader};
 use std::path::PathBuf;
 
 // Include the generated bindings
@@ -28,10 +28,14 @@ enum Commands {
         #[arg(short, long)]
         input: Option<String>,
         
-        /// File containing inputs (one per line)
+        /// File containing inputs, memory-mapped and split by --delimiter
         #[arg(short, long)]
         file: Option<PathBuf>,
         
+        /// How inputs in --file are delimited
+        #[arg(long, value_enum, default_value = "newline")]
+        delimiter: Delimiter,
+        
         /// Output results in JSON format
         #[arg(long)]
         json: bool,
@@ -47,10 +51,14 @@ enum Commands {
         #[arg(short, long)]
         input: Option<String>,
         
-        /// File containing inputs (one per line)
+        /// File containing inputs, memory-mapped and split by --delimiter
         #[arg(short, long)]
         file: Option<PathBuf>,
         
+        /// How inputs in --file are delimited
+        #[arg(long, value_enum, default_value = "newline")]
+        delimiter: Delimiter,
+        
         /// Output results in JSON format
         #[arg(long)]
         json: bool,
@@ -72,6 +80,17 @@ enum Commands {
     },
 }
 
+/// Record delimiters for --file
+#[derive(Clone, Copy, ValueEnum)]
+enum Delimiter {
+    /// One input per line; surrounding whitespace and blank lines are skipped
+    Newline,
+    /// Inputs terminated by NUL bytes, taken byte for byte
+    Nul,
+    /// Each input preceded by its length as a 4-byte little-endian integer
+    Length,
+}
+
 #[derive(Serialize, Deserialize, Debug)]
 struct SqliComparison {
     input: String,
@@ -101,12 +120,12 @@ struct XssComparison {
     matches: bool,
 }
 
-fn call_c_sqli(input: &str, flags: i32) -> Result<CSqliResult> {
-    let c_input = CString::new(input).context("Failed to create C string")?;
-    
+// The harness passes the length on to libinjection, so inputs go over as
+// pointer and length with no NUL terminator and no copy
+fn call_c_sqli(input: &[u8], flags: i32) -> Result<CSqliResult> {
     unsafe {
         let result = harness_detect_sqli(
-            c_input.as_ptr(),
+            input.as_ptr().cast(),
             input.len(),
             flags,
         );
@@ -121,12 +140,10 @@ fn call_c_sqli(input: &str, flags: i32) -> Result<CSqliResult> {
     }
 }
 
-fn call_c_xss(input: &str, flags: i32) -> Result<bool> {
-    let c_input = CString::new(input).context("Failed to create C string")?;
-    
+fn call_c_xss(input: &[u8], flags: i32) -> Result<bool> {
     unsafe {
         let result = harness_detect_xss(
-            c_input.as_ptr(),
+            input.as_ptr().cast(),
             input.len(),
             flags,
         );
@@ -135,9 +152,9 @@ fn call_c_xss(input: &str, flags: i32) -> Result<bool> {
     }
 }
 
-fn compare_sqli_single(input: &str, flags: i32) -> Result<SqliComparison> {
+fn compare_sqli_single(input: &[u8], flags: i32) -> Result<SqliComparison> {
     // Call Rust implementation
-    let rust_result = rust_detect_sqli(input.as_bytes());
+    let rust_result = rust_detect_sqli(input);
     
     // Call C implementation
     let c_result = call_c_sqli(input, flags)?;
@@ -155,7 +172,7 @@ fn compare_sqli_single(input: &str, flags: i32) -> Result<SqliComparison> {
     };
     
     Ok(SqliComparison {
-        input: input.to_string(),
+        input: String::from_utf8_lossy(input).into_owned(),
         rust_result: rust_sqli_result,
         c_result,
         match_result,
@@ -163,52 +180,72 @@ fn compare_sqli_single(input: &str, flags: i32) -> Result<SqliComparison> {
     })
 }
 
-fn compare_xss_single(input: &str, flags: i32) -> Result<XssComparison> {
+fn compare_xss_single(input: &[u8], flags: i32) -> Result<XssComparison> {
     // Call Rust implementation
-    let rust_result = rust_detect_xss(input.as_bytes()).is_injection();
+    let rust_result = rust_detect_xss(input).is_injection();
     
     // Call C implementation
     let c_result = call_c_xss(input, flags)?;
     
     Ok(XssComparison {
-        input: input.to_string(),
+        input: String::from_utf8_lossy(input).into_owned(),
         rust_result,
         c_result,
         matches: rust_result == c_result,
     })
 }
 
-fn read_inputs_from_file(file_path: &PathBuf) -> Result<Vec<String>> {
-    let file = fs::File::open(file_path)
-        .with_context(|| format!("Failed to open file: {:?}", file_path))?;
-    let reader = BufReader::new(file);
-    
-    let mut inputs = Vec::new();
-    for line in reader.lines() {
-        let line = line.context("Failed to read line")?;
-        if !line.trim().is_empty() {
-            inputs.push(line.trim().to_string());
+/// Inputs for one run: a single --input string or a mapped --file
+enum Inputs {
+    Arg(String),
+    File(Mmap),
+}
+
+impl Inputs {
+    fn open(input: Option<String>, file: Option<PathBuf>) -> Result<Self> {
+        if let Some(input) = input {
+            Ok(Inputs::Arg(input))
+        } else if let Some(file) = file {
+            let handle = fs::File::open(&file)
+                .with_context(|| format!("Failed to open file: {:?}", file))?;
+            // SAFETY: the corpus is read-only input for this process; like any
+            // mmap user we assume nobody truncates the file while it is mapped
+            let map = unsafe { Mmap::map(&handle) }
+                .with_context(|| format!("Failed to map file: {:?}", file))?;
+            Ok(Inputs::File(map))
+        } else {
+            anyhow::bail!("Either --input or --file must be specified");
         }
     }
-    
-    Ok(inputs)
+
+    /// Slices the inputs out of the argument or the mapping, without copying
+    fn records(&self, delimiter: Delimiter) -> Result<Vec<&[u8]>> {
+        let data = match self {
+            Inputs::Arg(input) => return Ok(vec![input.as_bytes()]),
+            Inputs::File(map) => &map[..],
+        };
+        let format = match delimiter {
+            Delimiter::Newline => RecordFormat::Newline,
+            Delimiter::Nul => RecordFormat::Nul,
+            Delimiter::Length => RecordFormat::LengthPrefixed,
+        };
+        let mut inputs = records(data, format).collect::<Result<Vec<_>, _>>()?;
+        if let Delimiter::Newline = delimiter {
+            inputs = inputs.into_iter().map(<[u8]>::trim_ascii).filter(|line| !line.is_empty()).collect();
+        }
+        Ok(inputs)
+    }
 }
 
 fn main() -> Result<()> {
     let cli = Cli::parse();
     
     match cli.command {
-        Commands::Sqli { input, file, json, flags } => {
-            let inputs = if let Some(input) = input {
-                vec![input]
-            } else if let Some(file) = file {
-                read_inputs_from_file(&file)?
-            } else {
-                anyhow::bail!("Either --input or --file must be specified");
-            };
+        Commands::Sqli { input, file, delimiter, json, flags } => {
+            let inputs = Inputs::open(input, file)?;
             
             let mut results = Vec::new();
-            for input in inputs {
+            for input in inputs.records(delimiter)? {
                 let comparison = compare_sqli_single(&input, flags)?;
                 results.push(comparison);
             }
@@ -232,17 +269,11 @@ fn main() -> Result<()> {
             }
         }
         
-        Commands::Xss { input, file, json, flags } => {
-            let inputs = if let Some(input) = input {
-                vec![input]
-            } else if let Some(file) = file {
-                read_inputs_from_file(&file)?
-            } else {
-                anyhow::bail!("Either --input or --file must be specified");
-            };
+        Commands::Xss { input, file, delimiter, json, flags } => {
+            let inputs = Inputs::open(input, file)?;
             
             let mut results = Vec::new();
-            for input in inputs {
+            for input in inputs.records(delimiter)? {
                 let comparison = compare_xss_single(&input, flags)?;
                 results.push(comparison);
             }
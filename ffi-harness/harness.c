@@ -2,8 +2,22 @@
 #include "libinjection.h"
 #include "libinjection_sqli.h"
 #include "libinjection_xss.h"
+#include "libinjection_html5.h"
 #include <string.h>
 
+// Copies the state's fingerprint into result, null-terminated
+static void copy_fingerprint(sqli_result_t* result, const struct libinjection_sqli_state* state) {
+    memcpy(result->fingerprint, state->fingerprint, 8);
+    result->fingerprint[8] = '\0';
+    
+    // Find actual end of fingerprint (remove trailing nulls)
+    int end = 7;
+    while (end >= 0 && result->fingerprint[end] == '\0') {
+        end--;
+    }
+    result->fingerprint[end + 1] = '\0';
+}
+
 sqli_result_t harness_detect_sqli(const char* input, size_t input_len, int flags) {
     sqli_result_t result = {0};
     struct libinjection_sqli_state state;
@@ -15,20 +29,7 @@ sqli_result_t harness_detect_sqli(const char* input, size_t input_len, int flags
     result.is_sqli = libinjection_is_sqli(&state);
     
     // Always get fingerprint from state, regardless of injection status
-    // Copy fingerprint and ensure null termination
-    memcpy(result.fingerprint, state.fingerprint, 8);
-    result.fingerprint[8] = '\0';
-    
-    // Find actual end of fingerprint (remove trailing nulls)
-    int end = 7;
-    while (end >= 0 && result.fingerprint[end] == '\0') {
-        end--;
-    }
-    if (end >= 0) {
-        result.fingerprint[end + 1] = '\0';
-    } else {
-        result.fingerprint[0] = '\0';
-    }
+    copy_fingerprint(&result, &state);
     
     return result;
 }
@@ -45,6 +46,45 @@ xss_result_t harness_detect_xss(const char* input, size_t input_len, int flags)
     return result;
 }
 
+int harness_sqli_tokenize(const char* input, size_t input_len, int flags) {
+    struct libinjection_sqli_state state;
+    int count = 0;
+    
+    // init points current at the state's first token slot, which each
+    // call overwrites
+    libinjection_sqli_init(&state, input, input_len, flags);
+    while (libinjection_sqli_tokenize(&state)) {
+        count++;
+    }
+    
+    return count;
+}
+
+sqli_result_t harness_sqli_fold(const char* input, size_t input_len, int flags) {
+    sqli_result_t result = {0};
+    struct libinjection_sqli_state state;
+    
+    libinjection_sqli_init(&state, input, input_len, flags);
+    
+    // Resets the state, folds and writes the fingerprint; no lookups
+    libinjection_sqli_fingerprint(&state, flags);
+    copy_fingerprint(&result, &state);
+    
+    return result;
+}
+
+int harness_html5_tokenize(const char* input, size_t input_len, int flags) {
+    h5_state_t state;
+    int count = 0;
+    
+    libinjection_h5_init(&state, input, input_len, (enum html5_flags)flags);
+    while (libinjection_h5_next(&state)) {
+        count++;
+    }
+    
+    return count;
+}
+
 const char* harness_version(void) {
     return libinjection_version();
 }
\ No newline at end of file
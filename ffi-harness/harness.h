@@ -41,6 +41,38 @@ sqli_result_t harness_detect_sqli(const char* input, size_t input_len, int flags
  */
 xss_result_t harness_detect_xss(const char* input, size_t input_len, int flags);
 
+/*
+ * Single stages of detection, for timing against the matching Rust stages.
+ * They allocate nothing and read only the input_len bytes of input.
+ */
+
+/**
+ * Tokenize input without folding
+ * @param input Input string to tokenize
+ * @param input_len Length of input
+ * @param flags SQLi flags, as for libinjection_sqli_init
+ * @return Number of tokens
+ */
+int harness_sqli_tokenize(const char* input, size_t input_len, int flags);
+
+/**
+ * Tokenize, fold and fingerprint input, without the blacklist or whitelist
+ * @param input Input string to fold
+ * @param input_len Length of input
+ * @param flags SQLi flags, as for libinjection_sqli_fingerprint
+ * @return Result with the fingerprint set and is_sqli always 0
+ */
+sqli_result_t harness_sqli_fold(const char* input, size_t input_len, int flags);
+
+/**
+ * Run the html5 tokenizer over input in one starting context
+ * @param input Input string to tokenize
+ * @param input_len Length of input
+ * @param flags Starting context, an enum html5_flags value (0 for DATA_STATE)
+ * @return Number of tokens
+ */
+int harness_html5_tokenize(const char* input, size_t input_len, int flags);
+
 /**
  * Get libinjection version string
  * @return Version string
@@ -0,0 +1,122 @@
+#![no_main]
+use libfuzzer_sys::fuzz_target;
+use libinjectionrs::sqli::SqliTokenizer;
+use libinjectionrs::xss::{Html5Flags, Html5State};
+use libinjectionrs::SqliFlags;
+use std::hint::black_box;
+use std::sync::OnceLock;
+use std::time::{Duration, Instant};
+
+// Cost-guided fuzzing of the tokenizers.
+//
+// Coverage alone does not steer the fuzzer towards slow inputs: a run of
+// `--` takes the same branches whether it is 10 bytes long or 4000. So the
+// time the tokenizers spend per input byte is measured, bucketed on a log
+// scale, and each bucket reaches its own function. An input that is slower
+// per byte than any before reaches a function none did, which the fuzzer
+// sees as new coverage and keeps. The corpus fills up with ever slower
+// inputs, which `perf_gate --select` turns into the regression set.
+//
+// With LIBINJECTION_COST_BUDGET set (in nanoseconds per byte), an input
+// that stays over it when measured again fails, so it is saved as a crash.
+
+const HTML5_CONTEXTS: [Html5Flags; 5] = [
+    Html5Flags::DataState,
+    Html5Flags::ValueNoQuote,
+    Html5Flags::ValueSingleQuote,
+    Html5Flags::ValueDoubleQuote,
+    Html5Flags::ValueBackQuote,
+];
+
+// Shorter inputs are too quick for their cost to be measured
+const MIN_LEN: usize = 64;
+const RUNS: usize = 3;
+
+fn tokenize(input: &[u8]) -> usize {
+    let mut count = 0;
+    let mut tokenizer = SqliTokenizer::new(input, SqliFlags::FLAG_QUOTE_NONE | SqliFlags::FLAG_SQL_ANSI);
+    while tokenizer.next_token().is_some() {
+        count += 1;
+    }
+    for flags in HTML5_CONTEXTS {
+        let mut state = Html5State::new(input, flags);
+        while state.next() {
+            count += 1;
+        }
+    }
+    count
+}
+
+// Best of a few runs, less the time a call on the empty input takes
+fn cost(input: &[u8]) -> Duration {
+    static BASE: OnceLock<Duration> = OnceLock::new();
+    let base = *BASE.get_or_init(|| time(b""));
+    time(input).saturating_sub(base)
+}
+
+fn time(input: &[u8]) -> Duration {
+    (0..RUNS)
+        .map(|_| {
+            let started = Instant::now();
+            black_box(tokenize(black_box(input)));
+            started.elapsed()
+        })
+        .min()
+        .unwrap_or_default()
+}
+
+// Picoseconds per byte on a log scale, four buckets per doubling
+fn bucket(cost: Duration, len: usize) -> usize {
+    let ps_per_byte = (cost.as_nanos() * 1000 / len as u128).max(1);
+    let log = ps_per_byte.ilog2();
+    let fraction = if log >= 2 { (ps_per_byte >> (log - 2)) & 3 } else { 0 };
+    (log as usize * 4 + fraction as usize).min(LEVELS.len() - 1)
+}
+
+#[inline(never)]
+fn reach<const N: usize>() {
+    black_box(N);
+}
+
+macro_rules! levels {
+    ($($n:literal)*) => { [$(reach::<$n> as fn()),*] };
+}
+
+// Up to 2^20 picoseconds, about a microsecond, per byte
+const LEVELS: [fn(); 80] = levels!(
+    0 1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30 31
+    32 33 34 35 36 37 38 39 40 41 42 43 44 45 46 47 48 49 50 51 52 53 54 55 56 57 58 59 60 61 62 63
+    64 65 66 67 68 69 70 71 72 73 74 75 76 77 78 79
+);
+
+fn budget() -> Option<u128> {
+    static BUDGET: OnceLock<Option<u128>> = OnceLock::new();
+    *BUDGET.get_or_init(|| std::env::var("LIBINJECTION_COST_BUDGET").ok().and_then(|ns| ns.parse().ok()))
+}
+
+fuzz_target!(|data: &[u8]| {
+    if data.len() < MIN_LEN {
+        let _ = tokenize(data);
+        return;
+    }
+
+    let level = bucket(cost(data), data.len());
+    // Reach every level up to this one, so a slower input covers a
+    // superset of what a faster one does
+    for reach in &LEVELS[..=level] {
+        reach();
+    }
+
+    if let Some(budget) = budget() {
+        let over = |cost: Duration| cost.as_nanos() > budget * data.len() as u128;
+        // A single slow run may be the machine; it has to be slow twice
+        if over(cost(data)) && over(cost(data)) {
+            panic!(
+                "{} bytes take {:?}, over the budget of {} ns per byte",
+                data.len(),
+                cost(data),
+                budget
+            );
+        }
+    }
+});
@@ -1,5 +1,7 @@
 use clap::{Parser, Subcommand};
 use colored::*;
+use libinjectionrs::records::{records, RecordFormat};
+use memmap2::Mmap;
 use std::fs;
 use std::path::PathBuf;
 
@@ -83,8 +85,13 @@ enum Commands {
     },
     /// Compare multiple inputs
     Batch {
-        /// File containing inputs (one per line)
+        /// File containing inputs, memory-mapped and split by --delimiter
         inputs_file: PathBuf,
+        
+        /// Input delimiter: newline (one per line), nul, or length
+        /// (4-byte little-endian length before each input)
+        #[arg(long, default_value = "newline")]
+        delimiter: String,
     },
     /// Interactive debugging session
     Interactive,
@@ -97,8 +104,8 @@ fn main() -> Result<(), Box<dyn std::error::Error>> {
         Some(Commands::Test { case }) => {
             run_test_cases(case.as_deref())?;
         }
-        Some(Commands::Batch { inputs_file }) => {
-            run_batch_analysis(inputs_file)?;
+        Some(Commands::Batch { inputs_file, delimiter }) => {
+            run_batch_analysis(inputs_file, delimiter)?;
         }
         Some(Commands::Interactive) => {
             run_interactive_mode()?;
@@ -159,25 +166,37 @@ fn run_test_cases(case: Option<&str>) -> Result<(), Box<dyn std::error::Error>>
     test_cases::run_all_tests(case)
 }
 
-fn run_batch_analysis(inputs_file: &PathBuf) -> Result<(), Box<dyn std::error::Error>> {
+fn run_batch_analysis(inputs_file: &PathBuf, delimiter: &str) -> Result<(), Box<dyn std::error::Error>> {
     println!("{}", "=== Batch Analysis ===".bright_blue().bold());
-    let contents = fs::read_to_string(inputs_file)?;
+    let format = match delimiter {
+        "newline" => RecordFormat::Newline,
+        "nul" => RecordFormat::Nul,
+        "length" => RecordFormat::LengthPrefixed,
+        _ => return Err(format!("Unknown delimiter: {}", delimiter).into()),
+    };
+    let file = fs::File::open(inputs_file)?;
+    // SAFETY: the inputs file is only read; like any mmap user we assume it
+    // is not truncated while mapped
+    let contents = unsafe { Mmap::map(&file)? };
     
-    for (line_num, line) in contents.lines().enumerate() {
-        if line.trim().is_empty() || line.starts_with('#') {
+    for (record_num, record) in records(&contents, format).enumerate() {
+        let input_bytes = record?;
+        // Line files may carry blank lines and # comments
+        if format == RecordFormat::Newline
+            && (input_bytes.trim_ascii().is_empty() || input_bytes.starts_with(b"#"))
+        {
             continue;
         }
         
         println!("\n{} {}: {}", 
                 "Input".bright_green(), 
-                line_num + 1, 
-                line.bright_white());
+                record_num + 1, 
+                String::from_utf8_lossy(input_bytes).as_ref().bright_white());
         
-        let input_bytes = line.as_bytes().to_vec();
         let config = DebugConfig::default();
         let debugger = TokenizerDebugger::new(config);
         
-        match debugger.analyze(&input_bytes) {
+        match debugger.analyze(input_bytes) {
             Ok(results) => {
                 formatters::output_text(&results, &Cli::parse_from(vec!["prog"]))?;
             }
@@ -0,0 +1,277 @@
+//! perf_gate: fails when any known-slow input drops below a throughput floor
+//!
+//! Replays the inputs in `benches/slowest` (the slowest ones found so far,
+//! see `fuzz/README.md`) through the SQLi and html5 tokenizers and both
+//! detectors, and exits with an error if any of them runs slower than the
+//! floor on any input. Pathological inputs, patterns that make a scanner
+//! look at the same bytes again and again, show up here long before they
+//! would show up in an average.
+//!
+//! Throughput is the input length over the time one call takes beyond a
+//! call on the empty input, so the fixed cost of a call does not count
+//! against short inputs. Each time is the best of several rounds.
+//!
+//!     cargo bench -p libinjectionrs --bench perf_gate [-- --floor MB/S]
+//!     cargo bench -p libinjectionrs --bench perf_gate -- --select N DIR...
+//!
+//! `--select` times the inputs in each DIR and in `benches/slowest`, and
+//! keeps the N slowest in `benches/slowest`.
+
+#![allow(clippy::float_arithmetic)]
+
+use std::fs;
+use std::hint::black_box;
+use std::io;
+use std::path::{Path, PathBuf};
+use std::process::ExitCode;
+use std::time::{Duration, Instant};
+
+use libinjectionrs::sqli::SqliTokenizer;
+use libinjectionrs::xss::{Html5Flags, Html5State};
+use libinjectionrs::{detect_sqli, detect_xss, SqliFlags};
+
+const USAGE: &str = "usage: perf_gate [--floor MB/S] [--select N DIR...]
+
+  --floor MB/S    lowest throughput allowed on any input and stage
+                  (default: $LIBINJECTION_PERF_FLOOR or 8)
+  --select N DIR  keep the N slowest inputs of DIR... and the current set";
+
+const DEFAULT_FLOOR_MBPS: f64 = 8.0;
+// Time one round takes at least, and how many rounds are taken
+const ROUND: Duration = Duration::from_millis(2);
+const ROUNDS: usize = 5;
+// Worst inputs listed in the report
+const REPORTED: usize = 10;
+
+const HTML5_CONTEXTS: [Html5Flags; 5] = [
+    Html5Flags::DataState,
+    Html5Flags::ValueNoQuote,
+    Html5Flags::ValueSingleQuote,
+    Html5Flags::ValueDoubleQuote,
+    Html5Flags::ValueBackQuote,
+];
+
+struct Stage {
+    name: &'static str,
+    run: fn(&[u8]) -> usize,
+}
+
+const STAGES: [Stage; 4] = [
+    Stage { name: "sqli_tokenize", run: sqli_tokenize },
+    Stage { name: "html5_tokenize", run: html5_tokenize },
+    Stage { name: "detect_sqli", run: |input| usize::from(detect_sqli(input).is_injection()) },
+    Stage { name: "detect_xss", run: |input| usize::from(detect_xss(input).is_injection()) },
+];
+
+fn sqli_tokenize(input: &[u8]) -> usize {
+    let mut tokenizer = SqliTokenizer::new(input, SqliFlags::FLAG_QUOTE_NONE | SqliFlags::FLAG_SQL_ANSI);
+    let mut count = 0;
+    while tokenizer.next_token().is_some() {
+        count += 1;
+    }
+    count
+}
+
+fn html5_tokenize(input: &[u8]) -> usize {
+    let mut count = 0;
+    for flags in HTML5_CONTEXTS {
+        let mut state = Html5State::new(input, flags);
+        while state.next() {
+            count += 1;
+        }
+    }
+    count
+}
+
+// Best time of one call over several rounds
+fn time_call(run: fn(&[u8]) -> usize, input: &[u8]) -> Duration {
+    // Size the rounds so the clock's resolution does not matter
+    let mut calls: u32 = 1;
+    loop {
+        let started = Instant::now();
+        for _ in 0..calls {
+            black_box(run(black_box(input)));
+        }
+        if started.elapsed() >= ROUND || calls >= 1 << 24 {
+            break;
+        }
+        calls = calls.saturating_mul(2);
+    }
+    (0..ROUNDS)
+        .map(|_| {
+            let started = Instant::now();
+            for _ in 0..calls {
+                black_box(run(black_box(input)));
+            }
+            started.elapsed() / calls
+        })
+        .min()
+        .unwrap_or_default()
+}
+
+struct Timed {
+    path: PathBuf,
+    len: usize,
+    // Throughput per stage in MB/s, in STAGES order
+    mbps: [f64; STAGES.len()],
+}
+
+impl Timed {
+    // The slowest stage and its throughput
+    fn worst(&self) -> (&'static str, f64) {
+        STAGES
+            .iter()
+            .zip(self.mbps)
+            .map(|(stage, mbps)| (stage.name, mbps))
+            .fold(("", f64::INFINITY), |worst, stage| if stage.1 < worst.1 { stage } else { worst })
+    }
+}
+
+fn time_input(path: &Path, input: &[u8], base: &[Duration; STAGES.len()]) -> Timed {
+    let mut mbps = [f64::INFINITY; STAGES.len()];
+    for ((stage, base), mbps) in STAGES.iter().zip(base).zip(mbps.iter_mut()) {
+        let extra = time_call(stage.run, input).saturating_sub(*base);
+        if !extra.is_zero() {
+            *mbps = input.len() as f64 / extra.as_secs_f64() / 1e6;
+        }
+    }
+    Timed { path: path.to_path_buf(), len: input.len(), mbps }
+}
+
+fn slowest_dir() -> PathBuf {
+    Path::new(env!("CARGO_MANIFEST_DIR")).join("benches/slowest")
+}
+
+// Non-empty files of `dir` but the README and hidden files, sorted by name
+fn inputs(dir: &Path) -> io::Result<Vec<(PathBuf, Vec<u8>)>> {
+    let mut paths: Vec<PathBuf> = fs::read_dir(dir)?
+        .filter_map(|entry| entry.ok().map(|entry| entry.path()))
+        .filter(|path| {
+            let name = path.file_name().map(|name| name.to_string_lossy()).unwrap_or_default();
+            path.is_file() && !name.starts_with('.') && name != "README.md"
+        })
+        .collect();
+    paths.sort();
+    let mut inputs = Vec::with_capacity(paths.len());
+    for path in paths {
+        let input = fs::read(&path)?;
+        if !input.is_empty() {
+            inputs.push((path, input));
+        }
+    }
+    Ok(inputs)
+}
+
+fn time_all(sets: &[(PathBuf, Vec<u8>)]) -> Vec<Timed> {
+    let mut base = [Duration::ZERO; STAGES.len()];
+    for (stage, base) in STAGES.iter().zip(base.iter_mut()) {
+        *base = time_call(stage.run, b"");
+    }
+    let mut timed: Vec<Timed> = sets.iter().map(|(path, input)| time_input(path, input, &base)).collect();
+    timed.sort_by(|a, b| a.worst().1.total_cmp(&b.worst().1));
+    timed
+}
+
+fn report(timed: &[Timed]) {
+    println!("{:>10}  {:>6}  {:<15} input", "MB/s", "bytes", "stage");
+    for t in timed.iter().take(REPORTED) {
+        let (stage, mbps) = t.worst();
+        let name = t.path.file_name().map(|name| name.to_string_lossy()).unwrap_or_default();
+        println!("{:>10.2}  {:>6}  {:<15} {}", mbps, t.len, stage, name);
+    }
+}
+
+fn check(floor: f64) -> io::Result<bool> {
+    let set = inputs(&slowest_dir())?;
+    let timed = time_all(&set);
+    report(&timed);
+    let failed: Vec<&Timed> = timed.iter().filter(|t| t.worst().1 < floor).collect();
+    println!("{} inputs, {} below {:.2} MB/s", timed.len(), failed.len(), floor);
+    for t in &failed {
+        let (stage, mbps) = t.worst();
+        eprintln!("perf_gate: {} runs at {:.2} MB/s in {}", t.path.display(), mbps, stage);
+    }
+    Ok(failed.is_empty())
+}
+
+fn select(keep: usize, dirs: &[String]) -> io::Result<()> {
+    let out = slowest_dir();
+    let mut candidates = inputs(&out)?;
+    for dir in dirs {
+        candidates.extend(inputs(Path::new(dir))?);
+    }
+    // The same input may be in several places
+    candidates.sort_by(|a, b| a.1.cmp(&b.1));
+    candidates.dedup_by(|a, b| a.1 == b.1);
+
+    let timed = time_all(&candidates);
+    report(&timed);
+    let kept: Vec<&Timed> = timed.iter().take(keep).collect();
+
+    let mut contents = Vec::with_capacity(kept.len());
+    for t in &kept {
+        if let Some((_, input)) = candidates.iter().find(|(path, _)| *path == t.path) {
+            contents.push(input.clone());
+        }
+    }
+    for (path, _) in inputs(&out)? {
+        fs::remove_file(path)?;
+    }
+    for input in &contents {
+        fs::write(out.join(format!("slow-{:016x}", fnv1a(input))), input)?;
+    }
+    println!("kept {} of {} inputs in {}", contents.len(), candidates.len(), out.display());
+    Ok(())
+}
+
+// Names files after their content, so a rerun does not churn them
+fn fnv1a(input: &[u8]) -> u64 {
+    input.iter().fold(0xcbf2_9ce4_8422_2325, |hash, &b| (hash ^ u64::from(b)).wrapping_mul(0x0100_0000_01b3))
+}
+
+fn main() -> ExitCode {
+    let mut floor = std::env::var("LIBINJECTION_PERF_FLOOR")
+        .ok()
+        .and_then(|floor| floor.parse().ok())
+        .unwrap_or(DEFAULT_FLOOR_MBPS);
+    let mut select_args: Option<(usize, Vec<String>)> = None;
+
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        match arg.as_str() {
+            // Passed by `cargo bench`
+            "--bench" => {}
+            "--floor" => match args.next().and_then(|value| value.parse().ok()) {
+                Some(value) => floor = value,
+                None => return usage("--floor needs a number"),
+            },
+            "--select" => match args.next().and_then(|value| value.parse().ok()) {
+                Some(keep) => select_args = Some((keep, args.by_ref().filter(|arg| arg != "--bench").collect())),
+                None => return usage("--select needs a count"),
+            },
+            "-h" | "--help" => return usage(""),
+            _ => return usage(&format!("unexpected argument: {}", arg)),
+        }
+    }
+
+    let result = match select_args {
+        Some((keep, dirs)) => select(keep, &dirs).map(|()| true),
+        None => check(floor),
+    };
+    match result {
+        Ok(true) => ExitCode::SUCCESS,
+        Ok(false) => ExitCode::FAILURE,
+        Err(err) => {
+            eprintln!("perf_gate: {}", err);
+            ExitCode::FAILURE
+        }
+    }
+}
+
+fn usage(message: &str) -> ExitCode {
+    if !message.is_empty() {
+        eprintln!("perf_gate: {}", message);
+    }
+    eprintln!("{}", USAGE);
+    ExitCode::from(2)
+}
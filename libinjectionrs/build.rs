@@ -5,11 +5,23 @@
 #![allow(clippy::panic)]
 #![allow(clippy::uninlined_format_args)]
 
+extern crate alloc;
+
 use std::env;
 use std::fs::File;
 use std::io::{self, Write};
 use std::path::Path;
 
+// Shared with the library so table layout and lookups hash identically
+#[allow(dead_code)]
+#[path = "src/phf.rs"]
+mod phf;
+
+// The XSS blacklists, hashed below for the detector's lookups
+#[allow(dead_code)]
+#[path = "src/xss/tables.rs"]
+mod xss_tables;
+
 fn main() -> io::Result<()> {
     // Tell rustc about our custom cfg
     println!("cargo:rustc-check-cfg=cfg(build_generated)");
@@ -18,6 +30,12 @@ fn main() -> io::Result<()> {
     
     let out_dir = env::var("OUT_DIR").unwrap();
     
+    // The XSS tables live in the crate, so their hashes are always generated
+    println!("cargo:rerun-if-changed=build.rs");
+    println!("cargo:rerun-if-changed=src/phf.rs");
+    println!("cargo:rerun-if-changed=src/xss/tables.rs");
+    process_xss_tables(&out_dir)?;
+    
     if Path::new(submodule_data).exists() {
         // Tell cargo to rerun if the data files change
         println!("cargo:rerun-if-changed={}", submodule_data);
@@ -123,7 +141,7 @@ fn process_sqlparse_data(out_dir: &str) -> io::Result<()> {
         
         writeln!(f, "pub const SQL_KEYWORDS: &[Keyword] = &[")?;
         
-        for (keyword, type_char) in sorted_keywords {
+        for (keyword, type_char) in &sorted_keywords {
             let token_type = match type_char {
                 'k' => "b'k'", // Keyword
                 'f' => "b'f'", // Function
@@ -147,16 +165,46 @@ fn process_sqlparse_data(out_dir: &str) -> io::Result<()> {
         
         writeln!(f, "];\n")?;
         
-        // Add helper function for keyword lookup
+        // Perfect hash over the sorted table, so lookups need neither a
+        // binary search nor an uppercase copy of the word
+        let keys: Vec<&[u8]> = sorted_keywords.iter().map(|(k, _)| k.as_bytes()).collect();
+        let (seed, disps, slots) = build_phf(&keys);
+        let max_len = keys.iter().map(|k| k.len()).max().unwrap_or(0);
+
+        writeln!(f, "// Perfect hash over SQL_KEYWORDS (see src/phf.rs)")?;
+        writeln!(f, "pub const MAX_KEYWORD_LEN: usize = {};\n", max_len)?;
+        writeln!(f, "const KEYWORD_SEED: u64 = 0x{:016x};\n", seed)?;
+        writeln!(f, "static KEYWORD_DISPS: [(u32, u32); {}] = [", disps.len())?;
+        for chunk in disps.chunks(8) {
+            let line: Vec<String> = chunk.iter().map(|(d1, d2)| format!("({}, {})", d1, d2)).collect();
+            writeln!(f, "    {},", line.join(", "))?;
+        }
+        writeln!(f, "];\n")?;
+        writeln!(f, "static KEYWORD_SLOTS: [u16; {}] = [", slots.len())?;
+        for chunk in slots.chunks(16) {
+            let line: Vec<String> = chunk.iter().map(|idx| idx.to_string()).collect();
+            writeln!(f, "    {},", line.join(", "))?;
+        }
+        writeln!(f, "];\n")?;
+
+        // Add helper functions for keyword lookup
         writeln!(f, "use crate::sqli::TokenType;\n")?;
-        writeln!(f, "pub fn lookup_word(word: &str) -> TokenType {{")?;
-        writeln!(f, "    let upper = word.to_ascii_uppercase();")?;
-        writeln!(f, "    ")?;
-        writeln!(f, "    // Binary search through sorted keywords")?;
-        writeln!(f, "    let result = SQL_KEYWORDS.binary_search_by(|k| k.word.cmp(&upper));")?;
-        writeln!(f, "    ")?;
-        writeln!(f, "    if let Ok(idx) = result {{")?;
-        writeln!(f, "        match SQL_KEYWORDS[idx].token_type {{")?;
+        writeln!(f, "/// Finds the keyword table entry for `word`, ignoring ASCII case.")?;
+        writeln!(f, "pub fn find_keyword(word: &[u8]) -> Option<&'static Keyword> {{")?;
+        writeln!(f, "    if word.len() > MAX_KEYWORD_LEN {{")?;
+        writeln!(f, "        return None;")?;
+        writeln!(f, "    }}")?;
+        writeln!(f, "    let slot = crate::phf::slot(word, KEYWORD_SEED, &KEYWORD_DISPS, KEYWORD_SLOTS.len())?;")?;
+        writeln!(f, "    let keyword = SQL_KEYWORDS.get(usize::from(*KEYWORD_SLOTS.get(slot)?))?;")?;
+        writeln!(f, "    if keyword.word.as_bytes().eq_ignore_ascii_case(word) {{")?;
+        writeln!(f, "        Some(keyword)")?;
+        writeln!(f, "    }} else {{")?;
+        writeln!(f, "        None")?;
+        writeln!(f, "    }}")?;
+        writeln!(f, "}}\n")?;
+        writeln!(f, "pub fn lookup_word_bytes(word: &[u8]) -> TokenType {{")?;
+        writeln!(f, "    if let Some(keyword) = find_keyword(word) {{")?;
+        writeln!(f, "        match keyword.token_type {{")?;
         writeln!(f, "            b'k' => TokenType::Keyword,")?;
         writeln!(f, "            b'f' => TokenType::Function,")?;
         writeln!(f, "            b'U' => TokenType::Union,")?;
@@ -176,6 +224,58 @@ fn process_sqlparse_data(out_dir: &str) -> io::Result<()> {
         writeln!(f, "        TokenType::Bareword")?;
         writeln!(f, "    }}")?;
         writeln!(f, "}}\n")?;
+        writeln!(f, "pub fn lookup_word(word: &str) -> TokenType {{")?;
+        writeln!(f, "    lookup_word_bytes(word.as_bytes())")?;
+        writeln!(f, "}}\n")?;
+    }
+
+    // Fingerprints also get a set of their own, keyed by the raw fingerprint
+    // packed into a u64, so the blacklist check needs no '0' prefix string
+    if let Some(fingerprints) = data["fingerprints"].as_array() {
+        let mut fps: Vec<String> = fingerprints
+            .iter()
+            .filter_map(|fp| fp.as_str())
+            .map(|fp| fp.to_uppercase())
+            .collect();
+        fps.sort();
+        fps.dedup();
+        assert!(fps.iter().all(|fp| !fp.is_empty() && fp.len() <= 8));
+
+        let keys: Vec<&[u8]> = fps.iter().map(|fp| fp.as_bytes()).collect();
+        let (seed, disps, slots) = build_phf(&keys);
+
+        writeln!(f, "// Blacklisted fingerprints packed into u64 keys, in perfect-hash slot order")?;
+        writeln!(f, "const FINGERPRINT_SEED: u64 = 0x{:016x};\n", seed)?;
+        writeln!(f, "static FINGERPRINT_DISPS: [(u32, u32); {}] = [", disps.len())?;
+        for chunk in disps.chunks(8) {
+            let line: Vec<String> = chunk.iter().map(|(d1, d2)| format!("({}, {})", d1, d2)).collect();
+            writeln!(f, "    {},", line.join(", "))?;
+        }
+        writeln!(f, "];\n")?;
+        writeln!(f, "static FINGERPRINT_SET: [u64; {}] = [", slots.len())?;
+        for chunk in slots.chunks(4) {
+            let line: Vec<String> = chunk
+                .iter()
+                .map(|&idx| format!("0x{:016x}", pack_fingerprint(keys[usize::from(idx)])))
+                .collect();
+            writeln!(f, "    {},", line.join(", "))?;
+        }
+        writeln!(f, "];\n")?;
+
+        writeln!(f, "/// Checks a raw fingerprint (NUL-padded type bytes, any case) against the")?;
+        writeln!(f, "/// fingerprint blacklist.")?;
+        writeln!(f, "pub fn is_blacklisted_fingerprint(fingerprint: &[u8; 8]) -> bool {{")?;
+        writeln!(f, "    let len = fingerprint.iter().position(|&b| b == 0).unwrap_or(8);")?;
+        writeln!(f, "    if len == 0 {{")?;
+        writeln!(f, "        return false;")?;
+        writeln!(f, "    }}")?;
+        writeln!(f, "    let key = u64::from_le_bytes(fingerprint.map(|b| b.to_ascii_uppercase()));")?;
+        writeln!(f, "    let key = if len < 8 {{ key & ((1u64 << (len * 8)) - 1) }} else {{ key }};")?;
+        writeln!(f, "    match crate::phf::slot(&fingerprint[..len], FINGERPRINT_SEED, &FINGERPRINT_DISPS, FINGERPRINT_SET.len()) {{")?;
+        writeln!(f, "        Some(slot) => FINGERPRINT_SET.get(slot) == Some(&key),")?;
+        writeln!(f, "        None => false,")?;
+        writeln!(f, "    }}")?;
+        writeln!(f, "}}\n")?;
     }
     
     // Add CharType enum definition
@@ -215,3 +315,67 @@ fn process_sqlparse_data(out_dir: &str) -> io::Result<()> {
     Ok(())
 }
 
+
+fn process_xss_tables(out_dir: &str) -> io::Result<()> {
+    use xss_tables::{BLACK_ATTRS, BLACK_ATTR_EVENTS, BLACK_TAGS, BLACK_URL_PROTOCOLS};
+
+    let dest_path = Path::new(&out_dir).join("xss_phf.rs");
+    let mut f = File::create(dest_path)?;
+
+    writeln!(f, "// This file is auto-generated by build.rs")?;
+    writeln!(f, "// DO NOT EDIT MANUALLY\n")?;
+
+    let tags: Vec<&[u8]> = BLACK_TAGS.iter().map(|name| name.as_bytes()).collect();
+    let events: Vec<&[u8]> = BLACK_ATTR_EVENTS.iter().map(|entry| entry.name.as_bytes()).collect();
+    let attrs: Vec<&[u8]> = BLACK_ATTRS.iter().map(|entry| entry.name.as_bytes()).collect();
+
+    // Lookups compare with eq_ignore_ascii_case, which only agrees with C's
+    // cstrcasecmp_with_null (uppercase the input, compare exactly) when the
+    // patterns have no lowercase letters
+    let all = || tags.iter().chain(&events).chain(&attrs);
+    assert!(all().all(|k| !k.is_empty() && !k.iter().any(u8::is_ascii_lowercase)));
+    let max_len = all().map(|k| k.len()).max().unwrap_or(0);
+
+    writeln!(f, "// Longest name in any of the hashed tables")?;
+    writeln!(f, "pub const MAX_NAME_LEN: usize = {};\n", max_len)?;
+    let max_protocol_len = BLACK_URL_PROTOCOLS.iter().map(|p| p.len()).max().unwrap_or(0);
+    writeln!(f, "// Longest protocol in BLACK_URL_PROTOCOLS")?;
+    writeln!(f, "pub const MAX_URL_PROTOCOL_LEN: usize = {};\n", max_protocol_len)?;
+    for (comment, name, keys) in [
+        ("BLACK_TAGS", "BLACK_TAG_INDEX", &tags),
+        ("BLACK_ATTR_EVENTS, without the \"ON\" prefix", "BLACK_ATTR_EVENT_INDEX", &events),
+        ("BLACK_ATTRS", "BLACK_ATTR_INDEX", &attrs),
+    ] {
+        let (seed, disps, slots) = build_phf(keys);
+        writeln!(f, "// Perfect hash over {} (see src/phf.rs)", comment)?;
+        writeln!(f, "pub static {}: PhfIndex = PhfIndex {{", name)?;
+        writeln!(f, "    seed: 0x{:016x},", seed)?;
+        writeln!(f, "    disps: &[")?;
+        for chunk in disps.chunks(8) {
+            let line: Vec<String> = chunk.iter().map(|(d1, d2)| format!("({}, {})", d1, d2)).collect();
+            writeln!(f, "        {},", line.join(", "))?;
+        }
+        writeln!(f, "    ],")?;
+        writeln!(f, "    slots: &[")?;
+        for chunk in slots.chunks(16) {
+            let line: Vec<String> = chunk.iter().map(|idx| idx.to_string()).collect();
+            writeln!(f, "        {},", line.join(", "))?;
+        }
+        writeln!(f, "    ],")?;
+        writeln!(f, "}};\n")?;
+    }
+
+    Ok(())
+}
+
+// Packs an uppercase fingerprint into the u64 key used by FINGERPRINT_SET
+fn pack_fingerprint(fp: &[u8]) -> u64 {
+    let mut bytes = [0u8; 8];
+    bytes[..fp.len()].copy_from_slice(fp);
+    u64::from_le_bytes(bytes)
+}
+
+// Perfect hash over `keys`, see phf::build
+fn build_phf(keys: &[&[u8]]) -> phf::Layout {
+    phf::build(keys).expect("too many keys for u16 slots")
+}
@@ -0,0 +1,138 @@
+//! Experimental SQLi detection over several inputs at once
+//!
+//! The SQLi tokenizer is a long chain of data-dependent branches, and one
+//! input at a time gives the core nothing to do while it recovers from a
+//! mispredict. [`BatchScanner`] takes inputs in groups of `LANES` and runs
+//! their tokenizers round-robin, one token per input per round, so the work
+//! for neighbouring inputs is independent and can overlap. Each step goes
+//! into that input's token cache, the one detection passes already share
+//! (see `sqli::token_cache`); the detection that follows replays the steps
+//! instead of tokenizing. Folding and the passes then run one input at a
+//! time, as they must to follow the C control flow.
+//!
+//! This is for bulk work where aggregate throughput matters, such as
+//! replaying logs. Every verdict is the one [`detect_sqli_with_limits`]
+//! gives, but a single input waits for the rest of its group.
+//!
+//! Requires the `batch` feature. It stays opt-in until `batch_bench` shows
+//! it beating one input at a time; so far it has not.
+//!
+//! [`detect_sqli_with_limits`]: crate::detect_sqli_with_limits
+
+use core::array;
+
+use crate::prefilter;
+use crate::sqli::{ScanLimits, SqliFlags, SqliState, SqliTokenizer};
+use crate::{safe_sqli_result, sqli_result, DetectionResult};
+
+// Tokens run ahead per input. The first pass of most inputs reads no more
+// than this, and the token cache keeps room for the steps of later passes.
+const PREFETCH_STEPS: usize = 8;
+
+/// Runs SQLi detection over many values, `LANES` at a time
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::batch::BatchScanner;
+///
+/// let fields: &[&[u8]] = &[b"john", b"1' OR '1'='1", b"42", b"1 UNION SELECT password FROM users"];
+/// let scanner = BatchScanner::<4>::new();
+/// let flagged: Vec<bool> = scanner.detect_sqli_many(fields).map(|result| result.is_injection()).collect();
+///
+/// assert_eq!(flagged, [false, true, false, true]);
+/// ```
+#[derive(Debug, Clone)]
+pub struct BatchScanner<const LANES: usize = 4> {
+    sqli_flags: SqliFlags,
+    limits: ScanLimits,
+}
+
+impl<const LANES: usize> BatchScanner<LANES> {
+    // Checked when a scanner is created, so `BatchScanner<0>` fails to build
+    const HAS_LANES: () = assert!(LANES > 0, "a batch needs at least one lane");
+
+    /// Creates a batch scanner using the default SQLi flags, like `detect_sqli`
+    pub fn new() -> Self {
+        Self::with_sqli_flags(SqliFlags::FLAG_NONE)
+    }
+
+    /// Creates a batch scanner whose verdicts match `detect_sqli_with_flags`
+    pub fn with_sqli_flags(flags: SqliFlags) -> Self {
+        let () = Self::HAS_LANES;
+        BatchScanner {
+            sqli_flags: flags,
+            limits: ScanLimits::UNLIMITED,
+        }
+    }
+
+    /// Bounds the SQLi work done per value, see [`ScanLimits`]
+    pub fn with_limits(mut self, limits: ScanLimits) -> Self {
+        self.limits = limits;
+        self
+    }
+
+    /// Checks each value for SQL injection, returning the results in input
+    /// order
+    pub fn detect_sqli_many<'s>(&self, inputs: &'s [&'s [u8]]) -> impl Iterator<Item = DetectionResult> + 's {
+        let (flags, limits) = (self.sqli_flags, self.limits);
+        // One state per lane for the whole run, moved on to each input in place
+        let mut lanes: [SqliState<'s>; LANES] = array::from_fn(|_| SqliState::new(&[], flags));
+        inputs
+            .chunks(LANES)
+            .flat_map(move |group| detect_group(&mut lanes, group, flags, limits))
+            .flatten()
+    }
+}
+
+impl<const LANES: usize> Default for BatchScanner<LANES> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+fn detect_group<'s, const LANES: usize>(
+    lanes: &mut [SqliState<'s>; LANES],
+    group: &[&'s [u8]],
+    flags: SqliFlags,
+    limits: ScanLimits,
+) -> [Option<DetectionResult>; LANES] {
+    let mut results: [Option<DetectionResult>; LANES] = array::from_fn(|_| None);
+    // Lanes whose input the prefilter could not settle, with their tokenizers
+    let mut tokenizers: [Option<SqliTokenizer<'s>>; LANES] = array::from_fn(|_| None);
+
+    let lanes_in_use = group.iter().zip(lanes.iter_mut()).zip(&mut results).zip(&mut tokenizers);
+    for (((&input, state), result), tokenizer) in lanes_in_use {
+        if let Some(fingerprint) = prefilter::classify(input).sqli_safe(input, flags, limits) {
+            *result = Some(safe_sqli_result(fingerprint));
+            continue;
+        }
+        state.rebind(input, flags, limits);
+        *tokenizer = Some(state.prefetch_tokenizer());
+    }
+    let pending = tokenizers.each_ref().map(Option::is_some);
+
+    // Tokenize the group round-robin into the token caches
+    for _ in 0..PREFETCH_STEPS {
+        let mut running = false;
+        for (state, tokenizer) in lanes.iter_mut().zip(&mut tokenizers) {
+            if let Some(lane) = tokenizer {
+                if state.prefetch(lane) {
+                    running = true;
+                } else {
+                    *tokenizer = None;
+                }
+            }
+        }
+        if !running {
+            break;
+        }
+    }
+
+    for ((state, result), pending) in lanes.iter_mut().zip(&mut results).zip(pending) {
+        if pending {
+            *result = Some(sqli_result(state));
+        }
+    }
+    results
+}
@@ -0,0 +1,186 @@
+//! libinjection-scan: flags injections in newline-delimited records
+//!
+//! Maps FILE, or reads standard input in large blocks, and scans the
+//! records on all cores with `ParallelScanner`, a window of whole records at
+//! a time. Prints one line per flagged record: its line number, the
+//! injection type and the SQLi fingerprint. Records need not be UTF-8.
+
+use std::fs::File;
+use std::io::{self, BufWriter, Read, Write};
+use std::process::ExitCode;
+use std::time::Instant;
+
+use libinjectionrs::parallel::ParallelScanner;
+use libinjectionrs::InjectionType;
+use memmap2::Mmap;
+
+const USAGE: &str = "usage: libinjection-scan [--threads N] [--all] [FILE]
+
+  --threads N  worker threads (default: one per core)
+  --all        print every record, not just the flagged ones
+  FILE         newline-delimited records (default: standard input)";
+
+// Bytes scanned per window, and read per block from standard input; a
+// window grows to take in a record that does not fit
+const WINDOW_SIZE: usize = 64 << 20;
+
+struct Options {
+    threads: Option<usize>,
+    all: bool,
+    path: Option<String>,
+}
+
+fn parse_args() -> Result<Options, String> {
+    let mut options = Options { threads: None, all: false, path: None };
+    let mut args = std::env::args().skip(1);
+    while let Some(arg) = args.next() {
+        match arg.as_str() {
+            "--threads" => {
+                let value = args.next().ok_or("--threads needs a value")?;
+                let threads = value.parse().map_err(|_| format!("bad thread count: {}", value))?;
+                options.threads = Some(threads);
+            }
+            "--all" => options.all = true,
+            "-h" | "--help" => return Err(String::new()),
+            _ if options.path.is_none() => options.path = Some(arg),
+            _ => return Err(format!("unexpected argument: {}", arg)),
+        }
+    }
+    Ok(options)
+}
+
+fn main() -> ExitCode {
+    let options = match parse_args() {
+        Ok(options) => options,
+        Err(message) => {
+            if !message.is_empty() {
+                eprintln!("libinjection-scan: {}", message);
+            }
+            eprintln!("{}", USAGE);
+            return ExitCode::from(2);
+        }
+    };
+    match run(&options) {
+        Ok(()) => ExitCode::SUCCESS,
+        Err(err) => {
+            eprintln!("libinjection-scan: {}", err);
+            ExitCode::FAILURE
+        }
+    }
+}
+
+// Counts of the records scanned so far
+#[derive(Default)]
+struct Totals {
+    records: u64,
+    sqli: u64,
+    xss: u64,
+}
+
+impl Totals {
+    // Scans the records of `window`, printing the flagged ones (or all)
+    fn scan(&mut self, scanner: &ParallelScanner, window: &[u8], all: bool, out: &mut impl Write) -> io::Result<()> {
+        for result in scanner.scan_lines(window) {
+            self.records += 1;
+            let kind = if !result.is_injection() {
+                "safe"
+            } else if result.injection_type == InjectionType::Sqli {
+                self.sqli += 1;
+                "sqli"
+            } else {
+                self.xss += 1;
+                "xss"
+            };
+            if result.is_injection() || all {
+                let fingerprint = result.fingerprint.map(|fp| fp.to_string()).unwrap_or_default();
+                writeln!(out, "{}\t{}\t{}", self.records, kind, fingerprint)?;
+            }
+        }
+        Ok(())
+    }
+}
+
+// Length of the window at the start of `data`: up to the last newline
+// within WINDOW_SIZE, so no record is cut, or to the end
+fn window_len(data: &[u8]) -> usize {
+    if data.len() <= WINDOW_SIZE {
+        return data.len();
+    }
+    let (window, rest) = data.split_at(WINDOW_SIZE);
+    match window.iter().rposition(|&b| b == b'\n') {
+        Some(newline) => newline + 1,
+        None => rest.iter().position(|&b| b == b'\n').map_or(data.len(), |newline| WINDOW_SIZE + newline + 1),
+    }
+}
+
+// Scans FILE through a mapping, one window at a time
+#[allow(unsafe_code)]
+fn scan_file(path: &str, scanner: &ParallelScanner, all: bool, totals: &mut Totals, out: &mut impl Write) -> io::Result<()> {
+    let file = File::open(path)?;
+    // SAFETY: the file is only read; like any mmap user we assume it is not
+    // truncated while mapped
+    let map = unsafe { Mmap::map(&file)? };
+    let mut rest: &[u8] = &map;
+    while !rest.is_empty() {
+        let (window, after) = rest.split_at(window_len(rest));
+        totals.scan(scanner, window, all, out)?;
+        rest = after;
+    }
+    Ok(())
+}
+
+// Scans a stream that cannot be mapped, such as a pipe, in blocks of
+// WINDOW_SIZE
+fn scan_stream(mut input: impl Read, scanner: &ParallelScanner, all: bool, totals: &mut Totals, out: &mut impl Write) -> io::Result<()> {
+    let mut block = Vec::with_capacity(WINDOW_SIZE);
+    let mut target = WINDOW_SIZE;
+    loop {
+        let wanted = target.saturating_sub(block.len());
+        let read = input.by_ref().take(wanted as u64).read_to_end(&mut block)?;
+        let eof = read < wanted;
+
+        // Scan up to the last newline; the partial record after it starts
+        // the next block
+        let end = if eof {
+            block.len()
+        } else if let Some(newline) = block.iter().rposition(|&b| b == b'\n') {
+            newline + 1
+        } else {
+            target = target.saturating_mul(2);
+            continue;
+        };
+
+        totals.scan(scanner, &block[..end], all, out)?;
+        block.drain(..end);
+        target = WINDOW_SIZE;
+        if eof {
+            return Ok(());
+        }
+    }
+}
+
+fn run(options: &Options) -> io::Result<()> {
+    let mut scanner = ParallelScanner::new();
+    if let Some(threads) = options.threads {
+        scanner = scanner.with_threads(threads);
+    }
+
+    let mut out = BufWriter::new(io::stdout().lock());
+    let started = Instant::now();
+    let mut totals = Totals::default();
+    match options.path.as_deref() {
+        Some(path) if path != "-" => scan_file(path, &scanner, options.all, &mut totals, &mut out)?,
+        _ => scan_stream(io::stdin().lock(), &scanner, options.all, &mut totals, &mut out)?,
+    }
+
+    out.flush()?;
+    eprintln!(
+        "{} records, {} sqli, {} xss in {:.2?} on {} threads",
+        totals.records,
+        totals.sqli,
+        totals.xss,
+        started.elapsed(),
+        scanner.threads(),
+    );
+    Ok(())
+}
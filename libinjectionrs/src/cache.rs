@@ -0,0 +1,291 @@
+//! Verdict cache for values that repeat
+//!
+//! Traffic repeats the same values (`id=1`, session tokens, popular search
+//! terms) over and over. [`VerdictCache`] remembers the verdict for each
+//! recent value so a repeat costs a hash and a probe instead of a full
+//! detection run.
+//!
+//! Entries are keyed by a 128-bit hash of the input and the detection mode.
+//! The hash is keyed with random per-cache keys (`RandomState`), so inputs
+//! cannot be crafted to collide. The cache is split into shards, each behind
+//! its own lock, and each shard evicts with the CLOCK policy: a hit marks an
+//! entry as recently used, and eviction sweeps past marked entries, clearing
+//! the mark, until it finds an unmarked one. Inputs longer than a cutoff are
+//! not cached at all.
+//!
+//! Requires the `std` feature.
+
+use std::collections::hash_map::RandomState;
+use std::collections::HashMap;
+use std::hash::{BuildHasher, BuildHasherDefault, Hash, Hasher};
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Mutex, PoisonError};
+use std::vec::Vec;
+
+use crate::sqli::SqliFlags;
+use crate::xss::XssResult;
+use crate::{detect_sqli_with_flags, detect_xss, DetectionResult};
+
+// Inputs longer than this are detected without the cache by default
+const DEFAULT_MAX_INPUT_LEN: usize = 256;
+const DEFAULT_SHARDS: usize = 16;
+
+/// Cache counters since the cache was created
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub struct CacheStats {
+    /// Lookups answered from the cache
+    pub hits: u64,
+    /// Lookups that ran detection and stored the verdict
+    pub misses: u64,
+    /// Entries dropped to make room
+    pub evictions: u64,
+    /// Inputs over the size cutoff, detected without the cache
+    pub bypassed: u64,
+}
+
+/// Bounded concurrent cache in front of `detect_sqli` and `detect_xss`
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::cache::VerdictCache;
+///
+/// let cache = VerdictCache::new(10_000);
+/// for _ in 0..3 {
+///     assert!(cache.detect_sqli(b"1' OR '1'='1").is_injection());
+///     assert!(!cache.detect_xss(b"id=1").is_injection());
+/// }
+/// let stats = cache.stats();
+/// assert_eq!((stats.misses, stats.hits), (2, 4));
+/// ```
+pub struct VerdictCache {
+    shards: Vec<Mutex<Shard>>,
+    keys: (RandomState, RandomState),
+    max_input_len: usize,
+    hits: AtomicU64,
+    misses: AtomicU64,
+    evictions: AtomicU64,
+    bypassed: AtomicU64,
+}
+
+#[derive(Clone)]
+enum Verdict {
+    Sqli(DetectionResult),
+    Xss(XssResult),
+}
+
+// What a verdict was computed for
+#[derive(Hash)]
+enum Mode {
+    Sqli(SqliFlags),
+    Xss,
+}
+
+impl VerdictCache {
+    /// Creates a cache holding up to about `capacity` verdicts
+    pub fn new(capacity: usize) -> Self {
+        Self::with_shards(capacity, DEFAULT_SHARDS)
+    }
+
+    /// Creates a cache of `capacity` verdicts split over `shards` locks, at
+    /// least one. More shards mean less lock contention between threads.
+    pub fn with_shards(capacity: usize, shards: usize) -> Self {
+        let shards = shards.clamp(1, capacity.max(1));
+        let per_shard = capacity.div_ceil(shards);
+        VerdictCache {
+            shards: (0..shards).map(|_| Mutex::new(Shard::new(per_shard))).collect(),
+            keys: (RandomState::new(), RandomState::new()),
+            max_input_len: DEFAULT_MAX_INPUT_LEN,
+            hits: AtomicU64::new(0),
+            misses: AtomicU64::new(0),
+            evictions: AtomicU64::new(0),
+            bypassed: AtomicU64::new(0),
+        }
+    }
+
+    /// Caches only inputs of at most `len` bytes (256 by default). Longer
+    /// inputs are rarely repeated and would make hashing a large share of
+    /// the cost.
+    pub fn with_max_input_len(mut self, len: usize) -> Self {
+        self.max_input_len = len;
+        self
+    }
+
+    /// `detect_sqli` through the cache
+    pub fn detect_sqli(&self, input: &[u8]) -> DetectionResult {
+        self.detect_sqli_with_flags(input, SqliFlags::FLAG_NONE)
+    }
+
+    /// `detect_sqli_with_flags` through the cache
+    pub fn detect_sqli_with_flags(&self, input: &[u8], flags: SqliFlags) -> DetectionResult {
+        let verdict = self.lookup(input, Mode::Sqli(flags), || Verdict::Sqli(detect_sqli_with_flags(input, flags)));
+        match verdict {
+            Verdict::Sqli(result) => result,
+            // Keys differ by mode, so an XSS entry is never found here
+            Verdict::Xss(_) => detect_sqli_with_flags(input, flags),
+        }
+    }
+
+    /// `detect_xss` through the cache
+    pub fn detect_xss(&self, input: &[u8]) -> XssResult {
+        match self.lookup(input, Mode::Xss, || Verdict::Xss(detect_xss(input))) {
+            Verdict::Xss(result) => result,
+            Verdict::Sqli(_) => detect_xss(input),
+        }
+    }
+
+    /// Counters since the cache was created
+    pub fn stats(&self) -> CacheStats {
+        CacheStats {
+            hits: self.hits.load(Ordering::Relaxed),
+            misses: self.misses.load(Ordering::Relaxed),
+            evictions: self.evictions.load(Ordering::Relaxed),
+            bypassed: self.bypassed.load(Ordering::Relaxed),
+        }
+    }
+
+    /// Number of verdicts currently cached
+    pub fn len(&self) -> usize {
+        self.shards.iter().map(|shard| lock(shard).slots.len()).sum()
+    }
+
+    /// Returns `true` if nothing is cached
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+
+    /// Drops every cached verdict; the counters are kept
+    pub fn clear(&self) {
+        for shard in &self.shards {
+            let mut shard = lock(shard);
+            shard.slots.clear();
+            shard.index.clear();
+            shard.hand = 0;
+        }
+    }
+
+    fn lookup(&self, input: &[u8], mode: Mode, detect: impl FnOnce() -> Verdict) -> Verdict {
+        if input.len() > self.max_input_len {
+            self.bypassed.fetch_add(1, Ordering::Relaxed);
+            return detect();
+        }
+
+        let key = self.key(input, &mode);
+        let shard = self.shards.get((key >> 64) as usize % self.shards.len());
+        let Some(shard) = shard else {
+            return detect();
+        };
+        if let Some(verdict) = lock(shard).get(key) {
+            self.hits.fetch_add(1, Ordering::Relaxed);
+            return verdict;
+        }
+
+        // Detect without holding the lock; a racing thread may store the
+        // same verdict first, which is harmless
+        self.misses.fetch_add(1, Ordering::Relaxed);
+        let verdict = detect();
+        if lock(shard).insert(key, verdict.clone()) {
+            self.evictions.fetch_add(1, Ordering::Relaxed);
+        }
+        verdict
+    }
+
+    fn key(&self, input: &[u8], mode: &Mode) -> u128 {
+        let half = |keys: &RandomState| {
+            let mut hasher = keys.build_hasher();
+            mode.hash(&mut hasher);
+            hasher.write(input);
+            hasher.finish()
+        };
+        (u128::from(half(&self.keys.0)) << 64) | u128::from(half(&self.keys.1))
+    }
+}
+
+fn lock(shard: &Mutex<Shard>) -> std::sync::MutexGuard<'_, Shard> {
+    // A panic elsewhere cannot leave a shard inconsistent enough to matter:
+    // at worst one entry is missing from the index
+    shard.lock().unwrap_or_else(PoisonError::into_inner)
+}
+
+struct Slot {
+    key: u128,
+    verdict: Verdict,
+    referenced: bool,
+}
+
+// One lock's worth of entries, evicted with CLOCK
+struct Shard {
+    capacity: usize,
+    slots: Vec<Slot>,
+    index: HashMap<u128, usize, BuildHasherDefault<KeyHasher>>,
+    hand: usize,
+}
+
+impl Shard {
+    fn new(capacity: usize) -> Self {
+        Shard {
+            capacity,
+            slots: Vec::new(),
+            index: HashMap::default(),
+            hand: 0,
+        }
+    }
+
+    fn get(&mut self, key: u128) -> Option<Verdict> {
+        let slot = self.slots.get_mut(*self.index.get(&key)?)?;
+        slot.referenced = true;
+        Some(slot.verdict.clone())
+    }
+
+    // Stores a verdict, returning true if another entry was evicted for it
+    fn insert(&mut self, key: u128, verdict: Verdict) -> bool {
+        if self.capacity == 0 || self.index.contains_key(&key) {
+            return false;
+        }
+        let slot = Slot { key, verdict, referenced: false };
+        if self.slots.len() < self.capacity {
+            self.index.insert(key, self.slots.len());
+            self.slots.push(slot);
+            return false;
+        }
+
+        // Sweep the hand past recently used entries, clearing their marks;
+        // it stops within two laps at most
+        let victim = loop {
+            let at = self.hand % self.slots.len();
+            self.hand = at.wrapping_add(1);
+            match self.slots.get_mut(at) {
+                Some(candidate) if candidate.referenced => candidate.referenced = false,
+                Some(_) => break at,
+                None => return false,
+            }
+        };
+        if let Some(old) = self.slots.get_mut(victim) {
+            self.index.remove(&old.key);
+            *old = slot;
+            self.index.insert(key, victim);
+        }
+        true
+    }
+}
+
+// The keys are already uniformly random, so the index uses their low bits
+// as the hash instead of hashing them again
+#[derive(Default)]
+struct KeyHasher(u64);
+
+impl Hasher for KeyHasher {
+    fn finish(&self) -> u64 {
+        self.0
+    }
+
+    fn write(&mut self, bytes: &[u8]) {
+        for &b in bytes {
+            self.0 = self.0.rotate_left(8) ^ u64::from(b);
+        }
+    }
+
+    fn write_u128(&mut self, key: u128) {
+        self.0 = key as u64;
+    }
+}
@@ -0,0 +1,115 @@
+//! URL-decoding values on their way to the detectors
+//!
+//! Query arguments and form fields are usually checked decoded. Decoding
+//! each into a fresh buffer costs an allocation and a pass over the value;
+//! [`UrlDecoder`] instead hands back the value itself when it has nothing to
+//! decode, and otherwise decodes into one buffer it keeps between values.
+//! [`Scanner::detect_url_encoded`](crate::Scanner::detect_url_encoded) runs
+//! both detectors over values decoded this way.
+//!
+//! `%XX` with two hex digits (either case) is the byte `XX`; a `%` not
+//! followed by two hex digits is kept as it is, as browsers and most
+//! servers do. With [`UrlEncoding::Form`], `+` is a space.
+
+#[cfg(not(feature = "std"))]
+use alloc::vec::Vec;
+
+use crate::sqli::scan;
+
+/// How a value is URL-encoded
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum UrlEncoding {
+    /// `application/x-www-form-urlencoded`, as in query strings and form
+    /// bodies: percent escapes, and `+` for a space
+    Form,
+    /// Percent escapes only, as in paths; `+` is itself
+    Percent,
+}
+
+/// Decodes URL-encoded values, without copying those that have no escapes
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::decode::UrlDecoder;
+///
+/// let mut decoder = UrlDecoder::new();
+/// assert_eq!(decoder.decode(b"1%27+OR+%271%27%3D%271"), b"1' OR '1'='1");
+/// assert_eq!(decoder.decode(b"plain"), b"plain");
+/// ```
+#[derive(Debug, Clone)]
+pub struct UrlDecoder {
+    encoding: UrlEncoding,
+    // Decoded bytes of the last value that had escapes
+    buf: Vec<u8>,
+}
+
+impl UrlDecoder {
+    /// Creates a decoder for form-encoded values, where `+` is a space
+    pub fn new() -> Self {
+        Self::with_encoding(UrlEncoding::Form)
+    }
+
+    /// Creates a decoder for values encoded as `encoding`
+    pub fn with_encoding(encoding: UrlEncoding) -> Self {
+        UrlDecoder { encoding, buf: Vec::new() }
+    }
+
+    /// The encoding this decoder reads
+    pub fn encoding(&self) -> UrlEncoding {
+        self.encoding
+    }
+
+    /// Decodes `input`. Returns `input` itself if it has no escapes,
+    /// otherwise the decoded bytes, which stay valid until the next call.
+    pub fn decode<'a>(&'a mut self, input: &'a [u8]) -> &'a [u8] {
+        if find_escape(self.encoding, input).is_none() {
+            return input;
+        }
+        self.buf.clear();
+        decode_into(self.encoding, input, &mut self.buf);
+        &self.buf
+    }
+}
+
+/// Appends `input`, decoded as `encoding`, to `out`
+pub(crate) fn decode_into(encoding: UrlEncoding, input: &[u8], out: &mut Vec<u8>) {
+    let mut rest = input;
+    while let Some(at) = find_escape(encoding, rest) {
+        out.extend_from_slice(&rest[..at]);
+        rest = &rest[at..];
+        let (byte, used) = match rest {
+            [b'+', ..] => (b' ', 1),
+            [b'%', hi, lo, ..] => match (hex_value(*hi), hex_value(*lo)) {
+                (Some(hi), Some(lo)) => ((hi << 4) | lo, 3),
+                _ => (b'%', 1),
+            },
+            _ => (b'%', 1),
+        };
+        out.push(byte);
+        rest = &rest[used..];
+    }
+    out.extend_from_slice(rest);
+}
+
+fn find_escape(encoding: UrlEncoding, input: &[u8]) -> Option<usize> {
+    match encoding {
+        UrlEncoding::Form => scan::find_either(b'%', b'+', input),
+        UrlEncoding::Percent => scan::find_byte(b'%', input),
+    }
+}
+
+impl Default for UrlDecoder {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+fn hex_value(b: u8) -> Option<u8> {
+    match b {
+        b'0'..=b'9' => Some(b - b'0'),
+        b'a'..=b'f' => Some(b - b'a' + 10),
+        b'A'..=b'F' => Some(b - b'A' + 10),
+        _ => None,
+    }
+}
@@ -9,8 +9,20 @@
 //!
 //! - [`detect_sqli`] - Main SQL injection detection (recommended)
 //! - [`detect_sqli_with_flags`] - SQL injection detection with custom flags
+//! - [`detect_sqli_with_limits`] - SQL injection detection with bounded work
+//! - [`detect_sqli_ansi`] / [`detect_sqli_mysql`] - SQL injection detection for a backend of one dialect
 //! - [`detect_xss`] - Cross-site scripting detection
 //! - [`version`] - Library version information
+//! - [`StreamingDetector`] - Both detectors over input that arrives in chunks
+//! - [`Scanner`] - Both detectors over many values, reusing one state
+//! - [`request::RequestScanner`] - Both detectors over every field of a request in one pass
+//! - [`decode::UrlDecoder`] - URL-decoding values without a buffer per value
+//! - [`overlay::RuleOverlay`] - Custom keywords, fingerprints and XSS names, compiled to a shareable blob
+//! - `parallel::ParallelScanner` - Records spread over all cores (`parallel` feature)
+//! - `cache::VerdictCache` - Remembered verdicts for repeated values (`cache` feature)
+//! - `metrics::snapshot` - Counters of detection work for scraping (`metrics` feature)
+//! - `batch::BatchScanner` - SQLi detection over many values, several tokenized at once (experimental `batch` feature)
+//! - `middleware::AsyncScanner` / `middleware::InjectionLayer` - Detection from tokio services (`async` feature)
 //!
 //! These functions handle all the complexity of testing multiple contexts and
 //! SQL dialects automatically, returning simple results.
@@ -43,9 +55,28 @@ use core::fmt;
 #[cfg(feature = "std")]
 use std::error::Error as StdError;
 
+#[cfg(feature = "batch")]
+pub mod batch;
+#[cfg(feature = "cache")]
+pub mod cache;
+pub mod decode;
+#[cfg(feature = "metrics")]
+pub mod metrics;
+#[cfg(feature = "async")]
+pub mod middleware;
+pub mod overlay;
+#[cfg(feature = "parallel")]
+pub mod parallel;
+pub mod records;
+pub mod request;
+pub mod scanner;
 pub mod sqli;
+pub mod stream;
 pub mod xss;
 
+mod phf;
+mod prefilter;
+
 #[cfg(test)]
 mod tests;
 
@@ -56,8 +87,10 @@ mod final_test;
 
 
 // Re-export types for advanced usage
-pub use sqli::{SqliState, SqliFlags, Fingerprint};
+pub use sqli::{SqliState, SqliFlags, Fingerprint, ScanLimits};
 pub use xss::{XssDetector, XssResult};
+pub use scanner::Scanner;
+pub use stream::{StreamingDetector, StreamVerdict};
 
 /// The type of injection detected by libinjection.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
@@ -90,6 +123,9 @@ pub struct DetectionResult {
     pub fingerprint: Option<Fingerprint>,
     /// Confidence level (currently binary: 1.0 for injection, 0.0 for safe)
     pub confidence: f32,
+    /// True if a [`ScanLimits`] bound cut detection short and the verdict is
+    /// the one for the part of the input that was scanned
+    pub truncated: bool,
 }
 
 impl DetectionResult {
@@ -188,15 +224,122 @@ pub fn detect_sqli(input: &[u8]) -> DetectionResult {
 /// assert!(result.is_injection());
 /// ```
 pub fn detect_sqli_with_flags(input: &[u8], flags: SqliFlags) -> DetectionResult {
+    detect_sqli_with_limits(input, flags, ScanLimits::UNLIMITED)
+}
+
+/// Detects SQL injection, scanning at most as much input as `limits` allows.
+///
+/// Use this to bound the latency of detection on very large values. If the
+/// limits cut the scan short before the verdict was settled, the result is
+/// the verdict for the scanned part and `truncated` is set; otherwise the
+/// result is exactly that of [`detect_sqli_with_flags`].
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::{detect_sqli_with_limits, ScanLimits, SqliFlags};
+///
+/// let mut input = b"1' OR '1'='1".to_vec();
+/// input.resize(1 << 20, b' ');
+///
+/// let result = detect_sqli_with_limits(&input, SqliFlags::FLAG_NONE, ScanLimits::new(4096, 64));
+/// assert!(result.is_injection());
+/// assert!(result.truncated);
+/// ```
+pub fn detect_sqli_with_limits(input: &[u8], flags: SqliFlags, limits: ScanLimits) -> DetectionResult {
+    if let Some(fingerprint) = prefilter::classify(input).sqli_safe(input, flags, limits) {
+        return safe_sqli_result(fingerprint);
+    }
+    let mut state = SqliState::new(input, flags).with_limits(limits);
+    sqli_result(&mut state)
+}
+
+/// Detects SQL injection aimed at an ANSI SQL backend.
+///
+/// Runs only the passes that read the input as ANSI SQL, skipping the
+/// MySQL reparses [`detect_sqli`] makes, so it does less work; use it when
+/// the backend is known not to be MySQL.
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::detect_sqli_ansi;
+///
+/// assert!(detect_sqli_ansi(b"1' OR '1'='1").is_injection());
+/// assert!(!detect_sqli_ansi(b"hello world").is_injection());
+/// ```
+pub fn detect_sqli_ansi(input: &[u8]) -> DetectionResult {
+    detect_sqli_in_dialect(input, SqliFlags::FLAG_SQL_ANSI)
+}
+
+/// Detects SQL injection aimed at a MySQL backend.
+///
+/// Runs only the passes that read the input as MySQL, where `#` starts a
+/// comment and `--` needs whitespace after it to; use it when the backend
+/// is known to be MySQL.
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::detect_sqli_mysql;
+///
+/// assert!(detect_sqli_mysql(b"1' OR '1'='1' #").is_injection());
+/// assert!(!detect_sqli_mysql(b"hello world").is_injection());
+/// ```
+pub fn detect_sqli_mysql(input: &[u8]) -> DetectionResult {
+    detect_sqli_in_dialect(input, SqliFlags::FLAG_SQL_MYSQL)
+}
+
+fn detect_sqli_in_dialect(input: &[u8], dialect: SqliFlags) -> DetectionResult {
+    let flags = SqliFlags::FLAG_QUOTE_NONE | dialect;
+    if let Some(fingerprint) = prefilter::classify(input).sqli_safe(input, flags, ScanLimits::UNLIMITED) {
+        return safe_sqli_result(fingerprint);
+    }
     let mut state = SqliState::new(input, flags);
+    let is_sqli = state.detect_dialect(dialect);
+    sqli_verdict(&state, is_sqli)
+}
+
+// Runs `state.detect()` and wraps its verdict
+pub(crate) fn sqli_result(state: &mut SqliState<'_>) -> DetectionResult {
     let is_sqli = state.detect();
-    let fp = state.get_fingerprint();
+    sqli_verdict(state, is_sqli)
+}
+
+fn sqli_verdict(state: &SqliState<'_>, is_sqli: bool) -> DetectionResult {
+    let fp = state.detected_fingerprint();
     
     DetectionResult {
         is_injection: is_sqli,
         injection_type: InjectionType::Sqli,
         fingerprint: Some(fp),
         confidence: if is_sqli { 1.0 } else { 0.0 },
+        truncated: state.truncated(),
+    }
+}
+
+// The result for an input the prefilter proved safe, as `sqli_result`
+// would report it
+pub(crate) fn safe_sqli_result(fingerprint: Fingerprint) -> DetectionResult {
+    #[cfg(feature = "metrics")]
+    metrics::sqli_prefiltered();
+    DetectionResult {
+        is_injection: false,
+        injection_type: InjectionType::Sqli,
+        fingerprint: Some(fingerprint),
+        confidence: 0.0,
+        truncated: false,
+    }
+}
+
+// The result reported for an XSS injection
+pub(crate) fn xss_result() -> DetectionResult {
+    DetectionResult {
+        injection_type: InjectionType::Xss,
+        is_injection: true,
+        fingerprint: None,
+        confidence: 1.0,
+        truncated: false,
     }
 }
 
@@ -0,0 +1,365 @@
+//! Counters for what detection spends its time on
+//!
+//! With the `metrics` feature, the detectors count their work as they go:
+//! SQLi passes by quoting context and dialect, with the tokens, folds and
+//! bytes each pass took, blacklist hits and whitelist overrides, and XSS
+//! contexts evaluated and the rule each hit came from. Without the feature
+//! none of this is compiled at all.
+//!
+//! Each thread counts into its own counters, which only that thread writes,
+//! so counting costs a load and a store and never contends. [`snapshot`]
+//! sums every thread's counters for scraping (see
+//! [`MetricsSnapshot::write_prometheus`]); [`thread_snapshot`] reads only the
+//! calling thread's, so the difference around one call shows what that
+//! input cost. Counts of threads that have exited are kept. A thread's
+//! counters are allocated on its first detection, or by
+//! [`register_thread`].
+//!
+//! SQLi passes are counted wherever they run, the streaming detector
+//! included; detections are calls of `SqliState::detect`. XSS is counted for
+//! `detect_xss`, [`Scanner`](crate::Scanner) and the cache on a miss, but
+//! not for the streaming detector.
+//!
+//! Requires the `std` feature.
+
+use core::fmt::{self, Write};
+use std::string::String;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Arc, Mutex, PoisonError};
+use std::vec::Vec;
+
+use crate::sqli::SqliFlags;
+use crate::xss::XssRule;
+
+/// Quoting contexts of SQLi passes, in counter order
+pub const SQLI_QUOTES: [&str; 3] = ["none", "single", "double"];
+/// Dialects of SQLi passes, in counter order
+pub const SQLI_DIALECTS: [&str; 2] = ["ansi", "mysql"];
+/// XSS rules, in counter order (the order of `XssRule`)
+pub const XSS_RULES: [&str; 7] = ["doctype", "tag", "attribute", "url", "style", "indirect_attribute", "comment"];
+
+const PASSES: usize = SQLI_QUOTES.len() * SQLI_DIALECTS.len();
+
+// Counter layout
+const SQLI_DETECTIONS: usize = 0;
+const SQLI_PREFILTERED: usize = 1;
+const SQLI_TOKENS: usize = 2;
+const SQLI_FOLDS: usize = 3;
+const SQLI_BYTES: usize = 4;
+const SQLI_BLACKLIST_HITS: usize = 5;
+const SQLI_WHITELIST_OVERRIDES: usize = 6;
+const XSS_DETECTIONS: usize = 7;
+const XSS_PREFILTERED: usize = 8;
+const XSS_CONTEXTS: usize = 9;
+const XSS_TOKENS: usize = 10;
+const XSS_BYTES: usize = 11;
+const SQLI_PASSES: usize = 12;
+const SQLI_PASS_HITS: usize = SQLI_PASSES + PASSES;
+const XSS_HITS: usize = SQLI_PASS_HITS + PASSES;
+const COUNTERS: usize = XSS_HITS + XSS_RULES.len();
+
+/// Counter values at one point in time
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::metrics::thread_snapshot;
+///
+/// let before = thread_snapshot();
+/// libinjectionrs::detect_sqli(b"1' OR '1'='1");
+/// let cost = thread_snapshot().since(&before);
+/// assert_eq!(cost.sqli_detections(), 1);
+/// assert!(cost.sqli_tokens() > 0);
+///
+/// let exposition = libinjectionrs::metrics::snapshot().to_prometheus("libinjection_");
+/// assert!(exposition.contains("libinjection_sqli_detections_total"));
+/// ```
+#[derive(Debug, Clone, PartialEq, Eq)]
+pub struct MetricsSnapshot {
+    values: [u64; COUNTERS],
+}
+
+impl MetricsSnapshot {
+    /// `detect()` runs of the SQLi detector
+    pub fn sqli_detections(&self) -> u64 {
+        self.value(SQLI_DETECTIONS)
+    }
+
+    /// SQLi checks the prefilter answered without running the detector
+    pub fn sqli_prefiltered(&self) -> u64 {
+        self.value(SQLI_PREFILTERED)
+    }
+
+    /// SQLi passes run in a quoting context and dialect, indexes into
+    /// `SQLI_QUOTES` and `SQLI_DIALECTS`
+    pub fn sqli_passes(&self, quote: usize, dialect: usize) -> u64 {
+        self.pass_counter(SQLI_PASSES, quote, dialect)
+    }
+
+    /// SQLi passes in a context and dialect that found an injection
+    pub fn sqli_pass_hits(&self, quote: usize, dialect: usize) -> u64 {
+        self.pass_counter(SQLI_PASS_HITS, quote, dialect)
+    }
+
+    /// Tokens produced over all SQLi passes
+    pub fn sqli_tokens(&self) -> u64 {
+        self.value(SQLI_TOKENS)
+    }
+
+    /// Folds applied over all SQLi passes
+    pub fn sqli_folds(&self) -> u64 {
+        self.value(SQLI_FOLDS)
+    }
+
+    /// Input bytes over all SQLi passes
+    pub fn sqli_bytes(&self) -> u64 {
+        self.value(SQLI_BYTES)
+    }
+
+    /// SQLi passes whose fingerprint was on the blacklist
+    pub fn sqli_blacklist_hits(&self) -> u64 {
+        self.value(SQLI_BLACKLIST_HITS)
+    }
+
+    /// Blacklisted fingerprints the whitelist rules cleared
+    pub fn sqli_whitelist_overrides(&self) -> u64 {
+        self.value(SQLI_WHITELIST_OVERRIDES)
+    }
+
+    /// XSS checks run past the prefilter
+    pub fn xss_detections(&self) -> u64 {
+        self.value(XSS_DETECTIONS)
+    }
+
+    /// XSS checks the prefilter answered without tokenizing
+    pub fn xss_prefiltered(&self) -> u64 {
+        self.value(XSS_PREFILTERED)
+    }
+
+    /// XSS contexts tokenized to the end of the input or to a hit; contexts
+    /// dropped for joining another one are not counted
+    pub fn xss_contexts(&self) -> u64 {
+        self.value(XSS_CONTEXTS)
+    }
+
+    /// html5 tokens checked over all contexts
+    pub fn xss_tokens(&self) -> u64 {
+        self.value(XSS_TOKENS)
+    }
+
+    /// Input bytes over all XSS checks run past the prefilter
+    pub fn xss_bytes(&self) -> u64 {
+        self.value(XSS_BYTES)
+    }
+
+    /// XSS hits from a rule, an index into `XSS_RULES`
+    pub fn xss_hits(&self, rule: usize) -> u64 {
+        if rule < XSS_RULES.len() {
+            self.value(XSS_HITS + rule)
+        } else {
+            0
+        }
+    }
+
+    /// The counts since `earlier`, a snapshot taken before this one
+    pub fn since(&self, earlier: &MetricsSnapshot) -> MetricsSnapshot {
+        let mut values = self.values;
+        for (value, before) in values.iter_mut().zip(earlier.values.iter()) {
+            *value = value.saturating_sub(*before);
+        }
+        MetricsSnapshot { values }
+    }
+
+    /// Writes the counters in the Prometheus text exposition format, each
+    /// name prefixed with `prefix` (e.g. `libinjection_`)
+    pub fn write_prometheus(&self, prefix: &str, out: &mut impl Write) -> fmt::Result {
+        let plain = [
+            ("sqli_detections_total", "SQLi detector runs", SQLI_DETECTIONS),
+            ("sqli_prefiltered_total", "SQLi checks answered by the prefilter", SQLI_PREFILTERED),
+            ("sqli_tokens_total", "Tokens produced by SQLi passes", SQLI_TOKENS),
+            ("sqli_folds_total", "Folds applied by SQLi passes", SQLI_FOLDS),
+            ("sqli_bytes_total", "Input bytes of SQLi passes", SQLI_BYTES),
+            ("sqli_blacklist_hits_total", "SQLi fingerprints found on the blacklist", SQLI_BLACKLIST_HITS),
+            ("sqli_whitelist_overrides_total", "Blacklisted SQLi fingerprints cleared by the whitelist", SQLI_WHITELIST_OVERRIDES),
+            ("xss_detections_total", "XSS checks run past the prefilter", XSS_DETECTIONS),
+            ("xss_prefiltered_total", "XSS checks answered by the prefilter", XSS_PREFILTERED),
+            ("xss_contexts_total", "XSS contexts tokenized to the end or a hit", XSS_CONTEXTS),
+            ("xss_tokens_total", "html5 tokens checked", XSS_TOKENS),
+            ("xss_bytes_total", "Input bytes of XSS checks", XSS_BYTES),
+        ];
+        for (name, help, counter) in plain {
+            header(out, prefix, name, help)?;
+            writeln!(out, "{}{} {}", prefix, name, self.value(counter))?;
+        }
+
+        for (name, help, base) in [
+            ("sqli_passes_total", "SQLi passes by quoting context and dialect", SQLI_PASSES),
+            ("sqli_pass_hits_total", "SQLi passes that found an injection", SQLI_PASS_HITS),
+        ] {
+            header(out, prefix, name, help)?;
+            for (q, quote) in SQLI_QUOTES.iter().enumerate() {
+                for (d, dialect) in SQLI_DIALECTS.iter().enumerate() {
+                    let value = self.pass_counter(base, q, d);
+                    writeln!(out, "{}{}{{quote=\"{}\",dialect=\"{}\"}} {}", prefix, name, quote, dialect, value)?;
+                }
+            }
+        }
+
+        header(out, prefix, "xss_hits_total", "XSS hits by rule")?;
+        for (r, rule) in XSS_RULES.iter().enumerate() {
+            writeln!(out, "{}xss_hits_total{{rule=\"{}\"}} {}", prefix, rule, self.xss_hits(r))?;
+        }
+        Ok(())
+    }
+
+    /// [`write_prometheus`](Self::write_prometheus) into a new string
+    pub fn to_prometheus(&self, prefix: &str) -> String {
+        let mut out = String::new();
+        // Writing to a String cannot fail
+        let _ = self.write_prometheus(prefix, &mut out);
+        out
+    }
+
+    fn value(&self, counter: usize) -> u64 {
+        self.values.get(counter).copied().unwrap_or(0)
+    }
+
+    fn pass_counter(&self, base: usize, quote: usize, dialect: usize) -> u64 {
+        if quote >= SQLI_QUOTES.len() || dialect >= SQLI_DIALECTS.len() {
+            return 0;
+        }
+        self.value(base + quote * SQLI_DIALECTS.len() + dialect)
+    }
+}
+
+fn header(out: &mut impl Write, prefix: &str, name: &str, help: &str) -> fmt::Result {
+    writeln!(out, "# HELP {}{} {}", prefix, name, help)?;
+    writeln!(out, "# TYPE {}{} counter", prefix, name)
+}
+
+/// Counts over every thread since the process started
+pub fn snapshot() -> MetricsSnapshot {
+    let registry = REGISTRY.lock().unwrap_or_else(PoisonError::into_inner);
+    let mut values = registry.retired;
+    for counters in &registry.live {
+        for (value, counter) in values.iter_mut().zip(counters.iter()) {
+            *value = value.saturating_add(counter.load(Ordering::Relaxed));
+        }
+    }
+    MetricsSnapshot { values }
+}
+
+/// Counts of the calling thread alone since it started
+pub fn thread_snapshot() -> MetricsSnapshot {
+    let mut values = [0; COUNTERS];
+    let _ = LOCAL.try_with(|local| {
+        for (value, counter) in values.iter_mut().zip(local.0.iter()) {
+            *value = counter.load(Ordering::Relaxed);
+        }
+    });
+    MetricsSnapshot { values }
+}
+
+/// Registers the calling thread's counters now rather than on its first
+/// detection
+///
+/// Registering allocates, once per thread. A thread that must not allocate
+/// while detecting, such as a worker started with an allocation check, calls
+/// this when it starts.
+pub fn register_thread() {
+    let _ = LOCAL.try_with(|_| ());
+}
+
+type Counters = [AtomicU64; COUNTERS];
+
+struct Registry {
+    live: Vec<Arc<Counters>>,
+    // Sums of the threads that have exited
+    retired: [u64; COUNTERS],
+}
+
+static REGISTRY: Mutex<Registry> = Mutex::new(Registry { live: Vec::new(), retired: [0; COUNTERS] });
+
+// A thread's counters, registered on first use and retired when it exits
+struct Local(Arc<Counters>);
+
+impl Local {
+    fn register() -> Self {
+        let counters = Arc::new(core::array::from_fn(|_| AtomicU64::new(0)));
+        REGISTRY.lock().unwrap_or_else(PoisonError::into_inner).live.push(Arc::clone(&counters));
+        Local(counters)
+    }
+}
+
+impl Drop for Local {
+    fn drop(&mut self) {
+        let mut registry = REGISTRY.lock().unwrap_or_else(PoisonError::into_inner);
+        let registry = &mut *registry;
+        for (total, counter) in registry.retired.iter_mut().zip(self.0.iter()) {
+            *total = total.saturating_add(counter.load(Ordering::Relaxed));
+        }
+        registry.live.retain(|counters| !Arc::ptr_eq(counters, &self.0));
+    }
+}
+
+std::thread_local! {
+    static LOCAL: Local = Local::register();
+}
+
+#[inline]
+fn add(counter: usize, n: u64) {
+    // Only this thread writes its counters, so no read-modify-write is needed
+    let _ = LOCAL.try_with(|local| {
+        if let Some(counter) = local.0.get(counter) {
+            counter.store(counter.load(Ordering::Relaxed).wrapping_add(n), Ordering::Relaxed);
+        }
+    });
+}
+
+fn pass_index(flags: SqliFlags) -> usize {
+    let quote = match flags.quote_context() {
+        b'\'' => 1,
+        b'"' => 2,
+        _ => 0,
+    };
+    quote * SQLI_DIALECTS.len() + usize::from(flags.is_mysql())
+}
+
+// Hooks called by the detectors
+
+pub(crate) fn sqli_detection() {
+    add(SQLI_DETECTIONS, 1);
+}
+
+pub(crate) fn sqli_prefiltered() {
+    add(SQLI_PREFILTERED, 1);
+}
+
+pub(crate) fn sqli_pass(flags: SqliFlags, tokens: usize, folds: usize, bytes: usize, is_sqli: bool) {
+    let index = pass_index(flags);
+    add(SQLI_PASSES + index, 1);
+    add(SQLI_PASS_HITS + index, u64::from(is_sqli));
+    add(SQLI_TOKENS, tokens as u64);
+    add(SQLI_FOLDS, folds as u64);
+    add(SQLI_BYTES, bytes as u64);
+}
+
+pub(crate) fn sqli_blacklisted(whitelisted: bool) {
+    add(SQLI_BLACKLIST_HITS, 1);
+    add(SQLI_WHITELIST_OVERRIDES, u64::from(whitelisted));
+}
+
+pub(crate) fn xss_detection(bytes: usize, contexts: usize, tokens: usize) {
+    add(XSS_DETECTIONS, 1);
+    add(XSS_BYTES, bytes as u64);
+    add(XSS_CONTEXTS, contexts as u64);
+    add(XSS_TOKENS, tokens as u64);
+}
+
+pub(crate) fn xss_prefiltered() {
+    add(XSS_PREFILTERED, 1);
+}
+
+pub(crate) fn xss_hit(rule: XssRule) {
+    add(XSS_HITS + rule as usize, 1);
+}
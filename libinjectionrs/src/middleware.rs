@@ -0,0 +1,539 @@
+//! Detection from tokio services
+//!
+//! A gateway that checks values on its reactor threads cannot afford to run
+//! detection over a multi-megabyte body inline: at tens of megabytes a
+//! second that blocks every other connection on the thread for tens of
+//! milliseconds. [`AsyncScanner`] checks inputs up to a size limit on the
+//! calling task, where they cost less than a context switch would, and
+//! hands longer ones to tokio's blocking threads. At most a fixed number of
+//! those offloaded checks run at once; callers over that number wait for a
+//! slot, so a burst of large bodies queues instead of taking over the
+//! blocking pool.
+//!
+//! Dropping a future returned here, as hyper does when the client goes
+//! away, gives up its slot or its queued check. A check already running on
+//! a blocking thread cannot be interrupted, but it stops at the next point
+//! it looks: before it starts, and between the SQLi and XSS detectors.
+//!
+//! Bodies are checked as their frames arrive, through a
+//! [`StreamingDetector`], so an injection near the start of a body is
+//! reported without reading the rest. [`InjectionLayer`] wraps a tower
+//! service with that check and answers such requests itself.
+//!
+//! The [`Scanner`]s and detectors the checks run on are kept in a pool
+//! shared by the clones of one `AsyncScanner`, so their buffers are set up
+//! once per concurrent check instead of once per request. Every verdict is
+//! the one [`Scanner::detect`] or [`StreamingDetector::finish`] gives.
+//!
+//! Enabled by the `async` feature.
+
+use std::error::Error as StdError;
+use std::fmt;
+use std::future::Future;
+use std::pin::{pin, Pin};
+use std::sync::atomic::{AtomicBool, Ordering};
+use std::sync::{Arc, Mutex, MutexGuard, PoisonError};
+use std::task::{Context, Poll};
+use std::thread;
+
+use bytes::{Buf, Bytes};
+use http::{Request, Response, StatusCode};
+use http_body::Body;
+use http_body_util::{BodyExt, Full};
+use tokio::sync::Semaphore;
+use tower_layer::Layer;
+use tower_service::Service;
+
+use crate::sqli::{ScanLimits, SqliFlags};
+use crate::stream::{StreamVerdict, StreamingDetector};
+use crate::{xss_result, DetectionResult, Scanner};
+
+/// Error type of the boxed errors tower services pass around
+pub type BoxError = Box<dyn StdError + Send + Sync>;
+
+// Inputs up to this long are checked on the calling task by default
+const DEFAULT_INLINE_LIMIT: usize = 16 * 1024;
+// Idle scanners and detectors kept per pool
+const MAX_IDLE: usize = 256;
+// Detectors that buffered more than this are not pooled, so one huge body
+// does not pin its buffer for good
+const MAX_POOLED_BUFFER: usize = 1024 * 1024;
+
+/// Why an async check produced no verdict
+#[derive(Debug)]
+pub enum Error {
+    /// Reading the body failed
+    Body(BoxError),
+    /// The offloaded check did not complete: its thread panicked or the
+    /// runtime is shutting down
+    Offload,
+}
+
+impl fmt::Display for Error {
+    fn fmt(&self, f: &mut fmt::Formatter<'_>) -> fmt::Result {
+        match self {
+            Error::Body(err) => write!(f, "Reading the body failed: {}", err),
+            Error::Offload => write!(f, "Offloaded check did not complete"),
+        }
+    }
+}
+
+impl StdError for Error {
+    fn source(&self) -> Option<&(dyn StdError + 'static)> {
+        match self {
+            Error::Body(err) => Some(err.as_ref()),
+            Error::Offload => None,
+        }
+    }
+}
+
+/// Outcome of [`AsyncScanner::scan_body`]
+#[derive(Debug, Clone, PartialEq)]
+pub enum BodyScan {
+    /// The whole body, checked and found clean
+    Clean(Bytes),
+    /// An injection, found before or at the end of the body
+    Injection(DetectionResult),
+    /// The body is longer than the limit; it was not read past it
+    TooLarge,
+}
+
+/// Runs [`Scanner::detect`] from async code, offloading long inputs
+///
+/// Cloning is cheap; the clones share one pool of scanners and one limit
+/// on offloaded checks.
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::middleware::AsyncScanner;
+///
+/// # fn main() -> Result<(), Box<dyn std::error::Error>> {
+/// let runtime = tokio::runtime::Builder::new_current_thread().build()?;
+/// let scanner = AsyncScanner::new().with_inline_limit(1024);
+///
+/// runtime.block_on(async {
+///     // Checked on this task
+///     assert!(scanner.detect(&b"1' OR '1'='1"[..]).await?.is_injection());
+///     // Checked on a blocking thread
+///     let body = b"q=hello ".repeat(1000);
+///     assert!(!scanner.detect(body).await?.is_injection());
+///     Ok(())
+/// })
+/// # }
+/// ```
+#[derive(Clone)]
+pub struct AsyncScanner {
+    inline_limit: usize,
+    // One permit per offloaded check allowed to run at once
+    blocking: Arc<Semaphore>,
+    pools: Arc<Pools>,
+}
+
+impl AsyncScanner {
+    /// Creates a scanner with the default SQLi flags that checks inputs up
+    /// to 16 KiB inline and offloads one check per available core at once
+    pub fn new() -> Self {
+        AsyncScanner {
+            inline_limit: DEFAULT_INLINE_LIMIT,
+            blocking: Arc::new(Semaphore::new(thread::available_parallelism().map_or(1, |n| n.get()))),
+            pools: Arc::new(Pools::new(SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED)),
+        }
+    }
+
+    /// Checks inputs up to `bytes` long on the calling task
+    pub fn with_inline_limit(mut self, bytes: usize) -> Self {
+        self.inline_limit = bytes;
+        self
+    }
+
+    /// Runs at most `jobs` offloaded checks at once, at least one
+    pub fn with_blocking_jobs(mut self, jobs: usize) -> Self {
+        self.blocking = Arc::new(Semaphore::new(jobs.max(1)));
+        self
+    }
+
+    /// Uses `flags` for SQLi detection, like `detect_sqli_with_flags`
+    pub fn with_sqli_flags(mut self, flags: SqliFlags) -> Self {
+        self.pools = Arc::new(Pools::new(flags, self.pools.limits));
+        self
+    }
+
+    /// Bounds the SQLi work done per value, see [`ScanLimits`]. Bodies are
+    /// checked whole.
+    pub fn with_limits(mut self, limits: ScanLimits) -> Self {
+        self.pools = Arc::new(Pools::new(self.pools.sqli_flags, limits));
+        self
+    }
+
+    /// Inputs up to this long are checked on the calling task
+    pub fn inline_limit(&self) -> usize {
+        self.inline_limit
+    }
+
+    /// Checks one value for both detectors, as [`Scanner::detect`] does
+    pub async fn detect(&self, input: impl Into<Bytes>) -> Result<DetectionResult, Error> {
+        let input = input.into();
+        if input.len() <= self.inline_limit {
+            let mut scanner = self.pools.scanner();
+            let result = scanner.detect(&input);
+            self.pools.put_scanner(scanner);
+            return Ok(result);
+        }
+        let pools = Arc::clone(&self.pools);
+        self.offload(move |cancelled| {
+            if cancelled.load(Ordering::Relaxed) {
+                return None;
+            }
+            let mut scanner = pools.scanner();
+            let result = scanner.detect_unless(&input, || cancelled.load(Ordering::Relaxed));
+            pools.put_scanner(scanner);
+            result
+        })
+        .await
+    }
+
+    /// Starts checking an input that arrives in chunks
+    pub fn stream(&self) -> AsyncStream {
+        AsyncStream { scanner: self.clone(), detector: Some(self.pools.stream()) }
+    }
+
+    // Stream detectors waiting in the pool
+    #[cfg(test)]
+    pub(crate) fn idle_streams(&self) -> usize {
+        lock(&self.pools.streams).len()
+    }
+
+    /// Reads `body` frame by frame into a stream check. Stops at the first
+    /// injection it proves, or once the body is over `max_len` bytes.
+    pub async fn scan_body<B>(&self, body: B, max_len: usize) -> Result<BodyScan, Error>
+    where
+        B: Body,
+        B::Error: Into<BoxError>,
+    {
+        let mut body = pin!(body);
+        let mut stream = self.stream();
+        loop {
+            let frame = match body.frame().await {
+                Some(frame) => frame.map_err(|err| Error::Body(err.into()))?,
+                None => break,
+            };
+            let Ok(mut data) = frame.into_data() else {
+                // Trailers are not checked
+                continue;
+            };
+            let chunk = data.copy_to_bytes(data.remaining());
+            if stream.buffered_len().saturating_add(chunk.len()) > max_len {
+                return Ok(BodyScan::TooLarge);
+            }
+            if let Some(result) = stream.feed(chunk).await? {
+                return Ok(BodyScan::Injection(result));
+            }
+        }
+        let (verdict, body) = stream.finish_with_body().await?;
+        Ok(match body {
+            Some(body) => BodyScan::Clean(body),
+            None => BodyScan::Injection(injection(&verdict)),
+        })
+    }
+
+    // Runs `job` on a blocking thread once a slot is free. The job is told
+    // through its flag when the caller has gone away, and runs even then,
+    // so it can pool the state it owns; `None` from it means it gave up.
+    async fn offload<R, F>(&self, job: F) -> Result<R, Error>
+    where
+        R: Send + 'static,
+        F: FnOnce(&AtomicBool) -> Option<R> + Send + 'static,
+    {
+        let job = PendingJob(Some(job));
+        let permit = Arc::clone(&self.blocking).acquire_owned().await.map_err(|_| Error::Offload)?;
+        let cancelled = Arc::new(AtomicBool::new(false));
+        let _cancel_on_drop = CancelOnDrop(Arc::clone(&cancelled));
+        let task = tokio::task::spawn_blocking(move || {
+            let _permit = permit;
+            job.run(&cancelled)
+        });
+        task.await.ok().flatten().ok_or(Error::Offload)
+    }
+}
+
+impl Default for AsyncScanner {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// A [`StreamingDetector`] fed from async code, see [`AsyncScanner::stream`]
+///
+/// Each step runs on the calling task unless it would scan more than the
+/// scanner's inline limit, and on a blocking thread then. Most feeds only
+/// scan their chunk; the ones that rerun the early SQLi check over the
+/// buffered input, as it doubles, and `finish` scan it all. Dropping the
+/// stream returns its detector to the pool.
+pub struct AsyncStream {
+    scanner: AsyncScanner,
+    // Away while an offloaded step has it; gone if that step did not return
+    detector: Option<StreamingDetector>,
+}
+
+impl AsyncStream {
+    /// Appends a chunk of input. Returns the injection found so far, if
+    /// any, as [`StreamingDetector::feed`] does.
+    pub async fn feed(&mut self, chunk: impl Into<Bytes>) -> Result<Option<DetectionResult>, Error> {
+        let chunk = chunk.into();
+        let mut detector = self.detector.take().ok_or(Error::Offload)?;
+        if detector.feed_work(chunk.len()) <= self.scanner.inline_limit {
+            let found = detector.feed(&chunk);
+            self.detector = Some(detector);
+            return Ok(found);
+        }
+        let pools = Arc::clone(&self.scanner.pools);
+        let (detector, found) = self
+            .scanner
+            .offload(move |cancelled| {
+                if cancelled.load(Ordering::Relaxed) {
+                    pools.put_stream(detector);
+                    return None;
+                }
+                let found = detector.feed(&chunk);
+                Some((detector, found))
+            })
+            .await?;
+        self.detector = Some(detector);
+        Ok(found)
+    }
+
+    /// Bytes fed so far
+    pub fn buffered_len(&self) -> usize {
+        self.detector.as_ref().map_or(0, |detector| detector.buffered().len())
+    }
+
+    /// Ends the input and returns the final verdicts
+    pub async fn finish(self) -> Result<StreamVerdict, Error> {
+        self.finish_then(|_, _| ()).await.map(|(verdict, ())| verdict)
+    }
+
+    // `finish`, also handing over the detector's buffer of a clean input
+    async fn finish_with_body(self) -> Result<(StreamVerdict, Option<Bytes>), Error> {
+        self.finish_then(|verdict, detector| {
+            (!verdict.is_injection()).then(|| Bytes::from(detector.take_buffer()))
+        })
+        .await
+    }
+
+    // Finishes, runs `after` on the verdict and finished detector, and pools it
+    async fn finish_then<T, F>(mut self, after: F) -> Result<(StreamVerdict, T), Error>
+    where
+        T: Send + 'static,
+        F: FnOnce(&StreamVerdict, &mut StreamingDetector) -> T + Send + 'static,
+    {
+        let mut detector = self.detector.take().ok_or(Error::Offload)?;
+        let inline = detector.finish_work() <= self.scanner.inline_limit;
+        let pools = Arc::clone(&self.scanner.pools);
+        let finish = move |cancelled: &AtomicBool| {
+            let done = (!cancelled.load(Ordering::Relaxed)).then(|| {
+                let verdict = detector.finish();
+                let extra = after(&verdict, &mut detector);
+                (verdict, extra)
+            });
+            pools.put_stream(detector);
+            done
+        };
+        if inline {
+            return finish(&AtomicBool::new(false)).ok_or(Error::Offload);
+        }
+        self.scanner.offload(finish).await
+    }
+}
+
+impl Drop for AsyncStream {
+    fn drop(&mut self) {
+        if let Some(detector) = self.detector.take() {
+            self.scanner.pools.put_stream(detector);
+        }
+    }
+}
+
+/// Tower layer that checks request bodies before the wrapped service sees
+/// them, see [`InjectionService`]
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::middleware::{AsyncScanner, InjectionLayer};
+/// use tower_layer::Layer;
+/// # #[derive(Clone)]
+/// # struct Backend;
+///
+/// let layer = InjectionLayer::new(AsyncScanner::new()).with_max_body(4 * 1024 * 1024);
+/// let service = layer.layer(Backend);
+/// ```
+#[derive(Clone)]
+pub struct InjectionLayer {
+    scanner: AsyncScanner,
+    max_body: usize,
+}
+
+impl InjectionLayer {
+    /// Creates a layer that checks bodies with `scanner`, of any length
+    pub fn new(scanner: AsyncScanner) -> Self {
+        InjectionLayer { scanner, max_body: usize::MAX }
+    }
+
+    /// Answers requests with bodies over `bytes` with 413 Payload Too Large
+    pub fn with_max_body(mut self, bytes: usize) -> Self {
+        self.max_body = bytes;
+        self
+    }
+}
+
+impl<S> Layer<S> for InjectionLayer {
+    type Service = InjectionService<S>;
+
+    fn layer(&self, inner: S) -> Self::Service {
+        InjectionService { inner, scanner: self.scanner.clone(), max_body: self.max_body }
+    }
+}
+
+/// Tower service that checks each request body before passing it on
+///
+/// The body is read and checked frame by frame, then handed to the wrapped
+/// service whole. A request whose body is an injection is answered with 403
+/// Forbidden, with the [`DetectionResult`] in the response's extensions,
+/// without reading the rest of the body or calling the wrapped service.
+#[derive(Clone)]
+pub struct InjectionService<S> {
+    inner: S,
+    scanner: AsyncScanner,
+    max_body: usize,
+}
+
+impl<S, ReqBody, ResBody> Service<Request<ReqBody>> for InjectionService<S>
+where
+    S: Service<Request<Full<Bytes>>, Response = Response<ResBody>> + Clone + Send + 'static,
+    S::Future: Send,
+    S::Error: Into<BoxError>,
+    ReqBody: Body + Send + 'static,
+    ReqBody::Data: Send,
+    ReqBody::Error: Into<BoxError>,
+    ResBody: Default,
+{
+    type Response = Response<ResBody>;
+    type Error = BoxError;
+    type Future = Pin<Box<dyn Future<Output = Result<Response<ResBody>, BoxError>> + Send>>;
+
+    fn poll_ready(&mut self, cx: &mut Context<'_>) -> Poll<Result<(), BoxError>> {
+        self.inner.poll_ready(cx).map_err(Into::into)
+    }
+
+    fn call(&mut self, request: Request<ReqBody>) -> Self::Future {
+        // Call the instance that was polled ready, and leave a fresh clone
+        let clone = self.inner.clone();
+        let mut inner = std::mem::replace(&mut self.inner, clone);
+        let scanner = self.scanner.clone();
+        let max_body = self.max_body;
+        Box::pin(async move {
+            let (parts, body) = request.into_parts();
+            let body = match scanner.scan_body(body, max_body).await? {
+                BodyScan::Clean(body) => body,
+                BodyScan::Injection(result) => {
+                    let mut response = rejection(StatusCode::FORBIDDEN);
+                    response.extensions_mut().insert(result);
+                    return Ok(response);
+                }
+                BodyScan::TooLarge => return Ok(rejection(StatusCode::PAYLOAD_TOO_LARGE)),
+            };
+            inner.call(Request::from_parts(parts, Full::new(body))).await.map_err(Into::into)
+        })
+    }
+}
+
+fn rejection<B: Default>(status: StatusCode) -> Response<B> {
+    let mut response = Response::new(B::default());
+    *response.status_mut() = status;
+    response
+}
+
+// The result `Scanner::detect` would give for an input with these verdicts
+fn injection(verdict: &StreamVerdict) -> DetectionResult {
+    if verdict.xss.is_injection() && !verdict.sqli.is_injection() {
+        xss_result()
+    } else {
+        verdict.sqli.clone()
+    }
+}
+
+// Tells an offloaded job its caller has gone away
+struct CancelOnDrop(Arc<AtomicBool>);
+
+impl Drop for CancelOnDrop {
+    fn drop(&mut self) {
+        self.0.store(true, Ordering::Relaxed);
+    }
+}
+
+// An offloaded job until it runs. Dropped unrun, because its caller went
+// away while it waited for a slot or it never reached a blocking thread, it
+// runs on the spot with its flag set, which only returns its state to the
+// pool.
+struct PendingJob<R, F: FnOnce(&AtomicBool) -> Option<R>>(Option<F>);
+
+impl<R, F: FnOnce(&AtomicBool) -> Option<R>> PendingJob<R, F> {
+    fn run(mut self, cancelled: &AtomicBool) -> Option<R> {
+        self.0.take().and_then(|job| job(cancelled))
+    }
+}
+
+impl<R, F: FnOnce(&AtomicBool) -> Option<R>> Drop for PendingJob<R, F> {
+    fn drop(&mut self) {
+        if let Some(job) = self.0.take() {
+            job(&AtomicBool::new(true));
+        }
+    }
+}
+
+// Idle scanners and stream detectors, shared by the clones of a scanner
+struct Pools {
+    sqli_flags: SqliFlags,
+    limits: ScanLimits,
+    scanners: Mutex<Vec<Scanner<'static>>>,
+    streams: Mutex<Vec<StreamingDetector>>,
+}
+
+impl Pools {
+    fn new(sqli_flags: SqliFlags, limits: ScanLimits) -> Self {
+        Pools { sqli_flags, limits, scanners: Mutex::new(Vec::new()), streams: Mutex::new(Vec::new()) }
+    }
+
+    fn scanner(&self) -> Scanner<'static> {
+        lock(&self.scanners)
+            .pop()
+            .unwrap_or_else(|| Scanner::with_sqli_flags(self.sqli_flags).with_limits(self.limits))
+    }
+
+    fn put_scanner(&self, scanner: Scanner<'static>) {
+        let mut idle = lock(&self.scanners);
+        if idle.len() < MAX_IDLE {
+            idle.push(scanner);
+        }
+    }
+
+    fn stream(&self) -> StreamingDetector {
+        lock(&self.streams).pop().unwrap_or_else(|| StreamingDetector::with_sqli_flags(self.sqli_flags))
+    }
+
+    fn put_stream(&self, mut detector: StreamingDetector) {
+        if detector.buffered().len() > MAX_POOLED_BUFFER {
+            return;
+        }
+        detector.reset();
+        let mut idle = lock(&self.streams);
+        if idle.len() < MAX_IDLE {
+            idle.push(detector);
+        }
+    }
+}
+
+fn lock<T>(idle: &Mutex<T>) -> MutexGuard<'_, T> {
+    idle.lock().unwrap_or_else(PoisonError::into_inner)
+}
@@ -0,0 +1,448 @@
+//! Custom keyword, fingerprint and XSS name tables on top of the built-in ones
+//!
+//! [`RuleOverlay`] collects additions to and removals from the built-in
+//! tables: SQL keywords and their token types, blacklisted SQLi
+//! fingerprints, and blacklisted XSS tags and attributes. It compiles them
+//! into perfect hashes of the same kind build.rs generates for the built-in
+//! tables, written out as one compact byte blob.
+//!
+//! [`Rules`] reads such a blob in place. Opening one only checks its header,
+//! and lookups read the blob directly, so a blob compiled once can be
+//! memory-mapped by every worker process and shared read-only between them.
+//! The blob has no alignment requirements.
+//!
+//! A lookup tries the overlay first and falls back to the built-in table,
+//! so an overlay entry replaces the built-in one for the same name. Names
+//! are matched ignoring ASCII case, as the built-in tables match them.
+//!
+//! # Examples
+//!
+//! ```
+//! use libinjectionrs::overlay::{RuleOverlay, Rules};
+//! use libinjectionrs::sqli::TokenType;
+//! use libinjectionrs::{Scanner, SqliFlags, SqliState};
+//!
+//! # fn main() -> Result<(), libinjectionrs::Error> {
+//! let blob = RuleOverlay::new()
+//!     .with_keyword("send_mail", TokenType::Function)
+//!     .with_xss_tag("marquee")
+//!     .to_bytes()?;
+//! let rules = Rules::from_bytes(&blob)?;
+//! assert_eq!(rules.lookup_word(b"SEND_MAIL"), TokenType::Function);
+//!
+//! let mut state = SqliState::new(b"1 and send_mail(5)", SqliFlags::FLAG_NONE).with_rules(&rules);
+//! assert!(state.detect());
+//!
+//! // A scanner borrows its rules for as long as it lives
+//! let mut scanner = Scanner::new().with_rules(&rules);
+//! assert!(scanner.detect(b"<marquee onstart=x>").is_injection());
+//! # Ok(())
+//! # }
+//! ```
+
+#[cfg(not(feature = "std"))]
+use alloc::{collections::BTreeMap, vec::Vec};
+#[cfg(feature = "std")]
+use std::collections::BTreeMap;
+
+use crate::phf;
+use crate::sqli::{sqli_data, TokenType};
+use crate::xss::AttributeType;
+use crate::{Error, ParseError};
+
+/// Longest XSS tag or attribute name an overlay can hold
+pub const MAX_XSS_NAME_LEN: usize = 64;
+
+// Blob layout, all integers little-endian:
+//   magic, version (u32), then one header per table:
+//     seed (u64), longest key (u32), buckets (u32), displacements offset (u32),
+//     slots (u32), slots offset (u32)
+//   then per table its displacement pairs (2 x u32), its keys, and its slots:
+//     key offset (u32), key length (u16), value (u8), zero (u8)
+const MAGIC: [u8; 4] = *b"LJRO";
+const VERSION: u32 = 1;
+const TABLES: usize = 4;
+const TABLE_HEADER_LEN: usize = 28;
+const HEADER_LEN: usize = 8 + TABLES * TABLE_HEADER_LEN;
+const DISP_LEN: usize = 8;
+const SLOT_LEN: usize = 8;
+
+// The tables, in blob order. Word values are token type codes as in the
+// built-in keyword table; fingerprint and tag values are 1 for listed and 0
+// for removed; attribute values are attribute type codes.
+const WORDS: usize = 0;
+const FINGERPRINTS: usize = 1;
+const TAGS: usize = 2;
+const ATTRS: usize = 3;
+
+/// Additions to and removals from the built-in tables, to compile with
+/// [`to_bytes`](Self::to_bytes)
+///
+/// Later entries for a name replace earlier ones.
+#[derive(Debug, Clone, Default)]
+pub struct RuleOverlay {
+    // Keyed by the uppercase name
+    tables: [BTreeMap<Vec<u8>, u8>; TABLES],
+    // First invalid entry, reported by to_bytes
+    invalid: Option<&'static str>,
+}
+
+impl RuleOverlay {
+    /// Creates an empty overlay
+    pub fn new() -> Self {
+        Self::default()
+    }
+
+    /// Classifies `word` as `token_type`, which must be one of the types
+    /// the keyword table holds: `Keyword`, `Function`, `Union`, `Group`,
+    /// `Expression`, `SqlType`, `Tsql`, `Operator`, `LogicOperator`,
+    /// `Collate`, `Variable`, `Number` or `Bareword`. Multi-word keywords
+    /// such as `"UNION ALL"` take one space between the words.
+    pub fn with_keyword(self, word: &str, token_type: TokenType) -> Self {
+        match word_code(token_type) {
+            Some(code) => self.insert(WORDS, word.as_bytes(), code),
+            None => self.invalid("keyword token type is not a word type"),
+        }
+    }
+
+    /// Makes `word` a plain bareword, even if it is a built-in keyword
+    pub fn without_keyword(self, word: &str) -> Self {
+        self.with_keyword(word, TokenType::Bareword)
+    }
+
+    /// Blacklists the SQLi fingerprint `fingerprint`, as
+    /// `Fingerprint::as_str` spells it (at most 8 token types)
+    pub fn with_fingerprint(self, fingerprint: &str) -> Self {
+        self.insert_fingerprint(fingerprint, 1)
+    }
+
+    /// Takes the SQLi fingerprint `fingerprint` off the blacklist
+    pub fn without_fingerprint(self, fingerprint: &str) -> Self {
+        self.insert_fingerprint(fingerprint, 0)
+    }
+
+    /// Blacklists the XSS tag `name`
+    pub fn with_xss_tag(self, name: &str) -> Self {
+        self.insert_xss_name(TAGS, name, 1)
+    }
+
+    /// Takes the XSS tag `name` off the blacklist. Tags starting with `svg`
+    /// or `xsl` are flagged whatever the tables hold.
+    pub fn without_xss_tag(self, name: &str) -> Self {
+        self.insert_xss_name(TAGS, name, 0)
+    }
+
+    /// Gives the attribute `name` the type `atype`. Event handlers are
+    /// listed with their `on` prefix.
+    pub fn with_xss_attribute(self, name: &str, atype: AttributeType) -> Self {
+        self.insert_xss_name(ATTRS, name, attribute_code(atype))
+    }
+
+    /// Makes the attribute `name` harmless, even if it is on the built-in
+    /// blacklist. Attributes starting with `xmlns` or `xlink` are flagged
+    /// whatever the tables hold.
+    pub fn without_xss_attribute(self, name: &str) -> Self {
+        self.with_xss_attribute(name, AttributeType::None)
+    }
+
+    /// Compiles the overlay into a blob for [`Rules::from_bytes`]
+    pub fn to_bytes(&self) -> Result<Vec<u8>, Error> {
+        if let Some(message) = self.invalid {
+            return Err(Error::InvalidInput(message));
+        }
+
+        let mut out = Vec::new();
+        out.extend_from_slice(&MAGIC);
+        out.extend_from_slice(&VERSION.to_le_bytes());
+        out.resize(HEADER_LEN, 0);
+
+        for (index, table) in self.tables.iter().enumerate() {
+            let entries: Vec<(&[u8], u8)> = table.iter().map(|(name, &value)| (name.as_slice(), value)).collect();
+            let keys: Vec<&[u8]> = entries.iter().map(|&(name, _)| name).collect();
+            let (seed, disps, slots) = phf::build(&keys).ok_or(Error::InvalidInput("too many entries in one table"))?;
+            let max_key_len = keys.iter().map(|key| key.len()).max().unwrap_or(0);
+
+            let disps_off = out.len();
+            for (d1, d2) in &disps {
+                out.extend_from_slice(&d1.to_le_bytes());
+                out.extend_from_slice(&d2.to_le_bytes());
+            }
+            let mut key_offs = Vec::with_capacity(keys.len());
+            for key in &keys {
+                key_offs.push(blob_u32(out.len())?);
+                out.extend_from_slice(key);
+            }
+            let slots_off = out.len();
+            for &slot in &slots {
+                let key = usize::from(slot);
+                let (Some(&key_off), Some(&(name, value))) = (key_offs.get(key), entries.get(key)) else {
+                    return Err(Error::InvalidInput("perfect hash slot out of range"));
+                };
+                let key_len = u16::try_from(name.len()).map_err(|_| Error::InvalidInput("name too long"))?;
+                out.extend_from_slice(&key_off.to_le_bytes());
+                out.extend_from_slice(&key_len.to_le_bytes());
+                out.extend_from_slice(&[value, 0]);
+            }
+
+            let header = [
+                blob_u32(max_key_len)?,
+                blob_u32(disps.len())?,
+                blob_u32(disps_off)?,
+                blob_u32(slots.len())?,
+                blob_u32(slots_off)?,
+            ];
+            let at = 8 + index * TABLE_HEADER_LEN;
+            out[at..at + 8].copy_from_slice(&seed.to_le_bytes());
+            for (i, field) in header.iter().enumerate() {
+                let field_at = at + 8 + i * 4;
+                out[field_at..field_at + 4].copy_from_slice(&field.to_le_bytes());
+            }
+        }
+        Ok(out)
+    }
+
+    fn insert(mut self, table: usize, name: &[u8], value: u8) -> Self {
+        if name.is_empty() || name.contains(&0) {
+            return self.invalid("names must be non-empty and free of NUL bytes");
+        }
+        if let Some(table) = self.tables.get_mut(table) {
+            table.insert(name.to_ascii_uppercase(), value);
+        }
+        self
+    }
+
+    fn insert_fingerprint(self, fingerprint: &str, value: u8) -> Self {
+        if fingerprint.len() > 8 {
+            return self.invalid("fingerprints are at most 8 token types");
+        }
+        self.insert(FINGERPRINTS, fingerprint.as_bytes(), value)
+    }
+
+    fn insert_xss_name(self, table: usize, name: &str, value: u8) -> Self {
+        if name.len() > MAX_XSS_NAME_LEN {
+            return self.invalid("XSS names are at most MAX_XSS_NAME_LEN bytes");
+        }
+        self.insert(table, name.as_bytes(), value)
+    }
+
+    fn invalid(mut self, message: &'static str) -> Self {
+        self.invalid.get_or_insert(message);
+        self
+    }
+}
+
+/// Compiled overlay tables, read in place from a blob made by
+/// [`RuleOverlay::to_bytes`]
+#[derive(Debug, Clone, Copy)]
+pub struct Rules<'a> {
+    bytes: &'a [u8],
+    tables: [Table; TABLES],
+}
+
+#[derive(Debug, Clone, Copy)]
+struct Table {
+    seed: u64,
+    max_key_len: usize,
+    buckets: usize,
+    disps_off: usize,
+    slots: usize,
+    slots_off: usize,
+}
+
+impl Table {
+    const EMPTY: Table = Table { seed: 0, max_key_len: 0, buckets: 0, disps_off: 0, slots: 0, slots_off: 0 };
+}
+
+impl<'a> Rules<'a> {
+    /// Opens a blob. Checks the header and that every table lies within
+    /// the blob; a blob that passes but was not made by `to_bytes` gives
+    /// wrong verdicts, never a panic.
+    pub fn from_bytes(bytes: &'a [u8]) -> Result<Self, Error> {
+        if bytes.get(..MAGIC.len()) != Some(&MAGIC[..]) {
+            return Err(parse_error("not a rule overlay", 0));
+        }
+        if read_u32(bytes, 4) != Some(VERSION) {
+            return Err(parse_error("unsupported rule overlay version", 4));
+        }
+
+        let mut tables = [Table::EMPTY; TABLES];
+        for (index, table) in tables.iter_mut().enumerate() {
+            let at = 8 + index * TABLE_HEADER_LEN;
+            *table = read_table(bytes, at).ok_or(parse_error("rule overlay table out of bounds", at))?;
+        }
+        Ok(Rules { bytes, tables })
+    }
+
+    /// The blob these rules read
+    pub fn as_bytes(&self) -> &'a [u8] {
+        self.bytes
+    }
+
+    /// Classifies a SQL word: the overlay's type if it lists the word,
+    /// otherwise the built-in one
+    pub fn lookup_word(&self, word: &[u8]) -> TokenType {
+        match self.find(WORDS, word) {
+            Some(code) => word_type(code),
+            None => sqli_data::lookup_word_bytes(word),
+        }
+    }
+
+    /// Checks a raw, NUL-padded fingerprint against the blacklist with the
+    /// overlay's additions and removals
+    pub fn is_blacklisted_fingerprint(&self, fingerprint: &[u8; 8]) -> bool {
+        let len = fingerprint.iter().position(|&b| b == 0).unwrap_or(8);
+        match self.find(FINGERPRINTS, &fingerprint[..len]) {
+            Some(listed) => listed != 0,
+            None => sqli_data::is_blacklisted_fingerprint(fingerprint),
+        }
+    }
+
+    /// The overlay's verdict on a tag name, if it lists the tag
+    pub(crate) fn xss_tag(&self, name: &[u8]) -> Option<bool> {
+        self.find_xss_name(TAGS, name).map(|listed| listed != 0)
+    }
+
+    /// The overlay's type for an attribute name, if it lists the attribute
+    pub(crate) fn xss_attribute(&self, name: &[u8]) -> Option<AttributeType> {
+        self.find_xss_name(ATTRS, name).map(attribute_type)
+    }
+
+    // XSS names are matched with NUL bytes skipped, like the built-in ones
+    fn find_xss_name(&self, table: usize, name: &[u8]) -> Option<u8> {
+        if !name.contains(&0) {
+            return self.find(table, name);
+        }
+        let mut buf = [0u8; MAX_XSS_NAME_LEN];
+        let mut len = 0;
+        for &b in name.iter().filter(|&&b| b != 0) {
+            *buf.get_mut(len)? = b;
+            len += 1;
+        }
+        self.find(table, buf.get(..len)?)
+    }
+
+    fn find(&self, table: usize, key: &[u8]) -> Option<u8> {
+        let table = self.tables.get(table)?;
+        if key.len() > table.max_key_len {
+            return None;
+        }
+        let disp = |bucket: usize| {
+            let at = table.disps_off.checked_add(bucket.checked_mul(DISP_LEN)?)?;
+            Some((read_u32(self.bytes, at)?, read_u32(self.bytes, at.checked_add(4)?)?))
+        };
+        let slot = phf::slot_by(key, table.seed, table.buckets, disp, table.slots)?;
+
+        let at = table.slots_off.checked_add(slot.checked_mul(SLOT_LEN)?)?;
+        let key_off = read_u32(self.bytes, at)? as usize;
+        let key_len = usize::from(u16::from_le_bytes(self.bytes.get(at + 4..at + 6)?.try_into().ok()?));
+        let value = *self.bytes.get(at + 6)?;
+        let name = self.bytes.get(key_off..key_off.checked_add(key_len)?)?;
+        name.eq_ignore_ascii_case(key).then_some(value)
+    }
+}
+
+// `Rules::lookup_word` if there are rules, the built-in lookup otherwise
+#[inline]
+pub(crate) fn lookup_word(rules: Option<&Rules<'_>>, word: &[u8]) -> TokenType {
+    match rules {
+        Some(rules) => rules.lookup_word(word),
+        None => sqli_data::lookup_word_bytes(word),
+    }
+}
+
+// `Rules::is_blacklisted_fingerprint` if there are rules, the built-in
+// blacklist otherwise
+#[inline]
+pub(crate) fn is_blacklisted_fingerprint(rules: Option<&Rules<'_>>, fingerprint: &[u8; 8]) -> bool {
+    match rules {
+        Some(rules) => rules.is_blacklisted_fingerprint(fingerprint),
+        None => sqli_data::is_blacklisted_fingerprint(fingerprint),
+    }
+}
+
+fn read_table(bytes: &[u8], at: usize) -> Option<Table> {
+    let field = |i: usize| read_u32(bytes, at + 8 + i * 4).map(|value| value as usize);
+    let table = Table {
+        seed: u64::from_le_bytes(bytes.get(at..at + 8)?.try_into().ok()?),
+        max_key_len: field(0)?,
+        buckets: field(1)?,
+        disps_off: field(2)?,
+        slots: field(3)?,
+        slots_off: field(4)?,
+    };
+    let disps_end = table.disps_off.checked_add(table.buckets.checked_mul(DISP_LEN)?)?;
+    let slots_end = table.slots_off.checked_add(table.slots.checked_mul(SLOT_LEN)?)?;
+    let in_bounds = disps_end <= bytes.len() && slots_end <= bytes.len();
+    (in_bounds && (table.buckets == 0) == (table.slots == 0)).then_some(table)
+}
+
+fn read_u32(bytes: &[u8], at: usize) -> Option<u32> {
+    Some(u32::from_le_bytes(bytes.get(at..at.checked_add(4)?)?.try_into().ok()?))
+}
+
+fn blob_u32(value: usize) -> Result<u32, Error> {
+    u32::try_from(value).map_err(|_| Error::InvalidInput("rule overlay over 4 GiB"))
+}
+
+fn parse_error(message: &'static str, position: usize) -> Error {
+    Error::ParseError(ParseError { message, position })
+}
+
+// Token type codes, as the built-in keyword table stores them
+fn word_code(token_type: TokenType) -> Option<u8> {
+    match token_type {
+        TokenType::Keyword
+        | TokenType::Function
+        | TokenType::Union
+        | TokenType::Group
+        | TokenType::Expression
+        | TokenType::SqlType
+        | TokenType::Tsql
+        | TokenType::Operator
+        | TokenType::LogicOperator
+        | TokenType::Collate
+        | TokenType::Variable
+        | TokenType::Number
+        | TokenType::Bareword => Some(token_type.to_char() as u8),
+        _ => None,
+    }
+}
+
+// The inverse of word_code, matching the built-in lookup_word_bytes
+fn word_type(code: u8) -> TokenType {
+    match code {
+        b'k' => TokenType::Keyword,
+        b'f' => TokenType::Function,
+        b'U' => TokenType::Union,
+        b'E' => TokenType::Expression,
+        b'T' => TokenType::Tsql,
+        b't' => TokenType::SqlType,
+        b'o' => TokenType::Operator,
+        b'&' => TokenType::LogicOperator,
+        b'v' => TokenType::Variable,
+        b'1' => TokenType::Number,
+        b'A' => TokenType::Collate,
+        b'B' => TokenType::Group,
+        _ => TokenType::Bareword,
+    }
+}
+
+fn attribute_code(atype: AttributeType) -> u8 {
+    match atype {
+        AttributeType::None => 0,
+        AttributeType::Black => 1,
+        AttributeType::AttrUrl => 2,
+        AttributeType::Style => 3,
+        AttributeType::AttrIndirect => 4,
+    }
+}
+
+fn attribute_type(code: u8) -> AttributeType {
+    match code {
+        1 => AttributeType::Black,
+        2 => AttributeType::AttrUrl,
+        3 => AttributeType::Style,
+        4 => AttributeType::AttrIndirect,
+        _ => AttributeType::None,
+    }
+}
@@ -0,0 +1,191 @@
+//! Parallel detection over large record sets
+//!
+//! For offline work such as replaying access logs, [`ParallelScanner`]
+//! spreads records over a pool of scoped threads. The records are cut into
+//! fixed-size chunks that idle threads claim one at a time, from a shared
+//! counter over a slice or straight from a shared iterator, so a thread
+//! stuck on a run of long records does not hold up the others. Each thread
+//! runs its own [`Scanner`], and the results come back in input order
+//! whatever order the chunks finished in.
+//!
+//! Enabled by the `parallel` feature.
+
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Mutex, PoisonError};
+use std::thread;
+
+pub use crate::records::split_lines;
+use crate::sqli::{ScanLimits, SqliFlags};
+use crate::{DetectionResult, Scanner};
+
+// Records claimed by a thread at a time
+const CHUNK_RECORDS: usize = 512;
+
+// Results of one chunk, tagged with the chunk's index
+type Part = (usize, Vec<DetectionResult>);
+
+/// Runs [`Scanner::detect`] over many records on all cores
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::parallel::ParallelScanner;
+///
+/// let log = b"id=1\nid=1' OR '1'='1\nq=<script>alert(1)</script>\n";
+/// let results = ParallelScanner::new().with_threads(2).scan_lines(log);
+///
+/// let flagged: Vec<bool> = results.iter().map(|result| result.is_injection()).collect();
+/// assert_eq!(flagged, [false, true, true]);
+/// ```
+#[derive(Debug, Clone)]
+pub struct ParallelScanner {
+    threads: usize,
+    sqli_flags: SqliFlags,
+    limits: ScanLimits,
+}
+
+impl ParallelScanner {
+    /// Creates a scanner with one thread per available core and the default
+    /// SQLi flags
+    pub fn new() -> Self {
+        ParallelScanner {
+            threads: thread::available_parallelism().map_or(1, |n| n.get()),
+            sqli_flags: SqliFlags::FLAG_NONE,
+            limits: ScanLimits::UNLIMITED,
+        }
+    }
+
+    /// Uses `threads` threads, at least one
+    pub fn with_threads(mut self, threads: usize) -> Self {
+        self.threads = threads.max(1);
+        self
+    }
+
+    /// Number of threads a scan uses at most
+    pub fn threads(&self) -> usize {
+        self.threads
+    }
+
+    /// SQLi flags for every record, see [`Scanner::with_sqli_flags`]
+    pub fn with_sqli_flags(mut self, flags: SqliFlags) -> Self {
+        self.sqli_flags = flags;
+        self
+    }
+
+    /// Bounds the SQLi work done per record, see [`ScanLimits`]
+    pub fn with_limits(mut self, limits: ScanLimits) -> Self {
+        self.limits = limits;
+        self
+    }
+
+    /// Scans each record, returning one result per record in input order
+    pub fn scan_records(&self, records: &[&[u8]]) -> Vec<DetectionResult> {
+        let chunks = records.len().div_ceil(CHUNK_RECORDS);
+        let threads = self.threads.min(chunks);
+        if threads <= 1 {
+            let mut scanner = self.scanner();
+            return records.iter().map(|record| scanner.detect(record)).collect();
+        }
+
+        let next_chunk = AtomicUsize::new(0);
+        in_order(threads, || self.work(records, &next_chunk))
+    }
+
+    /// Scans the records of an iterator, see [`scan_records`](Self::scan_records).
+    /// Threads take the records from the iterator a chunk at a time, so it
+    /// is never collected whole.
+    pub fn scan<'a, I>(&self, records: I) -> Vec<DetectionResult>
+    where
+        I: IntoIterator<Item = &'a [u8]>,
+        I::IntoIter: Send,
+    {
+        let records = records.into_iter().fuse();
+        if self.threads <= 1 {
+            let mut scanner = self.scanner();
+            return records.map(|record| scanner.detect(record)).collect();
+        }
+
+        let records = Mutex::new((0, records));
+        in_order(self.threads, || self.work_iter(&records))
+    }
+
+    /// Scans newline-delimited records, see [`split_lines`]
+    pub fn scan_lines(&self, data: &[u8]) -> Vec<DetectionResult> {
+        self.scan(split_lines(data))
+    }
+
+    fn scanner(&self) -> Scanner<'static> {
+        Scanner::with_sqli_flags(self.sqli_flags).with_limits(self.limits)
+    }
+
+    // Claims chunks until none are left, returning each chunk's results
+    // tagged with its index
+    fn work(&self, records: &[&[u8]], next_chunk: &AtomicUsize) -> Vec<Part> {
+        let mut scanner = self.scanner();
+        let mut parts = Vec::new();
+        loop {
+            let chunk = next_chunk.fetch_add(1, Ordering::Relaxed);
+            let start = chunk.saturating_mul(CHUNK_RECORDS);
+            let end = start.saturating_add(CHUNK_RECORDS).min(records.len());
+            let Some(chunk_records) = records.get(start..end).filter(|part| !part.is_empty()) else {
+                return parts;
+            };
+            parts.push((chunk, chunk_records.iter().map(|record| scanner.detect(record)).collect()));
+        }
+    }
+
+    // `work` over a shared iterator and the index of its next chunk
+    fn work_iter<'a, I>(&self, records: &Mutex<(usize, I)>) -> Vec<Part>
+    where
+        I: Iterator<Item = &'a [u8]>,
+    {
+        let mut scanner = self.scanner();
+        let mut chunk_records = Vec::with_capacity(CHUNK_RECORDS);
+        let mut parts = Vec::new();
+        loop {
+            let chunk = {
+                let mut shared = records.lock().unwrap_or_else(PoisonError::into_inner);
+                let (next_chunk, records) = &mut *shared;
+                chunk_records.extend(records.take(CHUNK_RECORDS));
+                let chunk = *next_chunk;
+                *next_chunk = chunk.wrapping_add(1);
+                chunk
+            };
+            if chunk_records.is_empty() {
+                return parts;
+            }
+            parts.push((chunk, chunk_records.drain(..).map(|record| scanner.detect(record)).collect()));
+        }
+    }
+}
+
+// Runs `work` on `threads` scoped threads and joins the chunks' results in
+// chunk order
+fn in_order<W>(threads: usize, work: W) -> Vec<DetectionResult>
+where
+    W: Fn() -> Vec<Part> + Sync,
+{
+    let mut parts: Vec<Part> = thread::scope(|scope| {
+        let workers: Vec<_> = (0..threads).map(|_| scope.spawn(&work)).collect();
+        workers
+            .into_iter()
+            .flat_map(|worker| match worker.join() {
+                Ok(parts) => parts,
+                Err(payload) => std::panic::resume_unwind(payload),
+            })
+            .collect()
+    });
+
+    parts.sort_unstable_by_key(|&(chunk, _)| chunk);
+    let mut results = Vec::with_capacity(parts.iter().map(|(_, part)| part.len()).sum());
+    for (_, part) in parts {
+        results.extend(part);
+    }
+    results
+}
+
+impl Default for ParallelScanner {
+    fn default() -> Self {
+        Self::new()
+    }
+}
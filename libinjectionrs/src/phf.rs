@@ -0,0 +1,147 @@
+// Perfect hashing for the generated lookup tables
+//
+// build.rs includes this file with `#[path]`, so the hash used to lay out the
+// tables at build time is exactly the one used to probe them at runtime.
+// The scheme is hash-and-displace: a key's hash picks a bucket, the bucket's
+// displacement pair moves it to a slot that no other key occupies. The
+// builder lives here too, so rule overlays compiled at runtime (see
+// overlay.rs) are laid out the same way as the built-in tables.
+
+#[cfg(not(feature = "std"))]
+use alloc::{vec, vec::Vec};
+
+pub struct Hashes {
+    pub g: u32,
+    pub f1: u32,
+    pub f2: u32,
+}
+
+/// Hashes `key` with ASCII case folding applied byte by byte, so a word can
+/// be classified without building an uppercase copy of it first.
+#[inline]
+pub fn hash(key: &[u8], seed: u64) -> Hashes {
+    let mut h = 0xcbf2_9ce4_8422_2325_u64 ^ seed;
+    for &b in key {
+        h = (h ^ u64::from(b.to_ascii_uppercase())).wrapping_mul(0x0000_0100_0000_01b3);
+    }
+    let h = fmix64(h);
+    let h2 = fmix64(h ^ 0x9e37_79b9_7f4a_7c15);
+    Hashes {
+        g: (h >> 32) as u32,
+        f1: h as u32,
+        f2: h2 as u32,
+    }
+}
+
+#[inline]
+pub fn displace(f1: u32, f2: u32, d1: u32, d2: u32) -> u32 {
+    d2.wrapping_add(f1.wrapping_mul(d1)).wrapping_add(f2)
+}
+
+/// Returns the only slot `key` can occupy in a table of `len` entries, or
+/// `None` for an empty table.
+#[inline]
+pub fn slot(key: &[u8], seed: u64, disps: &[(u32, u32)], len: usize) -> Option<usize> {
+    slot_by(key, seed, disps.len(), |bucket| disps.get(bucket).copied(), len)
+}
+
+/// `slot` for displacements kept somewhere other than a slice: `disp`
+/// reads the pair of one of `buckets` buckets.
+#[inline]
+pub fn slot_by(
+    key: &[u8],
+    seed: u64,
+    buckets: usize,
+    disp: impl Fn(usize) -> Option<(u32, u32)>,
+    len: usize,
+) -> Option<usize> {
+    if buckets == 0 || len == 0 {
+        return None;
+    }
+    let hashes = hash(key, seed);
+    let (d1, d2) = disp(hashes.g as usize % buckets)?;
+    Some(displace(hashes.f1, hashes.f2, d1, d2) as usize % len)
+}
+
+/// A built table: the seed, one displacement pair per bucket, and the key
+/// index stored in each slot
+pub type Layout = (u64, Vec<(u32, u32)>, Vec<u16>);
+
+/// Builds a perfect hash over `keys` (hash-and-displace, as in rust-phf).
+/// Returns `None` if there are more keys than `u16` slots can index. The
+/// keys must be distinct ignoring ASCII case. Seeds are tried in a fixed
+/// order so the tables come out the same every time.
+pub fn build(keys: &[&[u8]]) -> Option<Layout> {
+    const LAMBDA: usize = 5;
+    if keys.len() > usize::from(u16::MAX) {
+        return None;
+    }
+
+    let table_len = keys.len();
+    let buckets_len = table_len.div_ceil(LAMBDA);
+    if table_len == 0 {
+        return Some((0, Vec::new(), Vec::new()));
+    }
+
+    let mut attempt = 0u64;
+    'seeds: loop {
+        let seed = attempt.wrapping_mul(0x9e37_79b9_7f4a_7c15);
+        attempt = attempt.wrapping_add(1);
+        let hashes: Vec<Hashes> = keys.iter().map(|k| hash(k, seed)).collect();
+
+        let mut buckets: Vec<Vec<usize>> = vec![Vec::new(); buckets_len];
+        for (i, h) in hashes.iter().enumerate() {
+            buckets[h.g as usize % buckets_len].push(i);
+        }
+        let mut order: Vec<usize> = (0..buckets_len).collect();
+        order.sort_by(|&a, &b| buckets[b].len().cmp(&buckets[a].len()).then(a.cmp(&b)));
+
+        let mut disps = vec![(0u32, 0u32); buckets_len];
+        let mut map: Vec<Option<u16>> = vec![None; table_len];
+        let mut try_map = vec![0u64; table_len];
+        let mut generation = 0u64;
+
+        for &bucket in &order {
+            let keys_in_bucket = &buckets[bucket];
+            if keys_in_bucket.is_empty() {
+                continue;
+            }
+            let mut placed = false;
+            'disps: for d1 in 0..table_len as u32 {
+                'second: for d2 in 0..table_len as u32 {
+                    generation = generation.wrapping_add(1);
+                    for &key in keys_in_bucket {
+                        let idx = displace(hashes[key].f1, hashes[key].f2, d1, d2) as usize % table_len;
+                        if map[idx].is_some() || try_map[idx] == generation {
+                            continue 'second;
+                        }
+                        try_map[idx] = generation;
+                    }
+                    for &key in keys_in_bucket {
+                        let idx = displace(hashes[key].f1, hashes[key].f2, d1, d2) as usize % table_len;
+                        map[idx] = Some(key as u16);
+                    }
+                    disps[bucket] = (d1, d2);
+                    placed = true;
+                    break 'disps;
+                }
+            }
+            if !placed {
+                continue 'seeds;
+            }
+        }
+
+        let slots = map.iter().map(|k| k.unwrap_or(0)).collect();
+        return Some((seed, disps, slots));
+    }
+}
+
+#[inline]
+fn fmix64(mut h: u64) -> u64 {
+    h ^= h >> 33;
+    h = h.wrapping_mul(0xff51_afd7_ed55_8ccd);
+    h ^= h >> 33;
+    h = h.wrapping_mul(0xc4ce_b9fe_1a85_ec53);
+    h ^= h >> 33;
+    h
+}
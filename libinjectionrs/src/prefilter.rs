@@ -0,0 +1,185 @@
+// Fast path for inputs that cannot be injections
+//
+// Most values are plain words, numbers or opaque tokens. One pass over the
+// bytes, folding each byte's class bits together, proves some of them
+// benign so the tokenizers never run:
+//
+// SQLi: an input made only of digits is one number token, and one made only
+// of word bytes (letters, digits, `_`, bytes 0x80 and up except 0xA0; see
+// CHAR_MAP) that does not start with a digit is one word token, since none of
+// those bytes ends a word or starts a string. A lone token's fingerprint is
+// its type, unless folding drops it (operators, SQL types), which is left to
+// the full detector. The input has no quote, so no quoted pass runs, and no
+// comment, so no MySQL pass runs; the verdict is the blacklist lookup of
+// that one-letter fingerprint.
+//
+// XSS: an input without `<`, `>`, `=`, `/`, quotes, backticks or whitespace
+// is a single text, attribute name or attribute value token in every
+// starting context, and none of those alone is ever flagged.
+
+#[cfg(not(feature = "std"))]
+use alloc::vec::Vec;
+
+use crate::overlay::{self, Rules};
+use crate::sqli::sqli_data::{CharType, CHAR_MAP};
+use crate::sqli::{Fingerprint, ScanLimits, SqliFlags, TokenType, LIBINJECTION_SQLI_TOKEN_SIZE};
+
+// Class bits of a byte
+const SQLI_DIGIT: u8 = 1 << 0;
+const SQLI_WORD: u8 = 1 << 1;
+const XSS_INERT: u8 = 1 << 2;
+
+static CLASSES: [u8; 256] = classes();
+
+const fn classes() -> [u8; 256] {
+    let mut table = [0u8; 256];
+    let mut i = 0;
+    while i < 256 {
+        let b = i as u8;
+        let mut class = 0;
+        if b.is_ascii_digit() {
+            class |= SQLI_DIGIT | SQLI_WORD;
+        }
+        // Bytes that start a word, or a string prefix that falls back to one
+        if matches!(
+            CHAR_MAP[i],
+            CharType::Word
+                | CharType::BString
+                | CharType::EString
+                | CharType::NQString
+                | CharType::QString
+                | CharType::UString
+                | CharType::XString
+        ) {
+            class |= SQLI_WORD;
+        }
+        if !matches!(b, b'<' | b'>' | b'=' | b'/' | b'\'' | b'"' | b'`' | b' ' | b'\t' | b'\n' | 0x0B | 0x0C | b'\r') {
+            class |= XSS_INERT;
+        }
+        table[i] = class;
+        i += 1;
+    }
+    table
+}
+
+/// Classes shared by every byte of an input
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) struct Proof(u8);
+
+/// Classifies `input` in one pass, eight bytes per step, stopping early
+/// once no class is left
+#[inline]
+pub(crate) fn classify(input: &[u8]) -> Proof {
+    let mut shared = SQLI_DIGIT | SQLI_WORD | XSS_INERT;
+    let mut chunks = input.chunks_exact(8);
+    for chunk in &mut chunks {
+        for &b in chunk {
+            shared &= CLASSES[usize::from(b)];
+        }
+        if shared == 0 {
+            return Proof(0);
+        }
+    }
+    for &b in chunks.remainder() {
+        shared &= CLASSES[usize::from(b)];
+    }
+    Proof(shared)
+}
+
+/// `classify` for fields laid end to end in `arena`, field `i` ending at
+/// `ends[i]`, in one pass over the arena. Appends one proof per field to
+/// `proofs`. Steps are eight bytes or up to the next field end, whichever
+/// is nearer, and the rest of a field is skipped once no class is left.
+pub(crate) fn classify_fields(arena: &[u8], ends: &[usize], proofs: &mut Vec<Proof>) {
+    const ALL: u8 = SQLI_DIGIT | SQLI_WORD | XSS_INERT;
+    let mut ends = ends.iter().copied();
+    let Some(mut end) = ends.next() else {
+        return;
+    };
+    let mut shared = ALL;
+    let mut pos = 0;
+    loop {
+        // Close every field that ends here, empty ones included
+        while pos >= end {
+            proofs.push(Proof(shared));
+            shared = ALL;
+            match ends.next() {
+                Some(next) => end = next,
+                None => return,
+            }
+        }
+        if shared == 0 {
+            pos = end;
+            continue;
+        }
+        let step_end = pos.saturating_add(8).min(end);
+        for &b in arena.get(pos..step_end).unwrap_or_default() {
+            shared &= CLASSES[usize::from(b)];
+        }
+        pos = step_end;
+    }
+}
+
+impl Proof {
+    /// True if `detect_xss` is proven to find nothing
+    #[inline]
+    pub(crate) fn xss_safe(self) -> bool {
+        self.0 & XSS_INERT != 0
+    }
+
+    /// The fingerprint a safe SQLi verdict for `input` reports, if `input`
+    /// is proven safe under `flags` and `limits`
+    pub(crate) fn sqli_safe(self, input: &[u8], flags: SqliFlags, limits: ScanLimits) -> Option<Fingerprint> {
+        self.sqli_safe_with_rules(input, flags, limits, None)
+    }
+
+    /// `sqli_safe` with words and the fingerprint looked up in `rules`
+    pub(crate) fn sqli_safe_with_rules(
+        self,
+        input: &[u8],
+        flags: SqliFlags,
+        limits: ScanLimits,
+        rules: Option<&Rules<'_>>,
+    ) -> Option<Fingerprint> {
+        // A quote context turns the input into a string; a limit could cut
+        // the scan and mark the verdict truncated
+        if flags.quote_context() != 0 || input.len() > limits.max_bytes || limits.max_tokens < 2 {
+            return None;
+        }
+        let Some(&first) = input.first() else {
+            return Some(Fingerprint::new([0; 8]));
+        };
+
+        let token_type = if self.0 & SQLI_DIGIT != 0 {
+            TokenType::Number
+        } else if self.0 & SQLI_WORD != 0 && !first.is_ascii_digit() {
+            if input.len() < LIBINJECTION_SQLI_TOKEN_SIZE {
+                overlay::lookup_word(rules, input)
+            } else {
+                TokenType::Bareword
+            }
+        } else {
+            return None;
+        };
+
+        let kind = match token_type {
+            TokenType::Bareword => b'n',
+            TokenType::Number => b'1',
+            TokenType::Keyword => b'k',
+            TokenType::Function => b'f',
+            TokenType::Union => b'U',
+            TokenType::Expression => b'E',
+            TokenType::Tsql => b'T',
+            TokenType::LogicOperator => b'&',
+            TokenType::Collate => b'A',
+            TokenType::Group => b'B',
+            TokenType::Variable => b'v',
+            _ => return None,
+        };
+        let fingerprint = [kind, 0, 0, 0, 0, 0, 0, 0];
+        if overlay::is_blacklisted_fingerprint(rules, &fingerprint) {
+            return None;
+        }
+        Some(Fingerprint::new(fingerprint))
+    }
+}
@@ -0,0 +1,94 @@
+//! Splitting a buffer of many inputs into records
+//!
+//! Corpora and logs hold one input per record. [`records`] slices a buffer
+//! (typically a whole file, read or memory-mapped) into those records
+//! without copying them, so binary inputs pass to the detectors unchanged.
+
+use crate::Error;
+
+/// How records are delimited in a buffer
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum RecordFormat {
+    /// One record per line, as [`split_lines`] splits them
+    Newline,
+    /// Records terminated by a NUL byte; the last one may be unterminated
+    Nul,
+    /// Each record preceded by its length as a 4-byte little-endian integer
+    LengthPrefixed,
+}
+
+/// Iterator over the records of a buffer, see [`records`]
+#[derive(Debug, Clone)]
+pub struct Records<'a> {
+    // Input not yet split, None once every record has been taken
+    rest: Option<&'a [u8]>,
+    format: RecordFormat,
+}
+
+/// Splits `data` into records of the given format.
+///
+/// Yields an error, and then nothing more, if a length-prefixed record runs
+/// past the end of the buffer.
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::records::{records, RecordFormat};
+///
+/// let data = b"\x03\0\0\0abc\x01\0\0\0\xff";
+/// let split: Vec<&[u8]> = records(data, RecordFormat::LengthPrefixed).collect::<Result<_, _>>().unwrap();
+/// assert_eq!(split, [&b"abc"[..], &b"\xff"[..]]);
+/// ```
+pub fn records(data: &[u8], format: RecordFormat) -> Records<'_> {
+    // Like BufRead::lines, a final delimiter does not start an empty record
+    let rest = match format {
+        _ if data.is_empty() => None,
+        RecordFormat::Newline => Some(data.strip_suffix(b"\n").unwrap_or(data)),
+        RecordFormat::Nul => Some(data.strip_suffix(b"\0").unwrap_or(data)),
+        RecordFormat::LengthPrefixed => Some(data),
+    };
+    Records { rest, format }
+}
+
+impl<'a> Iterator for Records<'a> {
+    type Item = Result<&'a [u8], Error>;
+
+    fn next(&mut self) -> Option<Self::Item> {
+        let rest = self.rest.take()?;
+        let delimiter = match self.format {
+            RecordFormat::Newline => b'\n',
+            RecordFormat::Nul => 0,
+            RecordFormat::LengthPrefixed => {
+                let Some((len, body)) = rest.split_first_chunk::<4>() else {
+                    return Some(Err(Error::InvalidInput("truncated record length")));
+                };
+                let len = usize::try_from(u32::from_le_bytes(*len)).unwrap_or(usize::MAX);
+                let Some((record, after)) = body.split_at_checked(len) else {
+                    return Some(Err(Error::InvalidInput("length-prefixed record runs past the end of the input")));
+                };
+                self.rest = Some(after).filter(|after| !after.is_empty());
+                return Some(Ok(record));
+            }
+        };
+
+        let record = match rest.iter().position(|&b| b == delimiter) {
+            Some(at) => {
+                let (record, after) = rest.split_at(at);
+                self.rest = after.get(1..);
+                record
+            }
+            None => rest,
+        };
+        if self.format == RecordFormat::Newline {
+            return Some(Ok(record.strip_suffix(b"\r").unwrap_or(record)));
+        }
+        Some(Ok(record))
+    }
+}
+
+/// Splits newline-delimited data into records, as `BufRead::lines` does but
+/// without requiring UTF-8: a trailing `\r` is removed from each record and
+/// a final newline does not start an empty record.
+pub fn split_lines(data: &[u8]) -> impl Iterator<Item = &[u8]> {
+    records(data, RecordFormat::Newline).filter_map(Result::ok)
+}
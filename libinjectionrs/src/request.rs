@@ -0,0 +1,147 @@
+//! Detection over every field of a request at once
+//!
+//! A request carries dozens of short fields, and checking each with its own
+//! calls pays the detectors' setup per field. [`RequestScanner`] copies the
+//! fields of one request into a single buffer, end to end, and keeps only
+//! their end offsets beside it. A scan then makes one prefilter pass over
+//! the whole buffer, marking for each field whether SQLi and XSS detection
+//! can be skipped for it, before the fields that are left go through one
+//! [`Scanner`], in order. Most fields of most requests are plain words and
+//! numbers that the first pass clears on its own.
+//!
+//! The buffers are kept from one request to the next, so once they have
+//! grown to the size of a typical request scanning allocates nothing.
+//! Each field's result is the one [`Scanner::detect`] gives for it.
+
+#[cfg(not(feature = "std"))]
+use alloc::vec::Vec;
+
+use crate::decode::{self, UrlEncoding};
+use crate::prefilter::{self, Proof};
+use crate::{DetectionResult, Scanner};
+
+/// Runs both detectors over the fields of one request
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::request::RequestScanner;
+///
+/// let mut request = RequestScanner::new();
+/// request.push(b"john");
+/// request.push_url_encoded(b"1%27+OR+%271%27%3D%271");
+/// request.push(b"<script>alert(1)</script>");
+///
+/// let flagged: Vec<bool> = request.scan().iter().map(|result| result.is_injection()).collect();
+/// assert_eq!(flagged, [false, true, true]);
+///
+/// request.clear();
+/// ```
+pub struct RequestScanner<'r> {
+    scanner: Scanner<'r>,
+    // Every field, end to end
+    arena: Vec<u8>,
+    // Where each field ends in `arena`
+    ends: Vec<usize>,
+    // Prefilter classes of each field, from the last scan
+    proofs: Vec<Proof>,
+    results: Vec<DetectionResult>,
+}
+
+impl<'r> RequestScanner<'r> {
+    /// Creates a request scanner over a default [`Scanner`]
+    pub fn new() -> Self {
+        Self::with_scanner(Scanner::new())
+    }
+
+    /// Creates a request scanner that checks fields with `scanner`, so with
+    /// its SQLi flags and limits
+    pub fn with_scanner(scanner: Scanner<'r>) -> Self {
+        RequestScanner {
+            scanner,
+            arena: Vec::new(),
+            ends: Vec::new(),
+            proofs: Vec::new(),
+            results: Vec::new(),
+        }
+    }
+
+    /// Adds a field; returns its index in the results
+    pub fn push(&mut self, value: &[u8]) -> usize {
+        self.arena.extend_from_slice(value);
+        self.end_field()
+    }
+
+    /// Adds a form-encoded field, decoded straight into the request's
+    /// buffer; returns its index in the results
+    pub fn push_url_encoded(&mut self, value: &[u8]) -> usize {
+        self.push_decoded(value, UrlEncoding::Form)
+    }
+
+    /// Adds a field encoded as `encoding`, decoded straight into the
+    /// request's buffer; returns its index in the results
+    pub fn push_decoded(&mut self, value: &[u8], encoding: UrlEncoding) -> usize {
+        decode::decode_into(encoding, value, &mut self.arena);
+        self.end_field()
+    }
+
+    fn end_field(&mut self) -> usize {
+        self.ends.push(self.arena.len());
+        self.ends.len() - 1
+    }
+
+    /// Number of fields added since the last [`clear`](Self::clear)
+    pub fn len(&self) -> usize {
+        self.ends.len()
+    }
+
+    /// True if no field has been added since the last clear
+    pub fn is_empty(&self) -> bool {
+        self.ends.is_empty()
+    }
+
+    /// The (decoded) value of field `index`
+    pub fn field(&self, index: usize) -> Option<&[u8]> {
+        let end = *self.ends.get(index)?;
+        let start = index.checked_sub(1).map_or(0, |before| self.ends[before]);
+        Some(&self.arena[start..end])
+    }
+
+    /// Iterator over the fields, in the order they were added
+    pub fn fields(&self) -> impl Iterator<Item = &[u8]> + '_ {
+        let starts = core::iter::once(0).chain(self.ends.iter().copied());
+        starts.zip(&self.ends).map(move |(start, &end)| &self.arena[start..end])
+    }
+
+    /// Checks every field, as [`Scanner::detect`] checks it. Returns one
+    /// result per field, in the order they were added.
+    pub fn scan(&mut self) -> &[DetectionResult] {
+        // One pass over the whole buffer first, then the engines over the
+        // fields it could not clear
+        self.proofs.clear();
+        prefilter::classify_fields(&self.arena, &self.ends, &mut self.proofs);
+
+        self.results.clear();
+        let mut start = 0;
+        for (&end, &proof) in self.ends.iter().zip(&self.proofs) {
+            let field = &self.arena[start..end];
+            self.results.push(self.scanner.detect_with_proof(field, proof));
+            start = end;
+        }
+        &self.results
+    }
+
+    /// Drops every field, keeping the buffers for the next request
+    pub fn clear(&mut self) {
+        self.arena.clear();
+        self.ends.clear();
+        self.proofs.clear();
+        self.results.clear();
+    }
+}
+
+impl Default for RequestScanner<'_> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
@@ -0,0 +1,180 @@
+//! Detection over many values with one reusable state
+//!
+//! A single request can carry dozens of query arguments, cookies and headers,
+//! each of which is checked on its own. [`Scanner`] keeps one `SqliState`
+//! between checks and moves it on to each new value with
+//! [`SqliState::reuse`], so its token buffers are set up once per scanner
+//! instead of once per value. The XSS tokenizers live on the stack for the
+//! length of one check and carry nothing over. Values that arrive
+//! URL-encoded are decoded into a buffer the scanner also keeps, see
+//! [`detect_url_encoded`](Scanner::detect_url_encoded).
+//!
+//! Every verdict is the one the matching free function gives:
+//! [`detect_sqli_with_limits`](crate::detect_sqli_with_limits) and
+//! [`detect_xss`](crate::detect_xss).
+
+use crate::decode::{UrlDecoder, UrlEncoding};
+use crate::overlay::Rules;
+use crate::prefilter::{self, Proof};
+use crate::sqli::{ScanLimits, SqliFlags, SqliState};
+use crate::xss::{XssDetector, XssResult};
+use crate::{safe_sqli_result, sqli_result, xss_result, DetectionResult};
+
+/// Runs SQLi and XSS detection over many values, reusing its state
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::{InjectionType, Scanner};
+///
+/// let fields: &[&[u8]] = &[b"john", b"1' OR '1'='1", b"<script>alert(1)</script>"];
+/// let mut scanner = Scanner::new();
+/// let results: Vec<_> = scanner.detect_many(fields).collect();
+///
+/// assert!(!results[0].is_injection());
+/// assert_eq!(results[1].injection_type, InjectionType::Sqli);
+/// assert_eq!(results[2].injection_type, InjectionType::Xss);
+/// ```
+pub struct Scanner<'r> {
+    // Idle between checks, bound to an empty input
+    sqli: Option<SqliState<'static>>,
+    sqli_flags: SqliFlags,
+    limits: ScanLimits,
+    rules: Option<&'r Rules<'r>>,
+    xss: XssDetector<'r>,
+    decoder: UrlDecoder,
+}
+
+impl<'r> Scanner<'r> {
+    /// Creates a scanner using the default SQLi flags, like `detect_sqli`
+    pub fn new() -> Self {
+        Self::with_sqli_flags(SqliFlags::FLAG_NONE)
+    }
+
+    /// Creates a scanner whose SQLi verdicts match `detect_sqli_with_flags`
+    pub fn with_sqli_flags(flags: SqliFlags) -> Self {
+        Scanner {
+            sqli: None,
+            sqli_flags: flags,
+            limits: ScanLimits::UNLIMITED,
+            rules: None,
+            xss: XssDetector::new(),
+            decoder: UrlDecoder::new(),
+        }
+    }
+
+    /// Bounds the SQLi work done per value, see [`ScanLimits`]
+    pub fn with_limits(mut self, limits: ScanLimits) -> Self {
+        self.limits = limits;
+        self
+    }
+
+    /// Checks every value with `rules` on top of the built-in tables, see
+    /// [`overlay`](crate::overlay)
+    pub fn with_rules(mut self, rules: &'r Rules<'r>) -> Self {
+        self.rules = Some(rules);
+        self.xss = self.xss.with_rules(rules);
+        self
+    }
+
+    /// Sets how [`detect_url_encoded`](Self::detect_url_encoded) decodes
+    /// values; form encoding, where `+` is a space, unless set
+    pub fn with_url_encoding(mut self, encoding: UrlEncoding) -> Self {
+        self.decoder = UrlDecoder::with_encoding(encoding);
+        self
+    }
+
+    /// Checks one value for SQL injection
+    pub fn detect_sqli(&mut self, input: &[u8]) -> DetectionResult {
+        self.detect_sqli_with_flags(input, self.sqli_flags)
+    }
+
+    /// Checks one value for SQL injection under `flags` instead of the
+    /// scanner's own, like `detect_sqli_with_flags`
+    pub fn detect_sqli_with_flags(&mut self, input: &[u8], flags: SqliFlags) -> DetectionResult {
+        self.sqli_with_proof(input, flags, prefilter::classify(input))
+    }
+
+    fn sqli_with_proof(&mut self, input: &[u8], flags: SqliFlags, proof: Proof) -> DetectionResult {
+        if let Some(fingerprint) = proof.sqli_safe_with_rules(input, flags, self.limits, self.rules) {
+            return safe_sqli_result(fingerprint);
+        }
+        let state = match self.sqli.take() {
+            Some(state) => state.reuse(input, flags),
+            None => SqliState::new(input, flags),
+        };
+        let mut state = state.with_limits(self.limits);
+        if let Some(rules) = self.rules {
+            state = state.with_rules(rules);
+        }
+        let result = sqli_result(&mut state);
+        self.sqli = Some(state.reuse(&[], flags));
+        result
+    }
+
+    /// Checks one value for XSS
+    pub fn detect_xss(&self, input: &[u8]) -> XssResult {
+        self.xss.detect(input)
+    }
+
+    /// Checks one value for both. Returns the SQLi result if it is an
+    /// injection, otherwise the XSS one if that is, otherwise the (safe)
+    /// SQLi result. XSS detection is skipped once SQLi is found.
+    pub fn detect(&mut self, input: &[u8]) -> DetectionResult {
+        // One prefilter pass serves both detectors
+        self.detect_with_proof(input, prefilter::classify(input))
+    }
+
+    // `detect` for an input already classified
+    pub(crate) fn detect_with_proof(&mut self, input: &[u8], proof: Proof) -> DetectionResult {
+        let sqli = self.sqli_with_proof(input, self.sqli_flags, proof);
+        if !sqli.is_injection() && self.xss_with_proof(input, proof) {
+            return xss_result();
+        }
+        sqli
+    }
+
+    // `detect`, giving up between the two detectors if `stop` says so
+    #[cfg(feature = "async")]
+    pub(crate) fn detect_unless(&mut self, input: &[u8], stop: impl Fn() -> bool) -> Option<DetectionResult> {
+        let proof = prefilter::classify(input);
+        let sqli = self.sqli_with_proof(input, self.sqli_flags, proof);
+        if sqli.is_injection() {
+            return Some(sqli);
+        }
+        if stop() {
+            return None;
+        }
+        Some(if self.xss_with_proof(input, proof) { xss_result() } else { sqli })
+    }
+
+    fn xss_with_proof(&self, input: &[u8], proof: Proof) -> bool {
+        if proof.xss_safe() {
+            #[cfg(feature = "metrics")]
+            crate::metrics::xss_prefiltered();
+            return false;
+        }
+        self.xss.detect_unfiltered(input).is_injection()
+    }
+
+    /// Checks one URL-encoded value for both, as [`detect`](Self::detect)
+    /// checks it decoded. A value without escapes is checked in place;
+    /// one with escapes is decoded into a buffer kept for the next value.
+    pub fn detect_url_encoded(&mut self, value: &[u8]) -> DetectionResult {
+        let mut decoder = core::mem::take(&mut self.decoder);
+        let result = self.detect(decoder.decode(value));
+        self.decoder = decoder;
+        result
+    }
+
+    /// Checks each value in turn, as by [`detect`](Self::detect)
+    pub fn detect_many<'s>(&'s mut self, inputs: &'s [&'s [u8]]) -> impl Iterator<Item = DetectionResult> + use<'r, 's> {
+        inputs.iter().map(move |input| self.detect(input))
+    }
+}
+
+impl Default for Scanner<'_> {
+    fn default() -> Self {
+        Self::new()
+    }
+}
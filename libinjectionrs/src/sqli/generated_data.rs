@@ -9622,16 +9622,855 @@ pub const SQL_KEYWORDS: &[Keyword] = &[
     Keyword { word: "~*", token_type: b'o' },
 ];
 
+// Perfect hash over SQL_KEYWORDS (see src/phf.rs)
+pub const MAX_KEYWORD_LEN: usize = 29;
+
+const KEYWORD_SEED: u64 = 0x0000000000000000;
+
+static KEYWORD_DISPS: [(u32, u32); 1871] = [
+    (0, 4), (0, 191), (0, 578), (0, 20), (0, 4), (0, 275), (0, 449), (0, 1250),
+    (0, 110), (0, 3), (0, 1056), (0, 3069), (0, 82), (0, 423), (0, 639), (0, 56),
+    (0, 904), (0, 3), (0, 14), (0, 2), (0, 1), (0, 263), (0, 0), (0, 42),
+    (0, 145), (0, 228), (0, 16), (0, 80), (0, 119), (0, 0), (0, 31), (0, 291),
+    (0, 0), (0, 444), (0, 834), (0, 12), (0, 3), (0, 8), (0, 144), (0, 7),
+    (0, 42), (0, 46), (0, 3), (0, 0), (0, 415), (0, 4), (0, 978), (0, 268),
+    (0, 180), (0, 115), (0, 0), (0, 3), (0, 101), (0, 3), (0, 23), (0, 14),
+    (0, 14), (0, 44), (0, 11), (0, 211), (0, 108), (0, 418), (0, 12), (0, 28),
+    (0, 0), (0, 360), (0, 132), (0, 31), (0, 27), (0, 155), (0, 20), (0, 0),
+    (0, 0), (0, 704), (0, 106), (0, 2329), (0, 50), (0, 14), (0, 5), (0, 184),
+    (0, 80), (0, 7), (0, 2), (0, 15), (0, 23), (0, 74), (0, 18), (0, 408),
+    (0, 719), (0, 0), (0, 1), (0, 5), (0, 18), (0, 360), (0, 9), (0, 302),
+    (0, 3), (0, 48), (0, 54), (0, 42), (0, 9), (0, 2), (0, 142), (0, 66),
+    (0, 1), (0, 37), (0, 6), (0, 40), (0, 22), (0, 22), (0, 9), (0, 798),
+    (0, 11), (0, 10), (0, 89), (0, 51), (0, 76), (0, 2), (0, 505), (0, 5),
+    (0, 758), (0, 494), (0, 35), (0, 47), (0, 3), (0, 1), (0, 10), (0, 170),
+    (0, 6), (0, 0), (0, 8), (0, 0), (0, 0), (0, 3155), (1, 5), (0, 4),
+    (0, 4), (0, 2), (0, 965), (0, 300), (0, 502), (0, 1), (0, 3), (0, 17),
+    (0, 127), (0, 3), (0, 4), (0, 543), (1, 12), (0, 499), (0, 717), (0, 2),
+    (0, 8), (0, 8), (0, 135), (0, 0), (0, 38), (0, 119), (0, 48), (0, 518),
+    (0, 0), (0, 664), (0, 100), (0, 40), (0, 1), (0, 23), (0, 1), (0, 32),
+    (0, 415), (0, 0), (0, 6), (0, 219), (0, 232), (0, 2), (0, 209), (0, 122),
+    (0, 12), (0, 186), (0, 0), (0, 25), (0, 11), (0, 542), (0, 31), (0, 166),
+    (0, 2), (0, 121), (0, 22), (0, 716), (0, 88), (0, 16), (0, 24), (0, 0),
+    (0, 0), (0, 451), (0, 2226), (0, 12), (0, 446), (0, 0), (0, 37), (0, 105),
+    (0, 5), (0, 40), (0, 373), (0, 3), (0, 532), (0, 6), (0, 1054), (0, 1),
+    (0, 8), (0, 190), (0, 37), (0, 4), (0, 246), (0, 0), (0, 42), (0, 0),
+    (0, 2), (0, 391), (0, 1), (0, 882), (0, 39), (0, 16), (0, 265), (0, 13),
+    (0, 1892), (0, 55), (0, 208), (0, 7), (0, 0), (0, 12), (0, 221), (0, 555),
+    (0, 171), (0, 157), (0, 103), (0, 27), (0, 649), (0, 0), (0, 14), (0, 33),
+    (0, 26), (0, 39), (0, 368), (0, 33), (0, 0), (0, 13), (0, 490), (0, 4),
+    (0, 2015), (0, 150), (0, 0), (0, 1239), (0, 17), (0, 84), (0, 36), (0, 28),
+    (0, 10), (0, 73), (0, 199), (0, 470), (0, 56), (0, 113), (0, 21), (0, 25),
+    (0, 91), (0, 310), (0, 356), (0, 0), (0, 21), (0, 582), (0, 215), (0, 0),
+    (0, 495), (0, 212), (0, 125), (0, 29), (0, 339), (0, 122), (0, 763), (0, 90),
+    (0, 1), (0, 418), (0, 51), (0, 18), (0, 0), (0, 31), (0, 2), (0, 1087),
+    (0, 20), (0, 137), (0, 161), (0, 9), (0, 19), (0, 93), (0, 471), (0, 297),
+    (0, 0), (0, 378), (0, 0), (0, 1112), (0, 106), (0, 8), (0, 14), (0, 57),
+    (0, 151), (0, 0), (0, 9), (0, 0), (0, 26), (0, 2425), (0, 5), (0, 852),
+    (0, 34), (0, 7), (0, 15), (0, 2936), (0, 8), (0, 30), (0, 99), (0, 191),
+    (0, 423), (0, 201), (0, 42), (0, 1001), (0, 360), (0, 72), (0, 59), (0, 28),
+    (0, 21), (0, 0), (0, 1160), (0, 4), (0, 65), (0, 27), (0, 118), (0, 417),
+    (0, 313), (0, 98), (0, 339), (0, 0), (0, 0), (0, 8), (0, 14), (0, 11),
+    (0, 5), (0, 311), (0, 13), (0, 88), (0, 428), (0, 0), (0, 1323), (0, 23),
+    (0, 38), (0, 7), (0, 60), (0, 0), (0, 3), (0, 240), (0, 45), (0, 92),
+    (0, 269), (0, 751), (0, 53), (0, 23), (0, 11), (0, 374), (0, 2), (0, 75),
+    (0, 5), (0, 670), (0, 201), (0, 240), (0, 15), (0, 2621), (0, 2), (0, 6),
+    (0, 1435), (0, 1), (0, 1), (0, 2823), (0, 21), (0, 2), (0, 370), (0, 344),
+    (0, 9), (0, 1302), (0, 0), (0, 59), (0, 86), (0, 961), (0, 9), (0, 337),
+    (0, 106), (0, 572), (0, 102), (0, 67), (0, 2585), (0, 7), (0, 1103), (0, 1331),
+    (0, 1), (0, 0), (0, 41), (0, 768), (0, 10), (0, 2107), (0, 419), (0, 32),
+    (0, 434), (0, 33), (0, 5), (0, 6), (0, 5), (0, 3984), (0, 1557), (0, 4),
+    (0, 256), (0, 0), (0, 1), (0, 9), (0, 42), (0, 3), (0, 21), (0, 7),
+    (0, 231), (0, 0), (0, 379), (0, 0), (0, 786), (0, 49), (0, 627), (0, 13),
+    (0, 248), (0, 3), (0, 197), (0, 116), (0, 65), (0, 0), (0, 2496), (0, 0),
+    (0, 3101), (0, 13), (0, 16), (0, 270), (0, 71), (0, 1), (0, 140), (0, 50),
+    (0, 627), (0, 133), (0, 1336), (0, 0), (0, 2514), (0, 314), (0, 8), (0, 38),
+    (0, 442), (0, 651), (0, 20), (0, 1823), (0, 41), (0, 14), (0, 206), (0, 0),
+    (0, 10), (0, 833), (0, 0), (0, 310), (0, 0), (0, 742), (0, 25), (0, 0),
+    (0, 1177), (0, 83), (0, 412), (0, 25), (0, 16), (0, 1051), (0, 19), (0, 23),
+    (0, 0), (0, 3), (0, 6), (0, 2599), (0, 166), (0, 3), (0, 286), (0, 13),
+    (0, 1087), (0, 0), (0, 25), (0, 28), (0, 168), (0, 0), (0, 1), (0, 30),
+    (0, 10), (0, 5), (0, 0), (0, 2), (0, 283), (0, 136), (0, 230), (0, 290),
+    (0, 4), (0, 522), (0, 355), (0, 731), (0, 12), (0, 335), (0, 0), (0, 0),
+    (0, 10), (0, 1), (0, 28), (0, 47), (0, 1209), (0, 47), (0, 815), (0, 139),
+    (0, 782), (0, 0), (0, 0), (0, 1), (0, 105), (0, 0), (0, 12), (0, 98),
+    (0, 193), (0, 261), (0, 594), (0, 0), (0, 6), (0, 1012), (0, 1233), (0, 484),
+    (0, 0), (0, 303), (0, 592), (0, 1186), (0, 55), (0, 5), (1, 2), (0, 2),
+    (0, 3), (0, 10), (0, 1419), (0, 1), (0, 27), (0, 58), (0, 5), (0, 153),
+    (0, 365), (0, 23), (0, 100), (0, 61), (0, 1418), (0, 263), (0, 827), (0, 0),
+    (0, 16), (0, 0), (0, 358), (0, 535), (0, 31), (0, 8), (0, 232), (0, 0),
+    (0, 102), (0, 1049), (0, 880), (0, 1340), (0, 2417), (0, 58), (0, 924), (0, 17),
+    (0, 397), (0, 389), (0, 2647), (0, 1616), (0, 5), (0, 7), (0, 0), (0, 26),
+    (0, 0), (0, 28), (0, 8), (0, 1557), (0, 12), (0, 0), (0, 35), (0, 3),
+    (0, 492), (0, 2472), (0, 318), (0, 2), (0, 214), (0, 10), (0, 145), (0, 82),
+    (0, 3), (0, 57), (0, 109), (0, 24), (0, 96), (0, 48), (0, 0), (0, 3),
+    (0, 1), (0, 746), (0, 65), (0, 0), (0, 12), (0, 7), (0, 2), (0, 390),
+    (0, 2), (0, 49), (0, 46), (0, 1806), (0, 1), (0, 1879), (0, 53), (0, 202),
+    (0, 16), (0, 12), (0, 0), (0, 13), (0, 3), (0, 1475), (0, 606), (0, 4076),
+    (0, 2423), (0, 0), (0, 638), (0, 4384), (0, 43), (0, 6), (0, 9), (0, 0),
+    (0, 549), (0, 1), (0, 2180), (0, 2299), (0, 691), (0, 47), (0, 53), (0, 487),
+    (0, 46), (0, 2), (0, 216), (0, 856), (0, 1), (0, 1), (0, 1), (0, 189),
+    (0, 71), (0, 205), (0, 0), (0, 8), (0, 369), (0, 1660), (0, 93), (0, 3500),
+    (0, 255), (0, 31), (0, 215), (0, 1675), (0, 30), (0, 28), (0, 26), (0, 7),
+    (0, 55), (0, 1635), (0, 2437), (0, 27), (0, 186), (0, 518), (0, 905), (0, 10),
+    (0, 1), (0, 27), (0, 75), (0, 1134), (0, 1), (0, 664), (0, 0), (0, 95),
+    (0, 46), (0, 2), (0, 1993), (0, 372), (0, 1708), (0, 10), (0, 2), (0, 15),
+    (0, 0), (0, 26), (0, 44), (0, 77), (0, 0), (0, 647), (0, 9), (0, 308),
+    (0, 1076), (0, 353), (0, 211), (0, 92), (0, 136), (0, 5), (0, 1), (0, 1886),
+    (0, 221), (0, 77), (0, 487), (0, 3861), (0, 1736), (0, 564), (0, 1), (0, 301),
+    (0, 0), (0, 67), (0, 451), (0, 276), (0, 10), (0, 29), (0, 710), (0, 23),
+    (0, 10), (0, 0), (0, 0), (0, 136), (0, 6091), (0, 178), (0, 18), (0, 245),
+    (0, 75), (0, 3), (0, 7), (0, 12), (0, 3), (0, 1493), (0, 1), (0, 72),
+    (0, 0), (0, 56), (0, 686), (0, 283), (0, 43), (0, 2), (0, 459), (0, 17),
+    (0, 92), (0, 11), (0, 3008), (0, 9), (0, 256), (0, 1), (0, 491), (0, 0),
+    (0, 208), (0, 6), (0, 1515), (0, 73), (0, 24), (0, 786), (0, 7), (0, 112),
+    (0, 4308), (0, 48), (0, 44), (0, 311), (0, 2), (0, 65), (0, 8), (0, 1048),
+    (0, 5), (0, 65), (0, 27), (0, 593), (0, 8), (0, 12), (0, 114), (0, 878),
+    (0, 355), (0, 3778), (0, 0), (0, 5), (0, 1097), (0, 1131), (0, 8), (0, 1),
+    (0, 406), (0, 693), (0, 51), (0, 2681), (0, 982), (0, 4), (0, 1342), (0, 971),
+    (0, 58), (0, 5787), (0, 5), (0, 177), (0, 51), (0, 608), (0, 36), (0, 301),
+    (0, 2472), (0, 326), (0, 372), (0, 0), (0, 2), (0, 56), (0, 2190), (0, 1),
+    (0, 8435), (0, 0), (0, 2612), (0, 1199), (0, 269), (0, 90), (0, 2212), (0, 0),
+    (0, 842), (0, 3), (0, 20), (0, 0), (0, 6), (0, 1072), (0, 1546), (0, 486),
+    (0, 67), (0, 11), (0, 182), (0, 249), (0, 473), (0, 21), (0, 204), (0, 588),
+    (0, 723), (0, 2), (0, 492), (0, 13), (0, 673), (0, 230), (0, 4164), (0, 332),
+    (0, 192), (0, 254), (0, 402), (0, 130), (0, 1), (0, 39), (0, 116), (0, 27),
+    (0, 64), (0, 1917), (0, 99), (0, 4), (0, 11), (0, 119), (0, 34), (0, 125),
+    (0, 1), (0, 14), (0, 1156), (0, 1275), (0, 8), (0, 2676), (0, 2), (0, 143),
+    (0, 792), (0, 170), (0, 28), (0, 6), (0, 3284), (0, 115), (0, 37), (0, 9122),
+    (0, 18), (0, 107), (0, 492), (0, 1), (0, 1276), (0, 2233), (0, 612), (0, 324),
+    (0, 2), (0, 315), (0, 109), (0, 834), (0, 1), (0, 587), (0, 1503), (0, 27),
+    (0, 33), (0, 40), (0, 1721), (0, 222), (0, 0), (0, 331), (0, 185), (0, 130),
+    (0, 885), (0, 327), (0, 24), (0, 68), (0, 430), (0, 3245), (0, 3054), (0, 45),
+    (0, 43), (0, 1), (0, 5), (0, 7), (0, 45), (0, 21), (0, 308), (0, 706),
+    (0, 61), (0, 108), (0, 137), (0, 17), (0, 104), (0, 0), (0, 63), (0, 1175),
+    (0, 752), (0, 0), (0, 73), (0, 720), (0, 510), (0, 11), (0, 21), (0, 2),
+    (0, 75), (0, 1), (0, 1255), (0, 107), (0, 670), (0, 31), (0, 1774), (0, 47),
+    (0, 296), (0, 838), (0, 138), (0, 3), (0, 114), (0, 1968), (0, 1152), (0, 61),
+    (0, 2028), (0, 57), (0, 2644), (0, 17), (0, 260), (0, 15), (0, 2984), (0, 3936),
+    (0, 2), (0, 15), (0, 2431), (0, 800), (0, 1), (0, 560), (0, 3774), (0, 4),
+    (0, 1227), (0, 149), (0, 2), (0, 123), (0, 42), (0, 3), (0, 402), (0, 2439),
+    (0, 125), (0, 10), (0, 4289), (0, 0), (0, 46), (0, 6), (0, 259), (0, 4),
+    (0, 663), (0, 80), (0, 88), (0, 21), (0, 800), (0, 744), (0, 3829), (0, 208),
+    (0, 3), (0, 6), (0, 473), (0, 15), (0, 44), (0, 310), (0, 98), (0, 1903),
+    (0, 4), (0, 125), (0, 3377), (0, 2), (0, 9), (0, 125), (0, 3192), (0, 58),
+    (0, 1), (0, 0), (0, 20), (0, 4536), (0, 1084), (0, 2644), (0, 28), (0, 29),
+    (0, 1863), (0, 2099), (0, 208), (0, 23), (0, 255), (0, 8735), (0, 587), (0, 63),
+    (0, 8), (0, 320), (0, 83), (0, 3762), (0, 0), (0, 224), (0, 54), (0, 366),
+    (0, 246), (0, 240), (0, 408), (0, 62), (0, 51), (0, 958), (0, 67), (0, 15),
+    (0, 79), (0, 889), (0, 1860), (0, 53), (0, 56), (0, 69), (0, 103), (0, 4),
+    (0, 25), (0, 511), (0, 716), (0, 8316), (0, 2307), (0, 192), (0, 34), (0, 26),
+    (0, 7), (0, 81), (0, 19), (0, 624), (0, 1), (0, 890), (0, 11), (0, 43),
+    (0, 627), (0, 3), (0, 0), (0, 430), (0, 2303), (0, 1434), (0, 1959), (0, 126),
+    (0, 237), (0, 39), (0, 139), (0, 0), (0, 20), (0, 0), (0, 129), (0, 9),
+    (0, 117), (0, 5), (0, 417), (0, 1656), (0, 0), (0, 120), (0, 527), (0, 4005),
+    (0, 12), (0, 1386), (0, 210), (0, 78), (0, 743), (0, 2), (0, 0), (0, 2510),
+    (0, 14), (0, 14), (0, 28), (0, 296), (0, 7), (0, 48), (0, 2024), (0, 12),
+    (0, 0), (0, 4), (0, 28), (0, 0), (0, 81), (0, 0), (0, 858), (0, 405),
+    (0, 40), (0, 29), (0, 25), (0, 195), (0, 122), (0, 20), (0, 585), (0, 21),
+    (0, 14), (0, 49), (0, 1114), (0, 198), (0, 64), (0, 3), (0, 3865), (0, 1941),
+    (0, 840), (0, 1870), (0, 6876), (0, 94), (0, 11), (0, 2729), (0, 492), (0, 11),
+    (0, 88), (0, 9), (0, 76), (0, 1754), (0, 1), (0, 0), (0, 1130), (0, 512),
+    (0, 112), (0, 450), (0, 1166), (0, 885), (0, 1685), (0, 130), (0, 146), (0, 2120),
+    (0, 3232), (0, 70), (0, 3063), (0, 39), (0, 888), (0, 1665), (0, 2327), (0, 25),
+    (0, 2318), (0, 0), (0, 1463), (0, 35), (0, 10), (0, 4), (0, 1100), (0, 485),
+    (0, 154), (0, 2037), (0, 1045), (0, 1), (0, 6), (0, 1), (0, 882), (0, 2),
+    (0, 1069), (0, 95), (0, 273), (0, 874), (0, 488), (0, 137), (0, 1511), (0, 293),
+    (0, 212), (0, 0), (0, 190), (0, 13), (0, 0), (0, 1752), (0, 1), (0, 20),
+    (0, 14), (0, 58), (0, 549), (0, 1057), (0, 1992), (0, 3066), (0, 843), (0, 8945),
+    (0, 723), (0, 99), (0, 0), (1, 2118), (0, 2214), (0, 871), (0, 136), (0, 1925),
+    (0, 187), (0, 10), (0, 0), (0, 1836), (0, 3153), (0, 11), (0, 5387), (0, 106),
+    (0, 192), (0, 4), (0, 7), (0, 2180), (0, 2), (0, 3187), (0, 3372), (0, 771),
+    (0, 253), (0, 401), (0, 142), (0, 2), (0, 13), (0, 838), (0, 479), (0, 9),
+    (0, 6), (0, 0), (0, 5), (0, 268), (0, 1012), (0, 129), (0, 125), (0, 3),
+    (0, 2511), (0, 104), (0, 9), (0, 480), (0, 3266), (0, 2580), (0, 2858), (0, 194),
+    (0, 0), (0, 2619), (0, 277), (0, 2673), (0, 1022), (0, 0), (0, 5552), (0, 1511),
+    (0, 13), (0, 397), (0, 82), (0, 2), (0, 4), (0, 120), (0, 3312), (0, 112),
+    (0, 4492), (0, 5454), (0, 5), (0, 318), (0, 3387), (0, 3406), (0, 307), (0, 27),
+    (0, 314), (0, 6290), (0, 4722), (0, 1658), (0, 2744), (0, 25), (0, 2), (0, 0),
+    (0, 1073), (0, 2271), (0, 55), (0, 90), (1, 4074), (0, 771), (0, 2), (0, 0),
+    (0, 21), (0, 0), (0, 838), (0, 794), (0, 0), (0, 0), (0, 275), (0, 0),
+    (0, 1), (0, 1292), (0, 1726), (0, 197), (0, 13), (0, 0), (0, 2216), (0, 479),
+    (0, 936), (0, 9), (0, 32), (0, 8), (0, 17), (0, 4), (0, 72), (0, 3055),
+    (0, 315), (0, 1), (0, 67), (0, 3730), (0, 1219), (0, 0), (0, 132), (0, 1),
+    (0, 0), (1, 6752), (0, 1684), (0, 3344), (0, 169), (0, 2037), (0, 716), (0, 611),
+    (0, 4602), (0, 3141), (1, 791), (0, 4), (0, 0), (0, 132), (0, 209), (0, 1),
+    (0, 2784), (0, 299), (0, 5286), (0, 886), (0, 7278), (0, 1256), (0, 618), (0, 413),
+    (0, 249), (0, 2), (0, 2907), (0, 1), (1, 5227), (0, 2452), (0, 521), (0, 5),
+    (0, 7567), (0, 0), (0, 18), (0, 439), (0, 890), (0, 194), (0, 49), (0, 32),
+    (0, 419), (0, 145), (0, 635), (0, 77), (0, 26), (0, 159), (0, 87), (0, 606),
+    (0, 7546), (0, 18), (0, 185), (0, 2933), (0, 1269), (0, 1967), (0, 4718), (0, 362),
+    (0, 276), (0, 1145), (0, 2903), (0, 3457), (0, 41), (0, 908), (0, 9), (0, 39),
+    (0, 690), (0, 822), (0, 227), (0, 19), (0, 37), (0, 138), (0, 42), (1, 1598),
+    (0, 1576), (0, 180), (0, 91), (0, 21), (0, 55), (0, 98), (0, 37), (0, 645),
+    (0, 163), (0, 24), (0, 47), (0, 4), (0, 51), (0, 161), (0, 2265), (0, 26),
+    (0, 3), (0, 2491), (0, 13), (0, 0), (0, 259), (0, 107), (0, 1059), (0, 0),
+    (0, 115), (0, 3), (0, 1), (0, 76), (0, 0), (0, 1679), (0, 973), (0, 1339),
+    (0, 0), (0, 205), (1, 3196), (0, 353), (0, 12), (0, 1), (0, 13), (1, 5397),
+    (0, 836), (0, 65), (0, 0), (0, 170), (0, 0), (0, 46), (0, 4), (0, 48),
+    (0, 368), (0, 1136), (0, 22), (0, 71), (0, 0), (0, 980), (1, 2432), (0, 1412),
+    (0, 0), (0, 3), (0, 1978), (0, 1953), (0, 2), (0, 23), (0, 2778), (0, 75),
+    (0, 1), (0, 8132), (0, 3799), (0, 2587), (1, 227), (0, 213), (0, 8), (0, 4),
+    (0, 1894), (0, 2173), (0, 1), (0, 51), (0, 3181), (0, 3), (0, 13), (0, 1056),
+    (0, 16), (0, 3), (0, 7386), (0, 287), (0, 7), (0, 15), (0, 575), (1, 7023),
+    (0, 829), (0, 208), (0, 52), (0, 2), (0, 98), (0, 1), (0, 0), (0, 64),
+    (0, 5), (0, 27), (0, 4806), (0, 2173), (0, 210), (0, 3363), (0, 7140), (0, 7896),
+    (0, 9), (0, 7730), (0, 2499), (0, 422), (0, 1), (1, 6772), (0, 173), (0, 57),
+    (0, 1543), (0, 37), (0, 26), (0, 1), (0, 935), (0, 749), (1, 1771), (0, 20),
+    (0, 27), (0, 22), (0, 1), (0, 3), (1, 3531), (0, 115), (0, 20), (0, 1584),
+    (0, 6301), (0, 92), (0, 17), (0, 6), (0, 532), (0, 140), (0, 2252), (0, 346),
+    (0, 30), (0, 1303), (0, 313), (1, 1136), (0, 110), (3, 339), (0, 2866), (0, 55),
+    (0, 23), (0, 1), (0, 9283), (0, 41), (0, 1), (0, 396), (0, 2623), (0, 4103),
+    (0, 7), (0, 4), (0, 4), (0, 14), (0, 0), (0, 7260), (0, 3649), (0, 963),
+    (0, 4), (0, 632), (0, 3059), (0, 4407), (0, 49), (0, 6), (0, 6518), (0, 46),
+    (0, 480), (0, 1291), (0, 1), (0, 15), (0, 1), (0, 331), (0, 1666), (0, 22),
+    (0, 2198), (0, 1677), (0, 2), (0, 278), (0, 854), (0, 1260), (0, 210), (0, 24),
+    (0, 834), (0, 1419), (0, 1703), (0, 22), (0, 14), (0, 867), (0, 2880), (0, 2),
+    (1, 3133), (1, 768), (0, 519), (0, 3517), (0, 1396), (0, 2838), (0, 14), (0, 0),
+    (0, 2103), (0, 4), (0, 1020), (0, 864), (0, 70), (0, 803), (0, 33), (0, 2714),
+    (0, 230), (0, 2744), (0, 9), (0, 234), (0, 17), (1, 4519), (0, 2472), (0, 650),
+    (2, 588), (0, 9), (0, 0), (0, 405), (0, 4785), (0, 324), (0, 3420), (0, 4),
+    (0, 5), (0, 30), (0, 59), (0, 0), (0, 11), (0, 5216), (0, 17), (0, 3978),
+    (0, 94), (0, 169), (0, 9111), (0, 141), (0, 179), (0, 8562), (3, 723), (0, 8),
+    (0, 149), (0, 140), (0, 5), (0, 1338), (0, 7529), (0, 77), (0, 149), (0, 296),
+    (1, 7631), (0, 226), (3, 386), (0, 13), (0, 208), (0, 2), (0, 1378), (0, 3006),
+    (0, 394), (0, 296), (0, 2633), (0, 7), (0, 24), (0, 3308), (0, 3020), (0, 834),
+    (0, 1434), (0, 1679), (1, 943), (0, 0), (0, 267), (0, 276), (0, 2), (0, 2206),
+    (0, 230), (0, 19), (0, 94), (2, 1510), (0, 862), (0, 664), (0, 11), (2, 7155),
+    (0, 107), (0, 21), (0, 217), (0, 3), (0, 1066), (0, 7325), (0, 149), (0, 796),
+    (0, 14), (0, 52), (0, 2797), (0, 10), (0, 1767), (0, 858), (0, 207), (0, 2484),
+    (0, 266), (0, 6041), (0, 700), (0, 819), (0, 922), (3, 4166), (0, 28), (0, 38),
+    (0, 958), (0, 0), (0, 197), (0, 22), (0, 716), (0, 6), (0, 2570), (0, 207),
+    (0, 251), (0, 3416), (0, 772), (0, 365), (1, 5154), (0, 212), (2, 3060), (1, 1114),
+    (0, 6185), (0, 40), (0, 869), (0, 2), (0, 3699), (0, 822), (0, 35), (0, 647),
+    (0, 7702), (0, 9), (0, 339), (0, 1660), (0, 528), (0, 11), (0, 8871), (0, 39),
+    (0, 104), (0, 73), (0, 535), (0, 479), (1, 5650), (0, 0), (0, 28), (0, 0),
+    (0, 22), (0, 794), (0, 341), (1, 2019), (0, 0), (0, 4955), (2, 6191), (0, 3),
+    (0, 3804), (0, 6769), (0, 51), (0, 8669), (0, 1), (0, 923), (0, 5), (0, 3482),
+    (0, 190), (0, 1317), (0, 45), (0, 2), (0, 0), (0, 42), (0, 1833), (0, 0),
+    (1, 3334), (0, 19), (0, 4), (0, 7701), (0, 362), (0, 43), (0, 808), (0, 297),
+    (0, 194), (0, 4942), (0, 286), (0, 3), (0, 150), (1, 7980), (0, 563), (0, 55),
+    (0, 5), (0, 718), (0, 1076), (0, 4111), (0, 819), (0, 2842), (0, 2272), (0, 3307),
+    (0, 40), (0, 5928), (0, 273), (2, 7117), (4, 1411), (0, 227), (0, 103), (2, 3388),
+    (0, 329), (0, 128), (0, 1400), (1, 3222), (1, 4784), (0, 3), (0, 491), (0, 5017),
+    (0, 811), (0, 39), (4, 8769), (0, 408), (0, 159), (0, 2674), (0, 0), (0, 49),
+    (1, 703), (0, 1776), (0, 3465), (0, 162), (0, 8335), (2, 1646), (0, 727), (2, 2400),
+    (0, 3731), (0, 278), (1, 5605), (1, 1527), (0, 31), (0, 172), (0, 182), (0, 65),
+    (0, 171), (0, 15), (0, 140), (4, 3670), (0, 5609), (0, 307), (0, 1), (0, 343),
+    (0, 2485), (3, 2498), (0, 30), (0, 90), (0, 54), (0, 1381), (3, 3606), (0, 12),
+    (0, 0), (0, 454), (0, 3), (0, 5552), (0, 6432), (0, 8867), (0, 15), (0, 8),
+    (0, 293), (0, 257), (0, 3877), (0, 1751), (0, 309), (0, 310), (0, 5128), (0, 192),
+    (0, 16), (0, 41), (0, 89), (0, 7551), (0, 236), (1, 920), (0, 490), (1, 1136),
+    (0, 7021), (0, 191), (0, 37), (0, 1695), (0, 3013), (0, 7969), (4, 1088),
+];
+
+static KEYWORD_SLOTS: [u16; 9352] = [
+    4254, 318, 1338, 5994, 5253, 7268, 3107, 2739, 3947, 5531, 216, 1045, 5533, 9244, 4292, 354,
+    2386, 2624, 2093, 3757, 3447, 9189, 3854, 4321, 4018, 4181, 1572, 3209, 449, 6969, 7445, 5389,
+    6607, 3949, 1199, 3698, 2564, 95, 2470, 6939, 7406, 6380, 8055, 9314, 3371, 1019, 2844, 3878,
+    7379, 59, 8974, 6182, 2035, 5696, 8838, 3856, 3808, 829, 5006, 1135, 2787, 8229, 955, 8308,
+    1781, 1584, 2707, 1734, 3713, 2176, 978, 725, 524, 3499, 6064, 5251, 5877, 1004, 2423, 1487,
+    5745, 3342, 3670, 3844, 2059, 7652, 3, 6244, 9296, 9211, 4927, 3923, 3211, 3082, 419, 3987,
+    9213, 6797, 1458, 3873, 5079, 3400, 818, 1916, 63, 2775, 8494, 2755, 649, 8046, 4250, 1349,
+    3145, 3322, 281, 2259, 3963, 3464, 5661, 3402, 6411, 7730, 8951, 8845, 4570, 277, 7317, 1281,
+    1361, 5310, 1946, 4188, 4605, 4662, 2314, 4242, 841, 5139, 8779, 1600, 4547, 7072, 4597, 919,
+    4089, 1744, 1173, 1938, 2411, 2442, 4850, 4915, 5834, 4475, 6446, 1750, 9351, 7841, 1955, 6386,
+    997, 7904, 676, 4769, 2596, 1641, 5981, 1782, 7565, 3150, 3855, 3261, 1985, 1906, 5297, 6979,
+    488, 8306, 3578, 505, 2579, 4858, 3812, 1445, 8171, 1144, 623, 7867, 8689, 6637, 6865, 8525,
+    1398, 4743, 4356, 5811, 9277, 3799, 7908, 6369, 9199, 745, 115, 7267, 2592, 8349, 469, 3243,
+    3199, 1639, 7850, 4334, 1767, 993, 398, 8726, 7980, 3458, 7802, 985, 2708, 3516, 4447, 309,
+    2955, 5055, 733, 5943, 2549, 7612, 1370, 5827, 4269, 8045, 2256, 9237, 8803, 6291, 5179, 5088,
+    6148, 7785, 7976, 5824, 7277, 9307, 2468, 1301, 3495, 4944, 8956, 5304, 8770, 6136, 7837, 7010,
+    4469, 2113, 6046, 6545, 4225, 5846, 7792, 2650, 2002, 431, 3834, 7918, 1446, 4303, 3755, 339,
+    5985, 5388, 4847, 7348, 4320, 338, 1465, 5096, 4230, 5528, 5120, 3600, 8221, 9067, 6449, 214,
+    643, 6892, 3684, 6638, 8939, 8749, 8434, 1183, 2946, 8574, 641, 7671, 9154, 4051, 7751, 704,
+    8057, 9129, 2935, 6340, 1898, 1759, 7607, 8836, 3367, 5041, 6842, 4573, 4667, 4503, 6698, 832,
+    2825, 5441, 6275, 5272, 3454, 7704, 9194, 350, 7473, 5934, 3925, 6030, 891, 2897, 7540, 8339,
+    6473, 2128, 2686, 5515, 3283, 4839, 5635, 6709, 7735, 6150, 182, 3008, 7753, 6027, 5555, 2486,
+    1658, 180, 7226, 7050, 1302, 931, 4553, 6312, 2292, 5709, 3870, 8367, 6416, 2750, 7298, 7801,
+    6343, 1288, 3696, 8827, 950, 511, 5689, 8520, 204, 6071, 3990, 2220, 1894, 373, 2009, 6951,
+    6897, 4222, 3986, 6167, 3917, 5525, 2204, 3513, 6262, 1247, 7803, 5928, 3313, 4699, 3354, 2917,
+    2575, 7185, 7397, 8387, 5979, 2797, 3271, 7094, 6163, 4438, 5323, 1083, 1842, 5022, 360, 6353,
+    3352, 5496, 6649, 144, 5793, 7664, 3507, 187, 6843, 274, 7743, 3732, 7378, 1824, 6399, 8711,
+    7067, 4755, 5125, 7649, 6737, 4115, 9166, 9025, 9294, 1479, 1085, 1490, 8686, 7391, 6057, 561,
+    3416, 9324, 1292, 6200, 5046, 3376, 9050, 7716, 7638, 7663, 6424, 4191, 6846, 8301, 5932, 5211,
+    5204, 2890, 8052, 7209, 4157, 3325, 3287, 3636, 2033, 1250, 6669, 1270, 8597, 8671, 8668, 78,
+    6063, 8126, 4656, 2180, 8566, 6779, 6741, 3875, 5078, 3228, 5676, 2994, 2648, 4270, 3137, 8707,
+    2941, 8860, 9184, 1320, 8391, 7175, 2616, 5218, 587, 1318, 3010, 4582, 666, 4863, 5657, 7293,
+    6683, 1830, 4169, 5629, 7339, 3318, 5663, 4288, 6996, 9081, 2763, 8926, 2788, 8920, 4457, 7928,
+    89, 7995, 8454, 5300, 1284, 5126, 4982, 1699, 8336, 5226, 1514, 8679, 9057, 8462, 4138, 4853,
+    4287, 8760, 7727, 6065, 3334, 6362, 7886, 5474, 7401, 7517, 3427, 74, 3998, 9048, 6012, 155,
+    8410, 8698, 2395, 915, 4793, 8609, 6856, 7161, 2290, 833, 5780, 6134, 6859, 9241, 7291, 6009,
+    3806, 2392, 8839, 4353, 5909, 3210, 551, 8708, 5642, 1104, 5795, 8515, 1615, 2953, 7141, 3154,
+    5029, 5953, 5025, 3881, 1871, 8024, 2088, 4999, 434, 7960, 3534, 9043, 3814, 1617, 447, 9090,
+    2746, 2302, 6830, 7594, 4950, 6412, 3011, 7064, 4023, 1373, 7140, 6391, 5279, 294, 4403, 5412,
+    3043, 2451, 7564, 3785, 627, 6946, 5198, 958, 7395, 723, 3493, 5609, 1244, 5784, 8856, 3230,
+    4158, 8357, 5190, 4014, 2829, 8850, 9152, 923, 1262, 8199, 2064, 5950, 6320, 1537, 452, 2186,
+    2487, 1181, 730, 1218, 159, 5302, 8583, 3898, 4265, 6958, 5329, 5128, 2288, 7148, 514, 2459,
+    9200, 3585, 7591, 5481, 4569, 8559, 512, 6757, 4029, 3879, 6124, 2006, 3123, 4725, 6284, 757,
+    6430, 2886, 1852, 6023, 6302, 2424, 9089, 2803, 5646, 258, 5616, 226, 107, 4493, 8237, 5282,
+    6285, 7772, 2335, 4802, 9130, 7683, 7470, 5569, 1426, 7713, 192, 8175, 3087, 2143, 7484, 8941,
+    1531, 3414, 572, 582, 2409, 6350, 6794, 1694, 8964, 3954, 374, 6835, 227, 1610, 3663, 4248,
+    7121, 9114, 8666, 4751, 7053, 6097, 1904, 7073, 5848, 1109, 597, 4245, 5993, 4818, 498, 3794,
+    1211, 3614, 1530, 7211, 3579, 4272, 7709, 75, 6401, 437, 157, 606, 2477, 7514, 5169, 1416,
+    1627, 2830, 6164, 8791, 8754, 1581, 9062, 4026, 8692, 266, 4692, 4511, 6609, 2353, 8729, 8018,
+    2899, 6987, 8519, 3176, 6817, 1722, 4779, 2043, 8823, 8311, 8646, 1565, 6384, 5701, 5876, 5600,
+    4501, 2694, 499, 2658, 3900, 5805, 8740, 5333, 8132, 2902, 805, 5504, 6924, 5083, 5779, 342,
+    8868, 2094, 5319, 6031, 8537, 2367, 3893, 333, 5882, 3858, 5917, 7430, 7977, 492, 8771, 8448,
+    223, 980, 4136, 2756, 5762, 866, 8107, 5891, 8341, 346, 2369, 9125, 7084, 2814, 7532, 1732,
+    1051, 4343, 1234, 7355, 7404, 6491, 1158, 2974, 5050, 8621, 8012, 234, 5652, 4412, 2695, 7934,
+    2724, 543, 4739, 6288, 7933, 1962, 478, 8805, 4776, 7891, 1130, 6927, 3113, 8637, 890, 8786,
+    2298, 5982, 9191, 4113, 8541, 3500, 5915, 4990, 1737, 2494, 3519, 1905, 790, 2662, 5449, 3555,
+    8258, 925, 777, 2765, 1607, 5186, 1655, 7550, 4983, 3763, 6486, 5350, 4539, 6203, 4183, 2939,
+    1145, 4419, 8565, 3772, 104, 46, 1837, 3631, 8673, 7107, 7965, 8680, 3724, 7287, 2008, 4383,
+    6728, 2012, 4992, 2846, 8455, 1070, 4327, 1790, 2463, 3251, 1187, 7497, 876, 1206, 806, 8189,
+    5796, 5076, 5227, 3329, 7076, 6308, 9304, 8930, 7271, 1237, 4642, 4257, 3655, 5973, 6620, 3396,
+    6844, 5089, 7889, 6137, 3397, 5399, 1770, 2950, 1060, 1190, 3120, 2062, 2811, 6947, 406, 4686,
+    4442, 5797, 4587, 2809, 8424, 2022, 696, 8834, 7272, 6102, 6196, 4837, 4534, 2611, 7835, 794,
+    5872, 7216, 8518, 6217, 8819, 3217, 6909, 2360, 3553, 4697, 4413, 1448, 9289, 847, 3569, 4108,
+    4439, 9201, 5458, 283, 2511, 2197, 412, 8346, 1971, 5899, 3715, 4398, 8121, 4411, 3049, 9014,
+    4179, 5215, 969, 7108, 3699, 2521, 3868, 9084, 4497, 5260, 3783, 8802, 8866, 2351, 8993, 7388,
+    414, 5935, 5451, 2021, 4274, 1242, 4007, 8180, 6833, 8438, 8858, 1129, 1816, 8747, 2593, 8909,
+    5647, 6619, 7668, 7711, 5066, 4865, 7111, 7821, 5693, 912, 9018, 9007, 4105, 8826, 2280, 3170,
+    3129, 4000, 4228, 7488, 1482, 5019, 1322, 1344, 3577, 4408, 5977, 2904, 5199, 2046, 6664, 5059,
+    2676, 4050, 6784, 5507, 836, 7079, 2883, 1013, 3301, 1481, 4140, 4484, 7131, 3015, 1859, 7541,
+    8118, 9095, 3962, 2732, 953, 2504, 3825, 7340, 4009, 825, 9193, 7322, 8068, 4430, 4074, 7471,
+    6044, 1924, 2136, 578, 222, 7318, 4730, 6626, 999, 1066, 8932, 6568, 6375, 8162, 8551, 6907,
+    6610, 2339, 4929, 243, 2760, 4253, 8575, 6831, 5460, 5002, 9315, 1364, 5862, 3415, 6181, 2481,
+    1669, 132, 6661, 8002, 8406, 8640, 3950, 9223, 9123, 6998, 5502, 8348, 4890, 5589, 3079, 4072,
+    2116, 8267, 2434, 7807, 3759, 7008, 3139, 4032, 9247, 5290, 4200, 7144, 8765, 7932, 8225, 4892,
+    7154, 4418, 18, 3480, 2356, 9264, 9252, 8265, 3471, 4034, 4107, 6788, 5743, 2255, 4622, 5049,
+    5687, 4729, 6089, 9124, 4654, 5699, 1042, 6518, 3665, 6687, 4212, 2978, 828, 784, 3308, 5860,
+    3978, 6189, 2752, 8690, 2598, 2266, 670, 6177, 2206, 2384, 1792, 2670, 2887, 4989, 2048, 7193,
+    8240, 2848, 1868, 6732, 8719, 2404, 7330, 8445, 3393, 3748, 4901, 8097, 4154, 8824, 2300, 6995,
+    8244, 7361, 1979, 870, 8531, 2951, 5352, 3446, 4979, 2924, 7440, 6392, 5640, 2447, 1675, 4592,
+    3021, 7373, 539, 7627, 3622, 1807, 4555, 2729, 5751, 4878, 860, 4013, 4500, 6270, 3025, 5488,
+    809, 5060, 7817, 5094, 8444, 1797, 3339, 7786, 6323, 118, 7314, 4518, 2843, 7675, 2193, 1990,
+    4371, 1088, 5146, 2614, 7829, 6008, 7337, 3237, 2457, 5614, 3146, 6365, 8463, 8725, 3128, 8388,
+    1140, 3975, 5930, 5445, 814, 5512, 6176, 810, 7251, 7208, 3705, 8266, 6086, 8830, 6700, 7048,
+    4470, 817, 8130, 4280, 1977, 5303, 3607, 2792, 6651, 7725, 2131, 6204, 9066, 2108, 4672, 2261,
+    3477, 8656, 1591, 2354, 8533, 4633, 5225, 7648, 2262, 881, 2921, 7507, 4726, 3403, 1559, 209,
+    8352, 5588, 2888, 3108, 5127, 7096, 6451, 4716, 5016, 3904, 1489, 1854, 6697, 2913, 5744, 8473,
+    9300, 4897, 1266, 7342, 435, 2730, 9169, 3567, 90, 1049, 802, 6082, 8817, 4580, 8210, 6509,
+    898, 1278, 884, 6899, 7207, 3728, 5157, 1684, 9221, 3649, 9137, 6305, 2115, 1632, 8579, 9034,
+    599, 8562, 1040, 3831, 2874, 7941, 286, 2129, 1539, 4350, 8674, 9027, 1027, 8275, 4833, 2438,
+    1498, 6015, 759, 2017, 5371, 8025, 9215, 3706, 1585, 3671, 5673, 2996, 5356, 4363, 5810, 4984,
+    1949, 4276, 8488, 7105, 7055, 3404, 8279, 3098, 3291, 4331, 1132, 9328, 368, 7015, 7967, 550,
+    7828, 7394, 6103, 2244, 4955, 7082, 88, 6718, 4910, 6894, 9116, 198, 1314, 8331, 2691, 6554,
+    4807, 3771, 201, 4832, 7403, 4795, 4279, 4619, 780, 1623, 3375, 3492, 4238, 9222, 4823, 6199,
+    5153, 6530, 1452, 5944, 1678, 8663, 6324, 9266, 4474, 1332, 7774, 5832, 2484, 1691, 3818, 5901,
+    2489, 3433, 9268, 1052, 3186, 3850, 700, 250, 8695, 6763, 7312, 2025, 7562, 6246, 8570, 2530,
+    4917, 1756, 5543, 7705, 8907, 5152, 8847, 1238, 7036, 7898, 7559, 675, 7178, 9173, 1892, 8285,
+    3316, 5092, 5649, 9283, 6020, 2965, 6515, 5436, 3336, 3479, 4409, 4367, 408, 7832, 2640, 7341,
+    6277, 8202, 7974, 7432, 8196, 341, 1258, 8623, 161, 3379, 8405, 695, 4446, 8334, 3453, 3820,
+    2536, 3474, 6132, 171, 2308, 8778, 1580, 8796, 7230, 4143, 5878, 4712, 6673, 7566, 8305, 6000,
+    2988, 4645, 308, 2661, 4268, 501, 4994, 4825, 7429, 665, 4374, 3083, 4859, 6562, 4568, 4122,
+    4869, 737, 7177, 1470, 3758, 5036, 7822, 3926, 6824, 6441, 8529, 4713, 3934, 2656, 9254, 8401,
+    5344, 7381, 8468, 3657, 6219, 7806, 1249, 5641, 5331, 8741, 8757, 4676, 2539, 5706, 7521, 5422,
+    1204, 7825, 6690, 3548, 7501, 3749, 7256, 1345, 6078, 3859, 9311, 7920, 6144, 3652, 603, 8374,
+    6959, 8767, 5823, 9178, 1939, 8159, 521, 1897, 8582, 1236, 7592, 8088, 1021, 3028, 6901, 8662,
+    938, 6615, 7438, 8808, 5610, 7210, 6397, 4512, 1230, 1625, 8780, 7815, 8207, 2139, 7439, 5385,
+    4951, 7667, 4039, 7331, 4709, 1437, 5911, 8917, 1739, 5912, 9323, 2673, 3295, 4001, 6310, 3167,
+    8587, 6648, 8849, 7759, 7861, 7069, 2097, 3053, 887, 2633, 5749, 6838, 8618, 1735, 7223, 3752,
+    4650, 2237, 3460, 5521, 4062, 4489, 6494, 2063, 8530, 7903, 3726, 4506, 2319, 729, 4550, 196,
+    6248, 3782, 2172, 7947, 6883, 5419, 2326, 3922, 4665, 7480, 7356, 5849, 3688, 8288, 6253, 8963,
+    5242, 6194, 9157, 4791, 4628, 6172, 575, 3180, 4753, 608, 2704, 1212, 8745, 19, 4387, 7284,
+    873, 2359, 7755, 1309, 2018, 3051, 7245, 3310, 8643, 1621, 1720, 6992, 3571, 7724, 2925, 7235,
+    2903, 4624, 8914, 2652, 5822, 2622, 5478, 1388, 4079, 4635, 7016, 5770, 8452, 8706, 2385, 5835,
+    3890, 1557, 2605, 334, 631, 7855, 1883, 6807, 2824, 4688, 470, 367, 8841, 4416, 6187, 4004,
+    525, 2586, 766, 5567, 4064, 680, 2291, 7860, 5262, 4463, 1526, 6226, 5842, 3151, 5591, 7304,
+    7187, 49, 8457, 4681, 1269, 1366, 1529, 2278, 502, 2416, 253, 5671, 292, 4830, 5456, 8620,
+    436, 4190, 863, 6770, 6579, 6703, 1141, 2439, 4978, 7424, 2976, 8876, 5839, 1567, 6977, 321,
+    2822, 6848, 3489, 3496, 5715, 8021, 2498, 7819, 960, 6983, 5704, 9175, 65, 4260, 7862, 4271,
+    9165, 8395, 9140, 3556, 4670, 1381, 4959, 6165, 1814, 7296, 574, 7386, 5318, 5571, 5007, 5283,
+    731, 3357, 6523, 5788, 6360, 4251, 5454, 694, 8250, 4615, 6777, 9028, 2805, 4588, 4313, 6938,
+    8855, 3628, 3189, 7795, 5431, 7376, 560, 6974, 438, 1313, 1754, 5686, 2696, 842, 3481, 8586,
+    9080, 500, 1303, 8270, 3742, 7590, 5401, 1327, 5918, 6043, 4120, 4749, 6352, 7672, 4332, 2053,
+    7876, 5732, 7697, 7890, 5572, 5700, 5373, 9012, 3423, 1713, 362, 5338, 3408, 2929, 2871, 5328,
+    6282, 7078, 5037, 4028, 906, 1738, 5956, 5599, 9332, 5364, 3173, 7224, 4722, 1123, 5033, 3304,
+    5244, 8484, 9285, 758, 1867, 2174, 5203, 1493, 6422, 595, 1855, 5490, 9109, 5613, 2840, 9021,
+    3508, 141, 7174, 2781, 1945, 2130, 1676, 385, 5113, 7166, 589, 241, 8263, 4867, 628, 7478,
+    3774, 1176, 1589, 1566, 8019, 2638, 4967, 6003, 2373, 6279, 5224, 3457, 2971, 1009, 5394, 8408,
+    5980, 1223, 3790, 3539, 5708, 7909, 4736, 1334, 5306, 7763, 6035, 5342, 5042, 2092, 7025, 4056,
+    2168, 5400, 4216, 5035, 3906, 5517, 728, 4529, 8769, 297, 3086, 2370, 1609, 225, 7896, 1067,
+    6627, 2355, 6414, 6198, 6094, 3924, 7090, 5840, 1163, 6396, 1838, 5064, 4370, 6941, 1428, 2669,
+    9255, 6808, 3178, 8062, 8829, 2945, 8503, 8492, 874, 2245, 4055, 7421, 278, 5503, 3046, 8720,
+    3091, 2800, 8886, 7975, 4886, 228, 1415, 7417, 1758, 8890, 3991, 3275, 2286, 1709, 3888, 636,
+    7571, 7027, 2860, 459, 8013, 5538, 6875, 1803, 5374, 2052, 200, 739, 568, 4991, 5111, 8147,
+    6427, 1940, 7241, 9250, 3805, 4101, 8010, 2147, 8396, 6076, 8723, 5959, 567, 3823, 7308, 2989,
+    6580, 7900, 8971, 4466, 6221, 1760, 956, 1954, 744, 4721, 2145, 1747, 2389, 264, 849, 2299,
+    2723, 2690, 8467, 6600, 4294, 3278, 450, 4232, 6564, 6921, 2861, 7382, 7645, 2045, 9216, 5372,
+    2617, 7155, 1061, 2701, 5634, 5284, 356, 4708, 5475, 8, 738, 5775, 1464, 5231, 5086, 3105,
+    520, 4826, 3305, 6038, 646, 5430, 2990, 9009, 7679, 1704, 6910, 7847, 153, 1858, 2842, 4461,
+    5384, 8742, 8166, 3664, 4045, 8807, 9320, 7214, 6487, 4180, 3996, 2183, 644, 6547, 2566, 6544,
+    4455, 5195, 4647, 4510, 4038, 4449, 1657, 3332, 5453, 9042, 7171, 5435, 3999, 2497, 4515, 8508,
+    446, 1330, 6289, 6456, 2070, 3638, 4936, 5969, 8861, 9203, 1711, 3365, 1434, 5406, 909, 8094,
+    7737, 7651, 8370, 5992, 7533, 7509, 5285, 2674, 4660, 3220, 6426, 1147, 3097, 9226, 4187, 1217,
+    4151, 6773, 14, 7420, 8328, 8840, 6712, 93, 7248, 3309, 8458, 8483, 552, 8040, 8594, 1057,
+    2474, 3184, 3565, 4184, 624, 6121, 4775, 1886, 5620, 6714, 4302, 1551, 2577, 6825, 3216, 583,
+    732, 1921, 9258, 3491, 736, 3042, 3413, 8004, 3409, 2561, 921, 1923, 8599, 2163, 4661, 4030,
+    2991, 5723, 4925, 4578, 7534, 3899, 3842, 2450, 8693, 3549, 5150, 7359, 5479, 8293, 562, 331,
+    30, 995, 3819, 2268, 3114, 7392, 8775, 541, 4922, 5557, 6024, 4522, 3528, 6549, 1401, 3068,
+    6230, 7761, 4687, 1983, 907, 3461, 7680, 8737, 2155, 2612, 1312, 6782, 3382, 3880, 5683, 3586,
+    160, 6045, 207, 2793, 8595, 3594, 1719, 5345, 5464, 515, 8056, 6096, 716, 1601, 4414, 1062,
+    8538, 8535, 5568, 6766, 2343, 3849, 2091, 4016, 3264, 7539, 3795, 2879, 9122, 749, 609, 2225,
+    5494, 3141, 2956, 5158, 6650, 6404, 6706, 6985, 1629, 6810, 2388, 1931, 461, 8800, 2823, 9299,
+    5123, 6032, 9183, 3206, 1893, 6970, 8155, 1372, 92, 6823, 4571, 3736, 4771, 1907, 5375, 6280,
+    6743, 3707, 8404, 256, 7893, 8103, 1246, 6504, 6558, 5077, 9149, 220, 1887, 6686, 4773, 3568,
+    323, 8997, 3557, 1385, 7449, 2187, 1948, 7037, 7944, 7, 2727, 4297, 5976, 1876, 8996, 1519,
+    5924, 2771, 5730, 3179, 9003, 8910, 3946, 6496, 4817, 1243, 1642, 6272, 3775, 1377, 8759, 8990,
+    5767, 4473, 6488, 6978, 7071, 2408, 4684, 1343, 5989, 391, 1239, 8536, 7621, 5056, 812, 3323,
+    177, 8371, 9279, 1542, 7450, 4221, 7030, 727, 7364, 7034, 7354, 1582, 5675, 4147, 4918, 6140,
+    1026, 615, 6005, 9159, 4702, 6873, 954, 1980, 5452, 765, 5670, 7089, 340, 5818, 1433, 920,
+    4900, 8702, 1765, 3603, 5069, 8242, 1263, 7703, 1544, 6557, 6016, 3064, 7019, 4663, 6999, 4400,
+    5669, 8684, 2272, 3231, 1783, 8230, 4904, 6575, 2317, 3153, 3469, 5710, 4531, 7157, 2010, 7197,
+    1160, 5425, 3312, 2066, 3864, 8142, 2254, 2109, 781, 7986, 8099, 5237, 8140, 3747, 7045, 8418,
+    1888, 3700, 7605, 2414, 5100, 8241, 9077, 6759, 900, 5962, 4123, 2769, 4711, 4185, 2305, 8792,
+    8238, 4148, 9235, 2995, 1165, 7124, 7943, 6283, 2969, 8152, 380, 720, 2196, 4325, 2333, 2943,
+    175, 5074, 6667, 5450, 4044, 3860, 4706, 5396, 138, 6363, 3225, 3580, 1520, 1310, 2407, 9310,
+    3143, 762, 6192, 6563, 5679, 5815, 2141, 1850, 1673, 2233, 706, 4133, 1111, 2558, 1395, 8944,
+    6293, 4836, 8095, 7099, 3020, 6913, 7101, 5960, 4369, 3094, 4285, 612, 5498, 100, 8425, 6506,
+    6889, 8048, 1409, 2515, 8243, 7126, 213, 3767, 1122, 3288, 5782, 5867, 8247, 7407, 685, 6538,
+    5677, 1716, 1443, 3072, 3449, 6355, 2282, 2742, 6459, 5968, 819, 3627, 6707, 105, 4887, 5927,
+    6402, 6536, 8224, 5654, 4599, 4646, 2334, 5473, 4088, 752, 5870, 6881, 7425, 6472, 4731, 8204,
+    8074, 5265, 6433, 194, 2007, 6920, 8486, 9113, 2516, 5612, 7294, 2759, 7326, 1795, 2807, 3691,
+    7916, 986, 883, 943, 1406, 7827, 5984, 1618, 850, 474, 397, 6175, 2283, 2202, 3045, 6671,
+    2231, 6561, 7998, 2627, 4314, 336, 5254, 5099, 9312, 6228, 8041, 9325, 2545, 7149, 4975, 4973,
+    3637, 6168, 5124, 4728, 933, 7389, 581, 9031, 4806, 2473, 9271, 6220, 5549, 4042, 1533, 7247,
+    4877, 4767, 5105, 8325, 663, 688, 7091, 1671, 655, 7747, 4584, 2279, 1179, 3974, 3386, 7712,
+    8501, 4618, 6890, 5286, 7875, 5200, 6685, 2179, 5472, 4505, 6749, 8653, 4097, 9088, 6271, 4189,
+    6133, 26, 4462, 1466, 3667, 5556, 1169, 1272, 3689, 3330, 7637, 8491, 2118, 9146, 8825, 7319,
+    7236, 439, 7766, 1077, 9098, 8400, 8163, 6073, 2208, 7164, 1010, 7182, 3101, 7782, 9029, 8782,
+    4906, 638, 6720, 6069, 1805, 8979, 6011, 9094, 8272, 7244, 2014, 5380, 7283, 7796, 6261, 3366,
+    4870, 4533, 2250, 7793, 973, 119, 4551, 4059, 4318, 312, 3074, 2509, 872, 6800, 8158, 1605,
+    2926, 1870, 3363, 6218, 8634, 6906, 9238, 3780, 8186, 9045, 152, 6358, 3630, 2768, 1872, 9056,
+    6492, 3281, 5726, 3315, 8661, 2687, 6238, 7929, 6021, 4631, 462, 1847, 8148, 5590, 4768, 6679,
+    2134, 5721, 3109, 7606, 3953, 5633, 1640, 7024, 8967, 3792, 6332, 8938, 7459, 4010, 4295, 2702,
+    8363, 7086, 5615, 3935, 473, 4524, 4139, 9272, 7726, 9156, 8372, 3558, 2419, 423, 8957, 2398,
+    8988, 4801, 3941, 218, 2075, 1392, 3432, 2637, 8297, 5540, 5970, 4306, 4765, 8282, 1696, 5756,
+    4671, 125, 4246, 6670, 3582, 5177, 8184, 1188, 6242, 3511, 5578, 3677, 4005, 5259, 9151, 1315,
+    135, 5937, 7122, 8190, 5905, 415, 2417, 9218, 1164, 1421, 5631, 3982, 2720, 6854, 4923, 4903,
+    3952, 3892, 5838, 8479, 2527, 1358, 4616, 1953, 2898, 2087, 8762, 4395, 8011, 3544, 4365, 8513,
+    7708, 6735, 4508, 6816, 3515, 6560, 3081, 2032, 5028, 8506, 7856, 5907, 8980, 7338, 3709, 3484,
+    1410, 7289, 71, 6357, 4060, 1371, 8134, 1703, 5841, 2630, 918, 7205, 4558, 4424, 4589, 3061,
+    2226, 3803, 7568, 7183, 4496, 7848, 3613, 6313, 6898, 1569, 2534, 2361, 3837, 991, 8075, 4762,
+    5884, 5159, 463, 7800, 168, 3936, 9278, 1253, 2538, 1802, 6689, 8360, 3666, 4514, 2636, 5486,
+    7479, 9105, 4437, 4203, 4407, 5463, 80, 5816, 3610, 7608, 929, 3096, 6128, 6531, 3746, 1097,
+    4585, 4117, 1592, 4163, 4732, 6764, 2357, 3317, 2005, 6026, 6328, 8777, 5444, 9197, 1840, 9011,
+    1376, 5416, 399, 7184, 20, 7749, 6500, 8787, 5763, 1914, 908, 8426, 5773, 6304, 7979, 6556,
+    9075, 7476, 1661, 4926, 384, 5493, 6527, 3882, 5702, 3695, 8392, 3714, 9230, 8365, 1984, 4854,
+    4227, 5239, 6629, 710, 5082, 657, 8649, 9329, 2344, 4968, 2320, 8732, 934, 2072, 7179, 8625,
+    2550, 81, 7931, 4698, 8752, 8814, 1596, 8344, 7659, 7823, 5098, 102, 6984, 3245, 1207, 351,
+    764, 1664, 3248, 2472, 8650, 1927, 1107, 6845, 8602, 5505, 6227, 361, 5874, 4134, 1646, 7159,
+    5413, 8887, 1776, 1036, 7190, 311, 2712, 6522, 1686, 268, 3692, 1477, 1506, 7946, 4954, 9073,
+    2227, 2485, 3701, 3368, 8219, 279, 4346, 6879, 7147, 3830, 8029, 830, 12, 1880, 5783, 5376,
+    1474, 1745, 6301, 9135, 4620, 2479, 1961, 2672, 2034, 5720, 6053, 5442, 742, 2405, 3988, 1483,
+    4945, 2490, 701, 6662, 5122, 2543, 4349, 4153, 3885, 39, 774, 6408, 6184, 5065, 5714, 5165,
+    1403, 393, 2275, 4816, 6914, 4065, 2058, 4760, 6578, 202, 1910, 6660, 7857, 5217, 1251, 7334,
+    2618, 7874, 4114, 4521, 215, 6154, 2964, 56, 7619, 6708, 2980, 471, 2217, 131, 5550, 3070,
+    7494, 6795, 3867, 6742, 8547, 3512, 4693, 4427, 6337, 5072, 1029, 1121, 4993, 2802, 8688, 5858,
+    8248, 8314, 2569, 5908, 2421, 848, 1300, 5132, 7597, 2894, 1125, 6462, 7840, 1743, 3473, 2137,
+    6900, 6850, 939, 1558, 2123, 1995, 5541, 2697, 8934, 6640, 4841, 263, 7057, 1337, 4135, 1359,
+    6886, 580, 417, 4159, 5075, 3994, 1463, 4417, 3116, 3196, 940, 2412, 5785, 7738, 2138, 172,
+    6526, 6100, 9069, 8511, 714, 4085, 5813, 6062, 4931, 5798, 2461, 8730, 3207, 6348, 6733, 889,
+    8165, 4338, 2122, 9107, 5476, 3389, 1509, 6421, 1254, 2678, 9231, 1235, 1076, 5271, 6874, 7748,
+    3424, 8495, 3002, 6273, 7613, 3172, 5645, 2639, 8028, 7561, 8212, 2476, 3522, 3731, 1885, 1500,
+    1638, 6852, 8608, 2004, 3140, 1291, 6117, 2390, 8208, 1944, 2709, 3895, 617, 2084, 8784, 8916,
+    1116, 6754, 6222, 4478, 3992, 3306, 6603, 693, 7746, 5308, 3729, 2764, 5998, 8677, 2090, 9017,
+    3645, 5073, 1469, 4284, 5185, 7770, 2960, 8252, 5292, 5790, 6047, 8249, 3348, 8700, 3063, 7884,
+    5448, 5173, 708, 5664, 7963, 5404, 9281, 3562, 2615, 4881, 7556, 2799, 7604, 3921, 5906, 5561,
+    2541, 9102, 4774, 4821, 2460, 542, 8220, 1899, 7173, 206, 4914, 8428, 5191, 3939, 1819, 9044,
+    789, 6730, 9227, 1930, 9030, 2791, 7482, 7626, 3915, 3776, 7170, 7791, 5162, 7595, 926, 4700,
+    8439, 6760, 1628, 2680, 1175, 2372, 179, 6828, 7698, 4273, 6060, 6546, 771, 6138, 3056, 9168,
+    8923, 3620, 4095, 7644, 1929, 5395, 1724, 2936, 2881, 633, 5477, 6815, 7040, 5885, 7596, 878,
+    1387, 975, 2892, 276, 6028, 8969, 549, 4402, 1166, 4902, 8987, 3581, 557, 4536, 4523, 3642,
+    6657, 4106, 5134, 7845, 4748, 1439, 8232, 7276, 1505, 5632, 9138, 8047, 3412, 4091, 5847, 619,
+    4804, 4224, 6478, 1072, 4641, 3779, 3625, 9145, 1733, 6081, 7303, 9186, 2240, 2506, 7455, 8286,
+    3188, 6520, 6425, 210, 6483, 1844, 5071, 4625, 9338, 6351, 7907, 6583, 1563, 4949, 7500, 2815,
+    2166, 4301, 158, 5804, 3346, 4054, 4428, 1438, 5309, 6576, 8194, 5327, 3434, 290, 897, 8953,
+    5151, 7719, 5776, 8459, 1394, 6888, 8904, 5415, 4880, 642, 2336, 5833, 9347, 5334, 6646, 7129,
+    7195, 1460, 2184, 9202, 7919, 2653, 7002, 966, 7814, 203, 8981, 553, 9150, 1055, 5576, 7255,
+    3877, 8645, 892, 6934, 3735, 2547, 5205, 4264, 4209, 747, 994, 3155, 4127, 5047, 1117, 2039,
+    1461, 4335, 3052, 8870, 111, 4352, 3661, 8313, 8561, 365, 2428, 4759, 6818, 5156, 1087, 5717,
+    1752, 4433, 8417, 8435, 2677, 927, 229, 5183, 9298, 5754, 671, 8526, 7259, 1969, 7109, 8903,
+    2214, 7441, 3542, 8218, 7523, 280, 6748, 4226, 5470, 7513, 2080, 7219, 1504, 1054, 3639, 3361,
+    4192, 634, 310, 4207, 770, 4601, 1079, 8489, 1622, 795, 5245, 2175, 1325, 8605, 8523, 327,
+    5831, 8176, 1018, 6840, 3704, 9257, 7538, 2219, 7728, 6811, 6263, 6019, 8329, 5903, 1809, 1099,
+    3853, 6674, 996, 1205, 5996, 4564, 8553, 1203, 3394, 1729, 7901, 4964, 5305, 3551, 217, 1007,
+    8571, 4868, 6342, 4103, 6540, 8901, 8977, 523, 2919, 5865, 7487, 3226, 272, 8622, 8422, 6799,
+    6937, 6694, 3911, 7935, 329, 576, 5236, 7457, 5995, 2685, 5542, 420, 3976, 1020, 8804, 4913,
+    4947, 1287, 4483, 8546, 8883, 7460, 3929, 2836, 3362, 9342, 7370, 7093, 8502, 5432, 6484, 6101,
+    4740, 6813, 2436, 3650, 6208, 6126, 6693, 807, 3036, 7402, 5819, 3973, 3540, 5752, 4627, 2944,
+    6466, 2784, 9144, 2095, 145, 7290, 5799, 977, 2205, 9239, 2982, 1191, 640, 402, 4341, 2173,
+    7125, 7629, 5618, 5136, 2251, 2626, 4359, 6993, 1472, 964, 8431, 6347, 1411, 1112, 8984, 4296,
+    5440, 4146, 352, 5983, 1335, 1363, 8178, 6668, 2444, 6663, 7246, 8407, 193, 101, 5836, 3321,
+    3092, 5737, 8302, 2749, 2364, 6884, 8042, 2651, 1342, 5340, 4675, 7137, 5247, 7156, 8573, 4308,
+    5575, 4942, 37, 3676, 5447, 2023, 4780, 2798, 1151, 5948, 1311, 1348, 7924, 4842, 8891, 1073,
+    7035, 5519, 6195, 3766, 530, 8801, 1357, 5068, 8119, 1667, 8607, 1999, 5288, 5010, 5015, 1417,
+    7508, 3919, 4491, 840, 1682, 5707, 3223, 6145, 8922, 8447, 6450, 4861, 7616, 8982, 9303, 3202,
+    1386, 6976, 1555, 2112, 972, 8087, 7922, 460, 6436, 2086, 5859, 2211, 5142, 3286, 604, 3866,
+    8131, 251, 7681, 871, 7065, 7966, 2518, 8300, 7948, 3561, 4785, 232, 2000, 5821, 2544, 851,
+    5585, 6624, 4086, 4324, 7710, 3005, 242, 3117, 3335, 5850, 6290, 7524, 8893, 7767, 3030, 6040,
+    2229, 5307, 684, 767, 5997, 260, 6769, 1690, 2287, 6786, 6721, 1068, 3067, 2068, 7661, 7760,
+    1093, 3075, 7061, 8470, 7369, 2576, 1935, 6354, 5913, 444, 8114, 136, 9110, 3828, 4948, 5919,
+    2387, 6715, 3944, 1352, 5596, 1775, 3012, 4782, 9249, 888, 1815, 6688, 8149, 1453, 8604, 6477,
+    8268, 4337, 5005, 6445, 7639, 8669, 5383, 355, 4480, 7635, 7964, 5263, 4591, 3431, 3417, 8896,
+    6378, 8289, 4019, 9160, 4423, 8429, 8260, 3587, 2368, 395, 1666, 713, 5564, 8774, 8766, 4604,
+    5115, 6049, 3331, 8867, 1032, 2297, 7632, 1862, 8569, 3737, 626, 6149, 1389, 7461, 2296, 8499,
+    1089, 3219, 7646, 5135, 2934, 4372, 25, 3632, 5482, 4201, 230, 7892, 5513, 6185, 6388, 4464,
+    1296, 3598, 3674, 4177, 6676, 9210, 3478, 9251, 2493, 5343, 3224, 3966, 1082, 4444, 8321, 4170,
+    3443, 7285, 8397, 1528, 3270, 9198, 1182, 8739, 5987, 1418, 6972, 9236, 6826, 4815, 7691, 8619,
+    8110, 2966, 3538, 1705, 8641, 7750, 2074, 1941, 5801, 7732, 8600, 4255, 4282, 6410, 504, 3545,
+    8874, 1257, 9092, 4015, 3392, 610, 185, 8030, 348, 8799, 5420, 1740, 2682, 7682, 9000, 6625,
+    3773, 2872, 894, 3964, 6964, 246, 3979, 4526, 7102, 8627, 3017, 2209, 6268, 5341, 1424, 8332,
+    3378, 4431, 244, 9083, 3541, 2133, 5539, 79, 2505, 556, 4330, 5048, 6215, 3490, 659, 8936,
+    6751, 5182, 3822, 8545, 3187, 746, 3422, 9319, 1710, 3564, 7132, 9006, 5234, 8795, 2657, 4396,
+    8436, 7899, 5894, 1860, 4386, 4043, 2845, 7493, 2567, 9117, 5423, 8098, 9206, 5621, 5489, 3149,
+    1864, 6183, 3754, 9068, 8606, 8848, 11, 3967, 5276, 4425, 3164, 7865, 7081, 533, 4960, 1294,
+    70, 3160, 1974, 1324, 1742, 8209, 3135, 4710, 7202, 5193, 2748, 8505, 156, 8067, 6303, 8385,
+    5377, 2927, 4649, 4546, 9322, 4199, 4636, 5093, 1050, 3080, 2660, 9214, 7134, 6722, 2909, 5524,
+    7181, 5003, 4366, 7295, 5116, 3554, 8001, 6247, 4052, 2559, 7003, 6267, 1210, 3602, 4548, 3459,
+    7777, 4012, 8806, 4976, 3543, 6595, 2159, 8894, 7146, 3279, 328, 9292, 7495, 9220, 2126, 7360,
+    8127, 3527, 4498, 6872, 5357, 5552, 6917, 9072, 5270, 951, 602, 4071, 5085, 5856, 383, 2469,
+    4761, 6010, 7657, 8713, 7558, 5246, 8734, 1286, 3200, 3347, 5718, 8750, 4477, 5264, 5957, 5080,
+    1712, 1092, 8918, 6511, 7674, 8761, 570, 2857, 7282, 3029, 7788, 5786, 21, 6239, 858, 1231,
+    7926, 287, 9267, 1769, 3203, 3857, 6744, 6374, 1878, 8865, 7415, 4112, 5359, 3300, 8983, 9008,
+    1347, 1966, 5255, 4167, 5516, 8123, 7811, 7345, 9180, 2641, 5769, 6429, 1153, 2634, 1323, 4840,
+    9167, 5491, 755, 1139, 4933, 7142, 3526, 7843, 1967, 8066, 1507, 625, 3487, 7343, 9209, 7165,
+    1649, 8611, 6174, 3804, 7881, 2938, 7486, 8986, 2665, 6423, 2065, 6529, 9181, 1105, 6705, 5293,
+    6574, 9063, 455, 221, 4388, 6681, 4236, 837, 3722, 7868, 6497, 9185, 2200, 5800, 3931, 4883,
+    330, 796, 2906, 2273, 8577, 6792, 3156, 593, 7818, 7427, 1225, 8170, 3658, 8050, 7970, 7261,
+    3084, 4750, 8809, 3498, 8016, 2734, 3235, 1535, 2260, 5321, 7529, 698, 2595, 1126, 4720, 775,
+    7033, 8733, 4778, 7264, 2997, 6258, 5391, 6160, 4376, 7567, 6498, 3420, 3901, 8475, 3897, 490,
+    8398, 3797, 5990, 4857, 7871, 4035, 2104, 6108, 8477, 2743, 3509, 8768, 7984, 2341, 7789, 916,
+    3456, 8414, 5021, 2783, 7734, 7228, 5881, 237, 6398, 8437, 9177, 4420, 571, 1731, 8481, 8540,
+    4033, 1435, 9248, 7046, 2114, 5459, 8626, 1791, 3809, 8764, 1925, 7830, 8527, 6105, 7004, 7560,
+    5740, 1194, 9059, 6508, 7452, 1503, 8822, 8913, 4602, 8716, 5964, 6636, 536, 8624, 4211, 3488,
+    5925, 366, 8794, 3058, 740, 1586, 5602, 8871, 5802, 4401, 8403, 9259, 1813, 3817, 5761, 6596,
+    428, 4495, 9119, 1723, 2623, 130, 165, 1156, 4454, 532, 6333, 8504, 378, 401, 5565, 5695,
+    1577, 5378, 3014, 2524, 8320, 3195, 1170, 5499, 5530, 2510, 3502, 8449, 4315, 1583, 8138, 5443,
+    6264, 1603, 6346, 2620, 6162, 3838, 7718, 6710, 1299, 5316, 8036, 2767, 6341, 6070, 7433, 2435,
+    3395, 9074, 8715, 6713, 984, 4575, 1952, 1149, 1922, 4204, 1331, 6006, 254, 3284, 2851, 4160,
+    4300, 2295, 4025, 4889, 1761, 1700, 8136, 7118, 4772, 6780, 618, 5988, 3319, 8773, 7778, 826,
+    6967, 8354, 545, 4552, 6839, 1017, 8852, 2772, 1522, 259, 4746, 464, 5061, 9243, 6864, 8358,
+    8552, 6037, 1220, 8875, 8712, 5734, 1788, 669, 9302, 1748, 4566, 7756, 2322, 2144, 2554, 6440,
+    4513, 6989, 2449, 4310, 3370, 7009, 629, 7405, 845, 3364, 8061, 4132, 7553, 8828, 2643, 2413,
+    7352, 9128, 6458, 4894, 5349, 8235, 5887, 6339, 5313, 6570, 2069, 7945, 8664, 6739, 616, 2833,
+    8991, 8160, 7729, 5101, 2146, 6190, 2284, 6861, 4262, 6153, 8509, 8032, 6918, 534, 1697, 2625,
+    3634, 4476, 914, 8064, 2735, 3710, 8295, 7851, 3977, 8613, 6368, 5405, 2751, 5222, 8898, 3908,
+    5192, 5024, 6489, 4482, 9280, 6991, 2993, 4422, 7623, 4373, 7961, 2289, 5595, 3593, 3428, 2949,
+    3125, 6942, 3124, 1408, 2979, 7754, 3054, 2330, 707, 1681, 7707, 3475, 1282, 4394, 472, 6061,
+    1226, 4715, 8687, 3272, 8342, 6127, 4734, 5166, 5735, 2003, 6260, 8568, 7286, 4381, 4240, 1804,
+    2812, 3250, 6950, 4930, 8544, 8217, 5110, 4613, 3827, 8081, 6370, 9228, 4980, 8091, 936, 8476,
+    558, 5986, 4333, 7563, 5755, 6847, 4277, 7969, 1449, 1172, 2753, 4440, 4340, 1926, 9208, 7332,
+    1785, 7054, 3836, 508, 1277, 2725, 7660, 163, 4220, 555, 7600, 2293, 6286, 2533, 1672, 6090,
+    5758, 761, 5529, 7971, 5295, 2551, 1702, 6468, 3324, 7584, 6171, 7385, 3928, 2264, 91, 1568,
+    6316, 186, 126, 178, 590, 212, 8009, 1213, 1896, 9143, 7526, 2529, 846, 4046, 3259, 8128,
+    249, 8851, 3268, 5095, 4375, 5611, 5057, 82, 139, 6067, 9024, 5690, 2125, 2182, 5898, 6197,
+    1071, 6250, 5967, 4677, 5691, 5160, 7431, 803, 715, 8810, 7265, 8880, 8919, 6292, 7213, 5114,
+    4920, 6747, 2325, 7641, 8262, 4800, 6366, 947, 5354, 7186, 4109, 5018, 4348, 8644, 3026, 1978,
+    6233, 946, 4499, 1420, 5728, 4144, 3927, 240, 405, 2140, 3740, 4198, 8965, 9334, 8704, 5626,
+    1599, 1812, 3016, 7870, 8085, 8117, 371, 782, 8507, 5108, 6952, 4567, 5587, 5545, 4128, 1560,
+    952, 8092, 6517, 2047, 6115, 4905, 3174, 5471, 601, 1382, 6582, 1578, 3678, 5144, 8651, 9341,
+    7300, 4293, 6851, 162, 8978, 1162, 6821, 1193, 6836, 1293, 2038, 8303, 2973, 2912, 2218, 3355,
+    1321, 7058, 6236, 6642, 1095, 3832, 5583, 3440, 6577, 3201, 1216, 8353, 535, 8284, 2786, 6593,
+    52, 2610, 614, 8073, 3609, 6880, 5387, 5546, 8976, 853, 8145, 3523, 7491, 4724, 3995, 8259,
+    5320, 2307, 9060, 3472, 662, 8034, 7930, 8911, 267, 5429, 50, 622, 6139, 7000, 1001, 8071,
+    8033, 7472, 8213, 1561, 1728, 8950, 7666, 5863, 1012, 4061, 8514, 8793, 425, 8968, 38, 2777,
+    4161, 62, 409, 8696, 8211, 7799, 1431, 2213, 6104, 3307, 5825, 4808, 8063, 4820, 7070, 4971,
+    7603, 3654, 7005, 974, 7490, 7973, 6528, 3938, 1527, 7940, 4532, 3399, 129, 7824, 1384, 4705,
+    4673, 7902, 5535, 5854, 1413, 4329, 106, 6390, 2911, 5418, 2316, 8253, 6452, 2502, 7243, 7274,
+    3902, 5014, 6383, 5355, 68, 3328, 687, 3570, 2418, 9240, 7225, 1368, 3247, 5421, 7575, 3861,
+    2482, 7292, 2346, 1256, 4556, 143, 3574, 8327, 9242, 6214, 2552, 7410, 23, 8120, 5914, 3843,
+    8630, 7127, 5212, 2590, 8233, 1189, 2868, 5580, 433, 113, 2986, 4326, 5651, 3958, 7536, 4448,
+    6870, 6566, 7169, 5978, 882, 5630, 4345, 3730, 4467, 6791, 7362, 1515, 4995, 8816, 2415, 9327,
+    7143, 1319, 2905, 8659, 7204, 3018, 6841, 3833, 8831, 6930, 8788, 1811, 1556, 8797, 7049, 5104,
+    3055, 8125, 6966, 7685, 7380, 7520, 7463, 6719, 645, 3373, 5180, 231, 4057, 4819, 3466, 4090,
+    8781, 8364, 8236, 7721, 5594, 6955, 9115, 2402, 8658, 3390, 3118, 407, 6628, 4683, 3617, 271,
+    5954, 7088, 4434, 2977, 8245, 8522, 4048, 4844, 6112, 5363, 5794, 1399, 9051, 9055, 1078, 6048,
+    859, 8813, 4142, 6548, 7702, 8015, 678, 2077, 142, 6191, 1786, 5219, 5175, 8246, 86, 510,
+    8881, 3181, 1307, 2078, 5119, 2430, 5829, 6524, 4460, 596, 4385, 7994, 5680, 7217, 5133, 6871,
+    4492, 3171, 3069, 1554, 6571, 2148, 1200, 1810, 4899, 5209, 4895, 7043, 9013, 1553, 3166, 4066,
+    856, 9139, 4638, 2210, 2044, 2432, 2789, 3997, 5975, 7307, 7229, 3037, 9039, 5509, 2471, 9171,
+    3240, 8076, 5738, 4305, 9091, 8167, 5469, 3258, 3702, 3265, 2195, 40, 8985, 110, 1091, 6729,
+    7499, 5339, 9234, 7846, 4758, 1779, 8948, 1016, 6454, 3344, 6306, 630, 4219, 1991, 5194, 2027,
+    8512, 726, 5949, 5433, 6602, 967, 8412, 9086, 2082, 4873, 4022, 7997, 1771, 1787, 1402, 7467,
+    1538, 6041, 2961, 3205, 6130, 1976, 8639, 7250, 3293, 3383, 4691, 1136, 4362, 2236, 7696, 1120,
+    7103, 6274, 69, 6857, 7654, 9004, 507, 4390, 778, 2338, 5362, 2666, 9262, 3668, 4502, 658,
+    4860, 1192, 293, 3387, 7041, 913, 7936, 1645, 9037, 8093, 3401, 8106, 9345, 8427, 7982, 358,
+    5537, 7028, 4704, 7313, 2736, 1884, 4102, 563, 8356, 1957, 3725, 3273, 443, 4011, 7769, 3572,
+    8474, 5291, 5606, 516, 3482, 248, 9103, 4581, 577, 6482, 2036, 3536, 5347, 2930, 8255, 5733,
+    1146, 1915, 868, 2519, 4104, 5370, 2152, 7542, 66, 1346, 1874, 8601, 307, 5434, 4520, 9308,
+    6480, 7779, 1298, 9153, 6692, 5118, 1154, 2358, 4957, 1588, 392, 5961, 5326, 2111, 1901, 7011,
+    7990, 400, 4235, 3038, 2483, 935, 1268, 712, 7456, 7222, 2099, 7962, 1374, 7888, 8139, 4648,
+    8017, 1958, 7502, 961, 4094, 5000, 691, 1271, 2425, 6586, 2276, 8928, 5051, 7442, 3239, 2177,
+    8676, 7273, 4813, 2026, 4559, 1245, 4099, 3659, 528, 233, 3719, 1827, 3840, 4275, 1549, 6611,
+    2, 3280, 2671, 5361, 4252, 3955, 5409, 6059, 7776, 3918, 2587, 7112, 5367, 6331, 3485, 875,
+    7504, 2761, 7063, 363, 6863, 6643, 7577, 2675, 7555, 9305, 7655, 7879, 7557, 2150, 7537, 6616,
+    3813, 298, 174, 7039, 8859, 8897, 1202, 639, 7554, 3426, 5623, 3099, 7428, 8758, 5067, 353,
+    3359, 4344, 7412, 9331, 2918, 2098, 8146, 3547, 6393, 2076, 6039, 8949, 779, 7569, 2645, 1127,
+    652, 9313, 5330, 2429, 3165, 3531, 3608, 1831, 9079, 2873, 885, 7411, 2754, 3765, 4657, 6243,
+    6704, 4590, 529, 5379, 2963, 4213, 6439, 2491, 9087, 6141, 3337, 5238, 7617, 6814, 3233, 3945,
+    2644, 2531, 8746, 2401, 5187, 3690, 6891, 1475, 7853, 7013, 8193, 1950, 2165, 7519, 5039, 5034,
+    2565, 7325, 7805, 5210, 8413, 5001, 9016, 8239, 5298, 5941, 5893, 4208, 7038, 4481, 3506, 1848,
+    3296, 1972, 3384, 4017, 2455, 2882, 6432, 4036, 7758, 5149, 4855, 4846, 3623, 5579, 970, 8598,
+    8038, 5748, 2117, 2399, 1973, 4429, 8368, 793, 5746, 4397, 7258, 3884, 5598, 6893, 4351, 5437,
+    8751, 5933, 7580, 8206, 1547, 3789, 1148, 3846, 5747, 7031, 513, 4516, 8111, 3869, 2215, 5141,
+    6077, 5807, 754, 2042, 6756, 1839, 5171, 1846, 5492, 6251, 5584, 2556, 1198, 5660, 3521, 4838,
+    1875, 7047, 6933, 5951, 4441, 176, 8899, 506, 8694, 8183, 6699, 901, 7611, 1780, 7336, 1065,
+    6075, 2309, 112, 4404, 3193, 3110, 6419, 1992, 2865, 2853, 1422, 6442, 4632, 8185, 5685, 7408,
+    7443, 6809, 3131, 6485, 134, 8277, 427, 3093, 3134, 4082, 5397, 8617, 410, 8943, 324, 3959,
+    9047, 7020, 4176, 5760, 1467, 6956, 1647, 2239, 5547, 1800, 2410, 3687, 8310, 2132, 8567, 3451,
+    6205, 2864, 8039, 5674, 7910, 6088, 7505, 6389, 7353, 3909, 5926, 2870, 8629, 317, 9010, 6541,
+    6249, 3356, 3161, 2957, 1341, 7196, 3930, 3232, 4535, 122, 4175, 6652, 7240, 6923, 3254, 1118,
+    41, 7921, 3937, 257, 2040, 8393, 195, 2464, 4316, 2247, 1829, 5462, 6087, 1390, 4217, 3778,
+    2427, 3777, 1706, 6605, 2156, 3821, 668, 1178, 4194, 1167, 7877, 9058, 2952, 5851, 6774, 4379,
+    8543, 4202, 3559, 4790, 5653, 3398, 54, 6387, 3647, 8785, 3626, 895, 3494, 8294, 7543, 9256,
+    6420, 3115, 7198, 8946, 5011, 8197, 8812, 4391, 4111, 3299, 5233, 1152, 4651, 4741, 3476, 1393,
+    6110, 485, 7014, 8051, 1826, 1532, 404, 7985, 6542, 527, 8857, 5644, 2380, 284, 7583, 8528,
+    1340, 5896, 928, 5026, 7434, 7527, 4485, 7233, 3993, 2454, 8905, 834, 7189, 422, 2837, 8610,
+    7006, 6943, 3462, 2235, 7981, 6827, 8465, 3407, 8815, 8031, 8086, 7368, 1034, 6912, 261, 7917,
+    6118, 6400, 1030, 320, 8895, 5053, 6682, 8945, 3418, 5923, 370, 4668, 8421, 6474, 6862, 2456,
+    5939, 3872, 4542, 4479, 8150, 2153, 8498, 5428, 219, 5678, 6042, 8937, 6982, 2716, 6091, 9093,
+    2285, 8319, 1080, 3377, 573, 0, 2079, 821, 99, 3576, 94, 1841, 6736, 3956, 705, 5269,
+    1590, 1000, 4472, 7270, 3529, 390, 800, 3847, 1936, 6696, 3891, 3503, 8389, 1718, 1033, 1502,
+    5161, 7231, 3468, 7396, 1616, 1274, 8008, 7955, 8721, 544, 8724, 347, 6495, 8555, 7278, 6007,
+    5403, 3599, 3157, 2875, 3191, 1048, 8728, 8078, 7426, 3133, 8591, 1138, 1660, 149, 8100, 1746,
+    57, 2806, 291, 494, 5497, 9053, 6805, 5853, 6109, 2692, 8877, 7128, 2693, 4784, 9002, 8195,
+    5662, 8317, 4361, 8862, 6, 6761, 7914, 9260, 7260, 5532, 2820, 6371, 4067, 5411, 5386, 6675,
+    4909, 9318, 4849, 5808, 6589, 3646, 6532, 8631, 1240, 2983, 7485, 565, 7506, 8441, 2349, 6658,
+    4206, 4, 2706, 6612, 2850, 4040, 811, 6647, 1636, 476, 108, 6300, 988, 699, 9317, 2315,
+    5605, 569, 3106, 3303, 1918, 6298, 4076, 611, 8151, 598, 7372, 4358, 8485, 326, 1808, 332,
+    5107, 949, 992, 6255, 6377, 2304, 3588, 2055, 2856, 3406, 2446, 4742, 8141, 1611, 1620, 7511,
+    4453, 2224, 5526, 1634, 4291, 8182, 4237, 189, 8927, 5223, 8743, 4096, 786, 1329, 9204, 6278,
+    6622, 2160, 2635, 3095, 8576, 7739, 3302, 453, 4382, 1209, 4426, 2061, 1764, 7201, 3483, 7844,
+    5229, 5427, 6645, 5280, 1264, 4972, 6231, 3802, 7301, 2901, 8044, 8026, 540, 9297, 2028, 7092,
+    6702, 497, 482, 2826, 6036, 1131, 3066, 2602, 1159, 2795, 8998, 7489, 2318, 4290, 1934, 6543,
+    5759, 5311, 4312, 1227, 8902, 8581, 1951, 6903, 4126, 5155, 865, 1873, 7444, 7275, 6802, 1134,
+    2248, 6858, 7398, 9161, 5627, 1766, 1695, 3697, 6093, 1480, 343, 2738, 4164, 4674, 1933, 2391,
+    6516, 7952, 3314, 1150, 7374, 5694, 3595, 2453, 8069, 6050, 9330, 4799, 7306, 6608, 546, 4714,
+    9195, 2015, 1762, 1501, 5875, 3198, 4745, 1730, 3192, 2948, 6098, 1375, 5256, 6241, 3605, 2878,
+    4562, 8554, 416, 5032, 2801, 3027, 2310, 3815, 5109, 4696, 3933, 835, 235, 4487, 1059, 4996,
+    2501, 3644, 1959, 3960, 6882, 43, 1546, 8443, 2083, 8973, 8283, 893, 9108, 4682, 5622, 275,
+    6325, 4083, 8227, 824, 3764, 4399, 8023, 2931, 3121, 2437, 1003, 8343, 3076, 7150, 2629, 8588,
+    6122, 2189, 7262, 9020, 4617, 7882, 8355, 6986, 64, 5778, 2448, 1260, 2167, 6537, 6338, 458,
+    4864, 4545, 2228, 6768, 1913, 5536, 7551, 7188, 8214, 5366, 9333, 5857, 3612, 2571, 5712, 8480,
+    7106, 2345, 4958, 6820, 2303, 7194, 9301, 7864, 4829, 8832, 1512, 2073, 1397, 7579, 7114, 6379,
+    5483, 7522, 4156, 3274, 2813, 2525, 1891, 5648, 1513, 51, 7531, 2681, 8753, 8351, 8256, 5252,
+    519, 2780, 1451, 8685, 7249, 5063, 3078, 2532, 4598, 5868, 2758, 6911, 5873, 6372, 3584, 2376,
+    6256, 1956, 5897, 7866, 9133, 169, 3285, 2832, 7320, 299, 9293, 1360, 27, 4063, 4456, 5886,
+    1259, 1801, 7723, 7060, 9339, 3013, 648, 8496, 1133, 6717, 5250, 7113, 8226, 6740, 300, 6276,
+    6349, 8380, 6716, 3673, 9127, 128, 924, 1677, 1832, 1425, 509, 5809, 3744, 8409, 8442, 3894,
+    9033, 2467, 359, 3218, 2947, 6309, 783, 6186, 3369, 3345, 6413, 8460, 1038, 7023, 6437, 4137,
+    2863, 1851, 2328, 4943, 647, 2557, 4540, 8497, 4241, 85, 3276, 7100, 7610, 1495, 5274, 181,
+    7771, 5090, 7095, 3781, 2081, 792, 7885, 1613, 8798, 9148, 7773, 660, 4100, 2057, 465, 475,
+    289, 5446, 4763, 4087, 4311, 5168, 4970, 2715, 8524, 1275, 9121, 1612, 8153, 2928, 2776, 303,
+    1614, 768, 6793, 3019, 3294, 3238, 9306, 5787, 2895, 6111, 4171, 1454, 7042, 28, 5929, 7662,
+    9164, 1725, 2987, 5817, 3267, 1186, 2475, 6514, 9286, 6113, 211, 879, 1994, 1741, 3651, 262,
+    6565, 1510, 1975, 5214, 418, 4644, 6860, 692, 1023, 3212, 1297, 7158, 756, 4195, 3104, 4525,
+    2096, 4080, 8580, 3606, 3182, 5724, 5558, 3721, 5008, 6428, 3177, 2889, 2578, 8564, 8174, 3445,
+    3791, 7775, 5861, 1794, 9005, 3672, 2445, 6034, 5617, 8940, 1908, 8958, 8844, 8420, 7959, 3060,
+    2880, 3669, 5360, 2884, 3711, 2265, 7546, 4458, 9015, 1960, 6639, 4831, 7074, 3138, 8394, 2257,
+    5081, 4070, 1367, 4443, 8912, 87, 2766, 857, 2599, 4214, 9284, 4196, 1471, 120, 5213, 3751,
+    5013, 3158, 2893, 9344, 6765, 7938, 7052, 3425, 5902, 2876, 22, 1674, 7849, 2151, 6832, 1947,
+    2570, 13, 7797, 6143, 5955, 8995, 5258, 1654, 5624, 5368, 8318, 5468, 5603, 6259, 7589, 6431,
+    2711, 6997, 2230, 8096, 4874, 4845, 288, 2019, 7915, 8296, 2396, 1516, 1518, 5655, 1579, 8065,
+    8080, 3583, 4436, 2269, 6257, 7765, 7733, 7813, 8201, 2540, 3249, 2560, 5266, 5999, 4392, 3532,
+    2271, 942, 683, 1008, 2363, 3257, 4561, 3436, 976, 4450, 3533, 6159, 8419, 3024, 456, 489,
+    58, 411, 526, 3062, 9118, 7816, 4075, 1652, 2891, 2703, 4389, 3111, 4459, 8315, 621, 5510,
+    7288, 8257, 4377, 8089, 8590, 8416, 5774, 4609, 5910, 8633, 7123, 7206, 1006, 8369, 7051, 2563,
+    5332, 1339, 2655, 6297, 7001, 2523, 17, 9245, 4987, 6931, 7640, 9287, 5682, 73, 5147, 8596,
+    2959, 3340, 8102, 3537, 7232, 8376, 2232, 7418, 4907, 1895, 9038, 4354, 8933, 4640, 3159, 7152,
+    7453, 7115, 5791, 5392, 7834, 3455, 1400, 2962, 5102, 6778, 9326, 2588, 5871, 1833, 6329, 6493,
+    7937, 3374, 1903, 6085, 7587, 6745, 6734, 5659, 922, 3738, 3716, 1806, 8872, 2741, 1351, 2342,
+    5054, 4781, 5408, 3970, 4963, 7062, 1968, 5650, 7350, 389, 7942, 8572, 1025, 7923, 2500, 9187,
+    1981, 344, 735, 6359, 3829, 8735, 6829, 7633, 8337, 4986, 1289, 205, 313, 441, 7784, 1184,
+    5852, 8655, 7464, 8699, 7191, 2869, 6975, 1043, 791, 9096, 1219, 6232, 6022, 2164, 2688, 4519,
+    5220, 7180, 1404, 7496, 4031, 8776, 5009, 6916, 1707, 5965, 8154, 6457, 2313, 6502, 9036, 5843,
+    6001, 4384, 4152, 4579, 1221, 917, 8534, 6635, 3450, 2294, 2849, 8007, 4827, 382, 5879, 8560,
+    8384, 6068, 741, 5301, 15, 6444, 7897, 3122, 717, 9336, 448, 8558, 7120, 4797, 1336, 5129,
+    6925, 2512, 6591, 5044, 7602, 2382, 2263, 9179, 3244, 7741, 1185, 944, 98, 6971, 2613, 7745,
+    1195, 753, 8264, 3889, 5506, 7309, 5336, 7599, 4695, 8022, 8234, 33, 1963, 2157, 4848, 5753,
+    140, 6099, 7677, 2051, 4723, 6775, 7833, 8254, 1447, 2374, 7694, 7168, 673, 5725, 6025, 1717,
+    5639, 5559, 4197, 3132, 4885, 2583, 3641, 9001, 6079, 2403, 6590, 815, 5106, 9126, 7066, 3887,
+    7720, 7167, 5574, 2855, 3717, 3848, 3023, 4998, 4834, 6161, 9076, 6962, 6945, 335, 1304, 5130,
+    4445, 6936, 1523, 6146, 1772, 4261, 1863, 1541, 4006, 6552, 123, 6534, 7699, 7544, 3863, 2796,
+    6867, 8198, 7631, 724, 690, 6588, 6385, 8549, 7451, 5656, 3943, 8432, 6973, 2142, 3948, 6949,
+    3266, 197, 1763, 867, 1028, 2794, 2914, 6002, 592, 2779, 4689, 3430, 4626, 7176, 2238, 1534,
+    170, 8122, 5554, 8124, 5390, 990, 3214, 3768, 5314, 4509, 2877, 6418, 503, 7939, 1333, 6055,
+    7172, 864, 9174, 5466, 3358, 2243, 3517, 8156, 3597, 2526, 8665, 3385, 6954, 2568, 3816, 5789,
+    8731, 1035, 3685, 5866, 5582, 957, 5665, 4876, 2452, 1450, 2937, 7477, 9082, 4278, 6614, 2821,
+    1100, 146, 2431, 9070, 2379, 8789, 164, 1174, 6559, 1823, 4965, 5030, 8647, 4810, 5938, 8756,
+    6084, 1545, 702, 4435, 6178, 5920, 481, 7912, 6266, 3320, 477, 880, 3640, 1261, 932, 34,
+    3004, 2041, 3505, 5181, 1486, 4003, 3591, 6394, 2594, 3932, 4110, 1597, 3041, 7393, 6367, 3883,
+    2488, 7026, 7447, 4685, 3136, 9265, 5736, 483, 3694, 8216, 4888, 1608, 7625, 2212, 3604, 3119,
+    5202, 8790, 8722, 5936, 531, 7695, 6569, 7263, 1570, 3297, 4247, 2603, 5900, 3059, 8415, 6435,
+    772, 654, 4966, 239, 4941, 1441, 3260, 9064, 1943, 8251, 4307, 2721, 9032, 1986, 24, 2737,
+    839, 2462, 9104, 1998, 3601, 1659, 2507, 8222, 7365, 7808, 7138, 7894, 5398, 2719, 3681, 8772,
+    813, 151, 127, 9270, 548, 6601, 3905, 236, 3750, 2621, 5243, 3753, 7714, 1485, 5946, 6940,
+    1996, 1053, 5324, 5273, 1305, 5764, 6469, 4058, 8478, 7854, 1316, 6783, 3718, 1912, 2810, 6948,
+    8053, 5741, 681, 7757, 6519, 1497, 5577, 748, 2327, 3463, 5216, 1536, 3033, 5070, 7097, 8818,
+    7321, 3903, 6525, 1836, 8892, 7227, 8675, 2503, 9291, 7549, 6476, 1222, 1643, 5828, 1631, 1668,
+    948, 4727, 1255, 3222, 4977, 3465, 1440, 4792, 7252, 6915, 148, 4347, 910, 386, 937, 5508,
+    1484, 6004, 2107, 5004, 4574, 8744, 432, 8628, 2499, 1124, 5952, 487, 2383, 607, 4298, 6781,
+    7787, 1902, 3262, 7130, 3770, 4908, 4378, 5281, 1201, 3162, 1650, 124, 7951, 3621, 6866, 7351,
+    1103, 7993, 9246, 7950, 1648, 2016, 5012, 9147, 1595, 296, 8947, 1102, 7117, 7530, 4924, 7056,
+    3682, 3090, 10, 3793, 44, 4843, 3679, 6666, 2522, 8423, 522, 6335, 5768, 4852, 1626, 6701,
+    852, 6131, 1155, 6364, 5221, 8667, 1670, 7199, 8864, 2668, 7783, 2572, 8718, 8612, 2154, 3175,
+    2679, 5777, 6318, 4490, 7384, 4256, 6202, 4172, 7706, 1383, 3874, 1208, 4541, 6470, 7873, 605,
+    7535, 4871, 3405, 375, 7968, 6990, 6928, 1521, 5020, 8173, 3518, 7018, 5722, 8135, 9190, 7466,
+    6158, 3615, 2001, 7328, 3760, 5792, 3071, 3504, 6592, 2400, 3712, 1106, 2582, 468, 3619, 7925,
+    7810, 8433, 2705, 4486, 8550, 2324, 6395, 4488, 5346, 6922, 4557, 8999, 4652, 7436, 3437, 3467,
+    4231, 5197, 7742, 2816, 8105, 7422, 5052, 5514, 109, 1412, 7310, 325, 5455, 8636, 7972, 5167,
+    4985, 1692, 5597, 4764, 6581, 4786, 1552, 61, 7620, 7469, 3077, 3510, 8854, 8925, 3421, 8705,
+    5287, 6460, 7302, 1845, 8681, 4452, 2252, 1964, 5196, 1407, 564, 6725, 5353, 3040, 1849, 2916,
+    6789, 2011, 255, 8059, 6503, 6572, 4594, 7305, 7528, 1476, 2171, 4856, 3263, 2555, 116, 8035,
+    6409, 4614, 147, 5117, 1508, 2441, 838, 4538, 5501, 7956, 4932, 4544, 8113, 5241, 319, 1075,
+    1965, 3411, 53, 8966, 6656, 3590, 6018, 3103, 247, 7029, 9134, 1280, 7656, 6501, 5592, 4694,
+    3563, 1365, 7448, 5382, 7578, 1024, 1442, 8748, 5172, 5727, 664, 697, 3686, 6801, 3034, 6738,
+    2790, 2574, 7545, 7989, 4267, 2242, 7104, 5518, 2747, 493, 6463, 2580, 4707, 6750, 6963, 273,
+    245, 1917, 8931, 7200, 2201, 1828, 7367, 2632, 8108, 5207, 5888, 8942, 987, 2684, 734, 1693,
+    7762, 1444, 269, 2321, 5248, 4770, 8992, 5278, 1630, 265, 7744, 1369, 1356, 5325, 981, 4669,
+    7624, 3185, 2981, 1096, 8615, 3839, 8584, 5438, 4621, 7570, 4125, 301, 6512, 3372, 798, 4037,
+    2378, 1157, 8466, 6072, 5705, 5864, 2181, 8885, 9188, 7324, 479, 3841, 2608, 2332, 7059, 2105,
+    7731, 6095, 8654, 672, 1857, 8714, 7686, 6621, 4543, 5257, 9192, 7344, 1056, 7905, 3624, 9040,
+    8490, 3514, 2397, 2253, 3009, 4896, 6953, 3194, 1644, 2375, 3985, 3762, 7299, 6235, 6029, 2241,
+    9163, 4098, 5091, 8104, 199, 2054, 5757, 8493, 9276, 6806, 4634, 4504, 7234, 1058, 349, 5143,
+    8635, 3851, 9233, 1820, 1633, 6597, 4149, 4940, 4118, 4323, 7021, 5140, 5697, 4234, 9217, 4595,
+    1276, 5335, 2667, 4612, 8379, 5628, 2520, 1273, 396, 7548, 316, 7409, 5393, 787, 2908, 5889,
+    6210, 442, 5484, 3951, 854, 1683, 4664, 6461, 3448, 8962, 8027, 3003, 6201, 7254, 4355, 7516,
+    1378, 2535, 8469, 4891, 4020, 6295, 1919, 1937, 4875, 6604, 1069, 7859, 6785, 4218, 36, 2100,
+    7481, 7826, 5562, 6107, 7911, 8188, 750, 1843, 6155, 1755, 2120, 6013, 9182, 8309, 3100, 4866,
+    8603, 6033, 72, 4577, 4405, 1524, 3886, 3290, 3292, 5806, 9348, 1379, 184, 2609, 2589, 3852,
+    3989, 2954, 4988, 5772, 4744, 2050, 4798, 1679, 5742, 6772, 6125, 8322, 2838, 2649, 3126, 1932,
+    7689, 484, 6631, 6876, 5084, 4952, 3044, 1753, 8632, 4069, 4193, 7586, 7872, 6327, 1989, 3656,
+    3147, 5604, 486, 6307, 7483, 5826, 6555, 5883, 8736, 9219, 1821, 1727, 5570, 6415, 8453, 5485,
+    2900, 7573, 1970, 1687, 4916, 6326, 167, 2352, 4339, 5027, 1624, 3085, 518, 6623, 1229, 1818,
+    6968, 3560, 8660, 7257, 3727, 1689, 6653, 2311, 5322, 9232, 1317, 9282, 1161, 47, 7253, 5145,
+    3720, 8109, 6475, 8083, 8347, 6672, 5176, 133, 5692, 7650, 6598, 554, 3152, 4737, 7812, 2267,
+    2513, 1047, 8003, 5586, 674, 1328, 1350, 1197, 2465, 7151, 8961, 5566, 1856, 2406, 5991, 2312,
+    6240, 7327, 6443, 7988, 8172, 6980, 208, 6120, 6790, 4415, 7780, 5178, 3183, 4757, 5522, 7653,
+    2362, 2029, 5365, 7883, 9205, 4937, 7581, 6535, 4049, 2841, 3197, 7068, 4939, 7687, 3680, 1488,
+    7437, 2178, 7820, 96, 5666, 2770, 6376, 2847, 6106, 3796, 6855, 8333, 6447, 9170, 5457, 6407,
+    8672, 3786, 305, 2056, 8340, 7740, 4835, 8952, 632, 7279, 4537, 3022, 7390, 304, 559, 4243,
+    1494, 2858, 6726, 5148, 904, 6539, 3835, 5164, 4788, 5023, 6678, 7333, 4607, 1459, 2223, 6869,
+    5031, 5461, 635, 6434, 9100, 2818, 4092, 7503, 6311, 2985, 2420, 4811, 7329, 1525, 8783, 5688,
+    5500, 4289, 2835, 480, 6229, 6467, 8884, 6655, 6116, 4911, 2827, 5315, 5299, 8585, 1911, 3163,
+    6299, 5189, 6902, 7475, 8440, 8411, 8082, 1436, 2999, 3144, 1306, 4364, 1462, 9052, 6746, 8169,
+    6180, 1604, 2573, 3435, 9275, 911, 9054, 1593, 8642, 719, 7615, 173, 2281, 5771, 306, 1736,
+    8563, 7080, 8516, 3410, 7387, 1920, 3862, 7044, 2933, 6908, 2601, 8000, 322, 1881, 6224, 2103,
+    1228, 5351, 7781, 4738, 2710, 8532, 2422, 3546, 8215, 6296, 3256, 7162, 6152, 6356, 451, 7160,
+    7701, 2700, 7383, 2804, 3380, 2920, 998, 3708, 5781, 6944, 682, 3204, 1044, 7346, 620, 2508,
+    773, 2683, 711, 7435, 3662, 8299, 1798, 9, 1749, 1064, 2722, 1778, 285, 388, 1562, 3743,
+    2030, 816, 7585, 1171, 4410, 6771, 4701, 689, 4554, 8101, 4166, 5607, 4244, 7416, 3761, 1380,
+    6319, 5296, 7601, 8112, 4974, 7371, 2606, 2049, 2199, 1081, 2277, 4130, 651, 4658, 6723, 8203,
+    4233, 1022, 6453, 1550, 6334, 3566, 3213, 1214, 9120, 1168, 8335, 2817, 3438, 2466, 5495, 5890,
+    8878, 1014, 7913, 5527, 3524, 5511, 282, 5045, 7628, 751, 4124, 7419, 1598, 5895, 7978, 8115,
+    2020, 4928, 6321, 2301, 1128, 7991, 8116, 9162, 2607, 2101, 2089, 8006, 8727, 896, 3169, 4796,
+    2972, 2170, 7618, 8164, 55, 2542, 6147, 5439, 2426, 2194, 2553, 8187, 2161, 8924, 7022, 2698,
+    2106, 4131, 703, 4319, 9274, 1196, 8390, 8291, 4286, 6659, 5921, 5601, 7658, 3452, 3629, 7474,
+    6403, 3050, 7423, 5188, 7722, 2331, 1114, 2203, 1656, 3236, 1326, 2110, 3327, 1799, 1564, 1997,
+    2249, 1777, 5268, 5038, 2647, 1726, 968, 2659, 454, 3006, 804, 5765, 3635, 9273, 5966, 6510,
+    7192, 4041, 1825, 5, 8935, 9316, 6896, 1890, 2548, 6066, 4173, 2866, 7498, 3168, 8090, 9290,
+    9225, 3643, 4756, 3968, 2740, 7280, 8054, 2124, 8361, 1248, 5820, 4879, 3442, 3298, 2664, 8049,
+    4317, 4717, 3419, 9343, 3811, 2597, 6173, 2819, 7768, 8287, 4754, 121, 3920, 831, 8223, 7032,
+    2478, 5312, 2381, 6868, 9350, 3800, 3057, 4997, 6731, 3589, 8593, 8482, 7468, 4281, 9019, 2037,
+    2862, 3675, 9158, 8366, 3350, 83, 7083, 7492, 5916, 9132, 8908, 7163, 6762, 8350, 1721, 8359,
+    8276, 2198, 6123, 5465, 4322, 3234, 7465, 3801, 6849, 3242, 5267, 8970, 4872, 6727, 2867, 3807,
+    8863, 6479, 1793, 7838, 394, 3130, 3000, 4766, 9349, 2207, 4002, 6322, 930, 2663, 4077, 4073,
+    6188, 3703, 4803, 387, 8326, 8205, 7220, 566, 6156, 166, 2731, 7413, 2458, 7842, 8989, 6438,
+    5206, 7572, 1685, 7349, 8137, 7366, 1074, 7335, 3252, 6803, 3343, 3486, 8820, 2854, 2135, 7266,
+    2169, 6753, 5426, 4530, 7512, 9269, 4560, 5410, 4517, 1714, 5201, 4828, 2394, 5945, 467, 1594,
+    1517, 6960, 6315, 5814, 7906, 2907, 1688, 6505, 579, 5940, 4494, 2757, 2323, 3965, 7238, 7358,
+    3596, 6169, 6382, 7347, 6926, 8373, 4368, 1928, 8464, 8386, 5402, 7119, 4432, 2127, 9112, 7525,
+    6553, 6234, 613, 3444, 6471, 9101, 3633, 9099, 6381, 7927, 3552, 3784, 3035, 5087, 7992, 1090,
+    7133, 3391, 1177, 4777, 8181, 8280, 7135, 6083, 295, 7836, 6796, 5317, 8472, 5837, 2942, 7957,
+    8161, 2546, 862, 2221, 1698, 7269, 5174, 5667, 4938, 820, 4752, 8072, 537, 2859, 6417, 8316,
+    776, 4893, 4145, 4283, 2149, 6179, 8143, 661, 4794, 8683, 4239, 1455, 4703, 8399, 7999, 3810,
+    4593, 8362, 844, 3723, 8375, 5235, 3073, 3741, 314, 2718, 8879, 1005, 2060, 8648, 6684, 3007,
+    5812, 6606, 6314, 3349, 8539, 369, 3912, 4008, 8592, 8323, 252, 183, 6142, 8763, 8703, 6054,
+    8330, 2222, 8616, 7688, 5277, 5121, 7576, 4610, 6017, 7552, 3148, 1432, 191, 8261, 224, 2371,
+    4121, 6056, 2717, 7242, 3653, 8548, 679, 5958, 2885, 2188, 2923, 7736, 3255, 9111, 5880, 7692,
+    4360, 1101, 3031, 4653, 2258, 8556, 5608, 1651, 238, 8058, 8456, 2274, 6634, 5467, 584, 60,
+    9176, 7764, 403, 7098, 1900, 6599, 7643, 6129, 6151, 6618, 3845, 35, 7869, 3618, 3048, 8900,
+    7297, 1511, 6633, 6632, 8157, 4309, 5972, 7087, 150, 7462, 8273, 4165, 16, 8614, 3039, 3798,
+    5636, 7700, 3788, 6665, 5103, 1909, 3769, 6988, 5017, 5638, 959, 6223, 7790, 1046, 5698, 6711,
+    1355, 2646, 8014, 103, 4299, 137, 5625, 9224, 9026, 3896, 6929, 637, 8077, 3127, 4471, 2185,
+    8670, 5947, 2745, 2967, 588, 2834, 4824, 1224, 1308, 1796, 8709, 8043, 430, 1086, 4583, 97,
+    4174, 6464, 3826, 5154, 424, 5058, 7684, 2915, 6052, 7075, 1866, 7582, 4733, 9172, 6211, 822,
+    7996, 2192, 7593, 1987, 6080, 3208, 7804, 9097, 4629, 1619, 1015, 4576, 2785, 2778, 6245, 8959,
+    843, 8652, 6252, 5922, 3289, 7693, 2393, 2365, 6265, 2998, 3734, 4304, 8510, 5869, 3381, 5520,
+    7139, 7237, 4956, 677, 8678, 3441, 6135, 3501, 4678, 5563, 4680, 5750, 4053, 2940, 7798, 4021,
+    4258, 989, 4572, 3190, 905, 3969, 5232, 4969, 3253, 8231, 8177, 6074, 2619, 5942, 5040, 3983,
+    2600, 4266, 2984, 7547, 2828, 5729, 6254, 9261, 886, 4178, 1773, 1283, 4643, 4186, 1427, 5043,
+    3333, 7136, 7357, 3693, 2440, 2726, 8191, 9061, 3871, 3360, 5904, 8837, 945, 7794, 1574, 6641,
+    3961, 8338, 8461, 5643, 6758, 1573, 785, 6584, 5112, 4081, 3981, 8578, 3683, 8381, 2713, 594,
+    6585, 6724, 9078, 6613, 302, 8821, 6957, 971, 5855, 377, 8129, 8717, 2024, 1, 4168, 5553,
+    9207, 1889, 9071, 5523, 2514, 4229, 2350, 5892, 8179, 963, 5170, 8929, 5716, 7518, 6677, 1405,
+    8298, 76, 8382, 6853, 7609, 8972, 7153, 4921, 9035, 7215, 8005, 3032, 117, 9321, 6490, 4666,
+    1708, 5417, 1869, 8133, 763, 381, 1602, 457, 4735, 8517, 5240, 2246, 5931, 9136, 1834, 8290,
+    6594, 8292, 1587, 7665, 5381, 5097, 4962, 8378, 4565, 9340, 7110, 7446, 1865, 7954, 9023, 5337,
+    721, 8345, 8521, 3525, 5672, 42, 1751, 3648, 1456, 799, 7715, 8842, 1606, 1789, 7221, 788,
+    2234, 3971, 1180, 2896, 7400, 7458, 32, 1757, 1108, 2992, 8402, 5249, 538, 7953, 3910, 2306,
+    1822, 8304, 1491, 6654, 1119, 1241, 4328, 6119, 3470, 9346, 1492, 3575, 1817, 2774, 7622, 495,
+    2604, 3341, 9049, 9295, 1982, 3497, 667, 9022, 6361, 3972, 4747, 8833, 2337, 5548, 4637, 4078,
+    7642, 6691, 8682, 2537, 9155, 7598, 2329, 7239, 5414, 1295, 9263, 8430, 7752, 7887, 5424, 2581,
+    902, 7574, 6905, 6812, 6207, 6695, 5681, 801, 4608, 8915, 4393, 4068, 855, 3940, 3756, 600,
+    6617, 3311, 5230, 983, 1861, 7670, 877, 8954, 8324, 6837, 2013, 903, 6834, 5719, 8450, 8921,
+    6752, 7377, 3520, 6216, 3326, 4259, 3246, 6932, 270, 3047, 8471, 6533, 5131, 2377, 8487, 2689,
+    4611, 7323, 1429, 1430, 1142, 5573, 1637, 4953, 426, 3916, 6058, 2528, 6281, 8312, 2585, 4249,
+    5731, 1002, 3429, 6499, 345, 722, 4451, 7218, 2852, 9309, 1457, 5658, 8451, 77, 5593, 5358,
+    5619, 3535, 7678, 8994, 6448, 6822, 8079, 9041, 4898, 7017, 7809, 2119, 5163, 7007, 4623, 591,
+    1540, 8269, 3876, 7636, 7863, 2071, 84, 7588, 5971, 3089, 1419, 4919, 29, 1701, 2270, 9106,
+    8446, 4027, 1499, 9337, 6330, 656, 4814, 7281, 2191, 5668, 718, 6804, 5963, 1414, 4812, 1011,
+    8873, 5684, 517, 4084, 4129, 4024, 9288, 1774, 5845, 6567, 2782, 6550, 4527, 315, 9131, 4093,
+    2970, 6776, 3942, 5208, 6887, 7839, 1663, 372, 1715, 6819, 6573, 1496, 8307, 6787, 9142, 1768,
+    8192, 4981, 1290, 1137, 7515, 6885, 5766, 7116, 6680, 8589, 1285, 586, 7676, 6114, 3592, 1576,
+    8060, 6213, 7690, 4718, 379, 8070, 3282, 1478, 4679, 7983, 2591, 5184, 962, 8906, 653, 2932,
+    6755, 4882, 8701, 4465, 6798, 4655, 5369, 7510, 8869, 1084, 2773, 5637, 7085, 8278, 6904, 5289,
+    709, 3913, 1543, 4862, 3241, 3914, 7717, 376, 4606, 1665, 5581, 2922, 2831, 8638, 3229, 3573,
+    2654, 1473, 7375, 4851, 4119, 1037, 9046, 5261, 3142, 6513, 4357, 4215, 808, 1993, 6961, 7878,
+    1113, 1094, 6294, 5803, 429, 466, 5137, 3984, 6465, 5138, 899, 2433, 7949, 6406, 8960, 982,
+    861, 2975, 1423, 4182, 823, 8542, 7880, 3353, 2496, 2714, 8882, 3388, 9229, 6919, 2839, 3787,
+    413, 6206, 3550, 4336, 1653, 4805, 5062, 3957, 1354, 7987, 9253, 1252, 8843, 6994, 6193, 4787,
+    1680, 4934, 6209, 9335, 2642, 4822, 4586, 4150, 1362, 6587, 3102, 2808, 1031, 8657, 7316, 8697,
+    4596, 8853, 4406, 1279, 2495, 491, 8271, 1877, 7895, 3351, 5348, 2910, 7315, 869, 2584, 1988,
+    827, 3088, 4507, 3439, 1396, 7145, 3616, 5480, 9065, 8710, 8691, 337, 4468, 8955, 686, 4946,
+    5228, 8281, 48, 6336, 8200, 3065, 1041, 6405, 6287, 6212, 5703, 5713, 4342, 7212, 965, 3907,
+    3733, 7614, 3221, 5487, 6317, 7363, 2162, 941, 8835, 797, 6455, 7414, 6344, 4528, 5294, 1575,
+    5560, 6767, 3269, 979, 3215, 6644, 1063, 4155, 2762, 4719, 2744, 6877, 2699, 6981, 1215, 3611,
+    9085, 2517, 2733, 364, 5534, 6051, 6225, 3227, 8037, 8557, 7852, 9212, 4210, 2366, 7203, 4961,
+    4141, 6237, 1784, 4783, 4884, 2958, 2628, 114, 1143, 4809, 7077, 1662, 1232, 3338, 8500, 1353,
+    6373, 4603, 4935, 5844, 1468, 3739, 4162, 421, 8738, 8888, 4223, 2158, 7647, 7958, 67, 547,
+    4549, 3530, 3824, 6965, 8811, 585, 6551, 6166, 3660, 4047, 6014, 1265, 1882, 5711, 1548, 5830,
+    496, 357, 7454, 6345, 2562, 4205, 6630, 1233, 3112, 8228, 2067, 4690, 4116, 1942, 6269, 6935,
+    8168, 2443, 4789, 8383, 650, 743, 6521, 2348, 7669, 6170, 7858, 1571, 8755, 3865, 8274, 445,
+    7673, 8144, 1853, 3980, 4380, 3745, 7634, 4659, 188, 6895, 1115, 760, 6481, 2347, 769, 7399,
+    7831, 5739, 1835, 1879, 154, 1098, 9196, 4600, 6507, 2216, 8889, 9141, 8975, 4563, 4630, 1039,
+    2085, 4639, 5551, 31, 3001, 7630, 4263, 5544, 2728, 5974, 8020, 8377, 2190, 2102, 1110, 8084,
+    7311, 4912, 1267, 2492, 2968, 2121, 7012, 6878, 440, 4421, 6092, 2340, 2631, 2031, 5275, 2480,
+    3277, 6157, 1635, 5407, 45, 8846, 190, 1391,
+];
+
 use crate::sqli::TokenType;
 
-pub fn lookup_word(word: &str) -> TokenType {
-    let upper = word.to_ascii_uppercase();
-    
-    // Binary search through sorted keywords
-    let result = SQL_KEYWORDS.binary_search_by(|k| k.word.cmp(&upper));
-    
-    if let Ok(idx) = result {
-        match SQL_KEYWORDS[idx].token_type {
+/// Finds the keyword table entry for `word`, ignoring ASCII case.
+pub fn find_keyword(word: &[u8]) -> Option<&'static Keyword> {
+    if word.len() > MAX_KEYWORD_LEN {
+        return None;
+    }
+    let slot = crate::phf::slot(word, KEYWORD_SEED, &KEYWORD_DISPS, KEYWORD_SLOTS.len())?;
+    let keyword = SQL_KEYWORDS.get(usize::from(*KEYWORD_SLOTS.get(slot)?))?;
+    if keyword.word.as_bytes().eq_ignore_ascii_case(word) {
+        Some(keyword)
+    } else {
+        None
+    }
+}
+
+pub fn lookup_word_bytes(word: &[u8]) -> TokenType {
+    if let Some(keyword) = find_keyword(word) {
+        match keyword.token_type {
             b'k' => TokenType::Keyword,
             b'f' => TokenType::Function,
             b'U' => TokenType::Union,
@@ -9652,6 +10491,2336 @@ pub fn lookup_word(word: &str) -> TokenType {
     }
 }
 
+pub fn lookup_word(word: &str) -> TokenType {
+    lookup_word_bytes(word.as_bytes())
+}
+
+// Blacklisted fingerprints packed into u64 keys, in perfect-hash slot order
+const FINGERPRINT_SEED: u64 = 0x0000000000000000;
+
+static FINGERPRINT_DISPS: [(u32, u32); 1674] = [
+    (0, 6), (0, 18), (0, 54), (0, 140), (0, 1), (0, 132), (0, 0), (0, 188),
+    (0, 24), (0, 0), (0, 2), (0, 41), (0, 29), (0, 0), (0, 0), (0, 19),
+    (0, 121), (0, 0), (0, 41), (0, 2), (0, 16), (0, 222), (0, 0), (0, 559),
+    (0, 75), (0, 19), (0, 4), (0, 3), (0, 1), (0, 104), (0, 103), (0, 14),
+    (0, 4), (0, 46), (0, 16), (0, 48), (0, 1), (0, 34), (0, 4), (0, 16),
+    (0, 75), (0, 341), (0, 35), (0, 14), (0, 25), (0, 14), (0, 39), (0, 10),
+    (0, 1), (0, 2), (0, 232), (0, 1), (0, 15), (0, 299), (0, 1472), (0, 18),
+    (0, 42), (0, 0), (0, 104), (0, 285), (0, 4), (0, 0), (0, 1863), (0, 84),
+    (0, 16), (0, 1861), (0, 6), (0, 0), (0, 0), (0, 75), (0, 814), (0, 124),
+    (0, 156), (0, 29), (0, 994), (0, 3), (0, 16), (0, 185), (0, 5), (0, 12),
+    (0, 104), (0, 278), (0, 1), (0, 1), (0, 15), (0, 4), (0, 0), (0, 66),
+    (0, 15), (0, 0), (0, 114), (0, 3), (0, 67), (0, 1167), (0, 400), (0, 16),
+    (0, 2), (0, 3), (0, 580), (0, 948), (0, 44), (0, 0), (0, 43), (0, 21),
+    (0, 28), (0, 20), (0, 55), (0, 4), (0, 695), (0, 2), (0, 126), (0, 417),
+    (0, 72), (0, 70), (0, 19), (0, 2), (0, 69), (0, 2), (0, 5), (0, 41),
+    (0, 85), (0, 13), (0, 119), (0, 473), (0, 491), (0, 1), (0, 44), (0, 437),
+    (0, 4), (0, 3), (0, 4), (0, 2), (0, 5), (0, 33), (0, 1098), (0, 18),
+    (0, 4), (0, 70), (0, 18), (0, 229), (0, 48), (0, 504), (0, 3), (0, 3),
+    (0, 67), (0, 84), (0, 831), (0, 5), (0, 7), (0, 8), (0, 155), (0, 33),
+    (0, 0), (0, 2082), (0, 0), (0, 343), (0, 473), (0, 401), (0, 39), (0, 192),
+    (0, 2), (0, 12), (0, 0), (0, 34), (0, 207), (0, 35), (0, 703), (0, 220),
+    (0, 0), (0, 62), (0, 0), (0, 1315), (0, 0), (0, 258), (0, 10), (0, 46),
+    (0, 10), (0, 116), (0, 349), (0, 114), (0, 33), (0, 526), (0, 24), (0, 80),
+    (0, 1), (0, 41), (0, 23), (0, 0), (0, 144), (0, 27), (0, 66), (0, 0),
+    (0, 419), (0, 19), (0, 5), (0, 20), (0, 15), (0, 316), (0, 47), (0, 141),
+    (0, 7), (0, 0), (0, 0), (0, 339), (0, 2), (0, 0), (0, 437), (0, 276),
+    (0, 171), (0, 277), (0, 422), (0, 3), (0, 109), (0, 124), (0, 1004), (0, 17),
+    (0, 5), (0, 0), (0, 16), (0, 412), (0, 3467), (0, 127), (0, 144), (0, 223),
+    (0, 2068), (0, 177), (0, 1), (0, 59), (0, 43), (0, 19), (0, 1), (0, 56),
+    (0, 13), (0, 1), (0, 449), (0, 1), (0, 0), (0, 2), (0, 457), (0, 9),
+    (0, 67), (0, 267), (0, 1288), (0, 381), (0, 770), (0, 39), (0, 1069), (0, 83),
+    (0, 1663), (0, 0), (0, 180), (0, 18), (0, 39), (0, 891), (0, 1), (0, 64),
+    (0, 768), (0, 3), (0, 41), (0, 15), (0, 1566), (0, 128), (0, 56), (0, 4),
+    (0, 53), (0, 14), (0, 867), (0, 79), (0, 60), (0, 501), (0, 85), (0, 7),
+    (0, 547), (0, 54), (0, 73), (0, 68), (0, 0), (0, 835), (0, 238), (0, 26),
+    (0, 1), (0, 13), (0, 140), (0, 70), (0, 37), (0, 29), (0, 8), (0, 6),
+    (0, 845), (0, 97), (0, 35), (0, 33), (0, 22), (0, 12), (0, 677), (0, 156),
+    (0, 1361), (0, 50), (0, 8), (0, 1447), (0, 31), (0, 3), (0, 123), (0, 23),
+    (0, 1705), (0, 1), (0, 43), (0, 91), (0, 20), (0, 0), (0, 268), (0, 174),
+    (0, 47), (0, 259), (0, 1091), (0, 5), (0, 5), (0, 471), (0, 43), (0, 287),
+    (0, 15), (0, 10), (0, 37), (0, 4), (0, 6), (0, 133), (0, 36), (0, 1),
+    (0, 0), (0, 0), (0, 278), (0, 1359), (1, 15), (0, 16), (0, 47), (0, 1550),
+    (0, 14), (0, 330), (0, 2), (0, 3), (0, 10), (0, 66), (0, 868), (0, 346),
+    (0, 9), (0, 2), (0, 67), (0, 20), (0, 213), (0, 392), (0, 23), (0, 237),
+    (0, 226), (0, 86), (0, 892), (0, 110), (0, 6), (0, 26), (0, 14), (0, 9),
+    (0, 13), (0, 90), (0, 13), (0, 1040), (0, 109), (0, 112), (0, 212), (0, 201),
+    (0, 3), (0, 5), (0, 230), (0, 370), (0, 68), (0, 542), (0, 21), (0, 102),
+    (0, 3), (0, 2697), (0, 15), (0, 276), (0, 519), (0, 260), (0, 0), (0, 800),
+    (0, 68), (0, 2), (0, 87), (0, 354), (0, 470), (0, 135), (0, 2), (0, 86),
+    (0, 9), (0, 39), (0, 619), (0, 0), (0, 94), (0, 2), (0, 0), (0, 953),
+    (0, 1008), (0, 57), (0, 14), (0, 31), (0, 12), (0, 127), (0, 379), (0, 40),
+    (0, 1041), (0, 54), (0, 2), (0, 310), (0, 576), (0, 175), (0, 0), (0, 139),
+    (0, 95), (0, 95), (0, 385), (0, 91), (0, 24), (0, 21), (0, 384), (0, 1),
+    (0, 440), (0, 1397), (0, 424), (0, 168), (0, 8), (0, 188), (0, 0), (0, 2542),
+    (0, 3), (0, 4), (0, 528), (0, 4), (0, 697), (0, 117), (0, 1070), (0, 862),
+    (0, 383), (0, 2), (0, 686), (0, 120), (0, 1333), (0, 97), (0, 186), (0, 198),
+    (0, 44), (0, 7), (0, 6), (0, 170), (0, 77), (0, 142), (0, 0), (0, 48),
+    (0, 746), (0, 0), (0, 0), (0, 1), (0, 863), (0, 423), (0, 21), (0, 1170),
+    (0, 15), (0, 2133), (0, 42), (0, 40), (0, 192), (0, 322), (0, 490), (0, 58),
+    (0, 70), (0, 181), (0, 245), (0, 1), (0, 221), (0, 1391), (0, 275), (0, 1306),
+    (0, 68), (0, 66), (0, 10), (0, 38), (0, 831), (0, 29), (0, 264), (0, 1007),
+    (0, 43), (0, 3), (0, 35), (0, 1454), (0, 7), (0, 529), (0, 66), (0, 2031),
+    (0, 3146), (0, 245), (0, 186), (0, 5), (0, 212), (0, 7), (0, 2734), (0, 148),
+    (0, 731), (0, 35), (0, 298), (0, 111), (0, 7), (0, 0), (0, 827), (0, 349),
+    (0, 39), (0, 661), (0, 3356), (0, 26), (0, 17), (0, 456), (0, 14), (0, 4),
+    (0, 12), (0, 1008), (0, 101), (0, 2), (0, 0), (0, 596), (0, 223), (0, 20),
+    (0, 287), (0, 376), (0, 518), (0, 51), (0, 0), (0, 1049), (0, 41), (0, 103),
+    (0, 0), (0, 9), (0, 22), (0, 4), (0, 396), (0, 292), (0, 2754), (0, 16),
+    (0, 3365), (0, 277), (0, 149), (0, 44), (0, 132), (0, 16), (0, 5381), (0, 4),
+    (0, 23), (0, 195), (0, 10), (0, 222), (0, 49), (0, 0), (0, 12), (0, 117),
+    (0, 6), (0, 92), (0, 4), (0, 0), (0, 11), (0, 97), (0, 86), (0, 73),
+    (0, 117), (0, 11), (0, 9), (0, 74), (0, 2), (0, 521), (0, 13), (0, 18),
+    (0, 1761), (0, 272), (0, 3), (0, 8), (0, 901), (0, 1), (0, 10), (0, 53),
+    (0, 3), (0, 0), (0, 5), (0, 1091), (0, 1305), (0, 0), (0, 4), (0, 607),
+    (0, 4319), (0, 1), (0, 54), (0, 61), (0, 96), (0, 76), (0, 421), (0, 69),
+    (0, 493), (0, 2878), (0, 0), (0, 9), (0, 115), (0, 596), (0, 146), (0, 2477),
+    (0, 258), (0, 22), (0, 209), (0, 242), (0, 178), (0, 19), (0, 101), (0, 4),
+    (0, 38), (0, 1563), (0, 26), (0, 0), (0, 217), (0, 2058), (0, 2), (0, 4259),
+    (0, 27), (0, 80), (0, 69), (0, 171), (0, 127), (0, 6), (0, 282), (0, 250),
+    (0, 1), (0, 442), (0, 5), (0, 4), (0, 582), (0, 122), (0, 112), (0, 54),
+    (0, 420), (0, 80), (0, 430), (0, 1349), (0, 10), (0, 4), (0, 445), (0, 901),
+    (0, 497), (0, 409), (0, 8), (0, 1752), (0, 90), (0, 153), (0, 60), (0, 168),
+    (0, 137), (0, 1605), (0, 5), (0, 1163), (0, 136), (0, 0), (0, 54), (0, 0),
+    (0, 22), (0, 185), (0, 14), (0, 16), (0, 605), (0, 4), (0, 235), (0, 36),
+    (0, 2354), (0, 7), (0, 189), (0, 103), (0, 31), (0, 74), (0, 41), (0, 569),
+    (0, 85), (0, 47), (0, 1), (0, 4), (0, 41), (0, 2454), (0, 139), (0, 153),
+    (0, 298), (0, 2288), (0, 95), (0, 1), (0, 17), (0, 2), (0, 0), (0, 4811),
+    (0, 19), (0, 2352), (0, 15), (0, 0), (0, 6), (0, 25), (0, 10), (0, 124),
+    (0, 1459), (0, 3048), (0, 129), (0, 13), (0, 251), (0, 1513), (0, 0), (0, 18),
+    (0, 18), (0, 11), (0, 844), (0, 87), (0, 0), (0, 69), (0, 555), (0, 9),
+    (0, 124), (0, 1), (0, 7), (0, 0), (0, 114), (0, 1249), (0, 2), (0, 400),
+    (0, 892), (0, 49), (0, 246), (0, 8), (0, 174), (0, 31), (0, 548), (0, 4),
+    (0, 34), (0, 2174), (0, 2198), (0, 181), (0, 36), (0, 35), (0, 0), (0, 72),
+    (0, 38), (0, 139), (0, 3983), (0, 28), (0, 16), (0, 69), (0, 511), (0, 1),
+    (0, 39), (0, 666), (0, 38), (0, 53), (0, 1), (0, 5), (0, 636), (0, 40),
+    (0, 8), (0, 0), (0, 32), (0, 0), (0, 271), (0, 0), (0, 3), (0, 3216),
+    (0, 286), (0, 3), (0, 908), (0, 804), (0, 647), (0, 3), (0, 106), (0, 168),
+    (0, 353), (0, 7), (0, 1), (0, 7), (0, 2), (0, 210), (0, 1), (0, 816),
+    (0, 1), (0, 33), (0, 10), (0, 58), (0, 1), (0, 0), (0, 1), (0, 0),
+    (0, 57), (0, 1008), (0, 20), (0, 744), (0, 108), (0, 1582), (0, 3), (0, 126),
+    (0, 3765), (0, 0), (0, 45), (0, 384), (0, 101), (0, 3), (0, 138), (0, 0),
+    (0, 328), (0, 16), (0, 253), (0, 34), (0, 5), (0, 16), (0, 2990), (0, 21),
+    (0, 0), (0, 1811), (0, 606), (0, 53), (0, 418), (0, 0), (0, 100), (0, 9),
+    (0, 3), (0, 282), (0, 562), (0, 314), (0, 429), (0, 1558), (0, 291), (0, 263),
+    (0, 64), (0, 0), (0, 178), (0, 7), (0, 0), (0, 2686), (0, 8122), (0, 300),
+    (0, 0), (0, 73), (0, 46), (0, 6), (0, 15), (0, 600), (0, 426), (0, 5),
+    (0, 374), (0, 160), (0, 1), (0, 718), (0, 147), (0, 0), (0, 1612), (0, 195),
+    (0, 596), (0, 0), (0, 47), (0, 55), (0, 526), (0, 0), (0, 87), (0, 107),
+    (0, 176), (0, 3324), (0, 36), (0, 99), (0, 210), (0, 1744), (0, 9), (0, 1312),
+    (0, 517), (0, 1196), (0, 0), (0, 912), (0, 0), (0, 283), (0, 57), (0, 4504),
+    (0, 384), (0, 1161), (0, 279), (0, 2), (0, 26), (0, 17), (0, 170), (0, 13),
+    (0, 116), (0, 365), (0, 155), (0, 1304), (0, 4), (0, 0), (0, 32), (0, 648),
+    (0, 119), (0, 2124), (0, 2746), (0, 203), (0, 66), (0, 1), (0, 2072), (0, 1),
+    (0, 368), (0, 149), (0, 188), (0, 15), (0, 0), (0, 51), (0, 3947), (0, 115),
+    (0, 1843), (0, 1609), (0, 3), (0, 131), (0, 4), (0, 905), (0, 614), (0, 287),
+    (0, 105), (0, 34), (0, 4), (0, 0), (0, 0), (0, 1009), (0, 24), (0, 163),
+    (0, 1313), (0, 108), (0, 2243), (0, 1162), (0, 1434), (0, 1798), (0, 5), (0, 5552),
+    (0, 36), (0, 90), (0, 203), (0, 81), (0, 205), (0, 1), (0, 288), (0, 23),
+    (0, 239), (0, 110), (0, 2551), (0, 244), (0, 5), (0, 185), (0, 133), (0, 274),
+    (0, 240), (0, 55), (0, 217), (0, 0), (0, 68), (0, 25), (0, 3), (0, 657),
+    (0, 1633), (0, 76), (0, 98), (0, 504), (0, 0), (0, 134), (0, 8), (0, 1623),
+    (0, 0), (0, 57), (0, 15), (0, 6), (0, 419), (0, 239), (0, 37), (0, 13),
+    (0, 269), (0, 15), (0, 2), (0, 352), (0, 18), (0, 1), (0, 1), (0, 1),
+    (0, 0), (0, 260), (0, 214), (0, 135), (0, 0), (0, 4), (0, 36), (0, 176),
+    (0, 134), (0, 3), (0, 2432), (0, 599), (0, 350), (0, 385), (0, 241), (0, 0),
+    (0, 0), (0, 3), (0, 30), (0, 79), (0, 343), (0, 71), (0, 48), (0, 4),
+    (0, 15), (0, 481), (0, 2122), (0, 5), (0, 51), (0, 416), (0, 4), (0, 347),
+    (0, 1174), (0, 6), (0, 12), (0, 793), (0, 4406), (0, 1316), (0, 2536), (0, 17),
+    (0, 2), (0, 903), (0, 1400), (0, 1856), (0, 91), (0, 775), (0, 33), (0, 373),
+    (0, 8), (0, 31), (0, 1230), (0, 66), (0, 3875), (0, 61), (0, 1487), (0, 3),
+    (0, 2229), (0, 3070), (0, 4), (0, 1), (0, 111), (0, 2485), (0, 75), (0, 203),
+    (0, 0), (0, 2), (0, 1), (0, 0), (0, 1432), (0, 5), (0, 991), (0, 11),
+    (0, 14), (0, 3008), (0, 4709), (0, 548), (0, 797), (0, 0), (0, 752), (0, 4),
+    (0, 1709), (0, 101), (0, 2508), (0, 501), (0, 0), (0, 1167), (0, 615), (0, 499),
+    (0, 4310), (0, 631), (0, 6), (0, 46), (0, 80), (0, 2464), (0, 1122), (0, 839),
+    (0, 615), (0, 4), (0, 7428), (0, 37), (0, 4141), (0, 2187), (0, 249), (0, 4),
+    (0, 1160), (0, 0), (0, 4928), (0, 5204), (0, 503), (0, 2475), (0, 74), (0, 338),
+    (0, 6), (0, 21), (0, 376), (0, 1744), (0, 1907), (0, 0), (0, 77), (0, 872),
+    (0, 122), (0, 7), (0, 2382), (0, 4), (0, 21), (0, 9), (0, 2040), (0, 1),
+    (0, 6), (0, 6905), (0, 5047), (0, 832), (0, 116), (0, 1326), (0, 10), (0, 18),
+    (0, 5), (0, 8), (0, 74), (0, 153), (0, 546), (0, 40), (0, 0), (0, 1457),
+    (0, 16), (0, 266), (0, 94), (0, 597), (0, 119), (0, 13), (0, 136), (0, 133),
+    (0, 1316), (0, 1323), (0, 1757), (0, 554), (0, 126), (0, 8), (0, 3556), (0, 3791),
+    (0, 4726), (0, 1104), (0, 567), (0, 321), (0, 179), (0, 222), (0, 97), (0, 9),
+    (0, 66), (0, 2361), (0, 46), (0, 9), (0, 11), (0, 352), (0, 1), (0, 897),
+    (0, 8), (0, 2), (0, 505), (0, 162), (0, 58), (0, 44), (0, 1417), (0, 4),
+    (0, 90), (0, 193), (0, 438), (0, 44), (0, 4), (0, 13), (0, 25), (0, 76),
+    (0, 52), (0, 4002), (1, 2708), (0, 3224), (0, 627), (0, 38), (0, 168), (0, 67),
+    (0, 77), (0, 1), (0, 99), (1, 8281), (0, 0), (0, 28), (0, 931), (0, 8),
+    (0, 9), (0, 427), (0, 1192), (0, 16), (1, 267), (0, 14), (0, 1), (0, 217),
+    (0, 18), (0, 3249), (0, 60), (0, 255), (1, 2521), (0, 8), (0, 5857), (0, 668),
+    (0, 6326), (0, 798), (0, 3870), (0, 42), (0, 458), (0, 11), (0, 255), (0, 57),
+    (0, 0), (0, 13), (0, 1285), (0, 1924), (0, 338), (1, 1455), (0, 409), (0, 15),
+    (0, 963), (0, 155), (0, 1191), (0, 127), (0, 3), (1, 953), (0, 1400), (0, 159),
+    (0, 123), (0, 6), (0, 5919), (0, 1529), (0, 6117), (0, 113), (0, 526), (0, 1207),
+    (0, 993), (0, 27), (0, 792), (0, 545), (0, 1), (0, 199), (0, 30), (0, 427),
+    (0, 32), (0, 0), (0, 59), (0, 88), (1, 276), (0, 553), (0, 0), (0, 3044),
+    (1, 2188), (0, 2004), (0, 2733), (0, 7800), (0, 1), (0, 2951), (0, 89), (0, 13),
+    (0, 0), (0, 12), (0, 757), (0, 1996), (0, 61), (0, 745), (0, 288), (0, 371),
+    (0, 130), (0, 1514), (0, 592), (0, 1053), (0, 423), (0, 50), (0, 5428), (0, 140),
+    (0, 0), (0, 42), (0, 0), (2, 4496), (0, 3), (0, 1919), (0, 565), (0, 4),
+    (0, 6), (0, 24), (0, 54), (0, 221), (0, 5), (0, 1045), (0, 0), (0, 173),
+    (0, 36), (0, 706), (0, 599), (0, 0), (0, 24), (0, 58), (0, 6), (0, 27),
+    (0, 3), (0, 85), (0, 230), (0, 23), (0, 217), (0, 448), (1, 2043), (0, 5454),
+    (0, 536), (0, 473), (1, 3376), (0, 1859), (0, 62), (0, 122), (0, 116), (0, 0),
+    (0, 3911), (0, 440), (0, 0), (0, 2247), (0, 4466), (0, 10), (0, 1), (0, 23),
+    (1, 3292), (0, 2668), (0, 343), (0, 934), (0, 14), (0, 1811), (0, 1400), (0, 4373),
+    (0, 1217), (0, 1033), (0, 41), (0, 1414), (0, 4053), (0, 20), (0, 2105), (0, 201),
+    (0, 4), (0, 570), (0, 1088), (0, 769), (0, 9), (0, 398), (0, 9), (0, 4),
+    (0, 1524), (0, 537), (0, 0), (0, 19), (0, 0), (0, 6), (0, 898), (0, 1547),
+    (0, 150), (0, 710), (0, 30), (0, 59), (0, 10), (0, 0), (0, 188), (0, 0),
+    (0, 1172), (0, 586), (0, 1059), (0, 84), (0, 22), (0, 0), (0, 293), (0, 1734),
+    (0, 18), (0, 4905), (0, 2), (0, 2601), (0, 959), (0, 1567), (0, 508), (0, 144),
+    (0, 0), (0, 185), (0, 6), (0, 15), (0, 310), (0, 736), (0, 331), (0, 174),
+    (0, 3571), (1, 742), (0, 5), (0, 4), (0, 305), (0, 5), (0, 138), (0, 1248),
+    (0, 3416), (0, 46), (0, 51), (0, 359), (0, 7288), (0, 9), (0, 49), (0, 966),
+    (0, 1666), (0, 139), (0, 3725), (0, 215), (1, 2343), (0, 11), (0, 51), (0, 2710),
+    (0, 364), (0, 40), (0, 3), (0, 121), (0, 327), (0, 134), (0, 8111), (0, 5863),
+    (0, 30), (1, 1868), (0, 243), (0, 1107), (0, 31), (0, 440), (0, 188), (0, 0),
+    (0, 2386), (0, 5), (0, 35), (0, 6646), (0, 257), (0, 2486), (0, 5689), (0, 4153),
+    (0, 319), (0, 764), (0, 54), (0, 2082), (0, 28), (0, 75), (0, 0), (0, 1218),
+    (2, 2163), (0, 38), (1, 6581), (0, 385), (0, 699), (1, 361), (0, 286), (1, 640),
+    (0, 32), (0, 155), (0, 19), (0, 2076), (0, 38), (0, 5903), (0, 397), (0, 85),
+    (0, 3141), (2, 4951), (0, 20), (5, 1401), (0, 1), (0, 176), (0, 1873), (0, 6069),
+    (0, 6049), (0, 1696), (1, 1210), (0, 54), (0, 824), (1, 369), (0, 586), (0, 2),
+    (0, 26), (0, 7351), (0, 2278), (0, 5020), (0, 2220), (0, 784), (0, 3810), (0, 1844),
+    (0, 6424), (0, 135), (0, 823), (0, 3), (0, 1684), (0, 4520), (0, 5156), (0, 0),
+    (0, 4914), (0, 3), (1, 7878), (4, 1518), (0, 74), (0, 4164), (2, 4196), (0, 0),
+    (0, 1), (0, 12), (0, 2551), (0, 1), (0, 15), (0, 64), (1, 618), (0, 19),
+    (0, 30), (0, 1), (0, 128), (0, 1), (0, 206), (0, 207), (0, 245), (0, 501),
+    (0, 407), (0, 5415), (0, 42), (0, 434), (0, 49), (0, 0), (0, 540), (0, 0),
+    (0, 38), (0, 889), (3, 1657), (0, 462), (0, 124), (0, 1), (0, 1), (0, 6788),
+    (0, 182), (0, 10), (0, 1), (0, 1131), (0, 2), (0, 3548), (0, 3496), (0, 7602),
+    (0, 1), (0, 216), (2, 6048), (1, 7854), (0, 28), (0, 146), (0, 3155), (0, 4),
+    (0, 186), (0, 5046), (0, 3), (0, 9), (0, 90), (0, 622), (0, 0), (0, 316),
+    (2, 2884), (0, 7745), (0, 6), (0, 832), (0, 2430), (0, 593), (0, 2), (0, 996),
+    (1, 348), (0, 200), (0, 27), (0, 24), (0, 1146), (0, 1), (2, 2581), (0, 3854),
+    (0, 4372), (0, 1945), (1, 4138), (5, 217), (0, 988), (0, 6060), (0, 5564), (0, 2332),
+    (0, 5), (0, 110), (0, 2845), (0, 28), (0, 647), (0, 29), (0, 3196), (0, 5),
+    (0, 67), (0, 12), (0, 2643), (0, 3), (0, 47), (0, 3971), (0, 221), (0, 58),
+    (0, 14), (0, 2), (0, 209), (1, 7971), (2, 5672), (0, 94), (0, 33), (1, 4873),
+    (0, 57), (0, 218), (0, 83), (0, 4), (1, 5285), (0, 1581), (0, 934), (0, 1186),
+    (0, 2217), (0, 48), (2, 1630), (0, 460), (0, 263), (0, 5395), (5, 4867), (0, 1026),
+    (0, 7196), (0, 36), (0, 786), (0, 302), (1, 2441), (0, 1296), (0, 149), (0, 3538),
+    (0, 1), (0, 1411), (0, 56), (0, 233), (0, 28), (0, 3464), (0, 43), (0, 4138),
+    (0, 11), (0, 969), (1, 7167), (0, 4), (0, 7788), (0, 5664), (0, 13), (0, 1034),
+    (0, 306), (1, 3614), (0, 1), (0, 118), (0, 1226), (0, 3), (0, 5), (0, 816),
+    (0, 1), (0, 2522), (3, 3844), (0, 467), (0, 271), (0, 1133), (0, 8303), (0, 186),
+    (0, 1186), (0, 1), (0, 15), (0, 669), (1, 4615), (0, 85), (3, 6310), (0, 1159),
+    (0, 210), (0, 1163),
+];
+
+static FINGERPRINT_SET: [u64; 8367] = [
+    0x000000294e265645, 0x0000002653452845, 0x0000004331453b4e, 0x0000005628465531,
+    0x00000046424b2956, 0x000000534b4e4256, 0x0000004b294e4f53, 0x00000056424e4b45,
+    0x000000554e262956, 0x00000046544e4553, 0x0000004328543b56, 0x0000002c29564f31,
+    0x0000002656284f53, 0x000000462c534f53, 0x000000534f4e2631, 0x00000045554e2653,
+    0x000000435626294e, 0x0000002846452931, 0x0000002c56543b31, 0x0000002928465456,
+    0x0000003b564f294e, 0x0000004353262931, 0x000000294e4f2956, 0x000000464f56264e,
+    0x000000294e285531, 0x000000434e4b5645, 0x000000314e543b4e, 0x00000056544e4553,
+    0x0000004f294e2826, 0x000000314f295645, 0x000000464f314256, 0x00000031284b5345,
+    0x000000284b453b56, 0x0000005345534f53, 0x00000045284f2931, 0x0000003b534f2956,
+    0x000000284b543b31, 0x0000004f56285556, 0x0000004e45284f56, 0x0000004b4b543b4e,
+    0x0000002855314b53, 0x0000004f4e452631, 0x0000003128462854, 0x00000046534f314e,
+    0x000000464f31424e, 0x00000028464b5645, 0x00000028454e4b4e, 0x0000004f4b452855,
+    0x00000056264b2653, 0x00000055294e4f53, 0x0000004e4f45554e, 0x0000004e4f53544e,
+    0x0000004e45314b53, 0x000000284555294e, 0x00000031284e5431, 0x000000294e265345,
+    0x0000004e282c2953, 0x0000004e264e4b53, 0x000000564f4b4f56, 0x0000003145552953,
+    0x0000004e31455453, 0x0000003142564f4e, 0x0000003b31422931, 0x0000004f4e284f31,
+    0x00000031284f5354, 0x0000003128465654, 0x000000534f564556, 0x0000004b53314b45,
+    0x00000028464f314e, 0x000000294e28264e, 0x000000543b292846, 0x0000004b4e452856,
+    0x0000002629534b45, 0x0000004626534f4e, 0x000000284f564f31, 0x000000004e45554e,
+    0x00000028464b4531, 0x000000464f53554e, 0x0000004626314b53, 0x0000005345294b56,
+    0x000000462c312846, 0x000000294e284555, 0x0000004e4b4e2653, 0x00000045284b5556,
+    0x000000433b314b56, 0x000000294b534f31, 0x0000004628462845, 0x0000002c4e284656,
+    0x000000004e455531, 0x0000004655564f53, 0x000000425345554e, 0x00000054414e4f53,
+    0x0000003b314f2956, 0x0000004129562846, 0x0000003b53562656, 0x0000005356534f53,
+    0x000000263142294e, 0x000000564f532826, 0x0000003126532845, 0x000000562845554e,
+    0x0000004642294b31, 0x000000554e4b534b, 0x0000002842564b45, 0x00000026294e4b45,
+    0x00000042564f3145, 0x0000004555534556, 0x000000314b312656, 0x00000053544e454e,
+    0x000000464b53424e, 0x0000002c4e45554e, 0x0000004f56452956, 0x000000284f562845,
+    0x0000003b5556264e, 0x0000004528552856, 0x0000002931284555, 0x0000003b314f294e,
+    0x0000004f4e284626, 0x00000053282c294e, 0x000000462845544e, 0x0000003145564f53,
+    0x000000453b295345, 0x0000002842294b56, 0x0000004f4b543b56, 0x0000002c31543b56,
+    0x0000004b5645554e, 0x00000045534b294e, 0x0000004356453b53, 0x000000284b564256,
+    0x0000004353562656, 0x0000004628464b56, 0x0000004f45284f31, 0x00000056454e4b53,
+    0x0000005631292846, 0x000000464b534f31, 0x0000004f29532826, 0x0000004b4e422956,
+    0x0000000000564f31, 0x000000555626294e, 0x0000004356422956, 0x0000005654534f31,
+    0x0000002c31284b45, 0x0000005642294b56, 0x0000004656262956, 0x00000041564f314b,
+    0x000000284f56454e, 0x0000004e424b2953, 0x0000003126562846, 0x0000003b29312846,
+    0x00000046564f314e, 0x0000004e42534f4e, 0x0000004645554b53, 0x0000000043564556,
+    0x0000002956262931, 0x000000434e42294e, 0x0000005528534f53, 0x0000004331532653,
+    0x0000003128462631, 0x000000433b564e54, 0x00000046454e5453, 0x00000031284f5654,
+    0x0000003128455553, 0x0000005328264e45, 0x00000042534f294e, 0x0000004f314b4553,
+    0x000000553126294e, 0x0000003145555626, 0x00000042564f2956, 0x000000464f312656,
+    0x0000004329532653, 0x0000002c4e284631, 0x000000534f315556, 0x0000004f314b294e,
+    0x0000004e26564b4e, 0x0000004f53543b56, 0x0000004628464f4e, 0x0000004b45285553,
+    0x0000003128424e45, 0x000000543b294b53, 0x0000004b45284b45, 0x0000004e54564f4e,
+    0x0000004f53455453, 0x0000004f56543b31, 0x000000532846554e, 0x0000002956265345,
+    0x0000004f53282653, 0x0000004e31534f56, 0x0000004b45552953, 0x0000004628452845,
+    0x0000004f564b294e, 0x0000004b45534f53, 0x0000002846282c31, 0x0000005328452931,
+    0x0000004e45294b31, 0x00000000004e4256, 0x000000284f4e264e, 0x0000004e4f532653,
+    0x0000004e56455431, 0x0000002853292846, 0x000000553145554e, 0x00000031282c5345,
+    0x0000002c3155454e, 0x000000564b312631, 0x000000464f314e45, 0x0000002826294b31,
+    0x0000004b45554e45, 0x000000284653264e, 0x0000004628462953, 0x0000004b45555653,
+    0x000000434e453b53, 0x0000002631284f31, 0x000000534f565331, 0x000000294e312854,
+    0x000000544e543b53, 0x0000005529532846, 0x000000295345554e, 0x0000004b453b2953,
+    0x0000002631284f53, 0x00000056544e544e, 0x0000005628263145, 0x0000004f45292846,
+    0x000000462c564f31, 0x0000005628462845, 0x0000004e2c292846, 0x0000004346455556,
+    0x0000002953312854, 0x0000002846284654, 0x0000003b31453b53, 0x0000004b53452631,
+    0x0000004f56532656, 0x0000004b55564f31, 0x0000000053262956, 0x0000004f53265345,
+    0x00000053454e4b56, 0x0000004e28455456, 0x0000003b564f2953, 0x000000534f544153,
+    0x000000554e4b3145, 0x0000004e4b312653, 0x0000004e28423145, 0x0000004654534f53,
+    0x0000000000564231, 0x0000004e4f534253, 0x0000002846422931, 0x0000000055534f56,
+    0x0000005645314b56, 0x00000029314e2854, 0x0000005326293145, 0x0000004f4e284553,
+    0x00000000434e2653, 0x000000312656424e, 0x0000002845554e31, 0x0000005655534f31,
+    0x000000534f56554e, 0x00000028464b4556, 0x0000004e4f535645, 0x0000004e26534231,
+    0x0000002842534b53, 0x000000543b314b56, 0x00000046284e544e, 0x000000312842294e,
+    0x000000284f562656, 0x000000284f534b53, 0x000000543b4e4b31, 0x0000004f56532845,
+    0x0000004f29562826, 0x0000003b534f2953, 0x00000045554e4b31, 0x0000004f534b2956,
+    0x0000005642564f31, 0x00000053284f4e45, 0x0000004e56455453, 0x0000004e31455553,
+    0x000000464f4b4f31, 0x0000004f4e284256, 0x000000564f314b45, 0x0000002842294b53,
+    0x0000004f53284531, 0x0000004e54314556, 0x000000564f4e2854, 0x0000004645282c56,
+    0x00000053284e5431, 0x000000453b534b4e, 0x0000002928464e45, 0x0000004f56284156,
+    0x0000004f56312845, 0x000000534f315431, 0x0000004f4e284b31, 0x0000004f534b294e,
+    0x00000028264e4b53, 0x0000002931532845, 0x0000003142314f53, 0x0000004f53284653,
+    0x0000004356452656, 0x0000005645534b31, 0x000000564b534f4e, 0x0000004e264e4b56,
+    0x0000005328464555, 0x000000312845544e, 0x00000031284b2631, 0x000000264e452846,
+    0x0000004f314b2656, 0x000000464e45554e, 0x000000284f314555, 0x0000003b4e4b2956,
+    0x0000005642534b45, 0x000000284f4b4f56, 0x0000005441534f53, 0x0000002846284e31,
+    0x0000000055292846, 0x00000053294e2846, 0x0000004f564f5326, 0x00000000004e2656,
+    0x00000029564b5345, 0x000000534f4e2846, 0x0000000031452631, 0x000000543b534f56,
+    0x000000284b452956, 0x0000002854564f4e, 0x00000055314f5326, 0x0000004631534b45,
+    0x0000005326314f53, 0x000000284b534f56, 0x000000282c534f4e, 0x000000564b453b31,
+    0x0000004f4e452653, 0x00000031284b4556, 0x0000003126294b53, 0x0000002846562845,
+    0x000000464e4f5345, 0x0000005645285556, 0x0000004f31554553, 0x0000002c4e282653,
+    0x0000005628464b31, 0x00000046284f5354, 0x0000004653543b31, 0x0000003126562845,
+    0x000000532855454e, 0x0000005629532845, 0x0000004e56455531, 0x000000424e4b2956,
+    0x00000000434b2653, 0x0000004f29532656, 0x0000003142314b4e, 0x00000053264b4f31,
+    0x0000004f29312846, 0x000000462c534f31, 0x000000433b295645, 0x00000031264e4b53,
+    0x0000003154534556, 0x0000004b4f564f53, 0x0000003b4e4b294e, 0x0000004529314f53,
+    0x0000000000564b31, 0x00000046564f5354, 0x000000005645554e, 0x0000004b4f452846,
+    0x000000004345554e, 0x000000462c564256, 0x0000005645564b4e, 0x0000004b31543b53,
+    0x00000046424b294e, 0x000000004356554e, 0x0000004e4b4e4253, 0x000000293128464b,
+    0x0000004f45284f53, 0x000000532656264e, 0x00000045284b5345, 0x000000462c292846,
+    0x0000004e42532656, 0x0000002629562656, 0x00000045554e4253, 0x0000002846284253,
+    0x000000433b534b56, 0x0000002856543b31, 0x000000004e262956, 0x000000564f292846,
+    0x000000284b532656, 0x00000046284b4f31, 0x0000004f53262931, 0x0000004528534f53,
+    0x0000004f31285556, 0x0000004e28462c53, 0x00000031264e424e, 0x0000004e4b452931,
+    0x0000004b534f5645, 0x0000003145554b31, 0x0000002855564b53, 0x0000002826564231,
+    0x00000055314e4f53, 0x000000464f532845, 0x00000028264e264e, 0x000000452826294e,
+    0x000000434e45264e, 0x000000282c314231, 0x0000000043534f4e, 0x0000003142534b56,
+    0x0000004e4f534b53, 0x0000005328414e4b, 0x0000004628464231, 0x0000004f534b4e45,
+    0x0000004e2845264e, 0x0000005655534f4e, 0x000000314f532845, 0x0000004229532846,
+    0x00000056454e4f53, 0x0000004e4b45544e, 0x0000003145314b56, 0x000000462c315556,
+    0x0000004554534f56, 0x00000045534b2931, 0x0000005531455531, 0x0000004e4256424e,
+    0x0000004653455553, 0x000000284b455529, 0x0000004f29312656, 0x0000002c53284f31,
+    0x0000004e42564b4e, 0x00000053284e2854, 0x0000004e424e4b56, 0x0000004329534f53,
+    0x0000004e284b3145, 0x0000004629314f53, 0x0000004e54564f31, 0x0000003142564231,
+    0x0000000043534b31, 0x0000005529534f56, 0x0000004e54564553, 0x000000453b312631,
+    0x000000435645554e, 0x0000004e45532653, 0x000000454e292846, 0x000000312653264e,
+    0x00000028544e4f53, 0x00000053284f3126, 0x0000004b45532631, 0x0000004e3b534f31,
+    0x000000534f534b53, 0x00000053264e4231, 0x00000055564f4e26, 0x000000534e4f5531,
+    0x0000002846263145, 0x00000046284f314e, 0x00000053424e4b4e, 0x00000028424e4b4e,
+    0x000000453b294b4e, 0x000000464b543b31, 0x0000002931285431, 0x0000004b53453b53,
+    0x000000455556424e, 0x000000534528464e, 0x000000554e455556, 0x0000000000314b53,
+    0x000000462c314253, 0x0000005628265345, 0x0000002931282c31, 0x0000005328462c31,
+    0x0000005328463145, 0x000000284e4f5553, 0x0000002656284f31, 0x0000004f4b453b53,
+    0x000000003b534b4e, 0x0000003b4b455553, 0x0000002956285431, 0x0000004654534531,
+    0x000000294e4b5345, 0x0000004628464131, 0x0000004f29532631, 0x0000004f4e284b53,
+    0x00000031453b2956, 0x0000005328454253, 0x000000264e284b45, 0x0000005528564f31,
+    0x0000005629312845, 0x000000433b314e45, 0x0000004f56534b45, 0x000000314b452656,
+    0x000000282c564555, 0x000000534f565531, 0x0000004f5653264e, 0x00000053314f534b,
+    0x000000534e545553, 0x000000453b4e2653, 0x0000004e42564231, 0x0000003126292846,
+    0x0000005354534f53, 0x00000054564b4553, 0x0000004b4e452653, 0x0000005328454231,
+    0x0000002c56453b56, 0x00000046544e4556, 0x0000002c29312845, 0x0000004641534f31,
+    0x00000053264e4f53, 0x0000005453453b31, 0x000000453b564b4e, 0x000000434e262953,
+    0x000000294e4f5345, 0x0000004f55292846, 0x0000002846564f53, 0x0000003b55532656,
+    0x000000293128264e, 0x000000543a4e3b4e, 0x000000564528264e, 0x000000564b4e4253,
+    0x000000464f544156, 0x000000314f534253, 0x00000053282c534b, 0x00000046453b294e,
+    0x0000004656455531, 0x000000464f564f4e, 0x0000002c29534f31, 0x00000043564f2931,
+    0x0000004526314f53, 0x0000004f56262953, 0x000000564f314b4e, 0x0000004356554553,
+    0x0000005628452631, 0x0000002629532656, 0x0000003b31262956, 0x00000031544e5453,
+    0x0000002c53455553, 0x0000005645294b53, 0x0000005628462653, 0x0000004f5628454e,
+    0x0000004e284f3145, 0x0000004f5641564b, 0x000000534f534e54, 0x0000002928465331,
+    0x0000003a4e4e5431, 0x0000004654534f56, 0x0000004f29534f31, 0x000000003b532653,
+    0x0000004628414e4b, 0x0000004e424b2931, 0x0000005645534f56, 0x000000005553264e,
+    0x0000005345284b45, 0x000000464f564b4e, 0x0000000031262956, 0x000000564b56264e,
+    0x0000005645564b31, 0x0000004f4e4e5456, 0x00000046284b4f56, 0x0000005629562846,
+    0x00000056284e5456, 0x0000005329284656, 0x0000005526534f4e, 0x0000002629532653,
+    0x0000003145534b31, 0x0000004e28452855, 0x000000543b564553, 0x0000004f31284553,
+    0x000000284e455556, 0x000000462c4e4f53, 0x0000004329564f53, 0x00000056284b4f53,
+    0x0000004b31543b4e, 0x0000004e4e54544e, 0x0000005354564531, 0x0000004f4e42294e,
+    0x0000004356452653, 0x0000004b29312845, 0x0000004f564e5456, 0x0000004f56425345,
+    0x0000005653564f53, 0x0000004f53284f31, 0x000000284253264e, 0x000000314b292846,
+    0x0000004f53284645, 0x0000004e42314b56, 0x0000002928464b56, 0x0000003b4645554e,
+    0x0000004b314e4b45, 0x0000004f56284b31, 0x000000295628264e, 0x0000003142314b45,
+    0x00000056284e2854, 0x000000433142294e, 0x000000462846414e, 0x00000028534f314e,
+    0x000000564b4e264e, 0x000000003b534f4e, 0x0000004f31284656, 0x0000004e45312656,
+    0x00000000004e4b53, 0x00000028543b2931, 0x000000564f4b2653, 0x000000564f54414e,
+    0x0000005345555326, 0x00000053264b4f56, 0x0000004329532846, 0x0000005345554e31,
+    0x000000562846414e, 0x0000004626294e45, 0x0000004b534b5645, 0x0000004329564f31,
+    0x000000293128464e, 0x000000314b4e2656, 0x0000004b31453b53, 0x0000005642292846,
+    0x0000004f564f2953, 0x00000029284e4555, 0x0000005345294b53, 0x000000284f315456,
+    0x0000003126562656, 0x0000004e5345544e, 0x000000534f4e2854, 0x0000004628455431,
+    0x0000005326314253, 0x000000543b534f4e, 0x0000004642314256, 0x0000004628455531,
+    0x0000004642314b31, 0x0000004e2656264e, 0x0000004f31423145, 0x0000004331455531,
+    0x0000005441534f4e, 0x0000002845534f53, 0x0000002c29312846, 0x0000004653314b45,
+    0x0000002846284b4e, 0x0000004555314b45, 0x00000028453b294e, 0x0000004f31284654,
+    0x0000003b5653264e, 0x000000284b455456, 0x0000000029562846, 0x00000026314f2956,
+    0x000000464f294b56, 0x0000004f53414e4b, 0x000000434e26294e, 0x00000056264b2631,
+    0x00000031294e2846, 0x00000053282c564b, 0x00000045554e424e, 0x000000464b45554e,
+    0x0000005626564b56, 0x000000453b4e4b31, 0x0000004f4528264e, 0x0000004f564f314e,
+    0x000000464256264e, 0x00000028264b2656, 0x0000005328263145, 0x00000028464b5345,
+    0x0000004528464f56, 0x000000462c31554e, 0x000000003b314b56, 0x0000005328554553,
+    0x0000002853455553, 0x0000004e26294b56, 0x0000005355534f31, 0x0000004528552956,
+    0x0000004e4b534555, 0x000000464b534253, 0x0000004e3142294e, 0x00000043314e4b45,
+    0x000000465645554e, 0x000000462c31424e, 0x000000534f295645, 0x00000046264e2846,
+    0x0000004b45282631, 0x00000028264e2631, 0x000000464f4e5456, 0x0000003145285531,
+    0x0000002842314b53, 0x0000003b294e2845, 0x00000046284b534b, 0x0000004f53452656,
+    0x00000053284f4e26, 0x0000004f56284654, 0x000000314f534153, 0x000000294e284626,
+    0x000000564f534b4e, 0x000000284b453b4e, 0x0000004b4531264e, 0x0000004f5328414e,
+    0x0000004b45554b31, 0x000000314b534555, 0x00000056284f534b, 0x000000462c542846,
+    0x0000004b29534f53, 0x0000005641314f53, 0x0000004e31422956, 0x000000454e545456,
+    0x0000004b534f5345, 0x000000534f532826, 0x0000004e45282c4e, 0x0000003128554553,
+    0x0000003145534b56, 0x00000046284b4553, 0x00000031544e4556, 0x00000054544e4f53,
+    0x000000294e284156, 0x0000004f4e284556, 0x0000004f5628414e, 0x00000046534f5626,
+    0x000000464f535553, 0x000000534f312854, 0x000000284f56264e, 0x000000454e543b4e,
+    0x0000004f4e452845, 0x0000005345553126, 0x0000004e4b455453, 0x00000028464f5631,
+    0x0000003145284656, 0x00000053264e4b4e, 0x000000284b534f53, 0x0000004528534f4e,
+    0x00000028454e4b53, 0x0000005331534f56, 0x000000003b295345, 0x0000004e26564b45,
+    0x000000554e292846, 0x000000003b314b53, 0x0000004b4e314b45, 0x0000004345555631,
+    0x000000464f31554e, 0x00000055314b534b, 0x0000003b29564f31, 0x0000003128452656,
+    0x0000000000293145, 0x000000314f534555, 0x0000004f534b4f56, 0x0000003b56455556,
+    0x0000004e4b564f53, 0x0000002c534f314b, 0x0000004b31422953, 0x0000003142564f53,
+    0x0000004353422931, 0x0000002c4e284f4e, 0x0000005328464556, 0x0000003128453b53,
+    0x0000002854564531, 0x000000534b314555, 0x000000295628414e, 0x0000004645534b53,
+    0x0000004642312653, 0x0000000053262931, 0x0000003154534531, 0x0000003145554e26,
+    0x000000464f4b2656, 0x0000005328465453, 0x0000005356314f53, 0x00000053314f5326,
+    0x0000000055314f53, 0x00000053564f3145, 0x0000002c29284645, 0x000000534e545556,
+    0x0000004e28464231, 0x00000056264b4f56, 0x000000534f532656, 0x00000031543b2956,
+    0x000000284f315531, 0x0000002c4e284f53, 0x0000004542292846, 0x0000005553455531,
+    0x0000004626314256, 0x0000004641564f4e, 0x00000056264b4f53, 0x000000433b455531,
+    0x0000002845564f53, 0x0000005628455531, 0x00000028424e4b53, 0x000000433b31424e,
+    0x000000294e425345, 0x0000003b4e26294e, 0x00000056314e4f53, 0x0000004f53562854,
+    0x000000564b532656, 0x000000462c314231, 0x00000028544e5453, 0x0000004e4f53264e,
+    0x0000004f56265345, 0x0000004353554556, 0x0000002c56284645, 0x0000004f56285531,
+    0x000000294b564f4e, 0x0000004e42562656, 0x0000004e4e455431, 0x0000005345552931,
+    0x00000046264e2656, 0x000000464b45264e, 0x0000004e4e543b31, 0x0000002845284f56,
+    0x0000002c56543b4e, 0x0000004353554553, 0x0000002842534b31, 0x000000264e455553,
+    0x0000004e2656424e, 0x00000031284f5626, 0x0000004656534f56, 0x000000464b314b45,
+    0x0000003154564f31, 0x000000314b543b4e, 0x00000053264b2653, 0x0000000055534f4e,
+    0x0000005326534b45, 0x0000004f5645264e, 0x0000004628464f31, 0x0000002846454e31,
+    0x0000004356422931, 0x000000534f534b4e, 0x00000028554e4b4e, 0x000000433b564f53,
+    0x000000433b56314e, 0x0000004e4b294e45, 0x0000004e4b564555, 0x000000464f315553,
+    0x0000004f4e28544e, 0x00000056264e4b4e, 0x0000004355534f31, 0x000000462653264e,
+    0x0000002846284645, 0x0000004f56284645, 0x00000056264e2846, 0x0000004e454e2656,
+    0x0000004e264e4256, 0x000000462c562846, 0x00000031284b4e4b, 0x0000002956285556,
+    0x00000053284b3145, 0x000000314f292846, 0x000000564b534b45, 0x0000005355292846,
+    0x0000004f564e2854, 0x0000005626314b31, 0x000000282c4e4b45, 0x0000000000564555,
+    0x0000005626562656, 0x0000004629284645, 0x000000464b4e424e, 0x0000002c29562845,
+    0x0000004628463153, 0x0000004b26564f53, 0x000000003b295645, 0x0000004b4528554e,
+    0x000000284655454e, 0x0000004e45554f4e, 0x00000029314b3145, 0x0000005354564f4e,
+    0x000000534f535556, 0x000000534b453b4e, 0x0000000055562656, 0x000000565453454e,
+    0x0000004e284b2653, 0x0000004253262953, 0x0000000055312653, 0x0000004f56534f4e,
+    0x0000003128464556, 0x000000000045554e, 0x0000005326532846, 0x00000045554e4f53,
+    0x0000003b4e314b45, 0x000000433b543b31, 0x0000004355534f53, 0x000000314b452631,
+    0x00000056282c534b, 0x0000005654564f31, 0x0000002846262953, 0x0000000056534b45,
+    0x0000005628464253, 0x0000005345314b56, 0x0000003b45554e31, 0x0000005345534f56,
+    0x00000053284f314e, 0x000000464f4b264e, 0x0000002928463145, 0x0000000043455556,
+    0x000000534b564b45, 0x0000002845282c4e, 0x0000004656455556, 0x0000003128265645,
+    0x000000434645554e, 0x0000003126564253, 0x00000028544e4531, 0x00000056414e4f53,
+    0x0000004653543b53, 0x0000005328465556, 0x0000004356452931, 0x0000005345284f4e,
+    0x0000004f314e5431, 0x0000004331452631, 0x000000283b314b45, 0x0000004628424e45,
+    0x000000543b534b4e, 0x0000004f564f2931, 0x0000004631534f56, 0x00000056264e4253,
+    0x000000284f53414e, 0x000000564f4e5431, 0x0000002c29564f53, 0x0000005354314553,
+    0x0000004b45292846, 0x000000294e284631, 0x000000534f312631, 0x0000005626534253,
+    0x000000284b45544e, 0x000000434e4f294e, 0x00000026294e2631, 0x000000433b534f31,
+    0x0000005628462846, 0x000000284f4b2631, 0x0000004f4e284f4e, 0x0000004e282c314b,
+    0x0000004345555653, 0x0000003128464f31, 0x0000005645553145, 0x000000464e455553,
+    0x0000002855314f53, 0x0000004329314b45, 0x0000003128462c4e, 0x0000004628454b45,
+    0x000000312c292846, 0x0000004528554f4e, 0x0000002c56284f53, 0x0000000043455553,
+    0x0000004528464f31, 0x0000004e26314b31, 0x000000453b4e5453, 0x0000005645554b56,
+    0x00000026314f2931, 0x0000004f45564f4e, 0x00000045284b5645, 0x0000004e284f5645,
+    0x0000003b53422956, 0x000000315345554e, 0x0000002842314231, 0x000000284b4e4f53,
+    0x000000314f534b45, 0x0000002931284626, 0x0000004e4b455553, 0x0000005326534b4e,
+    0x0000005626534256, 0x0000004f453b2931, 0x000000534f564f31, 0x00000046284e4b45,
+    0x000000464f314b31, 0x0000004e5431454e, 0x00000028462c4e45, 0x000000534f4e4256,
+    0x0000004356532653, 0x0000002c294e2846, 0x0000004f56284b56, 0x000000282c562846,
+    0x0000004653543b56, 0x0000004626312653, 0x000000564b45294e, 0x00000043564b4f4e,
+    0x000000004b455531, 0x0000004b4555314e, 0x00000043564b4556, 0x0000003128452631,
+    0x0000002956282c4e, 0x000000453b562631, 0x0000004e4f4b4f4e, 0x0000004e284b4555,
+    0x00000031284b4f53, 0x000000004356424e, 0x0000004e54562653, 0x000000453b564b53,
+    0x000000464f532854, 0x0000004331453b31, 0x0000004f534e544e, 0x00000000554e264e,
+    0x0000004555564131, 0x000000285556264e, 0x0000004f4e285431, 0x0000003b534f5645,
+    0x000000434e455556, 0x0000005454314f53, 0x0000005441314f53, 0x000000454e545431,
+    0x00000055534b4531, 0x000000282631424e, 0x0000004f29284654, 0x000000543b295345,
+    0x0000005645534f53, 0x00000055534e4f31, 0x000000284f312854, 0x00000053424e4b56,
+    0x0000002928462c4e, 0x000000284528554e, 0x0000002953284253, 0x0000004f56284131,
+    0x0000003145282653, 0x000000434e452631, 0x0000005329284653, 0x000000464f564131,
+    0x0000004626564b56, 0x0000005645554e26, 0x00000056544e5453, 0x0000004f29562653,
+    0x000000294e263145, 0x000000284f294b31, 0x0000004f4e455553, 0x0000002953284631,
+    0x000000564f4b264e, 0x0000004b53543b53, 0x0000004e454e4553, 0x0000004e54314f53,
+    0x000000284f314253, 0x0000004629532846, 0x000000534b543b56, 0x00000029314f2956,
+    0x0000004f3128424e, 0x0000003128464553, 0x0000004b4528543b, 0x000000003142294e,
+    0x0000002956284f53, 0x0000004628453b31, 0x0000004e2845424e, 0x000000464231264e,
+    0x0000004b4e543b31, 0x0000002826562846, 0x000000284528464e, 0x0000004628462854,
+    0x0000003b53455531, 0x000000534b543b31, 0x0000004e4f534553, 0x000000534f314253,
+    0x000000543b314b31, 0x00000042314f5345, 0x000000282c564253, 0x0000004e28262956,
+    0x000000564b564f31, 0x000000564f535531, 0x00000045554e4531, 0x0000004f29534f53,
+    0x0000004f53455556, 0x00000056284f3126, 0x0000002629532631, 0x0000002826314231,
+    0x0000004346455553, 0x0000003126534b4e, 0x0000003126532653, 0x0000004f31282631,
+    0x0000004b45554f56, 0x000000433b4e424e, 0x00000031284b5645, 0x0000003b314f5345,
+    0x000000562846544e, 0x0000004e264e2846, 0x0000002c4e453b53, 0x0000003128464131,
+    0x000000265342294e, 0x0000004b29534f4e, 0x000000435553264e, 0x000000003b31424e,
+    0x000000433b4e4e54, 0x0000002c4e543b31, 0x0000004f56454e31, 0x0000005628464256,
+    0x0000005628464e45, 0x000000462846544e, 0x000000455554414e, 0x0000005454534f53,
+    0x000000284b454231, 0x000000434e422931, 0x000000284f532653, 0x000000294e4f2953,
+    0x0000004e3145554e, 0x0000004f534b4f31, 0x0000002826534b4e, 0x0000004e26314231,
+    0x0000004628465556, 0x000000534b452846, 0x0000004e454e4b56, 0x000000264e4f2931,
+    0x000000284f564f4e, 0x000000314b31424e, 0x000000282c53554e, 0x0000003128453b31,
+    0x0000004642562653, 0x0000003126562631, 0x0000002831292846, 0x0000003126294e45,
+    0x0000005642312631, 0x0000002653262956, 0x000000464b314555, 0x000000554e4f2931,
+    0x0000004e28452656, 0x00000053554b4553, 0x0000004f53284131, 0x000000433b314231,
+    0x000000534f312846, 0x0000004e4b534f4e, 0x000000314f534256, 0x0000004e28262931,
+    0x0000004e45534f4e, 0x0000004e454e2653, 0x000000315453454e, 0x00000046534f3154,
+    0x0000004229312845, 0x000000434e543b4e, 0x0000004b45312653, 0x0000002631452845,
+    0x0000005326562656, 0x0000005345554b4e, 0x0000002845554b4e, 0x000000314f295345,
+    0x00000045284f554e, 0x000000264e4f2956, 0x0000002931284645, 0x0000000043533145,
+    0x00000042534f5645, 0x00000000003b5556, 0x0000002855292846, 0x0000003126312653,
+    0x000000564f312631, 0x00000056544e4f53, 0x0000004626534b45, 0x000000314528264e,
+    0x0000004554534f4e, 0x0000004356543b31, 0x00000043554e2653, 0x0000005455534f31,
+    0x0000002845285531, 0x000000284f312631, 0x0000004642534b53, 0x00000056534f5326,
+    0x0000004b4e455529, 0x0000004e26564231, 0x0000003b31422953, 0x0000000043314555,
+    0x0000004328543b53, 0x0000004f4e284231, 0x0000004555314253, 0x0000002846564b45,
+    0x000000454e4b2953, 0x00000055314f5345, 0x0000005328454256, 0x0000002c53284b45,
+    0x0000000043535531, 0x0000004e4b455556, 0x0000002953285431, 0x0000002845294b31,
+    0x000000464f565331, 0x0000004e284f4b45, 0x000000284628424e, 0x000000453b534b31,
+    0x0000005328422931, 0x0000004e544e5431, 0x0000004e26532656, 0x0000002855314b4e,
+    0x0000000053452656, 0x0000002629312656, 0x000000284b292846, 0x000000534f564153,
+    0x0000002846265345, 0x000000534f535431, 0x0000003b314b294e, 0x0000004528262931,
+    0x000000284f565531, 0x00000053264e4b45, 0x0000003142314231, 0x0000000056452631,
+    0x0000005628465556, 0x0000004626564f53, 0x000000534b312631, 0x0000005326534f53,
+    0x00000028464b2953, 0x0000004f3145554e, 0x0000000031422956, 0x0000005626534f56,
+    0x000000464f294b4e, 0x0000004f4e45264e, 0x000000004331424e, 0x000000284b53264e,
+    0x000000003b564b53, 0x0000002956284153, 0x000000534b452956, 0x00000031544e454e,
+    0x0000004f45534f31, 0x0000004e4b314231, 0x00000045314b294e, 0x0000005626564253,
+    0x000000534b452653, 0x0000004653292846, 0x0000004e4b45554e, 0x0000004b45554b4e,
+    0x0000002c534f5645, 0x0000004e264e2656, 0x0000004e4b453b56, 0x00000028464f294e,
+    0x000000534f56424e, 0x00000046264e264e, 0x0000003b4e543b56, 0x00000000564f2953,
+    0x0000004f534e5431, 0x0000002846282631, 0x000000554e262931, 0x00000028264e2846,
+    0x0000003b31543b56, 0x0000004b534f294e, 0x0000002831284b45, 0x00000045554b4553,
+    0x0000005631534f56, 0x0000003b29312845, 0x0000000053455531, 0x000000462826294e,
+    0x0000004e28462656, 0x0000004645282653, 0x000000284f4b264e, 0x0000004e4f53414e,
+    0x0000003142532631, 0x0000004f534b4555, 0x0000004f5641534b, 0x000000534f53554e,
+    0x0000005326532845, 0x0000005328464f53, 0x000000554e314f53, 0x0000004e4f54414e,
+    0x0000002953284131, 0x00000028264e2656, 0x0000004b564b4e45, 0x0000004654534f4e,
+    0x0000004e4553264e, 0x0000002928462845, 0x0000004f314b3145, 0x0000002842314b4e,
+    0x000000535456454e, 0x0000005526534f56, 0x0000004e31284656, 0x0000003155314f53,
+    0x000000284b534231, 0x00000056454e4b4e, 0x0000000055564f31, 0x0000005326564231,
+    0x0000003154534553, 0x00000028543b2956, 0x0000004e544e5456, 0x000000283b4e4b45,
+    0x00000043564b4553, 0x000000453b294b31, 0x0000002845314b4e, 0x000000314b312653,
+    0x0000005342534231, 0x0000002855534231, 0x0000003b534b4555, 0x0000002631422956,
+    0x00000028534f5645, 0x000000312846264e, 0x0000005355564f4e, 0x000000284b534555,
+    0x0000005342312631, 0x000000314f534b4e, 0x0000004353453b56, 0x000000534f314e45,
+    0x000000433b534256, 0x000000284b314256, 0x0000003b4e4b4553, 0x000000284e543b53,
+    0x000000534f4e544e, 0x00000056264e2631, 0x00000053414e4f53, 0x0000004f4e284655,
+    0x00000056282c2931, 0x0000005556262953, 0x0000004e4f532826, 0x0000003142294b4e,
+    0x000000264e4f5345, 0x0000003b56422953, 0x0000002c564f534b, 0x00000031534f5626,
+    0x000000534f535645, 0x0000004b45564b4e, 0x000000434e4b4555, 0x0000005431543b56,
+    0x0000003126534253, 0x0000000000294e45, 0x0000004555564231, 0x0000002855562631,
+    0x0000003128465553, 0x0000004e42294b56, 0x000000314b452845, 0x0000004e4f455556,
+    0x00000056454e5431, 0x00000000003b5531, 0x000000464f535631, 0x00000053284b314b,
+    0x000000314b4e4b45, 0x000000434e314b45, 0x0000004645554b31, 0x0000004f53452845,
+    0x0000004e2841314b, 0x00000046284f3145, 0x000000284b452656, 0x000000532841564b,
+    0x0000005356292846, 0x00000045554e4b4e, 0x0000003b56453b56, 0x000000543b4e454e,
+    0x000000292846454e, 0x0000004f4e285531, 0x0000000043535645, 0x000000292846424e,
+    0x0000004e2653424e, 0x0000004e54543b53, 0x0000004656534f53, 0x00000046284b2656,
+    0x00000031284f4e45, 0x0000005556455531, 0x000000464f532653, 0x00000028464b264e,
+    0x000000004645554e, 0x0000002931282631, 0x0000004e4e545531, 0x0000004e26312656,
+    0x0000002c5645554e, 0x000000554e4f2956, 0x000000534f56454e, 0x0000004e284f5326,
+    0x0000005626295645, 0x000000453b534f53, 0x0000002c29562846, 0x0000002846282c4e,
+    0x0000002953284556, 0x0000003b564f2956, 0x0000004641534f53, 0x0000002931285531,
+    0x0000003128543b53, 0x00000053282c5645, 0x000000554e4b2953, 0x000000534f564256,
+    0x000000004e452656, 0x0000004e284b4f4e, 0x0000004626534b53, 0x00000031453b2953,
+    0x0000002953455556, 0x0000004f2928464e, 0x000000284f532631, 0x000000284b45424e,
+    0x000000282656424e, 0x0000005626532845, 0x0000004f29564b45, 0x0000004528464f53,
+    0x000000003b4e4b56, 0x000000264e262931, 0x000000314f535453, 0x0000005342314b56,
+    0x00000042564f4e45, 0x0000002953284653, 0x000000435345554e, 0x0000003128465456,
+    0x00000031284b2956, 0x0000003b31452653, 0x000000564b453b56, 0x0000004329312631,
+    0x0000004f564f314b, 0x0000004e45552953, 0x0000004555564f31, 0x0000002c31284f31,
+    0x00000031264e4b56, 0x00000056534f4e26, 0x000000534f293145, 0x0000005642314b45,
+    0x000000433b4e4256, 0x0000004555564b53, 0x0000004626293145, 0x0000004b534f4e45,
+    0x0000005355534f53, 0x0000004f56314b45, 0x0000005328425345, 0x000000004356314e,
+    0x00000056453b294e, 0x000000564f4e2846, 0x0000005328465553, 0x000000543b532631,
+    0x000000004331454e, 0x0000002826534f31, 0x000000532846454e, 0x00000043314f2931,
+    0x0000004f29312826, 0x00000046284b314b, 0x000000564b455529, 0x000000464b452953,
+    0x0000004e45554e26, 0x00000046314f5326, 0x000000004e26294e, 0x0000004656262953,
+    0x00000028464b4f56, 0x0000002845555345, 0x0000004b534f314b, 0x0000005328465331,
+    0x000000462c56424e, 0x000000294e4f2931, 0x00000046564f3145, 0x000000284645554e,
+    0x00000000004e2653, 0x0000004555534b53, 0x0000004655534f56, 0x000000284f543b56,
+    0x000000314b455456, 0x00000046284b4f4e, 0x00000056282c5645, 0x0000002931284f53,
+    0x0000004555564b45, 0x0000005545534f53, 0x000000433b53264e, 0x0000005345555626,
+    0x0000002953285456, 0x0000003142294b56, 0x000000462c535556, 0x000000003b4e4e54,
+    0x0000004645284645, 0x0000004e424e2656, 0x0000003b31422956, 0x0000005653564f31,
+    0x000000534f312656, 0x0000004b45294b53, 0x000000464f4e2656, 0x000000005626294e,
+    0x0000005631534f4e, 0x0000003126534b45, 0x00000056543b294e, 0x000000284f564b45,
+    0x0000002c56282653, 0x0000000056532653, 0x0000004642294b53, 0x000000564f314b53,
+    0x0000004e454e4531, 0x0000004b5342294e, 0x000000564b532631, 0x0000000000314253,
+    0x000000433b4e3145, 0x00000055564f534e, 0x000000314f53414e, 0x0000004e28464531,
+    0x000000562841564b, 0x00000046284f2953, 0x0000004e4b314f53, 0x0000004b4e455553,
+    0x0000002656455556, 0x0000002842314b45, 0x0000004555314531, 0x000000464f565456,
+    0x0000004555544153, 0x000000284628554e, 0x0000002841534f53, 0x000000464f314556,
+    0x00000028554e4256, 0x0000003126293145, 0x0000002842314253, 0x0000005345534b4e,
+    0x0000002631455531, 0x0000004f564e5431, 0x0000004f29532845, 0x0000004e45294b53,
+    0x0000004b314b4555, 0x0000002931425345, 0x0000000043533153, 0x00000046264e4256,
+    0x0000003128464231, 0x0000002928464b4e, 0x00000045554b2931, 0x000000462845554e,
+    0x0000002931284b4e, 0x0000004f314b4531, 0x000000294e284645, 0x0000004626534f56,
+    0x0000004b45284631, 0x000000424b564f4e, 0x000000295626294e, 0x0000004542564f31,
+    0x000000534f4e5431, 0x000000543b4e4f53, 0x0000004f28452656, 0x000000294b564f53,
+    0x000000464f564e54, 0x0000004f314e5456, 0x0000004655534f4e, 0x00000053264e2631,
+    0x0000004655292846, 0x0000004f56292846, 0x0000004b53453b56, 0x0000004f56452846,
+    0x0000004e544e2653, 0x0000002953562845, 0x000000295328464b, 0x000000564e54554e,
+    0x0000004e284f4e45, 0x0000003b31532631, 0x0000003155564f31, 0x000000433b534b53,
+    0x0000004f56452953, 0x0000004f53284654, 0x00000053284b264e, 0x00000042534b2931,
+    0x0000002846282656, 0x0000000045553153, 0x0000004f4e422956, 0x0000005645294b56,
+    0x0000005345314b53, 0x00000056424b294e, 0x0000000029532846, 0x000000462853544e,
+    0x0000002953284256, 0x0000002931284b53, 0x000000455553454e, 0x00000028464b4f53,
+    0x0000004e4b4e4b45, 0x000000314b452956, 0x0000004329534f4e, 0x00000053284f534b,
+    0x000000464e543b53, 0x0000004f53543b53, 0x000000284b564f4e, 0x0000003129532845,
+    0x0000004629534f4e, 0x0000004555564f4e, 0x000000003b4e2656, 0x0000002956455553,
+    0x0000004e4f534531, 0x00000043564b4f31, 0x000000534b312653, 0x0000005553262931,
+    0x0000004e54534f31, 0x0000000000535645, 0x0000000000563145, 0x0000004346455531,
+    0x0000002845564f4e, 0x000000464b312631, 0x0000003128454253, 0x000000454e453b31,
+    0x0000002842534b45, 0x000000462c4e4256, 0x0000004e4f455531, 0x0000004642564b56,
+    0x000000534b564253, 0x00000053284f5653, 0x0000002846284f56, 0x000000464b4e2656,
+    0x0000005642534256, 0x00000046424e2653, 0x00000031282c294e, 0x000000464f4e5645,
+    0x0000004e28265645, 0x000000264e4f2953, 0x0000002826534253, 0x00000028464f5354,
+    0x0000004626295345, 0x000000554e4b4531, 0x000000412931284b, 0x0000004353422953,
+    0x0000005341534f31, 0x00000042534f3145, 0x000000532631264e, 0x0000005345552956,
+    0x0000002956425345, 0x000000564f534555, 0x0000005326294b31, 0x0000004b45284f31,
+    0x000000464b452856, 0x00000045564b294e, 0x0000004e4f455553, 0x000000543b4e544e,
+    0x000000534f534253, 0x0000004e28422931, 0x00000055294e5645, 0x000000282c315556,
+    0x000000564528464e, 0x0000005441564f4e, 0x0000002845282656, 0x000000534f312826,
+    0x000000543b534f31, 0x0000004b29564f53, 0x0000005356534f56, 0x000000284f562653,
+    0x00000031282c3145, 0x0000002845282c56, 0x000000003b294e45, 0x00000026314b294e,
+    0x00000043314b4553, 0x0000002653422956, 0x000000534e455556, 0x0000004f31284626,
+    0x00000046264b2653, 0x0000002928462854, 0x0000005553564f31, 0x0000004642314b53,
+    0x0000000000432931, 0x0000004654564553, 0x0000002c31455553, 0x000000564f534231,
+    0x0000002855314b45, 0x000000543b312631, 0x000000282c565556, 0x0000004f4e282c56,
+    0x00000031284f5326, 0x00000053284b4e45, 0x0000004626312846, 0x0000002c53543b56,
+    0x0000004542534f4e, 0x00000055564f5326, 0x000000564b452846, 0x0000005345284653,
+    0x0000004b5345264e, 0x00000054564b4531, 0x0000004f56262956, 0x0000003b29564f4e,
+    0x000000464b534555, 0x0000004f53452931, 0x0000004f4e454e31, 0x000000543b4e264e,
+    0x0000004b564b5345, 0x0000004e28464156, 0x0000005456453b53, 0x0000004b4e4f2953,
+    0x0000002c4e284f56, 0x0000002931282c56, 0x000000284e455531, 0x0000004b4e453b53,
+    0x0000000043314253, 0x0000002931262953, 0x0000000000532653, 0x0000004555534b4e,
+    0x0000004528564f53, 0x0000004642534b45, 0x000000294e424e45, 0x000000564b564253,
+    0x000000003b53314e, 0x000000264e284645, 0x0000002846284b53, 0x000000564b534555,
+    0x00000043564f294e, 0x0000004f56455529, 0x0000004e42534f56, 0x0000004528265345,
+    0x0000004654534556, 0x000000004555534e, 0x0000002854534f56, 0x000000284f4e454e,
+    0x0000004f294e2656, 0x000000564f315431, 0x0000004f53425345, 0x0000005529314f53,
+    0x0000004e2653264e, 0x0000002846414e4b, 0x0000004f45284f4e, 0x0000004b29562845,
+    0x0000004f5328464e, 0x00000031424e4b56, 0x0000004626564b31, 0x0000004529534f31,
+    0x0000002854534556, 0x000000264e28424e, 0x0000004e45564b56, 0x0000004f4e284156,
+    0x0000004f4e284555, 0x0000004b45312656, 0x0000002846543b31, 0x00000028543b2953,
+    0x000000284f4e5456, 0x0000002845314b31, 0x000000543b31454e, 0x00000053424e2656,
+    0x000000284e314f53, 0x0000003b4b45554e, 0x000000284645294e, 0x000000452845554e,
+    0x0000003128462c53, 0x000000314b453b53, 0x0000000053452631, 0x0000005354314f53,
+    0x000000293145554e, 0x0000004f4b453b56, 0x0000004b4553264e, 0x0000002855564f4e,
+    0x000000434b455531, 0x000000534b45554e, 0x00000031284b4f31, 0x0000004b29284645,
+    0x0000004e45294b4e, 0x000000464b4e4231, 0x00000026534f3145, 0x0000002831543b53,
+    0x000000434e4b2931, 0x000000004b455556, 0x0000004628265645, 0x00000055314b2931,
+    0x00000046264e4b53, 0x0000003145284f53, 0x000000543b564f4e, 0x000000532845264e,
+    0x000000284f532854, 0x000000262956264e, 0x0000003142564b56, 0x0000004f53284156,
+    0x000000464f312653, 0x0000000043314231, 0x0000004b45294b4e, 0x000000003b532656,
+    0x0000004f564b2653, 0x00000056534f4e45, 0x0000004e45284b45, 0x0000004653564f31,
+    0x000000564f4e4231, 0x0000002656284645, 0x000000534e54554e, 0x0000005528564f53,
+    0x0000004b4e4f534b, 0x000000534f532653, 0x000000562846424e, 0x0000004e264e424e,
+    0x00000055314f2953, 0x0000004645564f31, 0x0000004e4b543b53, 0x0000005342534253,
+    0x000000464f4e2631, 0x00000053284b4f31, 0x0000004f56452656, 0x0000004f53453b4e,
+    0x0000004f554e4f53, 0x0000004b4f564f31, 0x0000000043315553, 0x0000004229314f53,
+    0x000000433b4e4b31, 0x0000004e284f4e26, 0x000000003b4e4f53, 0x0000003145314b4e,
+    0x00000043314b4f56, 0x0000004b45562656, 0x000000534b564f53, 0x0000004e26534256,
+    0x000000264e452845, 0x0000004f29564f53, 0x0000002842534f31, 0x000000314f4b4f4e,
+    0x0000004e28464b31, 0x0000003b564b4556, 0x000000554e4b564b, 0x000000464f534555,
+    0x000000284641564b, 0x0000000043534f31, 0x0000004e4f534153, 0x0000004e284b2931,
+    0x0000004e544e4553, 0x000000462831544e, 0x0000004e5456264e, 0x0000004f31425345,
+    0x0000004e4b312656, 0x0000004b564b3145, 0x0000004e314f5345, 0x0000002c29314f53,
+    0x0000003b5326294e, 0x000000435556264e, 0x00000046564f5326, 0x00000046534f5354,
+    0x00000053284f314b, 0x0000004e26562631, 0x0000004f4e28554e, 0x0000000053562656,
+    0x0000005645555626, 0x0000004656543b53, 0x00000028264b2631, 0x00000031264b4f31,
+    0x0000005356534f31, 0x0000002928465431, 0x0000004628262953, 0x00000053264e4b56,
+    0x0000005628462631, 0x0000000000564b56, 0x00000056284b4556, 0x0000003126534f31,
+    0x00000046284b4531, 0x000000294e425645, 0x0000004f4e452855, 0x00000029534f3145,
+    0x0000004542534f53, 0x00000028454e4b56, 0x00000028464b2653, 0x0000005645314f53,
+    0x0000004e4b4e4555, 0x0000002c5328264e, 0x0000004f4e452656, 0x00000053264e4b31,
+    0x0000003154564531, 0x000000534b452953, 0x0000004e544e4f53, 0x00000055314b2953,
+    0x0000004628465653, 0x000000433b564f4e, 0x000000464f56554e, 0x00000029534f294e,
+    0x000000465456454e, 0x0000004628465431, 0x000000284f535653, 0x0000004f4e452931,
+    0x000000433b314b31, 0x000000314e455531, 0x0000002956284b31, 0x0000000043564b56,
+    0x000000534f314b45, 0x000000464f534553, 0x0000003b31453b56, 0x0000003126314b53,
+    0x000000264e284f31, 0x0000002c564f3145, 0x0000004e28463145, 0x0000004e28424e45,
+    0x0000002956285453, 0x0000004628465654, 0x00000031284f3154, 0x0000004554314f53,
+    0x00000053282c314b, 0x0000004642564b53, 0x0000004e2928464e, 0x000000284f54414e,
+    0x0000004626532653, 0x00000029564f4e45, 0x0000002845284631, 0x000000005345554e,
+    0x0000004f564b4e4b, 0x0000004e284f2953, 0x0000004b264e4f53, 0x0000005531292846,
+    0x0000004b4e45554e, 0x0000004e4b45294e, 0x0000002931284531, 0x000000464b534256,
+    0x000000543b4e4b56, 0x0000004f5328464b, 0x00000028564f4e26, 0x000000534b56264e,
+    0x0000005529312653, 0x00000055564f4e45, 0x000000424e455531, 0x0000004f294e264e,
+    0x0000002653284f31, 0x0000005441534f31, 0x0000004f31452846, 0x000000564b314231,
+    0x0000005645555326, 0x0000004555534256, 0x0000003153564f53, 0x000000284f31424e,
+    0x0000004528554f31, 0x00000053284b4e4b, 0x000000284f314256, 0x000000464f562854,
+    0x0000004528452845, 0x0000005526534f53, 0x00000028464b4f4e, 0x0000004f53455531,
+    0x0000004631262931, 0x0000002c53282653, 0x0000004b4e455556, 0x0000005531262931,
+    0x0000004f56284153, 0x0000002928464e54, 0x000000434e455553, 0x00000000564f2956,
+    0x00000028414e4f53, 0x0000004626562653, 0x0000003b4b455531, 0x0000004b4e453b4e,
+    0x0000004642314231, 0x000000562841314b, 0x0000004f31265645, 0x000000462c314b45,
+    0x0000004645534f53, 0x000000464e262931, 0x00000046424e4256, 0x0000004e2826294e,
+    0x0000004f5645294e, 0x0000004e28465331, 0x0000005529312631, 0x000000424e4f2956,
+    0x0000004f53454e31, 0x000000543b534553, 0x000000464f534231, 0x0000002c53543b4e,
+    0x0000004f564b2931, 0x0000002953284e54, 0x0000004e53455453, 0x0000004555292846,
+    0x0000004f31284b53, 0x000000534f314b4e, 0x0000004f4e455456, 0x0000005453453b56,
+    0x0000005328462656, 0x000000464f562826, 0x0000005342314b4e, 0x00000046314f534b,
+    0x000000315456454e, 0x000000003b534231, 0x00000028554e4253, 0x0000004b3145264e,
+    0x000000544e54544e, 0x000000543b564b4e, 0x000000003b564256, 0x000000284f534131,
+    0x0000004555314f53, 0x00000046284f5626, 0x000000003b4e5645, 0x000000453b314b56,
+    0x0000000056452656, 0x0000005645555645, 0x0000004b29284653, 0x0000002831534f53,
+    0x0000005529564b45, 0x0000004f53554531, 0x00000045283b4e45, 0x00000028462c534b,
+    0x0000004e284f4e54, 0x0000003145282c4e, 0x00000045284b4531, 0x000000284f4e4553,
+    0x00000000314f2953, 0x00000046454e4b31, 0x000000433b532631, 0x00000026564f2931,
+    0x0000002831534f31, 0x0000002845294b53, 0x00000028264e4253, 0x0000003b55534f31,
+    0x000000543b293145, 0x0000004f453b2956, 0x00000028554e2656, 0x00000045284b3145,
+    0x00000043314e5453, 0x0000002842314f53, 0x0000005328464256, 0x000000284f295345,
+    0x0000000043532653, 0x0000005456453b56, 0x0000005328455431, 0x000000314b452953,
+    0x0000004555295645, 0x0000003b4e262953, 0x0000004e284f314e, 0x0000004f5328454e,
+    0x000000534f4e4555, 0x0000004555314231, 0x000000314f53544e, 0x0000000043532656,
+    0x000000284e4f5326, 0x000000544e453b53, 0x00000056282c5345, 0x000000534f4e4253,
+    0x0000004e54534f56, 0x000000534253264e, 0x00000053284f5326, 0x0000003b31453b4e,
+    0x0000002854314556, 0x0000005328465654, 0x0000004353543b31, 0x000000564b564256,
+    0x0000005553292846, 0x000000433126294e, 0x0000002841534f31, 0x00000029534b4e45,
+    0x0000002629562845, 0x00000056424e4f53, 0x000000534f544156, 0x000000312846414e,
+    0x0000005653314f53, 0x0000000053455556, 0x00000031264b2656, 0x00000055564b314b,
+    0x0000004e42312631, 0x000000000056264e, 0x0000002846452855, 0x0000005328422953,
+    0x0000002953285531, 0x0000004b4f4b4556, 0x0000002845314b53, 0x0000004554534f31,
+    0x000000003b534e54, 0x0000005328465354, 0x000000314f53424e, 0x0000000000534231,
+    0x0000000055532631, 0x00000056282c3145, 0x00000053544e4553, 0x000000312845554e,
+    0x0000002846425345, 0x0000003126295645, 0x000000003b534555, 0x00000056284f5326,
+    0x0000004f56425645, 0x0000004229534f56, 0x0000000043314b4e, 0x0000004629562845,
+    0x0000003b4e4b5645, 0x0000002931284231, 0x0000005453453b53, 0x0000004331262956,
+    0x000000003b543b56, 0x0000002629534f31, 0x0000004629532845, 0x0000003b29284645,
+    0x0000004b56453b53, 0x0000002c4e543b4e, 0x000000543b314531, 0x00000029314b4e45,
+    0x0000004b2931284b, 0x00000055314f2956, 0x0000002956284b53, 0x0000004e4f535431,
+    0x0000005641534f4e, 0x00000056534f5645, 0x000000455531424e, 0x000000464f564256,
+    0x0000004f55564f4e, 0x0000002956284231, 0x0000004e56455553, 0x0000004356532656,
+    0x0000002855314b31, 0x0000004231262931, 0x00000031284b4553, 0x0000005645552956,
+    0x00000042564f2953, 0x0000004628455529, 0x0000004f56532653, 0x0000002953284f4e,
+    0x00000056284b564b, 0x0000002846453b56, 0x000000284f315453, 0x000000433b45554e,
+    0x0000000056532656, 0x0000004356534b45, 0x00000043564f2953, 0x000000464e455556,
+    0x0000004629532854, 0x00000045294e4f53, 0x0000002853455531, 0x0000004331262931,
+    0x0000003b4e453b4e, 0x0000004628543b31, 0x0000004e4f4b4f53, 0x0000004f5626294e,
+    0x0000004b26564f4e, 0x0000004b45555626, 0x0000004f5628554e, 0x00000055564f2931,
+    0x000000462c534555, 0x00000026564b2931, 0x0000003145284645, 0x0000003b4e45264e,
+    0x000000284256264e, 0x0000004f4e284531, 0x0000004b4f455556, 0x000000464f563145,
+    0x0000003b294e2846, 0x00000031454e4b56, 0x000000284e4b4555, 0x0000005342564b53,
+    0x000000284b314253, 0x0000004f53562631, 0x000000564b292846, 0x0000000000534f53,
+    0x0000000053562631, 0x0000005328453b31, 0x0000004f4e425345, 0x000000003b4e4555,
+    0x000000453b314b31, 0x0000004628464b45, 0x00000056454e4b31, 0x0000004b53455556,
+    0x000000264e4b2953, 0x0000002845284653, 0x0000004645294b56, 0x0000005628464531,
+    0x00000053284f2931, 0x000000534e543b31, 0x0000004b4e4b4e45, 0x0000000045555653,
+    0x0000003b4e453b53, 0x0000004526534f56, 0x000000284f535645, 0x0000004653543b4e,
+    0x0000004f4e284131, 0x0000004555564256, 0x0000004329312656, 0x0000002845554e26,
+    0x00000028464e264e, 0x0000000029314b45, 0x0000004e424e4256, 0x000000282c534f56,
+    0x00000053564f4e45, 0x00000029534e2854, 0x000000454e543b53, 0x00000031284f5645,
+    0x0000005345294b31, 0x00000029314f2953, 0x00000028464f5626, 0x0000003b564b2956,
+    0x00000045284f4e45, 0x0000003128464b31, 0x000000564b534231, 0x000000282c535553,
+    0x000000464f564531, 0x0000004555534f53, 0x00000053284b2953, 0x00000028264e4b56,
+    0x0000004f31285431, 0x00000028554b4556, 0x0000005645284631, 0x0000002956262956,
+    0x0000000043312656, 0x000000464f31454e, 0x0000004f534b2653, 0x0000004629312854,
+    0x0000004b4555294e, 0x0000004f564b4555, 0x000000282c564f53, 0x000000284f31544e,
+    0x000000534b4e264e, 0x00000041294e284b, 0x000000464f314b4e, 0x000000532841534b,
+    0x0000002928464131, 0x0000002928463153, 0x0000002956284131, 0x000000284f314b4e,
+    0x00000046284f5653, 0x0000004f29532653, 0x000000564f4e2653, 0x000000424e262956,
+    0x0000002856455553, 0x0000004654314f53, 0x000000534b452656, 0x0000005326534f4e,
+    0x0000002841314f53, 0x000000312846544e, 0x000000005342294e, 0x0000002845554b31,
+    0x0000002853564f53, 0x000000464b314253, 0x0000004b45284f56, 0x00000028264e4256,
+    0x00000055564f2956, 0x000000433b314b53, 0x000000464f314553, 0x0000004f31284e31,
+    0x0000004e54532656, 0x0000002953282c31, 0x00000028464f3154, 0x00000045424e4f53,
+    0x0000004b4f4b4553, 0x000000434555534e, 0x0000004b26564f31, 0x00000028462c5345,
+    0x000000534f563153, 0x00000046454e4b53, 0x0000002841292846, 0x0000004f543b2953,
+    0x0000005326564b53, 0x0000000000565345, 0x0000002928465631, 0x0000004f564b2631,
+    0x0000004f3145544e, 0x00000042294e2845, 0x000000562842294e, 0x00000045554b4531,
+    0x000000534f565456, 0x0000002931282c53, 0x0000004b45553153, 0x000000433b56264e,
+    0x000000534f564f53, 0x0000004f56285431, 0x0000005326532656, 0x0000002631284b45,
+    0x0000004e28422953, 0x000000564f31264e, 0x0000004628264e45, 0x0000002629562846,
+    0x00000026534f4e45, 0x00000042314b2931, 0x0000003b564f3145, 0x0000004e424e4b31,
+    0x000000534f4b2653, 0x0000005645282631, 0x000000534f315531, 0x000000000056424e,
+    0x0000003b534b4553, 0x000000543b56264e, 0x00000055534f4e26, 0x0000004528552831,
+    0x000000464f312631, 0x0000004345554e31, 0x00000028543b294e, 0x0000004e284b4556,
+    0x00000055564b534b, 0x00000046453b2953, 0x0000002656422956, 0x00000056314f534b,
+    0x000000284f564256, 0x000000534f534553, 0x0000004e453b2953, 0x0000002842564b56,
+    0x000000464f565531, 0x0000004e28465354, 0x00000028554b4531, 0x0000004653284b45,
+    0x000000003b312653, 0x00000055534b2956, 0x00000043564b4f56, 0x0000005626532653,
+    0x0000004b29284656, 0x0000002629564f4e, 0x0000003128455556, 0x000000564f532653,
+    0x0000005628543b31, 0x0000004e45532631, 0x0000004f5341534b, 0x000000284b314f53,
+    0x0000005628464f31, 0x0000003b5645264e, 0x00000045554b4556, 0x0000004642534f53,
+    0x00000028464b294e, 0x00000028564f314e, 0x0000005345284f31, 0x0000004e42292846,
+    0x0000002928464256, 0x0000004628462653, 0x0000003b564f2931, 0x0000004e28454e31,
+    0x000000543b294e45, 0x0000004e4e543b53, 0x00000046424e2631, 0x000000434e4e5456,
+    0x00000055564f2953, 0x0000003b56543b53, 0x0000005628464131, 0x0000003128265345,
+    0x00000056284b5645, 0x0000005441292846, 0x0000004355562653, 0x0000004e42534f53,
+    0x00000055314f294e, 0x0000004528462846, 0x0000005341564f53, 0x0000004256262931,
+    0x00000000434b2631, 0x0000004f28455531, 0x0000004f56312854, 0x0000003126534f56,
+    0x0000002956285553, 0x0000002845284f4e, 0x0000003b534f5345, 0x0000002956282631,
+    0x0000002846294b53, 0x0000002631422931, 0x0000005628543b56, 0x000000464f4e5431,
+    0x00000031284b2931, 0x000000264e4b2956, 0x0000004f31284653, 0x0000005631455531,
+    0x0000003b31262953, 0x000000464f54414e, 0x000000534f4e4531, 0x000000433b532656,
+    0x000000543b562656, 0x00000053544e5453, 0x0000005645555345, 0x0000003b314b2931,
+    0x00000046424e4b53, 0x0000004b4e543b56, 0x00000031284f3126, 0x0000004e4b4e2631,
+    0x00000053264e2653, 0x0000005345564b31, 0x0000004f534b3145, 0x000000464e262956,
+    0x0000002854564f31, 0x00000028464e4b45, 0x0000004b4e4b3145, 0x000000433b4e264e,
+    0x0000005441564f53, 0x0000003b4e452631, 0x0000004f534b4556, 0x000000314b452846,
+    0x000000003b314e45, 0x0000004f53452631, 0x000000284b53424e, 0x000000462c314f53,
+    0x0000002953284654, 0x00000028424e4231, 0x000000462c314555, 0x0000004e4f534b31,
+    0x000000284f534b45, 0x0000004f314b4556, 0x0000005628465431, 0x0000004e45554f31,
+    0x0000002953262956, 0x0000003b56455553, 0x000000284b454b45, 0x0000004f53285456,
+    0x0000002928464f31, 0x000000314f535456, 0x0000003128464253, 0x0000004e4b4e2656,
+    0x0000002846284b31, 0x0000004e26534f4e, 0x0000002631262931, 0x0000000031422931,
+    0x00000056284f5631, 0x00000031534f5326, 0x0000004f4e262953, 0x0000005628454e31,
+    0x0000000000534555, 0x0000002826314253, 0x000000554e422931, 0x0000002846312854,
+    0x0000000055562631, 0x00000026564b294e, 0x000000462c4e4231, 0x00000056282c4e45,
+    0x000000433b31264e, 0x0000004628422956, 0x0000004e4b4e424e, 0x0000003b56453b53,
+    0x0000004b45554556, 0x0000004b45564b31, 0x0000004656292846, 0x0000005328464b31,
+    0x000000462846454e, 0x000000264e4b2931, 0x0000002629534f56, 0x0000002629564b45,
+    0x000000464e545553, 0x00000042564f5345, 0x0000000000564256, 0x0000004f56554556,
+    0x0000004f534b4f4e, 0x0000000046455556, 0x0000004f28455556, 0x0000003126564256,
+    0x00000055534f294e, 0x000000534f292846, 0x0000005328543b4e, 0x0000005653455553,
+    0x00000056264e264e, 0x0000004e4f534231, 0x00000000434e2631, 0x0000004f543b2956,
+    0x0000002c29564f4e, 0x00000056284f4e54, 0x0000004e54543b31, 0x000000282c4b2846,
+    0x000000464f56544e, 0x0000005355564f53, 0x00000053424e4253, 0x0000004628465553,
+    0x00000046284b564b, 0x0000004654564f53, 0x00000028453b2931, 0x000000314b314231,
+    0x0000005455534f56, 0x000000000053424e, 0x000000453b314b4e, 0x00000029314f5345,
+    0x00000031424e4b31, 0x0000004628462826, 0x0000004f56424e45, 0x0000004645284631,
+    0x000000564f534253, 0x0000004e544e5453, 0x0000002656422953, 0x0000002826534f56,
+    0x0000004528462656, 0x00000028454e4b31, 0x0000002956265645, 0x00000042564b294e,
+    0x0000004e544e2656, 0x0000000043565531, 0x0000000055564f53, 0x0000002846534f53,
+    0x000000534b4e4f53, 0x000000554b564f4e, 0x0000004f53284f56, 0x00000042564b2931,
+    0x0000004528453b31, 0x0000005645285553, 0x00000053284f2956, 0x000000534f535531,
+    0x0000005653292846, 0x000000284f534531, 0x000000284b455556, 0x0000002846534f31,
+    0x00000031284f4b45, 0x0000002826562631, 0x0000003126312656, 0x000000554e4f294e,
+    0x00000045314b2956, 0x000000284e455553, 0x000000003b4e4231, 0x0000005326314256,
+    0x0000005642294b53, 0x0000002855534f4e, 0x0000002956452855, 0x00000026294e2656,
+    0x00000028424b2931, 0x00000026564f2956, 0x0000004e4f295645, 0x00000053554b4556,
+    0x000000263128424e, 0x000000425626294e, 0x00000045283b5345, 0x0000002c534f3145,
+    0x000000314b45294e, 0x0000002c4e455553, 0x000000543b534f53, 0x0000004b31422956,
+    0x00000045554e4b56, 0x0000004645554e31, 0x0000004642314b45, 0x0000002c534f534b,
+    0x000000564f315556, 0x0000003142534b45, 0x000000294e284531, 0x000000532846284b,
+    0x0000004e42294b53, 0x000000455553414e, 0x0000004b4e452631, 0x0000004b4e452855,
+    0x000000464f564156, 0x00000031544e5456, 0x0000005626312653, 0x00000031264e4253,
+    0x0000003b53422931, 0x000000432931264e, 0x0000002631422953, 0x0000004329564f4e,
+    0x0000005326564256, 0x0000004b4b543b56, 0x000000314b564f31, 0x00000028534f5345,
+    0x00000028424b2956, 0x0000004f29534f4e, 0x00000031424e2653, 0x0000000000312631,
+    0x0000004628262931, 0x00000056284e544e, 0x0000004526564f31, 0x0000004555314553,
+    0x0000002928464556, 0x00000043534e5453, 0x0000005342562653, 0x0000004555293145,
+    0x000000464f564553, 0x00000000004e5645, 0x0000005526564f4e, 0x000000554e422956,
+    0x0000003b3126294e, 0x0000002846264e45, 0x0000002931284654, 0x0000004e45314b56,
+    0x0000002855534f53, 0x0000004353562653, 0x0000004f5642294e, 0x0000004f4e285553,
+    0x00000053284e544e, 0x000000282c564f4e, 0x000000564e545553, 0x000000284f535553,
+    0x0000004f31422953, 0x000000534f53414e, 0x0000005628465654, 0x0000002953284e45,
+    0x0000004631262953, 0x0000005642532653, 0x0000004628463154, 0x0000002842294b31,
+    0x000000464b453b53, 0x0000002846285453, 0x00000031284b4555, 0x0000004229534f4e,
+    0x0000005531455556, 0x000000562656424e, 0x000000564e545556, 0x0000002c46455556,
+    0x0000005455564f53, 0x000000294e284553, 0x0000004e4b543b56, 0x00000046454e4b56,
+    0x000000284f4e284b, 0x0000005628462826, 0x0000005645284f56, 0x0000004f4e28264e,
+    0x0000004f564b264e, 0x00000053284b4553, 0x00000028314f5326, 0x0000004b31452656,
+    0x0000004356453b31, 0x0000004f31284231, 0x0000003b4e4f2953, 0x0000003129284656,
+    0x000000534b452631, 0x0000004542534f56, 0x00000045284b5531, 0x000000534f534b56,
+    0x0000004f4e424e45, 0x0000004e4f53454e, 0x0000002846422956, 0x0000004e28452846,
+    0x0000004f4e4e5431, 0x0000003b4e543b4e, 0x0000002953455553, 0x0000004f5328264e,
+    0x000000003b535631, 0x0000004555294b53, 0x000000564b4e4231, 0x0000004528554e31,
+    0x0000004645284653, 0x0000000000314b31, 0x0000005342314b45, 0x000000534f564b53,
+    0x0000002846425645, 0x0000004e28464f56, 0x0000002841534f4e, 0x0000004e264e4b31,
+    0x0000004e453b2931, 0x0000004626534b56, 0x0000004f56284631, 0x000000284f564b56,
+    0x0000003142534b31, 0x000000453b56264e, 0x0000003b5531264e, 0x0000004645554b4e,
+    0x0000003145534f31, 0x000000005556264e, 0x000000314f4b4f53, 0x0000002853543b53,
+    0x0000004f31265345, 0x0000004e26314253, 0x000000284f564f53, 0x0000003b534f294e,
+    0x000000534f53544e, 0x000000543b564f31, 0x0000004b31455529, 0x00000031284f534b,
+    0x00000028554e4b53, 0x000000534f534555, 0x000000284f535531, 0x0000004356554556,
+    0x0000004353455531, 0x0000002631262956, 0x00000031453b294e, 0x0000003154534f4e,
+    0x000000534b532631, 0x0000003b53455553, 0x0000002631282631, 0x00000028464f564b,
+    0x0000002842314b56, 0x00000055564b2931, 0x0000005345553145, 0x000000562846554e,
+    0x000000314b562631, 0x0000005626312656, 0x0000002845534f56, 0x000000312846284b,
+    0x0000005328464e54, 0x0000002953284f53, 0x0000005628464231, 0x0000004e4b532631,
+    0x0000004b31534b45, 0x0000004555312631, 0x0000004b4e4b5345, 0x000000534f314553,
+    0x0000005654534f56, 0x00000041534f564b, 0x0000004e2846424e, 0x0000004555294b31,
+    0x0000003128464b53, 0x0000003b46455556, 0x0000004b45534b53, 0x000000554e4f5345,
+    0x0000004645294b53, 0x000000534f4b4f31, 0x000000564f31544e, 0x00000029534b3145,
+    0x0000004f294e2631, 0x0000003b56453b31, 0x0000005331455556, 0x0000002854534f4e,
+    0x00000054314b4553, 0x00000056314f5345, 0x00000053284f5631, 0x000000453b4e5456,
+    0x00000045283b5645, 0x0000004f56453b4e, 0x0000003145294b31, 0x0000005341314f53,
+    0x0000002845564b31, 0x0000005342532653, 0x00000042294e4f53, 0x0000002928464153,
+    0x0000005326292846, 0x000000314b532656, 0x00000056284f3154, 0x0000004f53452653,
+    0x00000028464b2931, 0x000000294e4f294e, 0x0000005342294b56, 0x00000053544e5456,
+    0x0000002629312845, 0x000000282c4e4253, 0x0000004e31455431, 0x00000026314b2953,
+    0x0000004e4f535553, 0x0000004528554e45, 0x000000564b534253, 0x0000004f56453b56,
+    0x0000004e28464b56, 0x000000464f56284b, 0x0000002928462c31, 0x0000004f4e28454e,
+    0x0000004e45532656, 0x000000312846424e, 0x0000002842534b4e, 0x000000282c564231,
+    0x0000004b4e543b53, 0x000000282631264e, 0x0000005345555345, 0x00000043534f2953,
+    0x0000005628464f56, 0x0000004528455531, 0x00000028424e4b45, 0x0000002c31284f56,
+    0x0000000031455556, 0x000000543b4e4553, 0x0000004528262953, 0x0000003129562846,
+    0x0000004b314b5645, 0x0000004353452956, 0x000000464e4f534b, 0x000000464f534156,
+    0x0000004231455531, 0x00000000534b4555, 0x0000005345314b31, 0x0000005628464555,
+    0x00000043314f2956, 0x000000284b564b45, 0x00000046282c564b, 0x00000043294e2656,
+    0x000000564f314e45, 0x0000003128464b56, 0x00000000004e4b31, 0x0000004b31455553,
+    0x000000284f534b56, 0x0000003b31455531, 0x000000564256264e, 0x000000284f312656,
+    0x0000004528314f53, 0x0000004555314b56, 0x000000284f534555, 0x000000534b4e4231,
+    0x0000004e543b2953, 0x0000000043315556, 0x000000265626294e, 0x00000031284e544e,
+    0x0000005531422953, 0x0000005642534253, 0x0000004626314b56, 0x0000003b564b4553,
+    0x00000000554e4f53, 0x000000554b564f31, 0x000000464e292846, 0x0000005645282c4e,
+    0x0000003b46455531, 0x0000005342534f31, 0x00000056264e4256, 0x0000004e3b534f56,
+    0x0000004e45294b56, 0x000000554b314f53, 0x0000002826294b56, 0x0000004231455556,
+    0x0000005431453b4e, 0x0000002653455556, 0x000000534b534f4e, 0x00000000534f2956,
+    0x000000284f294b4e, 0x0000004e3b4e4f53, 0x000000003126294e, 0x00000046534f564b,
+    0x0000005328452846, 0x00000056264e424e, 0x0000000056422953, 0x0000002846284f31,
+    0x0000002656262953, 0x000000534e543b53, 0x00000056534f3126, 0x0000003b53453b53,
+    0x0000004628454231, 0x0000003b4e4b4531, 0x000000534528264e, 0x00000055564b564b,
+    0x000000532c292846, 0x0000005556534f31, 0x000000433b314e54, 0x0000004e4e545553,
+    0x000000534f4e264e, 0x000000464f535531, 0x0000004e29532846, 0x00000053284b4555,
+    0x0000004645282656, 0x000000543b4e5456, 0x00000041564f534b, 0x00000046284b4545,
+    0x0000004353452656, 0x0000002c4e543b53, 0x0000002931285553, 0x000000284b4e4256,
+    0x0000000053455553, 0x0000003b564b4531, 0x0000004e54543b56, 0x00000026534b2956,
+    0x0000002842534253, 0x000000294e282c56, 0x0000004f56284656, 0x000000312845294e,
+    0x000000434e4f2931, 0x0000004f31455431, 0x00000031284b4e45, 0x0000004e4b4e5456,
+    0x000000464f4e4231, 0x0000003153284b45, 0x0000004b31455556, 0x0000005545564f31,
+    0x00000046264e4b31, 0x0000004654564556, 0x0000004e543b294e, 0x000000462c314256,
+    0x00000046264e2845, 0x0000005556534f53, 0x000000564b53264e, 0x000000294e292846,
+    0x0000005354534f31, 0x0000002953452845, 0x000000435653264e, 0x000000464f315431,
+    0x00000000004e4b56, 0x0000003128543b31, 0x0000004f31285531, 0x0000004e26534f56,
+    0x00000029534f2956, 0x0000005331534f4e, 0x00000000434e4256, 0x0000005653455531,
+    0x0000004e4253424e, 0x0000002c4e453b31, 0x0000005345534f31, 0x000000434e4e544e,
+    0x00000055534f3126, 0x0000005429532846, 0x000000543b4e2653, 0x000000464f544153,
+    0x00000043314f2953, 0x000000562845424e, 0x000000464f295345, 0x0000002c29534f4e,
+    0x000000534f31284b, 0x0000000043293145, 0x0000000043294e45, 0x000000314b4e4253,
+    0x000000003b564555, 0x0000002953284555, 0x0000004f4e453b53, 0x00000042534f5345,
+    0x0000004628453b56, 0x000000562845264e, 0x000000564f534153, 0x0000005341564f31,
+    0x000000464b292846, 0x0000002842534256, 0x00000031284b314b, 0x0000004b29532846,
+    0x0000004f56284b53, 0x0000004628462c56, 0x0000002846423145, 0x00000056284f5626,
+    0x0000004645534b4e, 0x00000031284b294e, 0x000000433b534f4e, 0x0000004f28464b45,
+    0x0000004b4e422931, 0x0000004e26294b4e, 0x00000046534f3145, 0x00000053424e424e,
+    0x00000028264e424e, 0x0000004e4e543b4e, 0x0000004f4e543b31, 0x0000003145282c31,
+    0x0000003b314f2931, 0x000000284642294e, 0x0000004f56284256, 0x0000003126534f4e,
+    0x000000433b312631, 0x0000002c56453b53, 0x000000534f56264e, 0x0000005528564f4e,
+    0x0000002846554556, 0x0000002826564b4e, 0x000000534f4e5456, 0x0000004b31455531,
+    0x0000004f56422931, 0x000000004353554e, 0x0000004555534b56, 0x0000004e4531264e,
+    0x000000464f312846, 0x0000004f4e282c53, 0x0000003b56452631, 0x000000462c565531,
+    0x0000004329562653, 0x0000002855532631, 0x0000002656452846, 0x000000564f534553,
+    0x0000005642564b31, 0x000000284f532656, 0x0000005529562846, 0x0000002846284531,
+    0x0000003b4e4b2931, 0x000000434e453b56, 0x00000028264e4b4e, 0x00000053284b5345,
+    0x000000284f535431, 0x000000534b564f4e, 0x0000002c53543b31, 0x0000005628554556,
+    0x000000284f314b53, 0x00000053284e5456, 0x000000295328464e, 0x0000002831534f4e,
+    0x000000284f534156, 0x000000464f53284b, 0x0000004331554556, 0x000000284256424e,
+    0x00000000534f294e, 0x0000000031534b45, 0x0000004256262953, 0x00000046284f4e26,
+    0x0000002826562656, 0x0000003142292846, 0x0000005528534f56, 0x000000314b455556,
+    0x00000046294e2846, 0x0000002826564f4e, 0x0000004353543b53, 0x0000002846452953,
+    0x00000046284f5345, 0x0000000000535631, 0x0000004e4b534f56, 0x0000003b564b4555,
+    0x000000453b534f4e, 0x0000004e45284631, 0x000000534f564b56, 0x0000005531422931,
+    0x000000464e543b56, 0x0000004f31543b31, 0x0000005641534f53, 0x00000043314b4531,
+    0x0000002c4e543b56, 0x0000004b56453b31, 0x0000004f534b4e4b, 0x0000002c53284555,
+    0x0000004329562846, 0x000000532653424e, 0x0000000056314b45, 0x0000002631284f4e,
+    0x0000002855562656, 0x0000005553422953, 0x0000005454292846, 0x0000005556292846,
+    0x000000424e4b2953, 0x00000056282c564b, 0x0000004e454e4f53, 0x000000534f315453,
+    0x00000031284f314b, 0x000000564b562631, 0x0000005545534f31, 0x0000003145564b53,
+    0x000000543b314f53, 0x0000002845534f4e, 0x0000002846294b56, 0x0000004e264b264e,
+    0x00000053454e544e, 0x000000003b534f53, 0x0000004526534f31, 0x000000534f564156,
+    0x0000004331543b31, 0x00000031284b4f4e, 0x000000284e4f554e, 0x000000284b543b53,
+    0x0000004e28264e45, 0x00000043294e4b45, 0x000000003b534b56, 0x0000004e4b4e3145,
+    0x0000002931532854, 0x0000005545564f4e, 0x000000292846284b, 0x0000003128262956,
+    0x000000284e545531, 0x0000003129284631, 0x00000043554e4f53, 0x0000004f29564f4e,
+    0x000000003145554e, 0x0000004e282c534b, 0x000000434e4e5431, 0x0000002846564f31,
+    0x000000464f4e4253, 0x00000055564b2956, 0x0000004629534f53, 0x00000029314f294e,
+    0x0000004642294b56, 0x000000464f294e45, 0x0000004f29562631, 0x0000002846452856,
+    0x000000534256424e, 0x000000464b4e4f53, 0x0000005642564253, 0x000000434e543b31,
+    0x0000004e264e2631, 0x0000003b5645554e, 0x0000004f4e282c4e, 0x0000005529312846,
+    0x000000284b452931, 0x0000003b5356264e, 0x000000434e543b56, 0x000000424b4e4f53,
+    0x000000462631264e, 0x0000003128464b4e, 0x00000028564f5326, 0x000000534f532845,
+    0x0000005642534f31, 0x0000004f5641314b, 0x00000031264e4b31, 0x000000562656264e,
+    0x0000005529312845, 0x0000003142562653, 0x000000435345264e, 0x0000005326294e45,
+    0x00000045284f5553, 0x0000002846562854, 0x00000053264b2656, 0x0000004529532846,
+    0x00000028464e4f53, 0x0000004645314b56, 0x0000005628464b53, 0x00000029284b2846,
+    0x000000282c565531, 0x00000031284f5345, 0x00000046284b4e45, 0x000000314e545553,
+    0x0000002831534f56, 0x000000003b455553, 0x000000294e285431, 0x0000005326312845,
+    0x0000004e42562653, 0x000000312846454e, 0x0000002956312854, 0x00000046544e5453,
+    0x000000564f314231, 0x0000004655564f31, 0x0000002845284f53, 0x0000004e42564253,
+    0x0000005645534f31, 0x00000026294e2653, 0x000000564f314531, 0x000000534528554e,
+    0x0000004f314e5453, 0x00000056454e5456, 0x0000004628464f53, 0x00000056282c314b,
+    0x00000055284e4f53, 0x0000002846554531, 0x0000004e42564f31, 0x000000564f314b56,
+    0x0000002928465556, 0x000000464f535653, 0x000000434e4b4553, 0x000000284f314553,
+    0x0000000000000058, 0x0000002846262956, 0x000000534f562845, 0x00000028564f5345,
+    0x0000002c564f4e45, 0x0000005331284b45, 0x00000046534f5631, 0x0000004e264b2656,
+    0x0000004642534231, 0x0000005326534f56, 0x000000294b4e4f53, 0x000000564b453b53,
+    0x0000004b4528464e, 0x0000000053262953, 0x0000004f56284f56, 0x000000282c56424e,
+    0x000000284b4e2656, 0x00000045314b2931, 0x0000004f4e26294e, 0x0000003145294b4e,
+    0x000000552931264e, 0x000000534f564131, 0x0000004e42314b4e, 0x0000002956284656,
+    0x0000003b31532656, 0x00000000314b4555, 0x000000433b562653, 0x0000002956284256,
+    0x0000002931282653, 0x0000004e4b564256, 0x000000453b564b56, 0x00000042314b2956,
+    0x0000004e42314231, 0x000000562c292846, 0x000000284b454253, 0x000000555342294e,
+    0x0000005326314b53, 0x0000004e544e4531, 0x0000002956284b4e, 0x000000464b543b4e,
+    0x000000284f4e4e54, 0x0000002842564b53, 0x0000003154292846, 0x0000004641534f4e,
+    0x0000004e2855454e, 0x0000004e54314531, 0x0000003b4e422956, 0x000000464b314256,
+    0x0000004f56284653, 0x0000004b53452846, 0x000000282c4e4256, 0x00000031424b2956,
+    0x00000028544e4556, 0x000000453b564f31, 0x0000004e4b45264e, 0x0000004645284f4e,
+    0x00000056424e4b53, 0x0000004628425645, 0x0000002928462c56, 0x0000004356262956,
+    0x000000285345554e, 0x0000000043564231, 0x000000283b564b45, 0x000000314b453b4e,
+    0x000000564f315456, 0x000000455553264e, 0x00000031424e4256, 0x000000294e28464b,
+    0x00000055534f5626, 0x00000056544e454e, 0x0000000000314256, 0x0000002c56282631,
+    0x000000534231424e, 0x00000029314f2931, 0x0000003142532653, 0x00000000433b554e,
+    0x0000005342292846, 0x000000564b45554e, 0x0000004f28452653, 0x0000005645554b4e,
+    0x000000433b295345, 0x00000053564f5345, 0x0000004e4253264e, 0x0000004f3128464b,
+    0x00000000433b5556, 0x000000534f53284b, 0x000000424b534f31, 0x0000004b45555331,
+    0x00000028424e2631, 0x0000002953284b45, 0x000000284f293145, 0x0000005355534f4e,
+    0x0000002846284555, 0x0000004f53285453, 0x0000004655314f53, 0x0000005645534f4e,
+    0x0000004e56455556, 0x00000043564b4531, 0x0000004642314b4e, 0x000000464555454e,
+    0x000000294e284f53, 0x0000004f314b4555, 0x0000003b55562653, 0x000000003b4e2631,
+    0x0000002c31282656, 0x0000005628465631, 0x00000056543b2956, 0x000000284f4e2631,
+    0x000000464b455556, 0x000000464f562845, 0x000000004e4b5645, 0x0000005626314256,
+    0x0000002842564f4e, 0x00000026534f5645, 0x0000005626294b53, 0x0000004e28453b4e,
+    0x0000004e4b564253, 0x00000046284b2631, 0x0000004656314b45, 0x000000464b562631,
+    0x00000028464b4f31, 0x000000534f565453, 0x0000004b554e4f53, 0x000000282c53424e,
+    0x0000000000004331, 0x000000464f532631, 0x0000005653455556, 0x000000464f562631,
+    0x0000005626534b31, 0x00000043314e5431, 0x000000564b312656, 0x0000004e314f534b,
+    0x000000433b4e4253, 0x0000004e4b452845, 0x0000003b554e4f53, 0x0000000043564553,
+    0x0000004645282631, 0x0000004b45312631, 0x000000534f564555, 0x0000004b5642294e,
+    0x0000004555564553, 0x0000004528534f31, 0x00000031534f534b, 0x00000029564f2953,
+    0x00000046282c4e4b, 0x00000045554b294e, 0x0000004e284f3126, 0x0000003b31452631,
+    0x000000534e455531, 0x00000028544e5456, 0x0000004f31455556, 0x00000029314b5645,
+    0x0000002855564b56, 0x000000464b314f53, 0x0000004356452631, 0x0000002c2931284b,
+    0x0000004645294b4e, 0x0000004642564f4e, 0x0000004626562656, 0x0000004b53453b4e,
+    0x000000464e455531, 0x000000005653264e, 0x0000005328455456, 0x000000264e28264e,
+    0x0000004645285531, 0x000000314e284b45, 0x0000005642314b31, 0x0000005441534f56,
+    0x000000004e262931, 0x0000004b4f4b264e, 0x0000002931284553, 0x0000004529564f53,
+    0x0000002c29534f53, 0x0000004f53284631, 0x00000029314e2845, 0x0000005345534b31,
+    0x0000005626564b4e, 0x0000002846284553, 0x000000462c56554e, 0x000000284f312826,
+    0x000000314b4e2631, 0x0000004626534f31, 0x00000056453b2953, 0x00000028464e544e,
+    0x0000004e282c2956, 0x000000462846554e, 0x000000282c542846, 0x0000005529534f53,
+    0x000000532656424e, 0x000000543b534531, 0x000000534f314555, 0x0000002953284f31,
+    0x000000000031264e, 0x0000004f31282c56, 0x00000056424e4231, 0x000000534f564253,
+    0x0000003128262953, 0x000000543b4e4531, 0x0000002826312656, 0x000000564f535553,
+    0x0000005345282c31, 0x000000004e422953, 0x0000004e42534b56, 0x00000053453b2956,
+    0x0000005431543b4e, 0x0000002631282653, 0x000000284f565456, 0x000000312928464e,
+    0x0000005645284f53, 0x00000000564f2931, 0x000000453b295645, 0x000000314b543b53,
+    0x0000004628554531, 0x0000004f5628264e, 0x0000002631452846, 0x0000002c4e282656,
+    0x000000543b4e4b53, 0x000000464f4e2826, 0x000000534b4e4555, 0x0000004e4f535653,
+    0x0000004353452631, 0x0000002956263145, 0x000000464b564555, 0x0000005645284656,
+    0x00000031554b4553, 0x000000564b455531, 0x000000534b314256, 0x0000004f56284555,
+    0x000000412956284b, 0x0000002c56453b4e, 0x0000004b534f2956, 0x0000004e42532653,
+    0x00000031424b294e, 0x0000003b53262931, 0x00000028464b4e4b, 0x0000005645282653,
+    0x0000003b4e4b2953, 0x0000005329562845, 0x0000004f53284f4e, 0x000000314b453b31,
+    0x0000002842564256, 0x0000004b45285556, 0x0000004f314b5345, 0x000000534f534556,
+    0x0000002846284b56, 0x000000464f562656, 0x000000284b45554e, 0x0000004b31543b31,
+    0x0000005354534531, 0x0000004f31284556, 0x00000055564b4531, 0x0000000029564b45,
+    0x000000284b453b53, 0x0000005628464e54, 0x00000046534f534b, 0x0000005531262956,
+    0x000000314f4b2656, 0x0000005342314256, 0x0000004e4f53284b, 0x0000002956284f31,
+    0x0000003b4e452653, 0x0000003b56262956, 0x000000284f312845, 0x0000004555532656,
+    0x0000003b4e4b5345, 0x0000005342534b56, 0x00000031284f2956, 0x0000004b564f314b,
+    0x0000002c4e284f31, 0x000000312656264e, 0x0000005345564f31, 0x0000005326532653,
+    0x0000003145284653, 0x00000000434e4b31, 0x0000003128425345, 0x000000433b312656,
+    0x00000055534f5645, 0x0000003b4e543b31, 0x0000003128463153, 0x0000000043314531,
+    0x0000004b543b294e, 0x000000434e262956, 0x0000004e45534b4e, 0x0000005328465531,
+    0x00000045314b2953, 0x000000424b534f56, 0x00000031424e4b4e, 0x00000028554e4f53,
+    0x0000005626534231, 0x0000004e5645554e, 0x00000053424e4b31, 0x0000000053562653,
+    0x0000004626562846, 0x000000284f4b4f53, 0x000000535645554e, 0x0000002953285556,
+    0x000000433b314253, 0x0000005342534b4e, 0x0000003126314b4e, 0x0000004f53455431,
+    0x0000004f4e282656, 0x0000004f534b4553, 0x0000002c31282653, 0x0000000043564b53,
+    0x0000004b53543b56, 0x0000004f55314f53, 0x0000004355292846, 0x000000434e4b294e,
+    0x0000005645294b31, 0x000000543b294b31, 0x0000002846532854, 0x0000002c4e4b4e45,
+    0x0000002846284f4e, 0x0000004f29532846, 0x0000004f4e45554e, 0x0000004b564f4e45,
+    0x0000004e26294b53, 0x0000004656534f31, 0x00000053454e4b53, 0x000000284f564b53,
+    0x0000004e28464153, 0x000000564f314555, 0x000000464f53424e, 0x0000003126532631,
+    0x000000284b4e4253, 0x0000005431543b31, 0x0000000000534256, 0x00000026534b2953,
+    0x0000004e4b4f4553, 0x000000284f312846, 0x000000564f4e4253, 0x000000543b564f53,
+    0x0000004e28262953, 0x0000004e282c2931, 0x0000002653282631, 0x000000265645554e,
+    0x0000002846422953, 0x00000042314f2953, 0x0000003b31455556, 0x00000028554b4553,
+    0x0000004653262953, 0x0000004626564253, 0x0000003b534b4531, 0x000000264e26294e,
+    0x000000434e45554e, 0x000000282c535531, 0x0000004642314253, 0x000000564b4e2653,
+    0x0000005431453b56, 0x0000004e54562631, 0x000000265628264e, 0x000000534f4e2656,
+    0x000000434e454e31, 0x000000554b534f4e, 0x0000002842534f4e, 0x00000028424e2653,
+    0x0000003b56534b45, 0x0000002956282c31, 0x0000004f31452953, 0x000000285453454e,
+    0x0000004345555331, 0x0000003b56532653, 0x000000534f31544e, 0x0000004e42534256,
+    0x0000004f4e262956, 0x000000464b534f4e, 0x0000002842312653, 0x0000002c4e292846,
+    0x000000003153264e, 0x0000004f564b534b, 0x000000285531424e, 0x0000002826312631,
+    0x0000004626294b4e, 0x0000004f53453b53, 0x0000002855532653, 0x000000312631264e,
+    0x000000532846264e, 0x000000292846544e, 0x0000004645564f53, 0x0000004f314b4f56,
+    0x0000004b543b2956, 0x0000003145284f4e, 0x0000002845564b53, 0x000000462841314b,
+    0x0000004631284b45, 0x00000000434e4555, 0x00000046543b2956, 0x0000004645282c4e,
+    0x0000004f4e284153, 0x000000464f564b31, 0x0000004b56543b31, 0x0000005654534f4e,
+    0x000000534b455431, 0x0000003142562656, 0x0000002856534f31, 0x000000562826294e,
+    0x000000314f532631, 0x00000055314f534e, 0x0000004f3126294e, 0x0000003b4e4b4e45,
+    0x0000004e26314f53, 0x00000028464f5654, 0x000000284628464e, 0x000000464f532826,
+    0x0000002845292846, 0x0000004331452653, 0x000000434e45294e, 0x0000002953452855,
+    0x0000002826314256, 0x0000004e454e2631, 0x0000005642312653, 0x0000004e3b4e5453,
+    0x000000433b534555, 0x000000284f543b53, 0x0000004f53423145, 0x0000004f31452845,
+    0x0000005628464b56, 0x0000004e45534b31, 0x00000053424b294e, 0x0000002845534b56,
+    0x0000003142312631, 0x00000055564f3126, 0x00000028464f5345, 0x0000004645555345,
+    0x0000002846455556, 0x000000462c53554e, 0x000000464f534256, 0x000000314e4f5556,
+    0x0000004b45552956, 0x0000005654314531, 0x0000004528564f4e, 0x00000046564f3154,
+    0x00000056284b2956, 0x000000564b455553, 0x000000284628414e, 0x000000282653264e,
+    0x000000453b564f53, 0x0000005654564f53, 0x0000005628452845, 0x0000004e28455453,
+    0x00000055264e4f53, 0x0000005556534f56, 0x0000004b4528264e, 0x000000462c535553,
+    0x000000564f532845, 0x00000054314b4556, 0x000000434e4b4e45, 0x0000005642314253,
+    0x0000004f31453b4e, 0x000000264e282653, 0x0000002842564b4e, 0x00000031282c564b,
+    0x000000464f315456, 0x0000004b4e45264e, 0x000000294b292846, 0x0000002842532631,
+    0x0000004329312846, 0x00000055294e2631, 0x00000031284b264e, 0x0000005453453b4e,
+    0x000000543b564b53, 0x0000004b4e4f294e, 0x00000041294e2846, 0x0000004355562656,
+    0x00000031284f4e54, 0x000000433b4e4555, 0x0000004f53284b56, 0x0000004f31554556,
+    0x0000002629534f53, 0x0000005641564f31, 0x0000003b55312653, 0x00000056284b4531,
+    0x0000002841564f31, 0x0000004f31452855, 0x000000284f4b2656, 0x0000005326562631,
+    0x000000564231424e, 0x00000046453b2931, 0x000000284f562631, 0x0000004628453b53,
+    0x000000464b455456, 0x0000005328462653, 0x0000004b4e452831, 0x0000004e26562653,
+    0x000000532826294e, 0x0000002656455553, 0x0000003b56422956, 0x0000003b56452653,
+    0x00000056424b2931, 0x000000314256264e, 0x0000004542564f4e, 0x00000053282c2931,
+    0x0000002953284626, 0x0000004f4e452956, 0x0000004f56265645, 0x0000004329532631,
+    0x0000003126312631, 0x0000002846562656, 0x0000004e284f294e, 0x000000284f4e4253,
+    0x0000005628465345, 0x0000004645534b31, 0x000000314b534f4e, 0x000000454e453b4e,
+    0x0000005655314f53, 0x000000284f543b4e, 0x0000004b45555645, 0x00000053284b5645,
+    0x0000005626314b56, 0x0000002855534f56, 0x00000053543b294e, 0x0000002845555645,
+    0x000000464e545556, 0x0000000045554e31, 0x0000002831455553, 0x0000005328463153,
+    0x0000004f564f3126, 0x0000004f56314f53, 0x0000003128465631, 0x0000004f29534f56,
+    0x000000264e455556, 0x00000045284e4f53, 0x00000053544e5431, 0x0000002c53282631,
+    0x000000544e4b4556, 0x0000004b56453b56, 0x0000004356454e31, 0x000000314b53264e,
+    0x0000003b55532631, 0x0000004e42532631, 0x0000004331453b56, 0x000000534f295345,
+    0x000000284b4e4b45, 0x000000464b564231, 0x0000003b55532653, 0x00000053554e4f53,
+    0x00000056284f314b, 0x000000003b4e4b53, 0x000000294e284b31, 0x00000028544e5431,
+    0x0000004e31455531, 0x000000264e422956, 0x000000265326294e, 0x0000003b29534f4e,
+    0x0000002931284f56, 0x000000534b452931, 0x0000000043564f4e, 0x00000053284e5453,
+    0x0000002855314b56, 0x0000002953284b53, 0x00000046284f564b, 0x0000004f31292846,
+    0x0000004528455556, 0x00000046424b2953, 0x0000004e454e5456, 0x0000003b56452656,
+    0x00000043564e544e, 0x0000004631543b56, 0x0000002846312656, 0x0000002846285556,
+    0x00000056284b534b, 0x0000004328543b4e, 0x000000003b534f56, 0x000000534f312653,
+    0x000000534b292846, 0x0000003128464531, 0x0000005456453b31, 0x000000284b564231,
+    0x0000004f564b4e45, 0x0000005328543b56, 0x000000283b534b45, 0x00000046282c3145,
+    0x0000004642532653, 0x0000000056422956, 0x0000005626534f4e, 0x0000002c314f534b,
+    0x000000424e455553, 0x00000053284b4f4e, 0x0000004e28543b56, 0x0000004e28464556,
+    0x000000314b564f4e, 0x000000462c534253, 0x0000002842312656, 0x0000004e26314b4e,
+    0x0000004229564f31, 0x00000056264e4b45, 0x000000435355454e, 0x0000004355532653,
+    0x0000004f4e453b56, 0x0000005526564f53, 0x0000004628465531, 0x000000434e453b4e,
+    0x0000004f5328424e, 0x0000002c56554553, 0x000000433b294e45, 0x000000434e4b4f4e,
+    0x0000004b564f5345, 0x0000005345564f53, 0x0000004f56284231, 0x00000028564f3145,
+    0x000000464b564253, 0x0000003b56314b45, 0x000000464f534b45, 0x0000005628465456,
+    0x00000053544e4531, 0x00000026564b2953, 0x000000434e4f2956, 0x0000002653282656,
+    0x0000002855534b4e, 0x00000031282c534b, 0x0000004642562656, 0x0000003128454256,
+    0x00000026564f5345, 0x00000053424e2631, 0x00000028424e424e, 0x0000000043314256,
+    0x0000002629534f4e, 0x000000284f534153, 0x0000002846562631, 0x0000002931284653,
+    0x00000031544e544e, 0x000000314b45554e, 0x0000004b31452631, 0x000000564b534f53,
+    0x000000284f564156, 0x000000564f31284b, 0x000000003b534f31, 0x00000031534f4e45,
+    0x0000000043534b53, 0x00000028564f3126, 0x00000000433b5553, 0x000000284b564253,
+    0x0000004f4e285556, 0x00000046284b2653, 0x000000544e545456, 0x000000462c534256,
+    0x0000003b53562631, 0x0000004f294e284b, 0x0000004f4e4e544e, 0x0000005628414e4b,
+    0x0000004b4e4b2631, 0x0000002931284b56, 0x0000004b4f4b2653, 0x000000314f534156,
+    0x0000002953284531, 0x0000000043564b4e, 0x0000004629562854, 0x0000004b53543b4e,
+    0x0000004e28464b53, 0x0000004229564f4e, 0x0000004e54564f53, 0x0000004529562846,
+    0x00000046284e2845, 0x00000056534f564b, 0x0000004e31534f53, 0x0000002c534b4555,
+    0x000000564256424e, 0x0000005455314f53, 0x0000004f45282631, 0x00000053264e424e,
+    0x000000433153264e, 0x0000004f45534f4e, 0x0000005328262956, 0x0000003b4e4f2931,
+    0x00000031284b534b, 0x000000464f535645, 0x0000005531534f4e, 0x0000002c294e284b,
+    0x0000004555562653, 0x0000004f4b455556, 0x0000003126294b31, 0x000000543b53264e,
+    0x0000004b45564f31, 0x0000004f56455556, 0x00000043564b4555, 0x00000046454e544e,
+    0x0000005553314f53, 0x000000552928464e, 0x0000004645314b53, 0x000000534f4e5645,
+    0x000000284e543b31, 0x0000004e2841564b, 0x0000000053422931, 0x00000053284f294e,
+    0x000000534b53424e, 0x000000564b564231, 0x00000042534f2953, 0x0000004b45314b53,
+    0x0000002826534f4e, 0x0000002855564f53, 0x000000284b534f31, 0x0000002c56554531,
+    0x000000464f532656, 0x0000003b31534b45, 0x000000263128264e, 0x00000031284e4f53,
+    0x0000004626534231, 0x000000284f532826, 0x0000003b314b4553, 0x000000264e422953,
+    0x0000004e4b314555, 0x0000003b55534f56, 0x000000564f295345, 0x0000002c29534f56,
+    0x000000534f562653, 0x0000004f29312845, 0x0000004b4e4f2956, 0x000000433b314f53,
+    0x000000005531264e, 0x0000004e26312653, 0x0000004f314b2956, 0x000000464528554e,
+    0x0000004e26314b56, 0x000000284f564b4e, 0x0000004b4e4b4555, 0x0000003128455453,
+    0x0000005331455531, 0x00000028554e424e, 0x0000005345284631, 0x0000004628455453,
+    0x0000004e31455556, 0x00000031284b3145, 0x000000464b56424e, 0x0000000043534f56,
+    0x0000005553262953, 0x00000046534f5326, 0x00000055534f5326, 0x0000000055312656,
+    0x0000003128453b56, 0x0000004e54564531, 0x00000053543b2931, 0x000000454e4b4531,
+    0x0000004626564b45, 0x00000000294e4b45, 0x0000004b45282c56, 0x0000004b45564b56,
+    0x0000004f31262931, 0x0000002826532653, 0x000000314b314256, 0x00000046544e5431,
+    0x0000004628565456, 0x0000004f5342294e, 0x0000002956284b45, 0x0000002842534f53,
+    0x000000464f564555, 0x0000004e45562653, 0x000000555345554e, 0x0000002845534b53,
+    0x0000004e54532631, 0x00000053264e264e, 0x0000000000455556, 0x0000002629532846,
+    0x00000029534f2953, 0x0000003155292846, 0x00000026294e2845, 0x0000004b4e453b31,
+    0x00000046454e5456, 0x0000004e31284653, 0x000000435342294e, 0x0000002826534256,
+    0x000000314b452855, 0x0000003142562631, 0x0000004626312631, 0x0000004e45554b4e,
+    0x0000004356262931, 0x0000003142532656, 0x0000004e45564f4e, 0x0000002953282653,
+    0x0000004e4f532631, 0x0000004f53424e45, 0x000000294e262931, 0x0000004e26294e45,
+    0x0000004b4f4b2631, 0x00000055294e2845, 0x0000002c56543b56, 0x000000433145294e,
+    0x00000031454e4b4e, 0x00000055314b4531, 0x0000004528453b53, 0x000000562845294e,
+    0x000000454e54544e, 0x0000002845552931, 0x0000002826534b31, 0x0000004e4b293145,
+    0x0000004b53452656, 0x000000314f53554e, 0x0000004b453b2931, 0x00000031284f564b,
+    0x00000046284e5453, 0x0000003128465645, 0x0000004628464b31, 0x000000534f532846,
+    0x000000284f532846, 0x000000282c315553, 0x0000005556262931, 0x000000464f56424e,
+    0x0000002931425645, 0x0000004626314b31, 0x000000554e4b5645, 0x00000000434e4253,
+    0x0000004f5341314b, 0x000000464b453b31, 0x0000004353454e31, 0x0000004e45562656,
+    0x0000002956285531, 0x0000003b4e452656, 0x000000564f314553, 0x0000002931284256,
+    0x0000005354564553, 0x0000004656543b56, 0x0000004555294e45, 0x0000003b56543b56,
+    0x000000464f314b45, 0x00000055534f3145, 0x000000534b543b4e, 0x0000003b5342294e,
+    0x0000002931285453, 0x0000002953455531, 0x000000433b534f56, 0x0000004555564153,
+    0x0000005345285531, 0x000000534231264e, 0x0000003126314b45, 0x0000004f56284531,
+    0x000000293128454e, 0x0000004f453b294e, 0x0000002928465345, 0x0000004329312653,
+    0x0000002846424e45, 0x0000004e2846544e, 0x0000003126532656, 0x0000004e454e4b31,
+    0x000000453b534b53, 0x0000005628422956, 0x000000424e455556, 0x00000000314f2956,
+    0x00000046284f3126, 0x00000053544e4f53, 0x0000002928462656, 0x0000003b4e453b31,
+    0x0000002856292846, 0x0000004e26314256, 0x0000003145554e45, 0x0000003145292846,
+    0x0000000055534f53, 0x0000004f53562656, 0x000000282c534253, 0x000000554b534f31,
+    0x0000004f4e28414e, 0x000000284b4e4555, 0x0000002931284253, 0x00000031554b4531,
+    0x00000046534f5345, 0x0000005626532631, 0x00000000434e4531, 0x0000005455534f53,
+    0x0000005326294b4e, 0x0000002c4e284653, 0x0000004e4f532656, 0x0000003128565453,
+    0x0000004628465631, 0x0000005355564f31, 0x0000003b53453b56, 0x000000284b534f4e,
+    0x000000433b4e5645, 0x0000004f53282c4e, 0x000000314f532653, 0x0000002629314f53,
+    0x0000000043535653, 0x00000031554e4f53, 0x00000053564f5326, 0x0000005553564f4e,
+    0x0000004554564f4e, 0x0000002846564f4e, 0x0000004b453b2956, 0x0000004f4e455556,
+    0x00000031264e2631, 0x0000002931282656, 0x0000004e26562845, 0x0000004329562845,
+    0x000000454e4b2931, 0x0000005331455553, 0x00000031424e4b53, 0x0000004b45553145,
+    0x0000004b45553126, 0x00000045564b2953, 0x00000053284f5345, 0x000000424e4b294e,
+    0x00000000294e2846, 0x0000002c46455531, 0x0000003b4e455556, 0x00000031264e4b45,
+    0x000000294e284f56, 0x0000004e45292846, 0x000000314f544131, 0x000000564f4e5645,
+    0x0000004b5645264e, 0x0000004b45555631, 0x0000004b4f292846, 0x0000004e4b532653,
+    0x000000465326294e, 0x000000453b562656, 0x0000004f314b2931, 0x0000000043535556,
+    0x00000056284f564b, 0x0000004b4f455553, 0x0000005654314556, 0x0000005342314f53,
+    0x00000026564f294e, 0x0000005328452653, 0x0000000000534253, 0x0000003154564553,
+    0x0000004f53284e45, 0x0000004b31453b4e, 0x0000004b314b5345, 0x0000004e4b453b4e,
+    0x0000005642564231, 0x00000031284f2953, 0x00000028554e2653, 0x0000004b29532845,
+    0x0000000043534f53, 0x0000004f314b314b, 0x0000000043315531, 0x000000294e28554e,
+    0x0000005326534b53, 0x000000294e285456, 0x000000534f31264e, 0x000000564b45544e,
+    0x0000004528543b56, 0x000000462631424e, 0x0000004645285553, 0x0000005342534b45,
+    0x00000056453b2956, 0x000000433b315345, 0x0000002845564f31, 0x0000004b29314f53,
+    0x0000005531262953, 0x00000056284e4b45, 0x0000005628452956, 0x0000002656284f56,
+    0x0000005328262931, 0x0000004e26562656, 0x0000005326562653, 0x0000004656262931,
+    0x0000005628452953, 0x0000003128462826, 0x0000005628464b4e, 0x000000554e455553,
+    0x0000005628452653, 0x00000055534b314b, 0x0000005345282c4e, 0x0000004f31264e45,
+    0x0000005328455529, 0x0000002845314b56, 0x00000046543b2931, 0x0000003142534f53,
+    0x0000004f53284e31, 0x000000284e54554e, 0x0000004f564f4e45, 0x000000433b534f53,
+    0x000000314b534253, 0x0000004b4e422953, 0x0000004f53282c56, 0x0000005328465431,
+    0x000000564f544131, 0x00000026294e4f53, 0x0000004645282c31, 0x000000314528554e,
+    0x000000265642294e, 0x0000000000314231, 0x0000003b56422931, 0x0000004f53562845,
+    0x0000004f5328554e, 0x000000314e543b56, 0x0000004e26312845, 0x0000005545534f4e,
+    0x0000004f4e455531, 0x0000004b45284f4e, 0x000000544e545431, 0x00000056264e4f53,
+    0x0000004555564b4e, 0x0000004e28543b4e, 0x0000004e4f532845, 0x000000554f292846,
+    0x000000424e4f5345, 0x0000004f2845264e, 0x000000464f295645, 0x0000004f31282656,
+    0x000000284f4e5453, 0x0000002931452845, 0x0000004654314556, 0x000000284b4e2653,
+    0x00000056284b314b, 0x0000004331554531, 0x0000004e28464b45, 0x0000005356534f4e,
+    0x0000002931455531, 0x0000004b534b4555, 0x000000534f314b31, 0x0000004545284f56,
+    0x0000002656455531, 0x0000004e42534b4e, 0x0000000031455531, 0x00000031284e4b45,
+    0x0000004f29284656, 0x00000028554e4b31, 0x0000004655534f53, 0x000000543b564b31,
+    0x0000003b554e264e, 0x0000005645284f4e, 0x00000000554e2653, 0x000000314f544156,
+    0x0000005455292846, 0x0000004f314b564b, 0x000000455556454e, 0x0000005328464b45,
+    0x0000003128452845, 0x000000433b4e4b4e, 0x0000004f53292846, 0x0000004e284f2956,
+    0x0000000043535553, 0x0000004628465345, 0x0000004f5628464e, 0x00000028554e4231,
+    0x0000004256455531, 0x000000314f534531, 0x0000004f53284e54, 0x0000004e45282c56,
+    0x0000004653262931, 0x0000002842292846, 0x0000004f53284b4e, 0x000000464e4f5531,
+    0x0000004b26314f53, 0x0000005645294b4e, 0x000000564f534156, 0x00000046264b4f31,
+    0x0000002845314f53, 0x00000043314b4556, 0x0000003126534b56, 0x0000004642534256,
+    0x00000031294e2845, 0x000000564f312854, 0x0000005642534b56, 0x0000003b55562631,
+    0x0000002846452656, 0x0000003128422956, 0x0000002956562854, 0x000000004353424e,
+    0x0000005529312656, 0x0000002c53284645, 0x000000285553424e, 0x0000004f56282656,
+    0x0000003b53262953, 0x0000005642564f4e, 0x0000000043295345, 0x00000000314f2931,
+    0x00000053454e4b31, 0x0000005628543b4e, 0x000000424e262931, 0x0000004356453b4e,
+    0x000000284f565431, 0x0000003b45555331, 0x000000003b565345, 0x0000003b53453b4e,
+    0x0000004645564b53, 0x00000026534b2931, 0x0000004e45534f56, 0x000000005645264e,
+    0x000000294e282653, 0x0000002855534253, 0x0000004e28464f4e, 0x00000042314f2931,
+    0x0000004f2931264e, 0x00000045564b2931, 0x0000004355532631, 0x0000004e282c3145,
+    0x000000543a4e3b31, 0x0000004b45534f4e, 0x00000053282c2953, 0x000000284e4f5556,
+    0x000000534f562656, 0x000000284645264e, 0x0000004654564f4e, 0x0000002845284b45,
+    0x000000564b312653, 0x000000534b452855, 0x000000284231264e, 0x0000004f31284645,
+    0x0000005342314253, 0x0000005628262931, 0x00000046284f5645, 0x000000564f4e2826,
+    0x000000433b4e4231, 0x00000045284b4556, 0x000000534f53424e, 0x0000004f31425645,
+    0x000000283145554e, 0x0000002842314b31, 0x000000292846414e, 0x000000003b4e4256,
+    0x0000003145534b4e, 0x000000314f293145, 0x0000004b314f534b, 0x000000534f4e4553,
+    0x0000005556262956, 0x0000000000564b53, 0x0000005626562631, 0x0000004e4b295345,
+    0x0000002c46455553, 0x000000314b4e4256, 0x000000453b534f56, 0x0000005631534f53,
+    0x00000055314b4553, 0x0000000031532653, 0x0000004f564b4f31, 0x0000004f56452631,
+    0x000000464e284b45, 0x0000005342564256, 0x000000462c564b45, 0x0000003b55564f31,
+    0x000000544e453b4e, 0x0000004642314b56, 0x0000004329562631, 0x0000004642532656,
+    0x0000003154564f53, 0x0000003b534f2931, 0x00000031534f5345, 0x000000464f315453,
+    0x0000002855314253, 0x0000004f4e284253, 0x0000002845285553, 0x0000004f4e282c31,
+    0x0000004353455553, 0x000000455556414e, 0x0000004f55564f53, 0x0000004f53284f53,
+    0x0000003126312846, 0x0000004645552953, 0x0000003b56543b31, 0x0000002846294b4e,
+    0x0000000043455531, 0x0000002928465531, 0x0000005645534b53, 0x0000005642534231,
+    0x0000004f564b3145, 0x0000004f56543b4e, 0x0000003b4b455556, 0x000000314f4b2653,
+    0x0000005326294b56, 0x00000028424b294e, 0x0000003b4e455531, 0x0000005626312845,
+    0x0000005453543b56, 0x0000004f53264e45, 0x0000004f534b5645, 0x0000005342314231,
+    0x0000002846543b4e, 0x000000294e423145, 0x0000004628452631, 0x00000042564f294e,
+    0x00000053424e4256, 0x0000004b4f45554e, 0x0000003b55534f4e, 0x000000564f312653,
+    0x000000314b4e4555, 0x000000294e284556, 0x00000045534b2953, 0x0000005645282c56,
+    0x0000005626314b53, 0x000000464f534b56, 0x0000005329312845, 0x00000046264e4231,
+    0x0000004e45284656, 0x0000005642294b4e, 0x000000564b452653, 0x000000453b532653,
+    0x0000004f4e262931, 0x0000003126314231, 0x000000464f4e454e, 0x0000004e264e2845,
+    0x0000004e4b56264e, 0x00000056424e4253, 0x00000053454e4b4e, 0x0000003128423145,
+    0x0000004b45554e26, 0x0000004e45555645, 0x0000004654564f31, 0x0000005645564b53,
+    0x0000004e28554531, 0x0000002c56455531, 0x00000055534b2931, 0x0000004e28464555,
+    0x0000002854534553, 0x0000002846292846, 0x0000004b4e4b4f45, 0x000000295628464e,
+    0x000000312855454e, 0x0000004f543b2931, 0x000000554e4b4556, 0x00000053264e2846,
+    0x000000433b533145, 0x000000464f4e424e, 0x0000004f31284531, 0x000000433b534e54,
+    0x0000004e284b5345, 0x0000004e2845294e, 0x0000004353453b4e, 0x000000464b534b45,
+    0x0000003128465556, 0x0000000043534531, 0x0000002845553126, 0x000000284f53544e,
+    0x000000534b314231, 0x0000003128454231, 0x0000003128452846, 0x0000004e28452953,
+    0x0000005626294b56, 0x0000004e4f534256, 0x0000002656282656, 0x0000004528462631,
+    0x00000056284b4555, 0x00000026564f4e45, 0x0000005628464f4e, 0x0000004e5453454e,
+    0x0000003153455531, 0x0000004542564f53, 0x0000004631455556, 0x0000004e26312631,
+    0x00000046454e4b4e, 0x00000046534f4e54, 0x0000005628463145, 0x00000056294e2846,
+    0x00000028464e2631, 0x0000002931284631, 0x0000004e29312846, 0x0000004b56455553,
+    0x0000004628452956, 0x0000003b31543b31, 0x0000004e31422953, 0x000000464f4b4f4e,
+    0x0000004e2841534b, 0x0000000056262956, 0x0000004628452855, 0x0000004526564f4e,
+    0x000000264e284f53, 0x0000004f314b5645, 0x0000004628452953, 0x000000434e452931,
+    0x000000562631264e, 0x0000004f31285456, 0x0000004e4528464e, 0x0000002826564b53,
+    0x000000464f4e4e54, 0x0000004e4b534256, 0x0000000043534b56, 0x0000004b45534b4e,
+    0x0000003b56262931, 0x00000028424e4256, 0x0000005655564f31, 0x0000005529534b45,
+    0x0000003b314b2956, 0x00000053543b2953, 0x00000029564f294e, 0x0000004e45555326,
+    0x00000042564b2956, 0x0000004f56282c31, 0x0000003142534f56, 0x0000004f4e453b31,
+    0x0000004f56532631, 0x0000004353262953, 0x000000534f31424e, 0x0000005345282656,
+    0x0000002928464231, 0x0000005654314553, 0x000000003b4e4b31, 0x0000002928464f53,
+    0x0000004e4b534f31, 0x0000004f53284b53, 0x0000004f564b314b, 0x0000004b45532653,
+    0x000000314f534131, 0x000000283b295345, 0x0000005328554531, 0x0000002826314b45,
+    0x000000264e262953, 0x0000005645564f4e, 0x0000002846284131, 0x0000004e54534f4e,
+    0x000000453b4e2631, 0x0000004e4b564f31, 0x00000056284f4e45, 0x0000004f5356264e,
+    0x0000002653282653, 0x000000564f4b4f53, 0x0000003154314553, 0x0000005545314f53,
+    0x0000002845284656, 0x000000543b534556, 0x000000464b4e4253, 0x0000002c31543b53,
+    0x000000464f31544e, 0x0000004628462c53, 0x0000004e26312846, 0x00000028554e4b45,
+    0x0000004e454e544e, 0x0000004e3b564f4e, 0x000000464b53264e, 0x0000004b55564f53,
+    0x0000004628462656, 0x0000004f56284253, 0x0000002953312845, 0x000000564231264e,
+    0x0000005326312653, 0x0000002845534b31, 0x0000004e26534b45, 0x0000005653284b45,
+    0x000000264e455531, 0x0000005626532846, 0x0000002629312631, 0x0000004628543b56,
+    0x000000534f4b4f56, 0x0000004f45534f56, 0x0000003b53564b45, 0x00000045284f5345,
+    0x000000464f315531, 0x00000045284f5531, 0x000000564b543b31, 0x0000003128455456,
+    0x0000005626314231, 0x0000004b45555345, 0x000000284b312653, 0x0000005642562656,
+    0x0000005529284645, 0x0000005628452656, 0x0000004642564f53, 0x000000284b45264e,
+    0x0000004e424e4b45, 0x0000004656455553, 0x0000004f31453b53, 0x000000554b564f53,
+    0x000000004e262953, 0x0000002953285553, 0x00000056284b4f4e, 0x0000002931455556,
+    0x0000004e45552931, 0x0000002953284b56, 0x00000028424e4b56, 0x000000464f534e54,
+    0x0000004b4555454e, 0x000000464b455553, 0x0000005342564253, 0x000000462846264e,
+    0x0000004e284b4e45, 0x0000004e4b534b45, 0x00000056284e2845, 0x000000433b293145,
+    0x000000564b452631, 0x000000284f315431, 0x00000000003b5553, 0x0000005328425645,
+    0x000000464e26294e, 0x0000005553262956, 0x0000000046455531, 0x0000004b45554f31,
+    0x0000004f564b564b, 0x0000004b45314b56, 0x0000004b45532656, 0x00000056424e4256,
+    0x0000004e4b4f4b45, 0x0000003145314f53, 0x0000005329312846, 0x0000004f53453b31,
+    0x000000534f564b45, 0x0000004f53285556, 0x00000028464f2953, 0x000000464253264e,
+    0x0000004e282c5345, 0x0000005626312846, 0x0000004641314f53, 0x0000004e4555294e,
+    0x0000004b534b4e45, 0x0000002845554b53, 0x0000002846285553, 0x0000005328452953,
+    0x00000028314f534b, 0x000000284f312653, 0x0000004628315453, 0x000000544e4b4553,
+    0x00000028544e544e, 0x0000002956284f56, 0x00000031284b4f56, 0x0000003b4e4f294e,
+    0x0000004f4e422931, 0x000000282c534b45, 0x0000004642314f53, 0x0000004f56455431,
+    0x00000043294e2846, 0x000000294e285553, 0x0000004329312845, 0x000000555326294e,
+    0x0000002846284e45, 0x0000002653284b45, 0x000000564b4e4f53, 0x00000046284b4f53,
+    0x000000534f564f4e, 0x000000314231264e, 0x0000004626295645, 0x000000314b452931,
+    0x0000004f4e4e2854, 0x000000433b564b56, 0x0000004f31455529, 0x0000004528264e45,
+    0x0000002c56455556, 0x000000283b293145, 0x000000314b534f56, 0x0000002953282c53,
+    0x000000434e4b4f53, 0x0000004b45555326, 0x00000055294e2846, 0x00000053284b534b,
+    0x0000005628554553, 0x0000005654564f4e, 0x0000002846532845, 0x000000454e453b53,
+    0x000000434e4b4556, 0x0000004f314b534b, 0x0000004f53452956, 0x000000282c314b45,
+    0x00000055534b2953, 0x000000314f294e45, 0x0000005642534b31, 0x000000462c4e2846,
+    0x0000004555532631, 0x0000004e28454256, 0x000000534b312656, 0x0000002956284654,
+    0x0000004555314b4e, 0x0000005328462845, 0x0000005629284653, 0x0000004f53554556,
+    0x00000000434e3153, 0x0000004e4b4e5645, 0x0000004f31455531, 0x0000004f4e284645,
+    0x0000005355314f53, 0x000000564f535645, 0x0000005628453b56, 0x0000005326564b4e,
+    0x00000046284f294e, 0x000000284f562846, 0x000000435645264e, 0x000000564f53544e,
+    0x0000004256455553, 0x0000004b4e455531, 0x000000534f535553, 0x0000000056452653,
+    0x0000004642532631, 0x0000002826293145, 0x00000043534b4f53, 0x0000004f5345544e,
+    0x000000294e285453, 0x00000046534f4e26, 0x000000462c534231, 0x000000314b45544e,
+    0x0000003b314b2953, 0x00000055314f2931, 0x00000056284f314e, 0x0000004e54292846,
+    0x0000005556455553, 0x0000004e4556264e, 0x000000532846424e, 0x000000295326294e,
+    0x000000284f314b56, 0x0000004e4b453b53, 0x000000464b45294e, 0x0000005642314b53,
+    0x0000002c4e4f534b, 0x0000004b45554f4e, 0x0000004e45282c53, 0x00000028464f2931,
+    0x0000004f564b2953, 0x000000564b455456, 0x00000056534f5345, 0x0000004529312846,
+    0x000000435645294e, 0x0000004528555645, 0x0000002846312653, 0x0000002856534f53,
+    0x000000424b534f4e, 0x0000003128463154, 0x000000453b293145, 0x0000005641534f31,
+    0x0000004e28425345, 0x0000004f4b453b4e, 0x000000314b312631, 0x000000564f4b2631,
+    0x0000004e26564256, 0x000000284f56554e, 0x00000031424e4f53, 0x0000002931455553,
+    0x00000026314f2953, 0x0000003142534f4e, 0x0000000043314553, 0x0000004631534f4e,
+    0x0000005626312631, 0x0000004e4b4e544e, 0x0000002629562631, 0x0000004e543b2931,
+    0x0000004f564b5345, 0x000000433b535653, 0x0000005654292846, 0x0000005654564553,
+    0x0000004b55292846, 0x0000004b56543b53, 0x000000314f53264e, 0x0000002846453b31,
+    0x0000004f53554553, 0x0000004b4e452853, 0x00000046554b4556, 0x000000464f4b4f53,
+    0x000000464f294b31, 0x0000004e54534556, 0x0000004e264e2653, 0x0000004e26314b53,
+    0x0000004f56284655, 0x0000002931285556, 0x0000004e2631264e, 0x0000002956424e45,
+    0x0000005341534f4e, 0x000000534f564b31, 0x00000056284b2953, 0x0000003b4e543b53,
+    0x0000005626564f4e, 0x0000002956284f4e, 0x0000004e28465431, 0x00000026314f294e,
+    0x000000464b455531, 0x00000046284e5431, 0x00000053424b2956, 0x0000002653284f4e,
+    0x0000000000312653, 0x0000002656284f4e, 0x0000004e31455456, 0x0000002846284556,
+    0x0000000043562631, 0x0000004626314f53, 0x000000264e45554e, 0x0000003145564b4e,
+    0x000000314e45554e, 0x000000464b4e4b45, 0x0000002629312653, 0x0000004f4e282631,
+    0x00000046284e5456, 0x0000004f294e4b45, 0x00000028462c564b, 0x000000543b562653,
+    0x0000004642564f31, 0x000000433b562656, 0x0000004656543b31, 0x000000543b4e5431,
+    0x0000003b31452656, 0x0000004b31422931, 0x000000294e455531, 0x00000056284b5345,
+    0x0000004631534f31, 0x000000464f564f31, 0x000000554b4e4f53, 0x00000045554e2631,
+    0x0000004653455556, 0x0000004b534f534b, 0x0000002c4e28464e, 0x0000004b26534f53,
+    0x0000004e29532845, 0x0000002842562631, 0x0000004654534553, 0x0000004f29562845,
+    0x0000002956284e54, 0x000000564e543b56, 0x0000002855564253, 0x00000029534f4e45,
+    0x000000003b563145, 0x0000004656314f53, 0x000000464b452855, 0x0000003126564b31,
+    0x00000031534f3126, 0x0000005628464f53, 0x0000000043314b56, 0x0000005341534f53,
+    0x0000000000532656, 0x0000003b564f4e45, 0x0000004626532656, 0x00000026534f2953,
+    0x000000284b4f4b45, 0x00000056264e4b56, 0x0000002842534f56, 0x0000002953284645,
+    0x00000053282c3145, 0x0000005628465331, 0x000000534f565345, 0x0000004b56534b45,
+    0x0000005626564b53, 0x0000005645292846, 0x000000464f564b56, 0x000000532842294e,
+    0x0000004b4e4b2656, 0x000000464f565431, 0x000000003b315345, 0x0000004555314b31,
+    0x0000002931284f4e, 0x000000314b455531, 0x000000284e545553, 0x000000464e543b4e,
+    0x00000045283b3145, 0x00000056424e264e, 0x0000003129562845, 0x0000004f56264e45,
+    0x0000003126534231, 0x0000004f4b452846, 0x0000003145564f4e, 0x0000004f29284626,
+    0x0000002928464f56, 0x0000004f56453b31, 0x0000004b4e543b4e, 0x000000284231424e,
+    0x00000046284b264e, 0x000000314f534e54, 0x0000000000564f53, 0x00000053284b2956,
+    0x0000004e28453b53, 0x0000004e54543b4e, 0x000000284f532845, 0x000000464f564b53,
+    0x000000424e4b4e45, 0x000000564f4e4531, 0x0000005626293145, 0x0000002856284b45,
+    0x0000004645534f31, 0x0000004f31453b31, 0x0000004f564f4e54, 0x000000464f4e4553,
+    0x00000055534f2931, 0x0000004e28464256, 0x00000046544e454e, 0x0000002854534f31,
+    0x0000005454534f56, 0x000000294e284153, 0x0000005654564556, 0x0000005328452631,
+    0x00000056284b264e, 0x00000056284f2953, 0x0000000029534b45, 0x000000294b564f31,
+    0x0000002846282c53, 0x0000004f28452631, 0x000000534f534b45, 0x0000002629312846,
+    0x000000562855454e, 0x000000464b312656, 0x0000004f534b564b, 0x0000002928464156,
+    0x0000003b29562845, 0x0000004b45554b53, 0x0000003b55314f53, 0x0000004e284b2953,
+    0x00000045284b5553, 0x000000464f314231, 0x0000002846314f53, 0x0000002c53453b4e,
+    0x0000004b4e4b2956, 0x000000464b4e2631, 0x0000002c53554556, 0x000000464f4e2846,
+    0x0000002846264e31, 0x000000464f56314e, 0x000000564f534531, 0x0000004f53284b31,
+    0x0000000043563153, 0x0000002656422931, 0x000000534b56424e, 0x0000005626562846,
+    0x000000554e4b4e45, 0x0000003142564b31, 0x0000004331422953, 0x00000053264e2656,
+    0x0000005328462c4e, 0x000000464f4e5453, 0x0000005354314556, 0x000000565456454e,
+    0x0000000043562653, 0x0000005345292846, 0x0000004628454256, 0x000000534f314b53,
+    0x0000004f53422956, 0x0000004653262956, 0x0000000043565553, 0x000000004353314e,
+    0x0000004f53284553, 0x000000464b455431, 0x0000003b53562653, 0x00000026534f5345,
+    0x000000564555294e, 0x00000026294e2846, 0x0000004f31453b56, 0x0000003b53314b45,
+    0x0000004645553126, 0x000000294b534f56, 0x000000464b562653, 0x000000264e42294e,
+    0x0000004555562631, 0x0000002826562845, 0x0000003b53543b31, 0x0000003126562653,
+    0x0000002c4e314f53, 0x0000002826532845, 0x00000028464b2656, 0x0000005628462c31,
+    0x0000005628463153, 0x000000284e4f5531, 0x0000000043535631, 0x0000004e42562631,
+    0x00000056544e4556, 0x0000004f4e284653, 0x0000003b294e4f53, 0x0000004f5341564b,
+    0x0000005626532656, 0x0000002854314f53, 0x0000004129312846, 0x0000005645282c31,
+    0x000000433145554e, 0x000000543b532653, 0x000000294f284645, 0x0000004b31452653,
+    0x0000003142534b4e, 0x0000004e28465556, 0x0000003128453b4e, 0x0000005626534b53,
+    0x000000534b45294e, 0x00000031284b4531, 0x00000000003b554e, 0x000000564f31424e,
+    0x000000464e4f5556, 0x000000464f31264e, 0x000000462842294e, 0x00000046564f3126,
+    0x0000003b29534b45, 0x0000002826314b31, 0x0000004355564f4e, 0x0000004e284f5653,
+    0x0000004e54534531, 0x0000002846543b56, 0x00000000534f2931, 0x000000543b294b56,
+    0x000000284f53284b, 0x0000005628423145, 0x00000028464e5453, 0x0000003155564f4e,
+    0x000000314f534b53, 0x0000004e42564b31, 0x0000005455564f31, 0x000000282c4e4555,
+    0x0000003b4e422953, 0x000000564e545531, 0x0000004e424e4b4e, 0x0000003145552956,
+    0x0000004f5328544e, 0x0000004e453b2956, 0x000000004353454e, 0x0000005329284631,
+    0x000000464b312653, 0x000000424e4f2953, 0x0000004e53455456, 0x0000003126294b4e,
+    0x0000004356455553, 0x0000004e42314f53, 0x0000002855314256, 0x0000004f56422956,
+    0x0000003145314b53, 0x000000532928464e, 0x0000004f31284253, 0x0000004e42564b56,
+    0x0000005328455553, 0x0000002953265345, 0x0000002631284f56, 0x00000053264e4253,
+    0x0000004f56455456, 0x000000462c564f4e, 0x0000004f56452845, 0x0000004e28462c4e,
+    0x0000004e28453b56, 0x0000005645282c53, 0x00000042314f2956, 0x0000004e3b4e5456,
+    0x0000002c314f5345, 0x000000544e453b56, 0x0000004e4f4b4f31, 0x000000284f31554e,
+    0x00000028534f314b, 0x0000005328262953, 0x00000031424b2931, 0x000000294e455553,
+    0x0000005529284631, 0x000000544e543b56, 0x0000003153455553, 0x00000045544e4f53,
+    0x0000005342564b45, 0x0000004b294e2846, 0x0000004b564f2931, 0x0000004645314b31,
+    0x0000004f31284b56, 0x0000004e284b294e, 0x00000031264b2631, 0x0000004f4e543b4e,
+    0x0000005529562653, 0x0000004b314b4e45, 0x00000046282c4e45, 0x000000284f53554e,
+    0x0000002826295645, 0x000000453b4e264e, 0x000000284b4e4231, 0x0000002953452846,
+    0x0000004b56455531, 0x00000043314e544e, 0x000000455531264e, 0x0000004545284f4e,
+    0x00000046284f5326, 0x0000000056262931, 0x0000002953284656, 0x0000004e45554f56,
+    0x0000004b4b543b53, 0x000000543b314b53, 0x0000002831455556, 0x00000053454e5431,
+    0x0000003142534231, 0x000000453b4e4b56, 0x000000284f564553, 0x0000004528543b4e,
+    0x0000004f4e264e45, 0x000000433b534b31, 0x000000462c312845, 0x00000046282c2956,
+    0x000000433b563153, 0x00000053284b2931, 0x0000005326534253, 0x000000284f4e2846,
+    0x0000004626564b4e, 0x00000031264e4256, 0x0000004626534256, 0x0000002846312631,
+    0x0000005326294b53, 0x000000534b314f53, 0x000000284f292846, 0x0000005642534f53,
+    0x0000005342564f31, 0x0000005628425345, 0x0000004656534f4e, 0x0000004e264b2653,
+    0x00000053554b4531, 0x0000004629312846, 0x0000005626314b4e, 0x0000004e28465654,
+    0x0000005345554b53, 0x0000004626314b4e, 0x0000005326564b45, 0x0000004f4e292846,
+    0x0000004e4f4b2653, 0x000000314b562653, 0x0000004628464153, 0x0000004b45554553,
+    0x000000453b314f53, 0x0000004645314f53, 0x0000005645552931, 0x0000005526564f31,
+    0x0000005328464b56, 0x0000004528553145, 0x0000003b29564b45, 0x000000282c31554e,
+    0x0000003128462846, 0x000000464f534153, 0x0000005642564b4e, 0x00000029534f5645,
+    0x0000004628554556, 0x000000433b562631, 0x0000005642314b56, 0x000000434e422953,
+    0x000000534b564555, 0x0000004e2631424e, 0x0000002653422931, 0x00000031454e5453,
+    0x0000004f56285456, 0x0000003128463145, 0x0000004e2846264e, 0x00000029534b5645,
+    0x0000004b29534f31, 0x0000003b4e4f2956, 0x0000003b534f4e45, 0x0000004e4b455531,
+    0x0000003129312846, 0x00000056282c2956, 0x0000003153292846, 0x0000005529564f53,
+    0x0000004f55534f56, 0x0000004f4e265345, 0x0000002c29532845, 0x0000004e264b4f31,
+    0x0000004e294e2845, 0x0000004e26562846, 0x00000045564b2956, 0x0000004f31284256,
+    0x0000004b314f2956, 0x000000564f4b2656, 0x0000005526534f31, 0x0000005345552953,
+    0x000000003b534253, 0x0000003145564b31, 0x00000045554e4256, 0x0000002928464b53,
+    0x000000464e4f5354, 0x000000003b562631, 0x00000043314b4555, 0x0000004e4b452656,
+    0x00000043314b4f53, 0x000000464b455453, 0x0000004b534f2931, 0x0000003128462656,
+    0x0000004b543b2931, 0x000000564f295645, 0x0000004e4b4f4556, 0x0000004f4b453b31,
+    0x0000003142534f31, 0x000000314f534556, 0x0000004229312846, 0x00000056424e2656,
+    0x0000004628452653, 0x000000003b543b31, 0x0000004e4231424e, 0x000000003b455531,
+    0x000000464f564b45, 0x000000314b532631, 0x0000004e424e4231, 0x0000005328465645,
+    0x0000004628543b4e, 0x000000464f534131, 0x000000464f535556, 0x00000046424e264e,
+    0x0000004f45314f53, 0x00000031264e2846, 0x0000004e2846284b, 0x00000046534f3126,
+    0x000000565345554e, 0x0000004629284656, 0x0000004f53263145, 0x0000004f31284b4e,
+    0x0000004e284b4f31, 0x0000002956284645, 0x000000462c315531, 0x000000534f564b4e,
+    0x0000004626292846, 0x000000314f53284b, 0x0000004641564f53, 0x000000534b4e4253,
+    0x0000004e4b452653, 0x0000004f534b314b, 0x0000003145534f56, 0x0000004e45282656,
+    0x00000046424e4253, 0x0000004528464f4e, 0x000000295628454e, 0x0000005626564b31,
+    0x000000314253264e, 0x0000002653284f56, 0x0000005641534f56, 0x0000004f53285531,
+    0x000000264e282656, 0x000000564f312656, 0x000000564f4e5456, 0x000000284b455453,
+    0x0000004353314b45, 0x000000534253424e, 0x000000284f314e45, 0x0000002854564556,
+    0x000000284f4e4555, 0x00000045534b2956, 0x0000004b45314b4e, 0x0000003b55312656,
+    0x0000003128462c31, 0x0000003145555326, 0x000000454e314f53, 0x000000464555294e,
+    0x000000534b45264e, 0x0000003128464e54, 0x0000002629314b45, 0x0000005529564f4e,
+    0x0000004e42534253, 0x0000004e42564b45, 0x000000284b543b56, 0x0000004626534b31,
+    0x000000534f4e2653, 0x000000534b534b45, 0x0000004f3128464e, 0x0000002842564253,
+    0x000000282c532846, 0x0000002c29532846, 0x000000003b455556, 0x0000005328464531,
+    0x00000045554b2953, 0x0000004e42534231, 0x0000003128452953, 0x0000004555314556,
+    0x0000004f4e455453, 0x0000004f56422953, 0x00000056284b2656, 0x0000003128554556,
+    0x0000004645284f53, 0x00000053284f4e54, 0x00000056264b4f31, 0x00000046424e4b56,
+    0x0000004b543b2953, 0x000000433b543b53, 0x000000434e4b543b, 0x0000004345553153,
+    0x00000056424e4b31, 0x0000000055562653, 0x0000002856455556, 0x0000003142534253,
+    0x0000000000534b31, 0x00000046564f4e45, 0x0000004529534f56, 0x0000000043534555,
+    0x000000564f534b53, 0x00000043534e5431, 0x000000294e284131, 0x0000004555562656,
+    0x000000314e543b31, 0x0000002c31284645, 0x0000004f53564f4e, 0x0000004b45554b56,
+    0x000000462855454e, 0x0000004353452653, 0x0000004f31284e45, 0x0000002826564b56,
+    0x000000554e4b5345, 0x000000534b564f31, 0x000000314b562656, 0x000000554e422953,
+    0x000000534f562826, 0x0000004f4e285453, 0x0000005629312846, 0x0000003126564b56,
+    0x000000423126294e, 0x000000294e312845, 0x0000004231262956, 0x0000004656543b4e,
+    0x00000031534f564b, 0x0000002653284f53, 0x0000005642534b4e, 0x00000055534f4e45,
+    0x0000002846455553, 0x000000314b455453, 0x000000314f532846, 0x000000003b314253,
+    0x000000424b314f53, 0x0000004628455456, 0x000000462c534f56, 0x0000004645554556,
+    0x0000004355312653, 0x0000004626564f4e, 0x0000004b53453b31, 0x0000003b534f3145,
+    0x0000004f31284b45, 0x00000000434b2656, 0x00000041534f534b, 0x0000002956284553,
+    0x0000002c534f4e45, 0x000000464f534b31, 0x0000005345564b53, 0x000000464b453b56,
+    0x0000003154564f4e, 0x0000005553455556, 0x0000002656282631, 0x0000004642534f4e,
+    0x0000002629284645, 0x0000005628454253, 0x0000004629284631, 0x0000005328464231,
+    0x000000284e545556, 0x000000312845424e, 0x000000562928464e, 0x0000004b53455553,
+    0x0000003a4e4e544e, 0x000000003b314231, 0x0000004f45534f53, 0x000000464f544131,
+    0x0000004e4b452853, 0x0000004626564b53, 0x0000004645564b4e, 0x00000031424e264e,
+    0x000000554e4f5326, 0x0000004f4e455431, 0x000000564f4b4f4e, 0x0000004356543b56,
+    0x00000046284b5345, 0x000000284b564f31, 0x0000002826564f31, 0x0000004e4f534131,
+    0x0000004356532631, 0x0000005328465345, 0x0000003b53452631, 0x0000004629534f31,
+    0x0000004645534f56, 0x000000564b534256, 0x0000000056455553, 0x0000005642312656,
+    0x0000005626562845, 0x0000004e4f535631, 0x0000004f3145264e, 0x0000005642564256,
+    0x000000464f4b2631, 0x000000464b564f53, 0x000000464e4f554e, 0x0000004654314531,
+    0x00000031264e4231, 0x0000004b4e4b264e, 0x0000005328462c56, 0x000000262931264e,
+    0x0000004e56455456, 0x0000005328463154, 0x00000031454e5431, 0x0000005354292846,
+    0x0000004f31452656, 0x000000552956264e, 0x000000534f4b264e, 0x0000004f294e4f53,
+    0x000000004e4b4555, 0x0000002c31554553, 0x000000000000434e, 0x000000284f535456,
+    0x000000314b56424e, 0x0000004b29562846, 0x0000004f31282653, 0x0000004e45282c31,
+    0x0000004628465354, 0x000000534f314256, 0x000000534f565556, 0x0000004e4528264e,
+    0x0000004628462931, 0x0000004e26534b56, 0x000000284f53264e, 0x000000294b534f4e,
+    0x0000004356452953, 0x0000004e28453b31, 0x000000532845294e, 0x0000004e4f4b2656,
+    0x000000534b455456, 0x0000002c4e453b56, 0x0000002656262956, 0x0000004e4256264e,
+    0x000000433b533153, 0x000000434b45554e, 0x0000002846452631, 0x000000433b534231,
+    0x0000004b56452846, 0x00000053424b2953, 0x0000003b29534f56, 0x000000464b534f53,
+    0x000000564f4e4553, 0x00000046284b2953, 0x0000004e28543b53, 0x0000004f53282631,
+    0x000000003b534256, 0x000000462656264e, 0x0000004554564f53, 0x0000004b56452653,
+    0x000000564b314f53, 0x0000000043564253, 0x000000554e4b294e, 0x0000004e29562845,
+    0x0000002846452956, 0x0000004f314b2631, 0x000000000043554e, 0x00000026564f3145,
+    0x0000005654534f53, 0x0000004353453b53, 0x0000002846455531, 0x0000004e29562846,
+    0x0000005429562846, 0x000000294e284653, 0x0000004555534f56, 0x000000564f534b31,
+    0x0000004e26295645, 0x0000004654292846, 0x0000005626294b31, 0x0000004e314f5326,
+    0x0000004e4e545556, 0x000000282c534555, 0x00000056284f2931, 0x0000004655564f4e,
+    0x00000028464b4553, 0x000000003b563153, 0x0000000045555331, 0x0000004b55534f56,
+    0x00000055534e4f4e, 0x0000004b534f564b, 0x000000284f56314e, 0x000000003b312656,
+    0x000000433b564b53, 0x000000284b455431, 0x000000314e543b53, 0x0000005326534b31,
+    0x00000028464f3145, 0x0000002956282653, 0x00000056424b2953, 0x0000003128465653,
+    0x0000002c31284f4e, 0x000000433b314256, 0x0000002928462826, 0x0000002845282c31,
+    0x000000433b455553, 0x0000000000314b56, 0x000000543b31264e, 0x000000564b452956,
+    0x000000434e452956, 0x0000000053314b45, 0x0000005642534b53, 0x0000004e45534f53,
+    0x0000002956282656, 0x0000004f31262953, 0x0000004626532631, 0x0000004e28465453,
+    0x00000046284f2931, 0x0000004b45284653, 0x0000002c53453b31, 0x0000003128464256,
+    0x000000284f535631, 0x000000564f53454e, 0x0000004e26314b45, 0x00000056282c294e,
+    0x0000002656284b45, 0x000000433b4e4b53, 0x0000002928465645, 0x00000031544e4553,
+    0x000000564f314e54, 0x0000003126564b53, 0x000000564b4e424e, 0x000000564f532656,
+    0x0000004628464253, 0x000000282c534231, 0x00000056284e5453, 0x00000056314f5326,
+    0x0000002953262931, 0x0000004f56554531, 0x000000433b543b56, 0x0000003b5626294e,
+    0x000000284f56284b, 0x0000004353452931, 0x000000462846424e, 0x0000004e45314f53,
+    0x000000564f534131, 0x000000464f565345, 0x000000314b4e4f53, 0x000000003b4e424e,
+    0x000000005642294e, 0x0000004628262956, 0x0000002855312631, 0x000000284e4f534b,
+    0x000000534b455529, 0x00000053564f534b, 0x000000534b543b53, 0x0000004628535456,
+    0x0000004f31282c31, 0x0000004642534b56, 0x0000005645314b31, 0x0000004f3128454e,
+    0x0000004641534f56, 0x00000031543b294e, 0x0000000043565345, 0x000000284f4b4f4e,
+    0x000000532653264e, 0x0000004f5345294e, 0x0000003154314531, 0x000000464f532846,
+    0x000000285431454e, 0x000000284641534b, 0x0000002653284645, 0x0000004f53262956,
+    0x0000002953424e45, 0x0000000043564b31, 0x00000053284b4556, 0x0000004645555326,
+    0x0000005326562845, 0x0000004e45312631, 0x0000003145553126, 0x000000282c534f53,
+    0x000000284b4e424e, 0x0000004b56422931, 0x000000564f535653, 0x0000002c4e455556,
+    0x0000004f56284f4e, 0x00000056264e4b31, 0x0000004f56262931, 0x0000002928464b31,
+    0x000000564f4e2845, 0x000000284f543b31, 0x000000534f4e5453, 0x00000046544e4531,
+    0x0000002853543b4e, 0x0000003b31543b4e, 0x0000002855532656, 0x0000005331534f53,
+    0x000000464b4e4555, 0x0000005628465653, 0x000000425326294e, 0x0000002928462631,
+    0x000000564b543b53, 0x0000004545284f53, 0x0000003b29534f31, 0x0000004e4b4f4531,
+    0x0000003b554e2653, 0x00000031284b2656, 0x00000055294e2653, 0x0000004f55534f4e,
+    0x000000554b534f53, 0x0000004628464156, 0x00000053282c5345, 0x000000543b534b31,
+    0x000000534f535631, 0x00000046294e2845, 0x0000002831455531, 0x000000003b564f53,
+    0x0000004631534f53, 0x0000005628464153, 0x0000002956452845, 0x0000002846284b45,
+    0x00000055294e3145, 0x0000002931264e45, 0x0000004e28462653, 0x0000004e45285553,
+    0x000000284f31284b, 0x0000002956532845, 0x00000031424e4b45, 0x000000294e4e2854,
+    0x0000004e4f534156, 0x0000004f4e28424e, 0x0000000000563153, 0x0000004e284b264e,
+    0x0000004631543b4e, 0x0000003b5345554e, 0x00000043534b4556, 0x0000004b26534f4e,
+    0x0000004653564f4e, 0x000000264e4b294e, 0x0000000043565331, 0x0000004529564f31,
+    0x0000005328464153, 0x0000004e28462c56, 0x0000004331452953, 0x0000004656534b45,
+    0x0000004f4e265645, 0x0000004e26564b31, 0x000000003b312631, 0x0000003145282c56,
+    0x00000053453b2931, 0x000000314f4b264e, 0x00000028462c4e31, 0x0000005328464b4e,
+    0x0000004b4f564f4e, 0x000000564f532631, 0x000000424e45554e, 0x0000004642564b4e,
+    0x00000028464b534b, 0x0000004f56543b56, 0x0000005454564f53, 0x00000046284f5631,
+    0x000000284f534b31, 0x0000005342534b31, 0x000000425645554e, 0x000000534b453b31,
+    0x000000564f534e54, 0x0000002c56455553, 0x0000004e28452631, 0x000000453b4e5431,
+    0x000000003145264e, 0x0000005326562846, 0x0000000000005531, 0x000000433b4e2631,
+    0x00000028464e5431, 0x0000005628265645, 0x00000028264e4231, 0x0000004628565431,
+    0x00000046284b4e4b, 0x0000004555534b45, 0x00000055564b294e, 0x000000003b4e2653,
+    0x0000004e54534553, 0x000000284f564153, 0x0000003b314b4531, 0x0000004e28464253,
+    0x0000004b45282629, 0x0000005628452846, 0x0000002845294b56, 0x000000003b533145,
+    0x00000028464f4e45, 0x000000534b532656, 0x0000003126314253, 0x0000004b564f534b,
+    0x000000564b543b4e, 0x00000045554b2956, 0x0000003b534b2956, 0x000000433b564b4e,
+    0x0000002842564b31, 0x00000056284b294e, 0x00000029534b5345, 0x0000004f53282c31,
+    0x000000534b45544e, 0x0000004645284f56, 0x000000464e543b31, 0x0000004b53422956,
+    0x0000004f3128554e, 0x000000314b455529, 0x0000004e45562631, 0x000000433b312653,
+    0x00000053564f3126, 0x0000005645564f31, 0x0000003126564231, 0x00000056554b4531,
+    0x00000046544e544e, 0x00000056284f4e26, 0x0000004631455531, 0x0000004645282c53,
+    0x0000004f564b4556, 0x0000005628463154, 0x0000005628453b31, 0x0000005645284645,
+    0x0000003128422931, 0x000000464b534f56, 0x0000004256262956, 0x000000564f4e454e,
+    0x00000000434e4b53, 0x0000004e29284645, 0x000000312826294e, 0x0000004b56543b4e,
+    0x00000028464b3145, 0x0000005328464156, 0x0000002846455529, 0x00000028264b4f4e,
+    0x0000004f31422931, 0x000000284f534553, 0x00000028464f534b, 0x0000004f29314b45,
+    0x0000000043534253, 0x0000004b55564f4e, 0x000000282c4e2846, 0x00000056284b2631,
+    0x000000284f534231, 0x000000462c532845, 0x0000004f4e452846, 0x0000004b45564f4e,
+    0x0000004555564556, 0x000000004353264e, 0x0000004253262956, 0x000000564253264e,
+    0x0000002826564b45, 0x0000003b29314f53, 0x000000264e422931, 0x00000042564f2931,
+    0x0000004629564f53, 0x000000534f532854, 0x0000005328452855, 0x0000004f2845554e,
+    0x0000002653455553, 0x000000265328264e, 0x0000000000432956, 0x000000424b564f31,
+    0x000000284b4e264e, 0x0000004e4b532656, 0x0000003126564b45, 0x000000464b564f4e,
+    0x00000053284e4f53, 0x0000003b314e4b45, 0x0000004f31452653, 0x0000004353455556,
+    0x0000004353543b56, 0x0000004f4e532854, 0x00000031284e5453, 0x0000005345282631,
+    0x000000314b4e264e, 0x0000004f4e543b56, 0x0000004628263145, 0x0000004b29284631,
+    0x00000046282c5345, 0x000000534e45554e, 0x0000005628462c4e, 0x00000031264b2653,
+    0x0000003b4e4f5345, 0x000000434b455556, 0x0000005345285556, 0x0000004b56452656,
+    0x00000028534f4e45, 0x0000002c294e4f53, 0x00000026564f2953, 0x000000314f535653,
+    0x0000004e45555626, 0x000000284628454e, 0x00000045284b4553, 0x00000043534b4f4e,
+    0x0000004329534f31, 0x00000028424e264e, 0x000000295328264e, 0x0000003a4e4e5456,
+    0x0000004e284b4553, 0x000000534f562854, 0x00000046554b4531, 0x0000004555534b31,
+    0x0000005328424e45, 0x0000004f314b4f31, 0x000000294e284656, 0x0000004e26534253,
+    0x0000004528543b31, 0x00000031534f5645, 0x0000004e26532845, 0x00000029564b4e45,
+    0x0000005628454256, 0x0000002656452845, 0x000000462c4e4b45, 0x0000004f31282c53,
+    0x00000026534f2931, 0x0000004f45564f31, 0x0000003128465345, 0x00000054554e4f53,
+    0x0000004e42314256, 0x0000003b29564f53, 0x000000000031424e, 0x00000031284f3145,
+    0x0000004e2846454e, 0x0000002845285556, 0x0000002953284f56, 0x00000055534f5653,
+    0x0000004f564e5453, 0x000000462845264e, 0x00000046284f3154, 0x000000284f534e54,
+    0x0000000046455553, 0x0000003128464f53, 0x0000002845534f31, 0x000000463126294e,
+    0x0000004e45285531, 0x0000004f31543b56, 0x0000004e31422931, 0x0000003142564253,
+    0x0000005628452855, 0x0000004356554531, 0x0000004645564f4e, 0x0000000043563145,
+    0x000000564f53414e, 0x0000004b53422953, 0x000000284b455531, 0x000000004e314b45,
+    0x000000284b534256, 0x0000000000562656, 0x000000284f562826, 0x000000003b293145,
+    0x0000002846284626, 0x0000004e28462854, 0x0000002953263145, 0x00000028464f5326,
+    0x0000004329314f53, 0x0000004e284f314b, 0x00000054314b4531, 0x0000004b314b3145,
+    0x0000003154534f31, 0x0000003154534f53, 0x0000004355532656, 0x000000314e54554e,
+    0x0000005341534f56, 0x000000284628464b, 0x0000002956284653, 0x0000004b4e545453,
+    0x000000534f56414e, 0x0000004f53452953, 0x0000002928465453, 0x0000004e4f4b4f56,
+    0x0000004e4f294e45, 0x0000004e4b534231, 0x0000004628425345, 0x0000005326534256,
+    0x000000543b56454e, 0x00000031284f294e, 0x000000003b56424e, 0x0000003b45555631,
+    0x000000564f4e5453, 0x00000031282c2956, 0x0000002855312653, 0x0000002842562656,
+    0x0000004e45554b56, 0x0000002c31554556, 0x00000028564f534b, 0x0000002928462653,
+    0x000000534f535653, 0x0000002953284231, 0x000000314f535645, 0x0000004329564b45,
+    0x00000046424e4b45, 0x0000004f31284631, 0x00000043294e264e, 0x0000004e28422956,
+    0x0000002846534f56, 0x0000004542534f31, 0x0000003126564f4e, 0x0000004f2928464b,
+    0x000000464f312845, 0x0000005628452931, 0x0000004e28465653, 0x000000004331554e,
+    0x0000002c53455531, 0x0000003145553145, 0x0000004f4e452953, 0x0000004626294b56,
+    0x0000004b2928464b, 0x0000005645534b56, 0x0000004628455553, 0x0000003145284f56,
+    0x00000031544e4531, 0x00000056544e5456, 0x00000042534b2953, 0x0000004645554b56,
+    0x0000003145552931, 0x0000004b4e452846, 0x0000004f56284b4e, 0x000000464f314b53,
+    0x00000031424e4253, 0x0000004f56532854, 0x0000004645555626, 0x0000005345282c53,
+    0x000000314f53454e, 0x000000284f31264e, 0x0000005431543b53, 0x00000031424e4231,
+    0x0000003145294b56, 0x000000532841314b, 0x0000004355314f53, 0x0000004f53562653,
+    0x0000002953264e45, 0x00000028534f5631, 0x000000293126294e, 0x0000002854314553,
+    0x00000046284b2956, 0x0000004f314b264e, 0x0000004256455556, 0x0000004654534f31,
+    0x0000005342294b4e, 0x00000000004e4231, 0x0000004555534153, 0x00000046264b2656,
+    0x000000314528464e, 0x0000004e424e2631, 0x0000004e4b4e5431, 0x00000046454e5431,
+    0x000000263126294e, 0x0000004e284b534b, 0x0000004f56452855, 0x000000434e452656,
+    0x000000534f31454e, 0x000000564f532854, 0x00000028534f3145, 0x0000002856543b56,
+    0x0000005556422956, 0x0000002855534b53, 0x000000284f294b53, 0x000000435326294e,
+    0x0000004528453b56, 0x0000004b55314f53, 0x000000543b4e4556, 0x000000285553264e,
+    0x00000031284e2854, 0x0000004f5345264e, 0x0000005331292846, 0x0000003145282631,
+    0x000000564f315531, 0x0000004f2953264e, 0x000000464b452931, 0x000000003b564f31,
+    0x0000005626314253, 0x0000002846282c56, 0x0000004e424e4253, 0x000000534f53454e,
+    0x00000053544e544e, 0x0000005454564f4e, 0x0000004f31285453, 0x0000005356455553,
+    0x0000004f294e2854, 0x00000026314f5345, 0x000000284f315553, 0x0000004f4e543b53,
+    0x000000564f315553, 0x000000454e4b4556, 0x00000053284f5354, 0x0000005342312656,
+    0x0000005628465553, 0x0000004e4b452856, 0x0000004e28554556, 0x0000002845284f31,
+    0x000000284b314555, 0x0000004645284f31, 0x00000053284b4531, 0x000000564f53284b,
+    0x0000004b45534b56, 0x00000046424e4f53, 0x00000031284b2653, 0x000000464b452831,
+    0x0000004e42314b45, 0x0000004626314231, 0x0000004642294b4e, 0x0000004f3145294e,
+    0x000000564f535631, 0x000000564f4e284b, 0x00000031284f314e, 0x0000005628465453,
+    0x0000000043292846, 0x00000046543b294e, 0x00000028464e2653, 0x000000543b312656,
+    0x0000005628465354, 0x0000002846455453, 0x0000002846282653, 0x0000004e4b53264e,
+    0x000000284b45294e, 0x000000544e545453, 0x000000314f535556, 0x0000002845555326,
+    0x0000003b55534f53, 0x0000004b53543b31, 0x0000002956284b56, 0x0000002629532845,
+    0x0000003b53452656, 0x000000433155454e, 0x0000004e4b31424e, 0x00000028264b4f53,
+    0x000000314b564253, 0x00000046564f5345, 0x000000284b452845, 0x0000002653422953,
+    0x0000004e42564b53, 0x000000284628544e, 0x0000002846285456, 0x0000004e28464f31,
+    0x0000003b31455553, 0x00000046454e4f53, 0x0000005456543b53, 0x000000543b534b53,
+    0x0000004f4e284654, 0x000000284b543b4e, 0x000000314b455553, 0x0000004e544e454e,
+    0x0000002846532631, 0x0000004b45562653, 0x0000005645564b56, 0x000000543b532656,
+    0x0000004f4b543b53, 0x0000004b314f294e, 0x00000056264e2845, 0x0000004229562846,
+    0x000000534f4e424e, 0x0000004f55564f31, 0x000000455556264e, 0x00000045284f2956,
+    0x000000534f534156, 0x0000005345564f4e, 0x0000000000534b56, 0x000000282c56554e,
+    0x0000004e284f5626, 0x0000000000565331, 0x0000004628464b53, 0x0000004528453b4e,
+    0x00000029564b5645, 0x0000002c31282631, 0x000000314b452653, 0x0000005342532656,
+    0x0000005454564f31, 0x000000464528543b, 0x0000005641564f4e, 0x000000562846284b,
+    0x00000028424e4f53, 0x000000003b314e54, 0x00000045284f2953, 0x0000002846554553,
+    0x0000002826564b31, 0x0000005553564f53, 0x000000284b56424e, 0x0000004b45564b53,
+    0x0000003126564b4e, 0x0000005328453b53, 0x000000534f534131, 0x000000435642294e,
+    0x0000003b29532845, 0x000000532845554e, 0x00000046453b2956, 0x0000002842564f53,
+    0x000000284f56544e, 0x0000004654314553, 0x0000002845553145, 0x0000004628423145,
+    0x00000043314b4f31, 0x0000004f31282c4e, 0x0000004f4b455531, 0x0000002845554e45,
+    0x0000004b56455556, 0x000000564f53264e, 0x000000564f4e4256, 0x000000284f4e2845,
+    0x000000534e4f5556, 0x000000314b534f53, 0x0000005341292846, 0x000000534f4b4f53,
+    0x000000284f564556, 0x000000462846294e, 0x0000004e26292846, 0x00000055564f5345,
+    0x000000534b314253, 0x000000435531264e, 0x0000004e28414e4b, 0x0000004353262956,
+    0x0000002c31455531, 0x000000564f31554e, 0x000000564f535453, 0x0000005628453b53,
+    0x0000005642564b56, 0x0000004555294b56, 0x0000004229564f53, 0x000000464b543b53,
+    0x0000003b5345264e, 0x0000004555294e31, 0x000000462845294e, 0x0000005655564f4e,
+    0x0000002826312846, 0x0000003142312653, 0x000000282c564f31, 0x0000004329534b45,
+    0x0000002826534b56, 0x0000003154314556, 0x0000004642564256, 0x00000042534f2931,
+    0x000000003b564e54, 0x0000000043534b4e, 0x0000003126534256, 0x00000031454e4b31,
+    0x0000003153564f31, 0x000000284b312656, 0x0000004555534f4e, 0x0000005326564f53,
+    0x0000005642564f53, 0x000000263145554e, 0x0000002c53284f56, 0x0000002845284645,
+    0x000000314b534256, 0x00000056424b2956, 0x0000005328465456, 0x000000004331264e,
+    0x0000004331554553, 0x0000002845552956, 0x0000004f534e5456, 0x0000004353562631,
+    0x0000000031262931, 0x0000004528554f56, 0x00000055534b4553, 0x00000056453b2931,
+    0x0000004626562845, 0x0000003126295345, 0x000000534f312845, 0x0000005642564b53,
+    0x0000004f31285553, 0x0000004e45564f31, 0x00000046564f4e26, 0x00000046282c294e,
+    0x0000005345284f53, 0x0000004f4b543b4e, 0x000000534f4b2656, 0x000000534f315553,
+    0x0000003128465531, 0x00000031282c4e4b, 0x000000003b564231, 0x0000003145284f31,
+    0x0000004e45312653, 0x0000004e4f4b2631, 0x0000004e42314b53, 0x0000002931452846,
+    0x0000005326534b56, 0x0000002c3145554e, 0x0000004f31284555, 0x0000000000455553,
+    0x000000284f4e2656, 0x0000004f29562846, 0x000000284628264e, 0x0000004642292846,
+    0x00000028453b2956, 0x0000003145314b31, 0x0000005628462c56, 0x000000535431454e,
+    0x0000004e4e54554e, 0x000000464f534531, 0x0000003145285553, 0x000000563145554e,
+    0x0000002846284f53, 0x0000004e4f292846, 0x0000005645554b31, 0x0000005529564f31,
+    0x000000424e26294e, 0x0000004331422956, 0x0000002656282653, 0x0000005529312826,
+    0x000000534f314556, 0x00000031264e2653, 0x0000005328453b4e, 0x00000028464b564b,
+    0x000000564b452953, 0x00000045554e264e, 0x000000453b294b56, 0x00000028264b264e,
+    0x00000028544e454e, 0x0000004e544e2631, 0x00000053284b4f53, 0x0000002953284b4e,
+    0x000000534f565431, 0x000000294e532854, 0x000000564f53554e, 0x000000433b543b4e,
+    0x00000029564b3145, 0x000000003b543b53, 0x0000004f29312631, 0x000000462c564231,
+    0x00000053282c4e45, 0x0000004f314b4f4e, 0x000000464f535456, 0x0000002845552953,
+    0x0000004b4e42294e, 0x000000464528464e, 0x0000005626562653, 0x000000534b564256,
+    0x00000028464b4555, 0x000000434e452653, 0x00000028453b2953, 0x0000004555295345,
+    0x0000003b31453b31, 0x0000004645552931, 0x000000554e455531, 0x000000564f293145,
+    0x00000053424e264e, 0x00000046264b264e, 0x0000000055312631, 0x0000005626294e45,
+    0x0000004331543b53, 0x0000004555534553, 0x0000004e4b4f454e, 0x0000004e284b2656,
+    0x0000004f31284f53, 0x000000284f314231, 0x00000056264e4b53, 0x000000312856544e,
+    0x0000005529534f4e, 0x0000002846452653, 0x00000045554e2656, 0x0000004629562846,
+    0x0000004f314e544e, 0x000000284f564e54, 0x0000003b31543b53, 0x0000000029312846,
+    0x000000284b454256, 0x0000005628262953, 0x00000029564f2931, 0x00000055294e2656,
+    0x0000004e26534b31, 0x0000004528263145, 0x00000055314b2956, 0x000000284b534253,
+    0x0000004356262953, 0x0000004e284b4f53, 0x0000002c56284f4e, 0x000000562841534b,
+    0x0000004e45284645, 0x000000464b564256, 0x000000284645544e, 0x00000055534f5345,
+    0x00000043564b4f53, 0x000000284f294b56, 0x0000004f56282c56, 0x0000002c534f564b,
+    0x000000534b534555, 0x000000534f565553, 0x000000464b45544e, 0x000000294b534f53,
+    0x0000004e42564256, 0x0000005528534f31, 0x0000004626564256, 0x0000004e28452956,
+    0x0000005342294b53, 0x0000004f4e284b45, 0x000000314b534231, 0x00000054564b4556,
+    0x0000003126314f53, 0x0000004355564f53, 0x000000534f4e2845, 0x00000028534f534b,
+    0x00000046264e4b45, 0x0000002854534f53, 0x0000004e31292846, 0x0000004f5355454e,
+    0x0000004f564f3154, 0x000000464f314e54, 0x000000284b314b45, 0x000000534e545531,
+    0x0000002931265345, 0x0000002855564256, 0x00000000314e4b45, 0x0000005326532631,
+    0x0000004628535453, 0x0000003126534f53, 0x000000284f563153, 0x0000004f314e2845,
+    0x000000284f314531, 0x000000564b31264e, 0x0000004e45552956, 0x0000000000312656,
+    0x0000002853284b45, 0x0000005645554e45, 0x0000000043564555, 0x000000534555294e,
+    0x000000434e4b4531, 0x0000004e45282653, 0x0000004e4b455431, 0x00000053264b264e,
+    0x0000000043314556, 0x00000031534f4e26, 0x000000284f4e424e, 0x00000046554e4f53,
+    0x00000028264e4b45, 0x00000055314b4556, 0x0000004f53564f53, 0x000000564b564555,
+    0x0000005341564f4e, 0x00000028462c314b, 0x000000314f535631, 0x0000004e4528554e,
+    0x0000005342564b31, 0x00000000564b4555, 0x0000002846284e54, 0x0000004e45554f53,
+    0x00000053424e2653, 0x00000053284f3154, 0x0000004555564253, 0x0000004f4e422953,
+    0x00000056284b4553, 0x0000003b4e4b4555, 0x000000464f4e544e, 0x0000000043314f53,
+    0x00000046424e4b4e, 0x0000004e42314b31, 0x00000028534f5653, 0x000000314b314555,
+    0x0000004f314b2653, 0x0000004f29284631, 0x0000004529564f4e, 0x000000464b532631,
+    0x0000004e284b564b, 0x0000005328423145, 0x0000005628464556, 0x0000005531534f31,
+    0x0000004631292846, 0x000000534b453b53, 0x000000284f56424e, 0x000000464b452956,
+    0x000000295328544e, 0x0000002855312656, 0x0000005328554556, 0x00000056424e4b56,
+    0x00000028554e264e, 0x0000000031262953, 0x0000005642532631, 0x0000004e264e4231,
+    0x000000464f562653, 0x000000464f314531, 0x0000004b4e4f5345, 0x0000004b45314b31,
+    0x00000043294e2631, 0x000000534b452845, 0x0000002928464553, 0x000000464f53544e,
+    0x0000004e54312653, 0x000000283b294e45, 0x000000314e545556, 0x0000004f564b4553,
+    0x0000004f534b2656, 0x0000004645285556, 0x00000029534f2931, 0x0000003b53455556,
+    0x0000004f31554531, 0x000000462c565556, 0x0000004645554553, 0x0000004f45282653,
+    0x00000031284f5631, 0x0000003126534b31, 0x0000003b4e453b56, 0x000000464f294b53,
+    0x0000005629284631, 0x0000002931282c4e, 0x0000004b294e284b, 0x0000003b5642294e,
+    0x0000004e4b314253, 0x00000046544e5456, 0x000000264e292846, 0x00000000434e424e,
+    0x00000053282c2956, 0x000000282c312846, 0x0000002c4e455531, 0x00000046282c2953,
+    0x00000045554e4b53, 0x0000005326314b4e, 0x0000005354534553, 0x00000045554e4553,
+    0x00000056264b2656, 0x0000002956284631, 0x0000005345282c56, 0x000000314b534f31,
+    0x0000004e4f532854, 0x0000004331534b45, 0x000000453b564f4e, 0x0000004555564f53,
+    0x000000433b564256, 0x0000002854534531, 0x00000028464b4e45, 0x0000004645552956,
+    0x00000046264e2631, 0x0000004f5345554e, 0x0000005328464f56, 0x0000005354564f53,
+    0x0000004355534f4e, 0x000000284f535556, 0x000000314b314b45, 0x00000053284b2656,
+    0x000000314f532854, 0x000000544e543b31, 0x00000056284f3145, 0x0000004e28425645,
+    0x000000543b564531, 0x00000026534f294e, 0x0000003142564256, 0x0000002842532656,
+    0x000000003b564253, 0x000000534f314231, 0x0000005342534b53, 0x000000314256424e,
+    0x0000002856314f53, 0x0000005328464e45, 0x00000031534f5631, 0x000000562846264e,
+    0x000000004e422931, 0x0000004e4b455529, 0x000000003b562656, 0x000000534e4f554e,
+    0x0000005626564f31, 0x0000005556422931, 0x0000004e54562656, 0x00000056264e2653,
+    0x0000004f56455553, 0x00000046554b4553, 0x0000004e45284f53, 0x00000046264e4253,
+    0x0000004331452956, 0x0000003b294e4b45, 0x000000433b564231, 0x0000005328462846,
+    0x0000003128425645, 0x0000002846452831, 0x000000564b314256, 0x0000005556455556,
+    0x00000056284b4e45, 0x000000452855294e, 0x000000314b564256, 0x00000053284e2845,
+    0x0000004f314b4e4b, 0x0000004545284f31, 0x0000002c564b4555, 0x0000002855534f31,
+    0x0000003b564b294e, 0x0000004331455553, 0x0000004642534253, 0x0000002846284545,
+    0x0000004626534b4e, 0x000000534f314e54, 0x000000264e282631, 0x000000564f4e544e,
+    0x0000005326314b56, 0x0000004e4b534f53, 0x0000000000315345, 0x000000464b564f31,
+    0x0000004e5453264e, 0x000000314f535553, 0x00000043294e4f53, 0x0000004628565453,
+    0x0000004f564f294e, 0x0000003b31262931, 0x00000053264e2845, 0x0000004b4e4b2953,
+    0x0000003b29562846, 0x00000046264e4f53, 0x0000005354564f31, 0x000000003b45554e,
+    0x000000464f4e2653, 0x0000002845564b56, 0x0000005556314f53, 0x000000534b534231,
+    0x0000005345314f53, 0x000000464f314b56, 0x0000005642562631, 0x0000004e28463153,
+    0x0000000056532631, 0x0000005329532846, 0x0000005645554e31, 0x000000424e4f2931,
+    0x0000002c4e4b4555, 0x00000028464f4e26, 0x000000464f4e4256, 0x00000043554e2656,
+    0x0000003b55564f53, 0x000000284b562656, 0x000000312846554e, 0x0000004f56284e31,
+    0x0000004628464553, 0x0000005328455531, 0x0000000043562656, 0x00000028464e2854,
+    0x0000002931452855, 0x00000056284b4f56, 0x0000002842564231, 0x0000003128455531,
+    0x00000043534f294e, 0x0000004f53452855, 0x0000004e264b4f56, 0x0000004628315431,
+    0x00000000434e4553, 0x0000004e54312631, 0x000000534f564231, 0x0000004e31534f31,
+    0x000000294e4b3145, 0x0000005345564b4e, 0x0000003b55312631, 0x0000002928464555,
+    0x000000433b314b4e, 0x0000004e26564b53, 0x0000004642534f56, 0x00000055534b534b,
+    0x0000004f453b2953, 0x0000004555534f31, 0x00000043564e5456, 0x0000002953284e31,
+    0x0000004f4e28464e, 0x000000314b564555, 0x000000464e262953, 0x0000004f5655454e,
+    0x0000004f56543b53, 0x000000564528554e, 0x0000004b29312846, 0x00000028462c3145,
+    0x0000004e42534b53, 0x0000004f56452931, 0x0000004b56452631, 0x00000028454e4f53,
+    0x0000004353543b4e, 0x0000004e4b4e4231, 0x0000005354534f56, 0x0000005553422931,
+    0x0000004e45553145, 0x00000031424e2631, 0x000000464b564b45, 0x0000004f564b4f56,
+    0x0000003128455431, 0x0000002845555626, 0x000000005356264e, 0x0000004f31284f31,
+    0x00000056543b2931, 0x00000028264b4f56, 0x0000000000562653, 0x000000285531264e,
+    0x0000005345314b4e, 0x0000005326564b56, 0x0000005328265345, 0x0000004e4b452855,
+    0x0000002846262931, 0x0000004b4e4b294e, 0x0000002c564f314b, 0x0000004f294e2845,
+    0x000000464f31284b, 0x0000002931423145, 0x0000004f56554553, 0x000000462c4e4555,
+    0x000000453b562653, 0x0000004528534f56, 0x000000564f314256, 0x000000433b565345,
+    0x000000534f534231, 0x0000004331454e31, 0x00000055534f534e, 0x0000003126532846,
+    0x0000005654534531, 0x0000004356452956, 0x0000002629564f53, 0x0000004f294e2653,
+    0x000000314e4f534b, 0x0000004628422931, 0x0000005456453b4e, 0x00000043564f2956,
+    0x0000003145284631, 0x0000005553422956, 0x00000055534b4e4b, 0x0000002956312845,
+    0x0000002931284e54, 0x000000292846264e, 0x0000002c4e284645, 0x0000000031422953,
+    0x0000004528552931, 0x0000004e5456454e, 0x000000284f534b4e, 0x0000002c56284555,
+    0x0000002931263145, 0x000000434e455531, 0x0000005626295345, 0x0000004b45534b31,
+    0x0000005529532826, 0x0000002842312631, 0x000000434e262931, 0x0000000043312653,
+    0x0000004e424e4f53, 0x0000004f31455453, 0x0000004f564b4531, 0x00000029564e2854,
+    0x00000042314b294e, 0x0000003142564f31, 0x000000464f534b4e, 0x0000004e4b543b31,
+    0x00000055564b4556, 0x000000534b562656, 0x0000004f534b2631, 0x000000464b452631,
+    0x000000284b452855, 0x000000284b532653, 0x000000564b4e4b45, 0x0000004331422931,
+    0x000000564f4e4e54, 0x0000003128454e31, 0x0000004e42312656, 0x0000003b53452653,
+    0x0000004f4e45294e, 0x0000002846284631, 0x0000005626294b4e, 0x0000004e28464131,
+    0x0000002855564f31, 0x000000464f534b53, 0x0000004f53564f31, 0x000000464f565556,
+    0x0000004628455556, 0x0000003b5553264e, 0x0000000055534f31, 0x0000004555564b56,
+    0x00000031534f314b, 0x00000042534b294e, 0x000000295328454e, 0x000000465431454e,
+    0x0000004e28465345, 0x0000004b2953284b, 0x000000433b4e2653, 0x00000000434e5645,
+    0x0000004f5645554e, 0x000000412953284b, 0x000000004e455556, 0x00000056264b264e,
+    0x0000004528464b45, 0x000000295645554e, 0x000000314f535531, 0x0000004e45282629,
+    0x000000564b455453, 0x0000004e282c564b, 0x0000004e45564f53, 0x0000002956264e45,
+    0x00000055534b564b, 0x000000462c4e4253, 0x0000004626562631, 0x000000564e543b31,
+    0x000000294e264e45, 0x00000046264e2653, 0x0000004e424e2653, 0x00000031424e424e,
+    0x000000564f535431, 0x0000003a4e4e5453, 0x0000004e28455531, 0x00000031264e4f53,
+    0x0000003154564556, 0x0000002855534b31, 0x0000004e284f3154, 0x000000284b452953,
+    0x0000004e4f532846, 0x000000314f534b56, 0x000000282c314f53, 0x0000002846284153,
+    0x00000000434b264e, 0x000000453b294b53, 0x0000002c564f5345, 0x00000028454e544e,
+    0x000000284f295645, 0x00000046284b4556, 0x000000004e422956, 0x00000043294e2845,
+    0x0000004253262931, 0x0000004b28452855, 0x000000534e4f5553, 0x0000004e4f544156,
+    0x0000005628464156, 0x00000055564b4e4b, 0x0000004f53284656, 0x0000002856534f4e,
+    0x0000004e53455431, 0x0000004e45534b56, 0x0000003128452956, 0x000000464f312854,
+    0x0000004e4e45544e, 0x0000004e453b294e, 0x0000000031532656, 0x0000004329532656,
+    0x0000005454534f4e, 0x0000003155564f53, 0x0000004e264b2631, 0x000000003b543b4e,
+    0x0000004628315456, 0x0000004f29312653, 0x0000003b53453b31, 0x0000004f29532854,
+    0x000000284f4e4256, 0x000000564b314555, 0x000000534e543b56, 0x0000003128565456,
+    0x000000554e262953, 0x0000005328464553, 0x0000005431453b31, 0x0000002c53284f4e,
+    0x000000284b562653, 0x0000004356314b45, 0x00000031264b264e, 0x0000000043534556,
+    0x0000005345554b56, 0x0000004653564b45, 0x0000004555564156, 0x0000004528552953,
+    0x0000004b4e545456, 0x000000464f534253, 0x0000004b45282653, 0x00000053543b2956,
+    0x00000031534f5653, 0x000000554b534f56, 0x000000464f4e4531, 0x00000056534f5653,
+    0x0000003b56262953, 0x000000534f563145, 0x00000056554e4f53, 0x00000028264e4b31,
+    0x00000055294e264e, 0x0000005326312631, 0x00000053294e2845, 0x00000028424e4b31,
+    0x0000003b55292846, 0x0000003145282656, 0x0000000043564f31, 0x00000055564b4553,
+    0x0000005342534f53, 0x0000004b26292846, 0x0000004f53284253, 0x000000543b4e4b4e,
+    0x000000544e453b31, 0x000000434e4b2956, 0x0000004f31262956, 0x0000002631282656,
+    0x0000003b31532653, 0x0000004628462c4e, 0x000000464231424e, 0x0000002953284153,
+    0x0000003128464f4e, 0x0000004f53422931, 0x0000002c294e2845, 0x0000002826564256,
+    0x000000314f544153, 0x0000005628455553, 0x00000055314b564b, 0x0000005529532845,
+    0x0000005326312846, 0x0000002856543b4e, 0x00000000434e4556, 0x0000004b4556264e,
+    0x0000004329562656, 0x0000003142534b53, 0x0000004628452656, 0x0000004331453b53,
+    0x0000005655534f56, 0x000000314e4f5531, 0x0000003b56453b4e, 0x000000003b564b4e,
+    0x0000002846312845, 0x0000003b3145264e, 0x0000004f29314f53, 0x000000534f564e54,
+    0x0000000043564f53, 0x0000004645294b31, 0x000000562653424e, 0x0000002953285453,
+    0x0000004f2956264e, 0x0000004328543b31, 0x0000003155534f4e, 0x0000002931424e45,
+    0x0000004e29284656, 0x000000265345554e, 0x0000002653452846, 0x00000053264b4f53,
+    0x000000564f4e4556, 0x0000005456543b31, 0x0000002c2956284b, 0x0000004e4b564b45,
+    0x0000000000004356, 0x0000004f53285553, 0x0000004e454e5453, 0x0000004e4b534253,
+    0x0000004645553145, 0x0000004e4f293145, 0x000000455531454e, 0x0000004e5431264e,
+    0x0000004e424b2956, 0x0000002c31284555, 0x0000004555544131, 0x00000056284f5654,
+    0x0000005628554531, 0x0000003145554b4e, 0x0000004f45564f53, 0x000000003b4e4253,
+    0x000000284f4e2653, 0x0000002831543b4e, 0x0000005328464f4e, 0x0000004e28462631,
+    0x0000004628453b4e, 0x0000000000534b4e, 0x0000004e4f535556, 0x0000004528555345,
+    0x0000003142564b4e, 0x00000029534f5345, 0x0000002846534f4e, 0x0000003b45555653,
+    0x0000004629284653, 0x000000554b292846, 0x00000056454e4b56, 0x0000003154534f56,
+    0x0000004626294b31, 0x0000004f53284555, 0x0000004e424e424e, 0x0000005329532845,
+    0x000000564b564f53, 0x0000003b56543b4e, 0x0000005345284645, 0x000000543b53454e,
+    0x00000045284b4f45, 0x000000434e422956, 0x0000004e28464e45, 0x000000534f544131,
+    0x0000004e4b4e4256, 0x00000000554e2656, 0x000000284f4e5431, 0x00000055534f5631,
+    0x000000433b563145, 0x00000053284f5645, 0x0000004645554531, 0x000000564f544153,
+    0x0000002956282c53, 0x0000004f53262953, 0x0000004f564f5345, 0x0000004642312631,
+    0x0000003129312845, 0x000000453b534f31, 0x0000003b564b2931, 0x00000056543b2953,
+    0x00000046284b3145, 0x00000031284e2845, 0x0000005342564b4e, 0x0000003128422953,
+    0x000000453b294e45, 0x00000043554e264e, 0x000000314f534231, 0x000000294e26294e,
+    0x0000005628455556, 0x0000002826564f53, 0x000000564f532846, 0x00000046534f314b,
+    0x0000004e424e4b53, 0x0000004f4e284f53, 0x0000005556422953, 0x0000002956285456,
+    0x0000004b45554e31, 0x0000004e4f534b4e, 0x0000005526314f53, 0x0000004626532845,
+    0x0000000056262953, 0x0000002953282656, 0x00000056282c4e4b, 0x0000005628455456,
+    0x0000002956284e31, 0x00000053453b294e, 0x000000284e543b4e, 0x00000028454e5456,
+    0x0000003142314b56, 0x000000284f564531, 0x0000005628464553, 0x0000004f53425645,
+    0x0000004f56414e4b, 0x0000005642562653, 0x0000004626312656, 0x000000433b534b4e,
+    0x0000003b4e42294e, 0x0000004b29534f56, 0x000000434e4b2953, 0x0000003128462c56,
+    0x000000294e28544e, 0x0000002953282c4e, 0x00000056284f5354, 0x000000564e543b4e,
+    0x0000004b29534b45, 0x0000004e284b2631, 0x0000002826294b4e, 0x000000534f315456,
+    0x0000004b534f3145, 0x0000002842534b56, 0x0000005641292846, 0x000000454e4b2956,
+    0x0000004e2846414e, 0x000000284b452846, 0x00000053314f5345, 0x000000432956264e,
+    0x0000004e4b452956, 0x000000004e4f2956, 0x0000004b3142294e, 0x0000000000005556,
+    0x000000284e543b56, 0x0000004f56284553, 0x000000534b534f53, 0x00000031284f5653,
+    0x000000534f314531, 0x0000003142534256, 0x0000004e28455431, 0x0000002c3128264e,
+    0x000000544e4b4531, 0x000000434e4b4f31, 0x0000004526534f4e, 0x0000005626564231,
+    0x0000005628462c53, 0x0000005645314b53, 0x0000005326314b45, 0x0000005326534f31,
+    0x0000003126314b56, 0x0000002c53284f53, 0x0000003128452855, 0x0000004555564531,
+    0x0000000043534256, 0x0000004b53455529, 0x0000002953284156, 0x0000003128462653,
+    0x000000464f564556, 0x0000004e42294b4e, 0x000000564f544156, 0x0000005631455553,
+    0x0000003b534b2931, 0x000000314231424e, 0x000000282653424e, 0x00000055314b4e4b,
+    0x0000004642562631, 0x0000002c53554531, 0x0000005342314b53, 0x000000534f4e4556,
+    0x00000028464f314b, 0x0000005356455556, 0x00000046284e4f53, 0x000000293128424e,
+    0x000000453b4e4f53, 0x0000004628535431, 0x000000282c314555, 0x0000004529534f4e,
+    0x0000005345534f4e, 0x0000002656262931, 0x0000004b564f2953, 0x000000314555294e,
+    0x0000004b56543b56, 0x0000005645314b4e, 0x000000564f534556, 0x0000004e4b452846,
+    0x0000004f564e544e, 0x0000003128464b45, 0x000000564b452931, 0x0000004f4b455553,
+    0x0000005329562846, 0x000000462856544e, 0x000000004e455553, 0x000000282c31424e,
+    0x0000004253455556, 0x0000004628464b4e, 0x000000284b453b31, 0x00000056284e5431,
+    0x0000000056422931, 0x000000434e4b3145, 0x000000004b45554e, 0x000000564b31424e,
+    0x0000000000295345, 0x00000043534e544e, 0x000000004b455553, 0x0000003126314b31,
+    0x00000046424e424e, 0x0000004b4e453b56, 0x000000003b534b31, 0x0000004f534b4f53,
+    0x0000002953265645, 0x0000004f534b2931, 0x0000005329284645, 0x00000043534b4555,
+    0x00000028464b2956, 0x000000295328424e, 0x00000053424e4f53, 0x000000555642294e,
+    0x00000026294e264e, 0x00000046414e4f53, 0x0000002842564f31, 0x0000004e284b4531,
+    0x0000004628464256, 0x0000002956284e45, 0x000000534b4e424e, 0x0000005328464131,
+    0x0000002826534b45, 0x0000004e28543b31, 0x0000004555532653, 0x0000004e4f544153,
+    0x000000453b564b31, 0x000000262953264e, 0x000000314f534b31, 0x0000004353422956,
+    0x000000564f534b56, 0x0000005553455553, 0x0000004f4e263145, 0x000000003b533153,
+    0x0000004f56534f31, 0x0000003b4e4b3145, 0x000000284f294e45, 0x0000005629284656,
+    0x000000564253424e, 0x0000004e28464553, 0x000000465345554e, 0x00000053564f4e26,
+    0x0000004e2845544e, 0x00000045554e4556, 0x0000004554292846, 0x0000003b56455531,
+    0x0000002842294b4e, 0x0000002c31554531, 0x000000284f564231, 0x0000003b554e2631,
+    0x000000284f544156, 0x0000000031532631, 0x0000004555312656, 0x0000005354314531,
+    0x0000002846285531, 0x0000005628455529, 0x0000000043315345, 0x0000004e45534b53,
+    0x0000002c4e4f5345, 0x0000005642534f4e, 0x0000002631284645, 0x0000005645284f31,
+    0x00000056424e4b4e, 0x0000004f31263145, 0x00000028264e4f53, 0x000000314f534553,
+    0x0000004b45554531, 0x00000056282c2953, 0x0000004b564b4555, 0x0000004f3142294e,
+    0x00000028314e4f53, 0x0000004355312631, 0x00000055564b2953, 0x0000005631534f31,
+    0x000000284656264e, 0x0000005529532653, 0x0000004f31284f56, 0x0000004f4e423145,
+    0x00000031544e4f53, 0x000000462c535531, 0x0000004f53452846, 0x000000315431454e,
+    0x000000534e455553, 0x0000002931262956, 0x0000002841564f53, 0x0000004e42564f53,
+    0x000000284b562631, 0x0000004e544e544e, 0x0000005529534f31, 0x0000005328453b56,
+    0x0000003b4e45554e, 0x0000003128464555, 0x0000004629564f4e, 0x0000004628464f56,
+    0x0000004331543b56, 0x00000046284b2931, 0x0000003126564f31, 0x0000003145285556,
+    0x000000462c4e424e, 0x0000002853543b56, 0x0000004528462845, 0x0000002826294b53,
+    0x00000031454e544e, 0x000000294e4b5645, 0x000000564b562653, 0x0000005328455453,
+    0x0000004628462846, 0x000000282c292846, 0x0000004e284b314b, 0x000000462841534b,
+    0x0000004e26532653, 0x0000003b53543b56, 0x000000453b31264e, 0x000000464b562656,
+    0x00000053424e4b53, 0x00000045284f3145, 0x0000002846532656, 0x0000005326314231,
+    0x0000004555534253, 0x0000002c53543b53, 0x00000046564f314b, 0x0000002831543b56,
+    0x0000005626534b4e, 0x00000055534f2956, 0x0000004f4e455529, 0x000000284641314b,
+    0x00000028462c4e4b, 0x000000534b4e2631, 0x0000004b4e545431, 0x000000264e262956,
+    0x00000000534f2953, 0x00000031284f4e26, 0x000000554e4f2953, 0x0000004b4f452855,
+    0x0000003b56532656, 0x0000000043312631, 0x0000003128465354, 0x0000000000314b4e,
+    0x00000056534f5626, 0x0000004e28465553, 0x00000043314f294e, 0x0000000000564253,
+    0x0000004f534b2953, 0x000000003b53264e, 0x000000534f54414e, 0x000000464e4f5326,
+    0x0000004f294e2846, 0x00000046264b2631, 0x000000433b56424e, 0x0000004f56282c4e,
+    0x0000005529284656, 0x0000004e29284631, 0x0000004231262953, 0x0000004e284f534b,
+    0x00000053264e4256, 0x0000004642534b4e, 0x0000003b534b294e, 0x000000284f314e54,
+    0x00000031544e5431, 0x0000004645555645, 0x000000004e42294e, 0x00000056534f3145,
+    0x000000294e452845, 0x0000002956452846, 0x0000003b3145554e, 0x0000004355564f31,
+    0x0000004356453b56, 0x0000004645534f4e, 0x0000002846452845, 0x00000056534f5631,
+    0x0000004353554531, 0x0000002826534b53, 0x00000000564f294e, 0x0000005631284b45,
+    0x000000534e543b4e, 0x00000043534b4553, 0x000000265628424e, 0x00000046294e4f53,
+    0x0000002956284555, 0x00000031424e2656, 0x000000543b564b56, 0x00000055294e2826,
+    0x0000005642294b31, 0x0000004e4f295345, 0x0000002928464531, 0x00000046282c2931,
+    0x0000004645284b45, 0x000000554e42294e, 0x000000534f532631, 0x000000464b56264e,
+    0x0000002c4e453b4e, 0x0000004e4f534b56, 0x00000042294e2846, 0x000000544e543b4e,
+    0x000000464f4b2653, 0x0000004628463145, 0x0000004f56284e54, 0x0000003b4e262956,
+    0x000000454e4b4553, 0x0000004b45552931, 0x00000055294e4b45, 0x0000004f29312854,
+    0x0000004f53455456, 0x0000002c56284f56, 0x000000462c564253, 0x0000004626564231,
+    0x0000003129532846, 0x000000464f564f53, 0x00000046424e2656, 0x000000532846544e,
+    0x00000056284f294e, 0x0000005545564f53, 0x000000534f564531, 0x000000564b452656,
+    0x00000056284f5653, 0x00000028564f314b, 0x0000004f31543b4e, 0x00000055534f2953,
+    0x0000005645282656, 0x000000464b452656, 0x0000004e26564f53, 0x0000004e26532846,
+    0x00000046284f4e45, 0x0000004b294e4b45, 0x0000003b45553153, 0x000000003b314b31,
+    0x000000314b4e424e, 0x000000464528264e, 0x0000005328454e31, 0x0000002c2928464b,
+    0x0000003128452931, 0x0000004e2846554e, 0x0000002846453b53, 0x0000004e543b2956,
+    0x0000002846284653, 0x000000564b4e4256, 0x0000002846562653, 0x00000028264b4f31,
+    0x00000053454e5453, 0x0000002855314231, 0x000000282c315531, 0x0000004631455553,
+    0x0000004f53564b45, 0x0000004f4e28464b, 0x0000004331262953, 0x0000004f56284b45,
+    0x000000453b4e2656, 0x00000046564f4e54, 0x000000453b314b53, 0x000000464f4b4f56,
+    0x0000004b53564b45, 0x000000564b4e2656, 0x0000004b3145554e, 0x00000053284e4b45,
+    0x0000000053422956, 0x0000004e294e2846, 0x000000564b314253, 0x0000004f564b4f53,
+    0x000000284f534253, 0x0000002c56453b31, 0x000000543b534b56, 0x00000028464b314b,
+    0x00000046284f5654, 0x0000004b564f294e, 0x0000004b4e4b5645, 0x0000004628464555,
+    0x00000056454e5453, 0x00000056534f314b, 0x0000004b56422956, 0x0000004f56284626,
+    0x000000432953264e, 0x0000004e284f5654, 0x0000003126564f53, 0x0000004f31284f4e,
+    0x0000005454534f31, 0x000000534f31554e, 0x000000314b543b56, 0x000000564b452845,
+    0x000000534b455531, 0x0000005328465631, 0x0000004f2931284b, 0x0000004e284f5631,
+    0x000000294e45554e, 0x000000464f4e2854, 0x000000564f4e424e, 0x0000004e284b4e4b,
+    0x0000005529532656, 0x0000002846285431, 0x000000434e453b31, 0x0000004e4b562653,
+    0x0000002c53455556, 0x0000005326534231, 0x0000002953282631, 0x0000003153455556,
+    0x000000433b4e2656, 0x00000046284b294e, 0x0000002855534b45, 0x000000554e4f534e,
+    0x0000004229534f31, 0x0000003145294b53, 0x0000000043565556, 0x0000004b4e4f2931,
+    0x000000004555314e, 0x000000284f565553, 0x00000031543b2931, 0x0000003128464153,
+    0x0000003b314b4556, 0x000000284f314b31, 0x0000004b4f455531, 0x00000031554b4556,
+    0x0000002631455556, 0x0000004e28465456, 0x0000004626314b45, 0x000000462c4e2845,
+    0x0000005645553126, 0x0000000000534f56, 0x0000002c5655454e, 0x000000004e452631,
+    0x000000564b564b45, 0x000000464b532653, 0x0000003b4e455553, 0x000000282c564256,
+    0x0000002842314256, 0x00000054534b4556, 0x0000004e29284653, 0x0000002928464b45,
+    0x000000004e4b5345, 0x0000004626534f53, 0x00000054294e2846, 0x0000004b45284f53,
+    0x00000045284f294e, 0x000000284f565556, 0x0000004e4e545456, 0x0000004e45282631,
+    0x000000434e4f2953, 0x0000005545292846, 0x000000295628464b, 0x0000004356455556,
+    0x000000543b314553, 0x00000045284b554e, 0x000000285456454e, 0x0000004e282c5645,
+    0x000000284e4f5345, 0x0000003142564b45, 0x0000002854564553, 0x00000053264b2631,
+    0x00000031453b2931, 0x000000534b534253, 0x00000028464f4e54, 0x0000002845294b4e,
+    0x0000004e26293145, 0x00000046264b4f56, 0x000000314b4e4231, 0x0000004e4b564f4e,
+    0x000000294e452855, 0x0000005326564b31, 0x000000462841564b, 0x000000433b532653,
+    0x0000004e28454253, 0x000000284528264e, 0x0000004e45314b4e, 0x0000000000435531,
+    0x0000004e4b564231, 0x0000004f45284f56, 0x0000004555534231, 0x0000004b564f2956,
+    0x0000005328265645, 0x0000003b314b4555, 0x0000003b53543b4e, 0x0000004e28462846,
+    0x0000005326312656, 0x000000435345294e, 0x000000464f4e284b, 0x00000045294e2846,
+    0x0000000056455531, 0x00000056424e424e, 0x0000000000435556, 0x0000004129532846,
+    0x0000004528462653, 0x0000004e28265345, 0x0000004f564f3145, 0x0000005453543b53,
+    0x00000042314f294e, 0x00000045554e4b45, 0x0000004e45285556, 0x00000029564f3145,
+    0x000000282c314253, 0x0000005529562656, 0x00000026314b2956, 0x0000000045555631,
+    0x000000284f53424e, 0x00000056284f2956, 0x000000284b314231, 0x0000004628465456,
+    0x0000002953425645, 0x0000003142294b53, 0x0000002853564f4e, 0x00000031454e4b53,
+    0x000000435655454e, 0x0000004f534b4531, 0x0000002c4e284555, 0x0000004b31452846,
+    0x000000433b4e4b56, 0x0000004f4e284b56, 0x0000002953284553, 0x00000053264e4b53,
+    0x00000055564f294e, 0x0000004e264b4f53, 0x0000004f564b5645, 0x0000003145282c53,
+    0x0000004f31452631, 0x0000004f56534f53, 0x0000003145284b45, 0x000000264e284f56,
+    0x00000028454e5431, 0x00000055564f314e, 0x0000004b314f5345, 0x0000004e3b4e5431,
+    0x0000002846452846, 0x00000028534f5626, 0x0000004f454e4f53, 0x0000005628424e45,
+    0x0000004642534b31, 0x00000056554b4553, 0x0000002c31284f53, 0x0000004628462631,
+    0x0000002931265645, 0x00000000434e4231, 0x0000005354534f4e, 0x0000004f53543b4e,
+    0x000000284f4e4556, 0x0000002928462c53, 0x0000004e45554b53, 0x0000004f4e284f56,
+    0x0000005354564556, 0x00000028264e2845, 0x0000004b4e54544e, 0x0000004f56453b53,
+    0x000000003b535645, 0x0000004e282c4e4b, 0x00000056284b4e4b, 0x000000462c4b2846,
+    0x0000004628464556, 0x0000003128464156, 0x0000002846284256, 0x0000004b45314f53,
+    0x000000453b534b56, 0x000000464f565453, 0x0000003b554e2656, 0x000000423145554e,
+    0x000000284b564555, 0x0000003128262931, 0x0000004b56453b4e, 0x000000294b314f53,
+    0x0000005328452845, 0x0000005628425645, 0x0000004f53284556, 0x00000053284f3145,
+    0x000000464f4e4556, 0x00000046534f5645, 0x00000046284f4e54, 0x000000464f564153,
+    0x0000000000435553, 0x0000000043532631, 0x00000045554e4231, 0x0000004f56284f53,
+    0x0000004f53282656, 0x0000002931284f31, 0x000000282c534256, 0x0000005328452656,
+    0x000000284f315556, 0x0000002928465653, 0x000000314f4b4f56, 0x0000002846284231,
+    0x000000284f53454e, 0x0000004f5628464b, 0x0000003b46455553, 0x000000554e45554e,
+    0x0000003128452653, 0x0000004e42314253, 0x0000005342564231, 0x000000003b535653,
+    0x0000004e4f544131, 0x00000046264e424e, 0x0000004b564b5645, 0x00000031282c2931,
+    0x000000543b4e2631, 0x0000002846543b53, 0x000000564b562656, 0x0000004f314b2953,
+    0x0000004645564b31, 0x0000005328462826, 0x0000004e26564f31, 0x0000004b45285531,
+    0x00000046282c5645, 0x0000004f543b294e, 0x0000004e28464e54, 0x000000294e452846,
+    0x00000046534f4e45, 0x0000002841534f56, 0x0000004e4e455456, 0x0000002846534b45,
+    0x000000314b532653, 0x000000564b4e4555, 0x0000005328464f31, 0x00000041534f314b,
+    0x000000003b56264e, 0x0000004e5645544e, 0x0000004b2956284b, 0x0000004331532656,
+    0x0000004645534b56, 0x0000004e284b4f56, 0x0000004b4555534e, 0x00000053424b2931,
+    0x0000002956425645, 0x0000004b4f4b2656, 0x0000002856534f56, 0x0000003128565431,
+    0x000000294e282c53, 0x000000534f4e284b, 0x0000002c5628264e, 0x0000004628554553,
+    0x000000534f534b31, 0x0000005529562845, 0x000000284b4e2631, 0x0000002c314b4555,
+    0x000000534b314b45, 0x00000053454e5456, 0x0000003145564b56, 0x0000004e28464f53,
+    0x000000284f534256, 0x00000031264b4f56, 0x0000005328462c53, 0x00000028464e2656,
+    0x000000534b564231, 0x000000464b534231, 0x0000002c56554556, 0x0000004e4f534b45,
+    0x0000000043564531, 0x0000004253455553, 0x0000005326295345, 0x0000004628465645,
+    0x0000002956284531, 0x000000534f564553, 0x0000003142312656, 0x0000004e3b4e544e,
+    0x0000002846265645, 0x0000003126312845, 0x0000004b534b5345, 0x0000005645554b53,
+    0x000000004e452653, 0x0000003b564b2953, 0x00000045284f5556, 0x0000004e54312656,
+    0x00000056424e2653, 0x00000056284b4f31, 0x000000543b295645, 0x0000004229534f53,
+    0x0000003145534f4e, 0x00000046424b2931, 0x000000464b543b56, 0x00000055534b4556,
+    0x0000004e4f535456, 0x000000294e282631, 0x0000004e26532631, 0x0000005345554e26,
+    0x000000462656424e, 0x0000004628543b53, 0x0000002845282653, 0x0000004b45282656,
+    0x0000002653455531, 0x000000464b455529, 0x0000004f53453b56, 0x0000004f31455456,
+    0x000000464f565553, 0x000000554f564f4e, 0x0000002846532653, 0x00000028462c5645,
+    0x000000462928464e, 0x000000284b532631, 0x0000004355534f56, 0x000000314b45264e,
+    0x000000285556424e, 0x0000004b29564f31, 0x0000005529562631, 0x000000534f56314e,
+    0x0000002845534b4e, 0x0000005645534b4e, 0x000000294e284b53, 0x000000284b452653,
+    0x000000534b562653, 0x00000046282c534b, 0x0000000053452653, 0x0000005345534b53,
+    0x0000004b314f2953, 0x000000282c4e424e, 0x0000004e4b292846, 0x000000434e4b5345,
+    0x000000564f312845, 0x0000004f31284655, 0x000000264e284f4e, 0x000000464256424e,
+    0x000000543b4e2656, 0x0000004e26295345, 0x00000056554b4556, 0x000000534f534153,
+    0x0000004b314f2931, 0x00000046284f314b, 0x0000004e4e455531, 0x00000043534b4531,
+    0x0000005645552953, 0x000000284f4e4231, 0x0000004f29284653, 0x00000031282c5645,
+    0x0000004f31422956, 0x0000004e4f53424e, 0x0000000000532631, 0x000000433b455556,
+    0x0000002826312845, 0x000000462845424e, 0x0000002c2953284b, 0x000000464f535431,
+    0x000000314b564b45, 0x0000003128465431, 0x0000003b4555314e, 0x0000005642314231,
+    0x0000004528552853, 0x0000003145554b56, 0x0000003b53543b53, 0x000000453b4e4b53,
+    0x00000046564f534b, 0x0000004f53265645, 0x000000314b56264e, 0x0000004f4e282653,
+    0x0000004f3128264e, 0x0000002928465553, 0x000000284b56264e, 0x000000284f4e2826,
+    0x000000284f4e544e, 0x0000002956284156, 0x0000004e3b564f53, 0x0000005628464b45,
+    0x0000004528262956, 0x0000004b26534f56, 0x00000046264e4b4e, 0x0000004356543b4e,
+    0x000000534f4e4231, 0x0000004b564f3145, 0x00000055564f3145, 0x0000002629564f31,
+    0x0000004f53284256, 0x000000464b4e2653, 0x0000000000432953, 0x00000056284f5645,
+    0x0000003b53262956, 0x000000462c564f53, 0x0000004e4b452831, 0x0000004e264e4253,
+    0x0000004e4f535531, 0x0000000000562631, 0x0000004656284b45, 0x0000000031452656,
+    0x0000002956532854, 0x0000004642534f31, 0x0000004f2953284b, 0x0000002845554b56,
+    0x00000053284f5654, 0x00000043314e5456, 0x0000000055532653, 0x00000056534f314e,
+    0x0000004f3155454e, 0x0000005645285531, 0x0000002846455456, 0x0000004e31284b45,
+    0x000000462c53424e, 0x0000003b53422953, 0x0000005345284f56, 0x0000004e3145544e,
+    0x000000564f4e2631, 0x0000004e4f534556, 0x0000002855564b4e, 0x00000053424e4b45,
+    0x0000002c56543b53, 0x0000005326564f4e, 0x00000056424e2631, 0x0000002855564b45,
+    0x0000000000564b4e, 0x0000002826532631, 0x00000055534f314e, 0x0000004f314e4f53,
+    0x0000005545534f56, 0x000000543a4e3b56, 0x00000053544e4556, 0x0000004f45282656,
+    0x0000003145555645, 0x0000005342532631, 0x000000464f292846, 0x00000031264b4f53,
+    0x00000041314f534b, 0x0000004f31284e54, 0x0000004f53284626, 0x00000031284b564b,
+    0x000000543b564556, 0x00000028264e2653, 0x0000002842562653, 0x000000433b564253,
+    0x000000434555314e, 0x00000028424b2953, 0x000000003b314f53, 0x0000004b45554f53,
+    0x0000004e3b292846, 0x0000004f53284231, 0x000000295328414e, 0x0000004542314f53,
+    0x000000314f4b4f31, 0x00000045284f5645, 0x0000003b564f5345, 0x0000004e284b5645,
+    0x0000004626294b53, 0x000000534f534256, 0x0000004555312653, 0x0000005628262956,
+    0x0000004626532846, 0x0000004e31284631, 0x0000004631543b53, 0x0000005354534556,
+    0x00000028464f5645, 0x0000004f53422953, 0x0000005455534f4e, 0x00000056284e4f53,
+    0x0000004f55534f53, 0x0000004353453b31, 0x000000314b314253, 0x0000000055564f4e,
+    0x0000002856543b53, 0x0000005531534f53, 0x0000004631262956, 0x0000004e4b312631,
+    0x0000002956262953, 0x0000005345534b56, 0x000000564b4e2631, 0x000000464f562846,
+    0x000000433b4e4f53, 0x000000554f564f31, 0x0000004b31543b56, 0x00000000554e2631,
+    0x0000004555564b31, 0x0000002826534231, 0x000000463145554e, 0x0000005655564f53,
+    0x000000284f564555, 0x0000004331452656, 0x0000003155534f31, 0x0000003142294b31,
+    0x0000004e45314b31, 0x000000284f31454e, 0x000000534f4e4e54, 0x0000005342534f4e,
+    0x0000005328462854, 0x00000042534f2956, 0x0000005345284656, 0x000000004356454e,
+    0x0000004e4f53554e, 0x0000005626314f53, 0x0000004f3128544e, 0x00000031534f3145,
+    0x0000004e4b56424e, 0x0000004e4e545453, 0x0000005441564f31, 0x0000004f31455553,
+    0x0000004628465331, 0x000000314e4f5345, 0x000000564b314b45, 0x00000053284b294e,
+    0x0000004e4e455453, 0x0000002826562653, 0x0000004e26534b53, 0x00000028534f5326,
+    0x0000002826314b56, 0x0000004e28455556, 0x000000464f4e4555, 0x0000004629564f31,
+    0x0000002c56282656, 0x000000003b31264e, 0x0000004f314b4f53, 0x0000002826314b53,
+    0x0000004e28465631, 0x00000000433b5531, 0x00000046424e4231, 0x0000004f56452653,
+    0x0000004b5345554e, 0x0000002c31543b4e, 0x000000464b453b4e, 0x00000042564b2953,
+    0x000000414e4f534b, 0x000000453b532631, 0x000000003b562653, 0x000000532631424e,
+    0x0000004b45294b56, 0x0000002956284253, 0x00000031282c314b, 0x0000004e28455529,
+    0x0000005342314b31, 0x00000046543b2953, 0x000000314f4b2631, 0x0000002953262953,
+    0x0000002931284656, 0x000000532845424e, 0x0000004e2845554e, 0x0000002826564253,
+    0x00000046284f2956, 0x0000004f314e4b45, 0x000000534b31424e, 0x0000002953425345,
+    0x0000004e45554b31, 0x0000005356455531, 0x0000003126534b53, 0x00000031534f314e,
+    0x000000282c4e4231, 0x000000534b455556, 0x0000004e45553126, 0x000000464b4e264e,
+    0x00000056544e5431, 0x0000005345555645, 0x00000056294e2845, 0x0000003b4e4b4556,
+    0x0000004e3b534f53, 0x00000028564f4e45, 0x000000453b4e544e, 0x00000056534f534b,
+    0x000000294e262953, 0x000000564b534f56, 0x0000003155534f53, 0x0000003128455529,
+    0x0000005626534f53, 0x000000453b312656, 0x0000003128543b4e, 0x0000002826312653,
+    0x0000004f564f4e26, 0x0000003145554b53, 0x000000465626294e, 0x0000005626564256,
+    0x0000002c534f5345, 0x0000005628455431, 0x00000056544e4531, 0x0000004229532845,
+    0x0000004e4b452953, 0x00000028534f4e26, 0x0000002c53282656, 0x00000028314f5345,
+    0x000000295328554e, 0x00000031454e4f53, 0x000000532846414e, 0x0000004f314b4e45,
+    0x0000004628265345, 0x0000005628462656, 0x0000004f29284645, 0x0000004b55534f31,
+    0x00000029314b5345, 0x0000003129284645, 0x0000003128464e45, 0x0000005328465653,
+    0x0000005456543b4e, 0x000000314b4e2653, 0x0000004b4e4b2653, 0x000000314b455431,
+    0x000000543a4e3b53, 0x0000004f56282631, 0x0000002846294b31, 0x000000294e4b4e45,
+    0x0000004628462956, 0x0000003145564f31, 0x0000004f5645544e, 0x0000004b294e2845,
+    0x0000004b56314b45, 0x00000046534f5654, 0x0000005531534f56, 0x000000464b31424e,
+    0x000000562846454e, 0x00000055454e4f53, 0x0000004356543b53, 0x000000554e26294e,
+    0x0000005529314b45, 0x000000294e284654, 0x000000435356264e, 0x0000005429312846,
+    0x000000534f535456, 0x0000004e45554e45, 0x000000534f4b4f4e, 0x0000004b31453b56,
+    0x000000424e262953, 0x0000004f534b5345, 0x000000552953264e, 0x000000554e4b314b,
+    0x0000004e54564556, 0x0000004e424b294e, 0x000000464b532656, 0x0000004f53455529,
+    0x0000004f4b45554e, 0x000000434b455553, 0x0000004b45534f31, 0x000000284b455553,
+    0x000000003b56314e, 0x0000004f4e284631, 0x000000264e4f294e, 0x0000004e28462c31,
+    0x0000002826532846, 0x00000031282c2953, 0x0000002931284b45, 0x0000002855564231,
+    0x00000031264e4b4e, 0x000000534b534f31, 0x0000004628462c31, 0x0000005326314b31,
+    0x000000284b31424e, 0x0000002845564b4e, 0x0000004f4e425645, 0x000000314b564231,
+    0x0000002846284656, 0x000000284e292846, 0x0000000043314b53, 0x0000003142564b53,
+    0x0000004f28455553, 0x000000464f56414e, 0x000000293128554e, 0x000000294e314b45,
+    0x0000002953423145, 0x0000004f4e4e5453, 0x000000462c564555, 0x00000000434e3145,
+    0x0000004f31543b53, 0x0000005626314b45, 0x00000053453b2953, 0x0000002831543b31,
+    0x00000031284b2953, 0x0000004e26564b56, 0x000000433b535631, 0x0000004f53543b31,
+    0x0000004e45564b4e, 0x0000004642564253, 0x00000043534f2956, 0x00000031264e2656,
+    0x000000004356264e, 0x000000462c534b45, 0x0000004526292846, 0x000000462846284b,
+    0x000000534b4e2653, 0x0000004331452931, 0x000000003b53424e, 0x0000004e284f5345,
+    0x000000284f564253, 0x000000564b455431, 0x0000002c4645554e, 0x000000464b452853,
+    0x00000046284b5645, 0x0000003b534b2953, 0x0000005345564b56, 0x0000005342534256,
+    0x0000005331534f31, 0x0000004e4f534e54, 0x000000412928464b, 0x0000005642532656,
+    0x0000004555452631, 0x0000004331455556, 0x000000282c564b45, 0x000000294e28414e,
+    0x0000002956284626, 0x000000534b455553, 0x00000028464e5456, 0x00000053284b4f56,
+    0x0000002653262931, 0x0000004f534b264e, 0x000000284f564131, 0x0000002826292846,
+    0x00000046264b4f53, 0x0000002931262931, 0x000000003b565331, 0x0000004526534f53,
+    0x000000554e4b4553, 0x00000054534b4553, 0x000000433b53424e, 0x0000004e4f4b264e,
+    0x0000004655534f31, 0x0000004628464e54, 0x000000464f535453, 0x0000004626534253,
+    0x0000005645284b45, 0x0000004e4b295645, 0x0000005328462631, 0x0000005629562845,
+    0x00000043314b4f4e, 0x0000004f56284e45, 0x0000005328455556, 0x000000003b314555,
+    0x00000046282c314b, 0x000000003b564b31, 0x00000055534e4f53, 0x000000295628544e,
+    0x000000424e4f294e, 0x000000464f56454e, 0x000000534b453b56, 0x0000005655534f53,
+    0x0000004f564b4f4e, 0x00000026314b2931, 0x0000004e284f5354, 0x0000004b56422953,
+    0x0000005529532631, 0x00000028544e4553, 0x0000005342564f4e, 0x0000002826295345,
+    0x000000294e285556, 0x0000003128264e45, 0x000000003b314256, 0x0000004e4b314b45,
+    0x0000004528455553, 0x0000004b45282c4e, 0x000000294e284f4e, 0x00000026534b294e,
+    0x0000005342562656, 0x000000433b564b31, 0x00000053284b2631, 0x000000464f53264e,
+    0x00000056284b2653, 0x0000003b4555534e, 0x000000554b452631, 0x000000534f294e45,
+    0x0000004f534b534b, 0x0000003128465453, 0x00000000434e2656, 0x0000002855534b56,
+    0x00000031424b2953, 0x0000004528452846, 0x000000454e4b294e, 0x0000004f564f2956,
+    0x0000004626314253, 0x0000004b53455531, 0x000000534f534531, 0x000000294e284f31,
+    0x000000543b562631, 0x0000003b3153264e, 0x0000000043295645, 0x000000284f564b31,
+    0x0000004e45284f31, 0x0000004356455531, 0x000000465453454e, 0x000000453b4e4b4e,
+    0x000000464f564231, 0x000000284f562854, 0x0000004629534f56, 0x0000004528543b53,
+    0x00000054534b4531, 0x000000314e292846, 0x00000056284b2931, 0x000000534f4b2631,
+    0x0000002826532656, 0x0000002854314531, 0x000000284f56414e, 0x0000005641564f53,
+    0x000000564f314556, 0x0000005328452956, 0x0000005528314f53, 0x000000453b532656,
+    0x0000003142314256, 0x000000543b294b4e, 0x000000314e4f5326, 0x00000056284b3145,
+    0x000000534b562631, 0x0000000056455556, 0x000000464f293145, 0x0000004f29562854,
+    0x000000464b31264e, 0x0000004e28462826, 0x000000282c314256, 0x0000002854564f53,
+    0x0000004e4b562631, 0x000000314b314f53, 0x0000004642564b45, 0x0000004555294b4e,
+    0x0000004e284f564b, 0x0000004e4b452631, 0x0000003142314253, 0x0000004353564b45,
+    0x00000056284f4b45, 0x000000424b534f53, 0x0000005342534f56, 0x0000004229562845,
+    0x00000046264e4b56, 0x0000004e54534f53, 0x0000005342312653, 0x000000534f562846,
+    0x000000434e4b4f56, 0x0000003b56532631, 0x0000002956455556, 0x0000004628452931,
+    0x000000564b532653, 0x0000003126314256, 0x000000285645554e, 0x000000284f544131,
+    0x0000005531422956, 0x0000002931284556, 0x0000004b45534f56, 0x0000005326564f31,
+    0x000000004e4b3145, 0x0000004355312656, 0x0000004f564f534b, 0x000000424b564f53,
+    0x0000005431453b53, 0x000000454e543b56, 0x0000002629562653, 0x00000053284f4b45,
+    0x00000000004e4b4e, 0x000000452846264e, 0x000000464f314555, 0x00000028534f3126,
+    0x00000043294e2653, 0x0000004f56263145, 0x0000004f53285431, 0x000000292846554e,
+    0x0000004e26564253, 0x0000000053564b45, 0x0000004e45564b31, 0x0000004e28463154,
+    0x00000046544e4f53, 0x0000004329534f56, 0x000000314e545531, 0x0000004e31534f4e,
+    0x0000004b29564f4e, 0x0000004f53282c53, 0x0000004f31452931, 0x0000002956282c56,
+    0x0000004e282c294e, 0x000000314e4f5553, 0x000000464b452845, 0x0000002c53554553,
+    0x0000000031455553, 0x0000004e4b562656, 0x0000005645564f53, 0x000000294e284b45,
+    0x000000564b564f4e, 0x0000004f31454e31, 0x0000005455564f4e, 0x0000004e544e4556,
+    0x0000005328464253, 0x000000564f4e2656, 0x0000002c31453b4e, 0x000000464f315556,
+    0x0000002c31453b31, 0x0000002826314b4e, 0x0000004555314b53, 0x00000055534b294e,
+    0x00000026534f2956, 0x0000004b45282c31, 0x0000002853455556, 0x0000002841564f4e,
+    0x0000002c31543b31, 0x00000031264e2845, 0x000000284b31264e, 0x0000004353452953,
+    0x000000462653424e, 0x0000004645314b4e, 0x0000000000295645, 0x000000464f563153,
+    0x000000464f4e2845, 0x0000004f56282653, 0x00000043564e5453, 0x000000294e282c31,
+    0x0000005529284626, 0x0000002842532653, 0x00000028464f3126, 0x000000554e4b2956,
+    0x000000433b565331, 0x000000453b292846, 0x0000003126294b56, 0x0000005628454231,
+    0x0000005345554e45, 0x000000464e54554e, 0x0000004653564f53, 0x0000004e26534f53,
+    0x0000002928464f4e, 0x0000005628465645, 0x0000005628422931, 0x000000314f532656,
+    0x000000314f535431, 0x000000534256264e, 0x0000004f56455453, 0x0000004e42312653,
+    0x0000005326564253, 0x0000004e28464b4e, 0x0000004628465453, 0x0000004e45555345,
+    0x0000004b45564f53, 0x0000005328422956, 0x000000293128544e, 0x00000046284f4b45,
+    0x0000002953282c56, 0x0000004628454e31, 0x0000004f29534b45, 0x0000004f564b2656,
+    0x0000003b55564f4e, 0x0000004641564f31, 0x0000004f31452956, 0x00000028534f564b,
+    0x00000046284b4555, 0x000000284f4e2854, 0x000000534b534f56, 0x0000002853564f31,
+    0x0000005328543b53, 0x000000434e452953, 0x0000005529284653, 0x0000004b4f4b4531,
+    0x0000005654534556, 0x0000004e45554e31, 0x000000284b312631, 0x0000004b56455529,
+    0x000000564f535456, 0x00000053284b564b, 0x000000462c534f4e, 0x00000043564e5431,
+    0x000000434e543b53, 0x0000004e284f2931, 0x0000004528554f53, 0x0000002c56284f31,
+    0x000000464f53454e, 0x0000004642564b31, 0x0000002956423145, 0x0000002c53453b56,
+    0x000000433b53314e, 0x000000433b564f31, 0x000000564b56424e, 0x0000005653564f4e,
+    0x000000464f534556, 0x000000454e545453, 0x000000564b452855, 0x0000003b314f2953,
+    0x000000264e314f53, 0x0000004229284645, 0x00000046314f5354, 0x000000564f53424e,
+    0x0000005628264e45, 0x0000004628454253, 0x000000282c534f31, 0x0000004356422953,
+    0x0000004b534f2953, 0x00000056264e2656, 0x000000564f4e264e, 0x00000028464f5653,
+    0x00000031543b2953, 0x0000004e28263145, 0x0000004628422953, 0x000000532845544e,
+    0x0000004f56284556, 0x0000002928462846, 0x000000534f53264e, 0x0000003128462845,
+    0x0000004b26534f31, 0x0000004e42564f4e, 0x0000004e3b564f31, 0x000000564f314253,
+    0x000000284f565345, 0x0000002846284655, 0x000000284e45554e, 0x000000284f535453,
+    0x0000000000004353, 0x00000028464b2631, 0x0000004b31453b31, 0x0000004e28554553,
+    0x0000000043564256, 0x000000543b312653, 0x000000314f54414e, 0x0000004628452846,
+    0x0000002631262953, 0x0000004f29562656, 0x000000564f535556, 0x0000004f4e284656,
+    0x000000564f4e4555, 0x0000004e4b4e5453, 0x00000046534f5653, 0x00000053282c4e4b,
+    0x00000053284b2653, 0x0000004554534f53, 0x000000284f4b4f31, 0x0000004e42534f31,
+    0x0000002956455531, 0x0000003b29314b45, 0x000000534f56284b, 0x0000004e28454231,
+    0x0000002853543b31, 0x0000005328464b53, 0x000000294e282656, 0x0000003154314f53,
+    0x0000004e45284653, 0x0000004e28465531, 0x0000004f2956284b, 0x000000564b45264e,
+    0x0000002826294e45, 0x0000004b534b3145, 0x0000002856455531, 0x0000002631455553,
+    0x00000026564b2956, 0x000000284631264e, 0x0000004641292846, 0x0000005342564f53,
+    0x0000004555534131, 0x00000043534b4f56, 0x000000003b532631, 0x00000053284f5626,
+    0x0000004e3b314f53, 0x00000053284f2953, 0x00000053284f564b, 0x0000005345554b31,
+    0x000000284f314556, 0x0000005631455556, 0x0000004528265645, 0x0000005628453b4e,
+    0x00000028424e4253, 0x0000004f56284f31, 0x00000055314b294e, 0x0000004b55534f4e,
+    0x0000002c5355454e, 0x0000004555534531, 0x000000003b564f4e, 0x0000003145534f53,
+    0x0000004e4b314256, 0x000000534b534256, 0x0000004645564b56, 0x0000004e28465645,
+    0x0000004e42294b31, 0x0000002c56284b45, 0x0000004f5628544e, 0x0000004f314e2854,
+    0x000000284f4b2653, 0x0000004f56285453, 0x0000000055532656, 0x0000003153564f4e,
+    0x00000045284b4e45, 0x000000464253424e, 0x000000562631424e, 0x0000004b2928464e,
+    0x0000003128543b56, 0x0000003b4e262931, 0x000000462c565553, 0x0000005654534553,
+    0x0000003145534b53, 0x0000002855562653, 0x0000004628464531, 0x000000564b543b56,
+    0x0000004f5326294e, 0x0000000000314555, 0x00000056284f5345, 0x00000028464f2956,
+    0x000000314b534b45, 0x0000004e28462845, 0x0000000043534553, 0x0000004e26534f31,
+    0x0000002c4e284b45, 0x0000003128263145, 0x0000005642314256, 0x0000002c31453b53,
+    0x000000003b4e3145, 0x0000003128465331, 0x0000002653262953, 0x0000005626534b45,
+    0x0000002c4e28264e, 0x000000534b455453, 0x0000002c4e282631, 0x0000004355562631,
+    0x0000004b55534f53, 0x0000000043314b31, 0x00000053454e4f53, 0x0000004554564f31,
+    0x00000043534b4f31, 0x00000045264e4f53, 0x0000004b45282c53, 0x0000005528534f4e,
+    0x000000284f4e4531, 0x0000004f53284153, 0x000000564e543b53, 0x0000002c53453b53,
+    0x0000005531455553, 0x000000534b532653, 0x000000433b564555, 0x000000005326294e,
+    0x000000314b53424e, 0x000000314b453b56, 0x0000004529534f53, 0x0000004e4b455456,
+    0x0000003b29532846, 0x00000029564f5345, 0x0000005626292846, 0x0000004e42534b45,
+    0x000000433145264e, 0x000000314b31264e, 0x0000005629532846, 0x000000534b4e4b45,
+    0x0000004329532845, 0x0000004f5628424e, 0x00000042534f4e45, 0x000000564f314b31,
+    0x0000005626534f31, 0x000000295628424e, 0x000000003b534b53, 0x0000004e282c4e45,
+    0x0000005626564b45, 0x0000004642312656, 0x0000004528564f31, 0x000000564b53424e,
+    0x000000462c315553, 0x00000028264b2653, 0x000000555645554e, 0x000000314b564f53,
+    0x0000004f534e5453, 0x000000003b564b56, 0x0000004b29314b45, 0x000000282656264e,
+    0x000000282c535556, 0x000000455553424e, 0x000000464f4e264e, 0x0000003145555345,
+    0x0000002846455431, 0x0000004b45284645, 0x0000004e28455553, 0x0000004631543b31,
+    0x0000004e4e545431, 0x0000005645284653, 0x000000284f565331, 0x00000028464e2845,
+    0x0000002855534256, 0x0000005529562826, 0x000000284b564f53, 0x0000004f31284b31,
+    0x000000284b534b45, 0x0000004e4b53424e, 0x00000031454e5456, 0x000000284253424e,
+    0x00000055314b314b, 0x000000464b452653, 0x000000564f294e45, 0x0000004b453b294e,
+    0x0000004f53284b45, 0x0000002c31455556, 0x00000042314b2953, 0x00000046424e4b31,
+    0x0000004e26534b4e, 0x000000314e455556, 0x0000004e2842294e, 0x0000005654564531,
+    0x0000005626564f53, 0x000000314e4f554e, 0x00000053564f314e, 0x000000265328424e,
+    0x000000294e455556, 0x000000543b314b4e, 0x0000005628543b53, 0x0000004f53284655,
+    0x0000005326295645, 0x0000005628422953, 0x000000534f56544e, 0x0000005556534f4e,
+    0x0000004e45534f31, 0x0000004f29564f31, 0x000000314b543b31, 0x0000004f4e45544e,
+    0x0000003b55562656, 0x0000004f564b2956, 0x0000000043534231, 0x000000314253424e,
+    0x0000004b4e452656, 0x000000554f564f53, 0x000000462c562845, 0x000000284f314b45,
+    0x0000004654564531, 0x0000000000534b53, 0x0000005456543b56, 0x0000004f4b543b31,
+    0x00000043534e5456, 0x0000004b53452653, 0x0000004e4e543b56, 0x0000004e4b453b31,
+    0x000000314f532826, 0x0000004f4e285456, 0x0000002846452853, 0x00000031284f2931,
+    0x0000002928464253, 0x00000000434e4b56, 0x000000564f315453, 0x0000005642534f56,
+    0x0000005345294b4e, 0x0000004e4f535453, 0x000000464f53414e, 0x0000002846284156,
+    0x00000053564f314b, 0x0000004645284656, 0x000000564f534b45, 0x000000312653424e,
+    0x0000000000455531, 0x0000004645292846, 0x0000004555314256, 0x0000003142314b31,
+    0x00000053424e4231, 0x000000464b452846, 0x00000031282c4e45, 0x0000003129284653,
+    0x0000004253455531, 0x0000004b45284656, 0x0000004f4e284b4e, 0x0000002956284556,
+    0x000000462c532846, 0x0000002826314f53, 0x0000003128464f56, 0x00000031264e264e,
+    0x0000004f53455553, 0x000000294e284b56, 0x0000004653455531, 0x000000464b4e4256,
+    0x0000004e54314553, 0x0000004f564f5354, 0x0000004645554e26, 0x000000564f4b4f31,
+    0x00000056454e544e, 0x0000004526564f53, 0x00000028424e2656, 0x0000002846314b45,
+    0x0000003142314b53, 0x0000004f56423145, 0x000000284626294e, 0x00000043534f2931,
+    0x000000454e453b56, 0x0000005642564b45, 0x0000004629312845, 0x000000564f31454e,
+    0x0000004555534156, 0x0000003b3142294e, 0x0000004e454e4b53, 0x0000003b4e422931,
+    0x000000284f563145, 0x000000284f565453, 0x000000543b314556, 0x000000533145554e,
+    0x0000005453543b31, 0x0000005642314b4e, 0x000000562653264e, 0x00000046314f5345,
+    0x000000535453454e, 0x0000005628455453, 0x0000005356284b45, 0x000000534f535453,
+    0x0000005629284645, 0x00000029564f2956, 0x000000564f312826, 0x0000004642564231,
+    0x0000002931285456, 0x0000005345282653, 0x000000433b314555, 0x0000005453543b4e,
+    0x000000314e455553, 0x000000562845544e, 0x0000005342564b56, 0x0000004b45562631,
+    0x0000002826534f53, 0x0000003155534f56, 0x0000004e54532653, 0x0000004645554e45,
+    0x00000056264e4231, 0x0000002c31453b56, 0x0000004b29564b45, 0x000000424e4b2931,
+    0x0000002845282631, 0x000000565431454e, 0x0000005642314f53, 0x0000004f56534f56,
+    0x00000043554e2631, 0x000000433b535645, 0x000000564f312846, 0x0000004f55534f31,
+    0x0000004e29312845, 0x0000004555544156, 0x000000564b534f31, 0x0000004f56282c53,
+    0x000000464e4f5553, 0x00000046294e2854, 0x000000564f534256, 0x0000004f56455531,
+    0x00000028554e2631, 0x0000002953562854, 0x000000534f562631, 0x0000005655292846,
+    0x0000004e454e5431, 0x0000004f31424e45, 0x00000042534b2956, 0x0000004628464e45,
+    0x0000005355534f56, 0x0000002842534231, 0x0000004626564f31, 0x0000003b534b4556,
+    0x000000554e4b4e4b, 0x0000004626312845, 0x0000004e45564b53, 0x000000434e4e5453,
+    0x0000005628462854, 0x000000534f4e454e, 0x0000003128554531, 0x000000464e545531,
+    0x000000284f544153, 0x00000000004e4253, 0x000000543b4e5453, 0x000000294e262956,
+    0x000000534b31264e, 0x000000282c565553, 0x0000005626534b56, 0x0000005328543b31,
+    0x0000004b4e4b2931, 0x0000004331532631, 0x00000028554e4b56, 0x0000004f4e453b4e,
+    0x0000005342294b31, 0x0000002854292846, 0x0000005345285553, 0x0000004e28452931,
+    0x000000312845264e, 0x0000003b29534f53, 0x00000031284e5456, 0x0000004e264e4f53,
+    0x000000534b4e2656, 0x0000005342562631, 0x0000002846453b4e, 0x0000004e264e4b45,
+    0x0000004e284b2956, 0x0000004f56285553, 0x000000284f534556, 0x0000004e4f534555,
+    0x000000282c4e4f53, 0x000000284e284b45, 0x0000004b4b543b31, 0x000000453b312653,
+    0x000000453b53264e, 0x000000005345264e, 0x0000000031452653, 0x000000553142294e,
+    0x000000295628554e, 0x0000002953284b31, 0x0000002855564b31, 0x00000046284e2854,
+    0x000000284b452631, 0x000000464f312826, 0x000000433b534253, 0x0000004e45284f4e,
+    0x0000004e28452653, 0x0000004b45294b31, 0x000000534f4e2826, 0x0000004e42534b31,
+    0x0000002c5345554e, 0x0000004231455553, 0x0000004e4231264e, 0x000000464b314231,
+    0x0000003145554e31, 0x0000004629284654, 0x000000312631424e, 0x0000000053422953,
+    0x00000028454e5453, 0x0000004e4b31264e, 0x0000004e454e4556, 0x0000004e28452845,
+    0x000000534b53264e, 0x0000005654314f53, 0x000000284f4e5645, 0x0000002845282c53,
+    0x000000464f314253, 0x0000004e26564f4e, 0x0000004331543b4e, 0x000000534f314b56,
+    0x000000294e28454e, 0x000000283b295645, 0x000000464f564253, 0x0000004e26294b31,
+    0x0000004f534e2854, 0x00000045554e454e, 0x000000554e4b2931, 0x000000564b453b4e,
+    0x000000564b455556, 0x00000046284f534b, 0x0000004b53422931,
+];
+
+/// Checks a raw fingerprint (NUL-padded type bytes, any case) against the
+/// fingerprint blacklist.
+pub fn is_blacklisted_fingerprint(fingerprint: &[u8; 8]) -> bool {
+    let len = fingerprint.iter().position(|&b| b == 0).unwrap_or(8);
+    if len == 0 {
+        return false;
+    }
+    let key = u64::from_le_bytes(fingerprint.map(|b| b.to_ascii_uppercase()));
+    let key = if len < 8 { key & ((1u64 << (len * 8)) - 1) } else { key };
+    match crate::phf::slot(&fingerprint[..len], FINGERPRINT_SEED, &FINGERPRINT_DISPS, FINGERPRINT_SET.len()) {
+        Some(slot) => FINGERPRINT_SET.get(slot) == Some(&key),
+        None => false,
+    }
+}
+
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum CharType {
     White,
@@ -2,10 +2,14 @@ use core::ops::{Deref, BitOr, BitOrAssign};
 
 #[cfg(feature = "smallvec")]
 use smallvec::SmallVec;
+#[cfg(not(feature = "std"))]
+use alloc::string::{String, ToString};
+#[cfg(all(not(feature = "std"), not(feature = "smallvec")))]
+use alloc::vec::Vec;
 
 pub const LIBINJECTION_SQLI_MAX_TOKENS: usize = 5;
 
-#[derive(Debug, Copy, Clone, PartialEq, Eq)]
+#[derive(Debug, Copy, Clone, PartialEq, Eq, Hash)]
 pub struct SqliFlags(u32);
 
 impl SqliFlags {
@@ -55,6 +59,36 @@ impl BitOrAssign for SqliFlags {
     }
 }
 
+/// Bounds on how much work one detection may do
+///
+/// `max_bytes` caps the input looked at, `max_tokens` the tokens each folding
+/// pass pulls from the tokenizer. When a limit cuts detection short, the
+/// verdict is the one for the input as far as it was read, and
+/// `SqliState::truncated()` reports it. If the tokens read before the cut
+/// already decide the verdict, it is exact and not reported as truncated.
+#[derive(Debug, Copy, Clone, PartialEq, Eq)]
+pub struct ScanLimits {
+    pub max_bytes: usize,
+    pub max_tokens: usize,
+}
+
+impl ScanLimits {
+    pub const UNLIMITED: ScanLimits = ScanLimits {
+        max_bytes: usize::MAX,
+        max_tokens: usize::MAX,
+    };
+
+    pub fn new(max_bytes: usize, max_tokens: usize) -> Self {
+        ScanLimits { max_bytes, max_tokens }
+    }
+}
+
+impl Default for ScanLimits {
+    fn default() -> Self {
+        Self::UNLIMITED
+    }
+}
+
 /// Fingerprint struct for SQL injection detection
 #[derive(Clone, PartialEq)]
 pub struct Fingerprint {
@@ -111,6 +145,74 @@ impl core::fmt::Debug for Fingerprint {
     }
 }
 
+// Room for MAX_TOKENS tokens plus the lookahead the folder grabs
+const FOLD_WINDOW_SIZE: usize = LIBINJECTION_SQLI_MAX_TOKENS + 3;
+
+/// Tokens being folded, kept as spans of the input
+///
+/// Merged "word word" tokens are the only values that are not spans; their
+/// text is stored next to the slot that holds them and moves with it.
+struct FoldWindow<'a> {
+    input: &'a [u8],
+    tokens: [SlimToken; FOLD_WINDOW_SIZE],
+    merged: [[u8; 32]; FOLD_WINDOW_SIZE],
+}
+
+impl<'a> FoldWindow<'a> {
+    fn new(input: &'a [u8]) -> Self {
+        FoldWindow {
+            input,
+            tokens: [SlimToken::EMPTY; FOLD_WINDOW_SIZE],
+            merged: [[0; 32]; FOLD_WINDOW_SIZE],
+        }
+    }
+    
+    #[inline]
+    fn value(&self, i: usize) -> &[u8] {
+        let token = &self.tokens[i];
+        if token.merged {
+            &self.merged[i][..token.len as usize]
+        } else {
+            token.span(self.input)
+        }
+    }
+    
+    // Byte `n` of the value, reading past the end as the C NUL terminator
+    #[inline]
+    fn byte(&self, i: usize, n: usize) -> u8 {
+        self.value(i).get(n).copied().unwrap_or(CHAR_NULL)
+    }
+    
+    fn copy_slot(&mut self, dst: usize, src: usize) {
+        self.tokens[dst] = self.tokens[src];
+        if self.tokens[src].merged {
+            self.merged[dst] = self.merged[src];
+        }
+    }
+}
+
+/// A token that survived folding, as the fingerprint and whitelist read it
+///
+/// The whitelist looks at no more than the first four bytes of a value, so
+/// those are all that is copied, which also covers merged values that are
+/// not spans of the input.
+#[derive(Debug, Clone, Copy)]
+struct FoldedToken {
+    slim: SlimToken,
+    head: [u8; 4],
+}
+
+impl FoldedToken {
+    const EMPTY: FoldedToken = FoldedToken { slim: SlimToken::EMPTY, head: [0; 4] };
+    
+    fn new(slim: SlimToken, value: &[u8]) -> Self {
+        let mut head = [0; 4];
+        let n = value.len().min(4);
+        head[..n].copy_from_slice(&value[..n]);
+        FoldedToken { slim, head }
+    }
+}
+
 /// Main SQL injection detection state
 pub struct SqliState<'a> {
     // Input string
@@ -119,15 +221,12 @@ pub struct SqliState<'a> {
     // Flags for SQL mode (ANSI, MySQL, etc.)
     flags: SqliFlags,
     
-    // Token storage - we store up to MAX_TOKENS + 3 during processing
+    // Folded tokens of the last fold, filled only by the inspection calls
+    // (`fold_tokens`, `get_fingerprint`, `is_sqli`); `detect` leaves it be
     #[cfg(feature = "smallvec")]
     pub tokens: SmallVec<[Token; 8]>,
     #[cfg(not(feature = "smallvec"))]
     pub tokens: Vec<Token>,
-    #[cfg(feature = "smallvec")]
-    token_vec: SmallVec<[Token; 8]>,
-    #[cfg(not(feature = "smallvec"))]
-    token_vec: Vec<Token>,
     
     // Current position in input
     pos: usize,
@@ -135,6 +234,16 @@ pub struct SqliState<'a> {
     // Current token being processed  
     current_token: Option<Token>,
     
+    // Tokenizer steps shared between detection passes
+    token_cache: TokenCache,
+    
+    // Keyword and fingerprint overlay, if any
+    rules: Option<&'a Rules<'a>>,
+    
+    // What the last fold kept, which is all detection reads
+    folded: [FoldedToken; FOLD_WINDOW_SIZE],
+    folded_len: usize,
+    
     // The fingerprint
     pub fingerprint: [u8; 8],
     
@@ -148,10 +257,47 @@ pub struct SqliState<'a> {
     
     // Reason for SQLi detection (for debugging)
     reason: u32,
+    
+    // Input needed to reproduce the last fold, None if it read to the end
+    fold_reach: Option<usize>,
+    
+    // Work limits; input_cut is set when max_bytes shortened the input
+    limits: ScanLimits,
+    input_cut: bool,
+    token_limit_hit: bool,
+    truncated: bool,
+    
+    // Pass that decided the last detect() call, kept across resets
+    detected_flags: SqliFlags,
+    detected_fingerprint: [u8; 8],
 }
 
 impl<'a> SqliState<'a> {
     pub fn new(input: &'a [u8], flags: SqliFlags) -> Self {
+        #[cfg(feature = "smallvec")]
+        let tokens = SmallVec::new();
+        // Only the inspection calls fill it, so it grows on first use
+        #[cfg(not(feature = "smallvec"))]
+        let tokens = Vec::new();
+        Self::with_buffers(input, flags, tokens, TokenCache::new())
+    }
+    
+    /// Moves the state over to another input, reset for `flags` as by
+    /// `new`, keeping the token buffers it has already allocated. Limits go
+    /// back to unlimited and rules back to the built-in ones.
+    pub fn reuse<'b>(mut self, input: &'b [u8], flags: SqliFlags) -> SqliState<'b> {
+        self.tokens.clear();
+        self.token_cache.clear();
+        SqliState::with_buffers(input, flags, self.tokens, self.token_cache)
+    }
+    
+    fn with_buffers(
+        input: &'a [u8],
+        flags: SqliFlags,
+        #[cfg(feature = "smallvec")] tokens: SmallVec<[Token; 8]>,
+        #[cfg(not(feature = "smallvec"))] tokens: Vec<Token>,
+        token_cache: TokenCache,
+    ) -> Self {
         // Match C behavior: if flags == 0, set to FLAG_QUOTE_NONE | FLAG_SQL_ANSI
         // C code reference: libinjection_sqli.c line 1251-1253 and line 1268-1270
         let adjusted_flags = if flags == SqliFlags::FLAG_NONE {
@@ -163,16 +309,13 @@ impl<'a> SqliState<'a> {
         SqliState {
             input,
             flags: adjusted_flags,
-            #[cfg(feature = "smallvec")]
-            tokens: SmallVec::new(),
-            #[cfg(not(feature = "smallvec"))]
-            tokens: Vec::with_capacity(LIBINJECTION_SQLI_MAX_TOKENS + 3),
-            #[cfg(feature = "smallvec")]
-            token_vec: SmallVec::new(),
-            #[cfg(not(feature = "smallvec"))]
-            token_vec: Vec::with_capacity(LIBINJECTION_SQLI_MAX_TOKENS + 3),
+            tokens,
             pos: 0,
             current_token: None,
+            token_cache,
+            rules: None,
+            folded: [FoldedToken::EMPTY; FOLD_WINDOW_SIZE],
+            folded_len: 0,
             fingerprint: [0; 8],
             stats_comment_ddw: 0,
             stats_comment_ddx: 0,
@@ -181,6 +324,13 @@ impl<'a> SqliState<'a> {
             stats_folds: 0,
             stats_tokens: 0,
             reason: 0,
+            fold_reach: None,
+            limits: ScanLimits::UNLIMITED,
+            input_cut: false,
+            token_limit_hit: false,
+            truncated: false,
+            detected_flags: adjusted_flags,
+            detected_fingerprint: [0; 8],
         }
     }
     
@@ -189,12 +339,60 @@ impl<'a> SqliState<'a> {
         Self::new(input.as_bytes(), flags)
     }
     
+    /// Classifies words and checks fingerprints with `rules` on top of the
+    /// built-in tables, see [`overlay`](crate::overlay)
+    pub fn with_rules(mut self, rules: &'a Rules<'a>) -> Self {
+        self.rules = Some(rules);
+        self.token_cache.clear();
+        self
+    }
+    
+    /// Bounds the work later calls may do, see [`ScanLimits`]
+    pub fn with_limits(mut self, limits: ScanLimits) -> Self {
+        self.apply_limits(limits);
+        self
+    }
+    
+    fn apply_limits(&mut self, limits: ScanLimits) {
+        if self.input.len() > limits.max_bytes {
+            self.input = &self.input[..limits.max_bytes];
+            self.input_cut = true;
+        }
+        self.limits = limits;
+    }
+    
+    /// `reuse(input, flags).with_limits(limits)` done in place, for an input
+    /// that lives as long as the current one. The state is large, and this
+    /// spares the moves in and out of `reuse`.
+    #[cfg(feature = "batch")]
+    pub(crate) fn rebind(&mut self, input: &'a [u8], flags: SqliFlags, limits: ScanLimits) {
+        self.tokens.clear();
+        self.token_cache.clear();
+        self.input = input;
+        self.reset(flags);
+        self.rules = None;
+        self.folded = [FoldedToken::EMPTY; FOLD_WINDOW_SIZE];
+        self.folded_len = 0;
+        self.fold_reach = None;
+        self.input_cut = false;
+        self.token_limit_hit = false;
+        self.truncated = false;
+        self.detected_flags = self.flags;
+        self.detected_fingerprint = [0; 8];
+        self.apply_limits(limits);
+    }
+    
+    /// True if a scan limit may have changed the verdict of the last `detect()`
+    pub fn truncated(&self) -> bool {
+        self.truncated
+    }
+    
     /// Main detection function - checks if input is SQL injection
     pub fn is_sqli(&mut self) -> bool {
         let fingerprint = self.fingerprint();
         
         // Check blacklist
-        if !blacklist::is_blacklisted(fingerprint.as_str()) {
+        if !overlay::is_blacklisted_fingerprint(self.rules, &fingerprint.fingerprint) {
             return false;
         }
         
@@ -207,60 +405,175 @@ impl<'a> SqliState<'a> {
         self.fingerprint()
     }
     
+    /// Folds and fingerprints the input the way detection does, without
+    /// filling `tokens`
+    pub fn detection_fingerprint(&mut self) -> Fingerprint {
+        self.fold_fingerprint(false)
+    }
+    
+    /// Runs only the whitelist rules on the last fingerprint computed.
+    /// Returns true if a blacklisted fingerprint still counts as SQLi.
+    pub fn is_not_whitelisted(&self) -> bool {
+        self.is_not_whitelist()
+    }
+    
     /// Detects SQL injection with additional flag handling
     /// This matches the C implementation's libinjection_is_sqli() function
     pub fn detect(&mut self) -> bool {
+        #[cfg(feature = "metrics")]
+        crate::metrics::sqli_detection();
+        self.token_limit_hit = false;
+        self.truncated = false;
+        if self.input_cut {
+            // The verdict may be settled before the cut, as for a streamed
+            // prefix (a pass that hit the token limit never is)
+            let flags = self.flags;
+            if let Some(is_sqli) = self.detect_passes(false) {
+                return is_sqli;
+            }
+            self.reset(flags);
+        }
+        let is_sqli = self.detect_passes(true) == Some(true);
+        self.truncated = self.input_cut || self.token_limit_hit;
+        is_sqli
+    }
+    
+    /// `detect()` for a backend that speaks only one dialect
+    ///
+    /// Runs the passes `detect()` runs, as-is and in single and double
+    /// quote context, all under `dialect` (`FLAG_SQL_ANSI` or
+    /// `FLAG_SQL_MYSQL`), and none of the reparses under the other one. The
+    /// flags the state was created with are not used.
+    pub fn detect_dialect(&mut self, dialect: SqliFlags) -> bool {
+        #[cfg(feature = "metrics")]
+        crate::metrics::sqli_detection();
+        let dialect = SqliFlags(dialect.0 & (SqliFlags::FLAG_SQL_ANSI.0 | SqliFlags::FLAG_SQL_MYSQL.0));
+        self.token_limit_hit = false;
+        self.detected_flags = SqliFlags::FLAG_QUOTE_NONE | dialect;
+        self.detected_fingerprint = [0; 8];
+
+        let passes = [
+            (SqliFlags::FLAG_QUOTE_NONE, !self.input.is_empty()),
+            (SqliFlags::FLAG_QUOTE_SINGLE, self.input.contains(&b'\'')),
+            (SqliFlags::FLAG_QUOTE_DOUBLE, self.input.contains(&b'"')),
+        ];
+        let mut is_sqli = false;
+        for (quote, needed) in passes {
+            if needed {
+                self.reset(quote | dialect);
+                if self.detection_pass(true) == Some(true) {
+                    is_sqli = true;
+                    break;
+                }
+            }
+        }
+        self.truncated = self.input_cut || self.token_limit_hit;
+        is_sqli
+    }
+    
+    /// `detect()` for an input that may still be a prefix of the real one
+    ///
+    /// Returns the verdict only once no continuation of the input can change
+    /// it or its deciding fingerprint; `None` until then.
+    pub(crate) fn detect_prefix(&mut self) -> Option<bool> {
+        self.detect_passes(false)
+    }
+    
+    fn detect_passes(&mut self, complete: bool) -> Option<bool> {
+        self.detected_flags = self.flags;
+        self.detected_fingerprint = [0; 8];
+        
         // no input? not SQLi
         if self.input.is_empty() {
-            return false;
+            return if complete { Some(false) } else { None };
         }
         
         // Test input "as-is" with the current flags
         // Note: preserve the original flags that were passed to the constructor
         let original_flags = self.flags;
-        let fingerprint = self.fingerprint();
-        if self.check_is_sqli(&fingerprint) {
-            return true;
+        if self.detection_pass(complete)? {
+            return Some(true);
         } else if self.reparse_as_mysql() {
             // Only switch to MySQL mode if reparsing is needed
             // C code reference: libinjection_sqli.c lines 2279-2286
             // C uses FLAG_QUOTE_NONE | FLAG_SQL_MYSQL (replaces ANSI with MySQL)
             let mysql_flags = (original_flags.0 & !SqliFlags::FLAG_SQL_ANSI.0) | SqliFlags::FLAG_SQL_MYSQL.0;
             self.reset(SqliFlags::new(mysql_flags));
-            let fingerprint = self.fingerprint();
-            if self.check_is_sqli(&fingerprint) {
-                return true;
+            if self.detection_pass(complete)? {
+                return Some(true);
             }
         }
         
         // If input has a single quote, test as if input was actually preceded by '
         if self.input.contains(&b'\'') {
             self.reset(SqliFlags::new(SqliFlags::FLAG_QUOTE_SINGLE.0 | SqliFlags::FLAG_SQL_ANSI.0));
-            let fingerprint = self.fingerprint();
-            if self.check_is_sqli(&fingerprint) {
-                return true;
+            if self.detection_pass(complete)? {
+                return Some(true);
             } else if self.reparse_as_mysql() {
                 // C code reference: libinjection_sqli.c lines 2294-2301  
                 // C uses FLAG_QUOTE_SINGLE | FLAG_SQL_MYSQL (replaces ANSI with MySQL)
                 self.reset(SqliFlags::new(SqliFlags::FLAG_QUOTE_SINGLE.0 | SqliFlags::FLAG_SQL_MYSQL.0));
-                let fingerprint = self.fingerprint();
-                if self.check_is_sqli(&fingerprint) {
-                    return true;
+                if self.detection_pass(complete)? {
+                    return Some(true);
                 }
             }
+        } else if !complete {
+            // A quote may still arrive and add this pass
+            return None;
         }
         
         // If input has a double quote, test as if input was actually preceded by "
         // C only uses MySQL mode for double quotes (libinjection_sqli.c:2303-2304)
         if self.input.contains(&b'"') {
             self.reset(SqliFlags::new(SqliFlags::FLAG_QUOTE_DOUBLE.0 | SqliFlags::FLAG_SQL_MYSQL.0));
-            let fingerprint = self.fingerprint();
-            if self.check_is_sqli(&fingerprint) {
-                return true;
+            if self.detection_pass(complete)? {
+                return Some(true);
             }
+        } else if !complete {
+            return None;
         }
         
-        false
+        Some(false)
+    }
+    
+    /// Fingerprint of the pass that decided the last `detect()` call
+    ///
+    /// This is the fingerprint `get_fingerprint()` would recompute right
+    /// after `detect()`, without folding the input again.
+    pub fn detected_fingerprint(&self) -> Fingerprint {
+        Fingerprint::new(self.detected_fingerprint)
+    }
+    
+    /// Flags of the pass that decided the last `detect()` call
+    pub fn detected_flags(&self) -> SqliFlags {
+        self.detected_flags
+    }
+    
+    /// Runs one pass of `detect()` with the current flags and records it.
+    /// For a possibly incomplete input, `None` if more input could change it.
+    fn detection_pass(&mut self, complete: bool) -> Option<bool> {
+        let fingerprint = self.fold_fingerprint(false);
+        self.detected_flags = self.flags;
+        self.detected_fingerprint = self.fingerprint;
+        let is_sqli = self.check_is_sqli(&fingerprint);
+        #[cfg(feature = "metrics")]
+        crate::metrics::sqli_pass(self.flags, self.stats_tokens, self.stats_folds, self.input.len(), is_sqli);
+        if complete || self.pass_is_settled() {
+            Some(is_sqli)
+        } else {
+            None
+        }
+    }
+    
+    /// True if the last fold and its verdict hold for any continuation of the
+    /// input: the fold stopped on a full window well before the end, and the
+    /// fingerprint does not end in a comment (the sp_password whitelist
+    /// exception looks at the whole input)
+    fn pass_is_settled(&self) -> bool {
+        let window_settled = self.fold_reach
+            .is_some_and(|reach| reach + MAX_LOOKAHEAD <= self.input.len());
+        let tlen = self.fingerprint.iter().position(|&b| b == 0).unwrap_or(8);
+        window_settled && !(tlen > 1 && self.fingerprint[tlen - 1] == b'c')
     }
     
     /// Get the detected fingerprint as a string
@@ -309,7 +622,6 @@ impl<'a> SqliState<'a> {
         
         self.flags = adjusted_flags;
         self.pos = 0;
-        self.tokens.clear();
         self.current_token = None;
         self.fingerprint = [0; 8];
         self.reason = 0;
@@ -319,17 +631,49 @@ impl<'a> SqliState<'a> {
         self.stats_comment_hash = 0;
         self.stats_folds = 0;
         self.stats_tokens = 0;
+        self.fold_reach = None;
     }
     
     fn fingerprint(&mut self) -> Fingerprint {
-        let token_count = self.fold_tokens();
+        self.fold_fingerprint(true)
+    }
+    
+    // Folds and fingerprints the input, also filling `tokens` if asked to
+    fn fold_fingerprint(&mut self, keep_tokens: bool) -> Fingerprint {
+        let token_count = self.fold(keep_tokens);
         
-        self.generate_fingerprint(token_count);
+        self.generate_fingerprint(token_count, keep_tokens);
         Fingerprint::new(self.fingerprint)
     }
     
-    
+    /// Folds the input, leaving the folded tokens in `tokens`, and returns
+    /// their count
     pub fn fold_tokens(&mut self) -> usize {
+        self.fold(true)
+    }
+    
+    // Keeps a token that survived folding
+    fn keep_folded(&mut self, slim: SlimToken, value: &[u8], keep_tokens: bool) {
+        if let Some(slot) = self.folded.get_mut(self.folded_len) {
+            *slot = FoldedToken::new(slim, value);
+            self.folded_len += 1;
+        }
+        if keep_tokens {
+            self.tokens.push(slim.to_token(value));
+        }
+    }
+    
+    fn fold(&mut self, keep_tokens: bool) -> usize {
+        // Each dialect gets its own tokenizer and folder, free of dialect
+        // checks; flags naming both dialects or neither keep the checks
+        match (self.flags.is_ansi(), self.flags.is_mysql()) {
+            (true, false) => self.fold_in::<DIALECT_ANSI>(keep_tokens),
+            (false, true) => self.fold_in::<DIALECT_MYSQL>(keep_tokens),
+            _ => self.fold_in::<DIALECT_FROM_FLAGS>(keep_tokens),
+        }
+    }
+
+    fn fold_in<const DIALECT: u32>(&mut self, keep_tokens: bool) -> usize {
         /*
          * This implementation exactly matches the C version's control flow structure because
          * the original separate Rust folding functions had subtle differences in behavior:
@@ -347,12 +691,16 @@ impl<'a> SqliState<'a> {
          * By inlining all the logic with the exact same control flow as C, we ensure
          * identical folding behavior that produces matching fingerprints.
          */
-        let mut last_comment = Token::new();
-        let mut tokenizer = SqliTokenizer::new(self.input, self.flags);
-        
-        // Clear and resize token vec
-        self.token_vec.clear();
-        self.token_vec.resize(LIBINJECTION_SQLI_MAX_TOKENS + 3, Token::new());
+        self.folded_len = 0;
+        if keep_tokens {
+            self.tokens.clear();
+        }
+        let mut last_comment = SlimToken::EMPTY;
+        let mut tokenizer = SqliTokenizer::<DIALECT>::specialized(self.input, self.flags);
+        if let Some(rules) = self.rules {
+            tokenizer = tokenizer.with_rules(rules);
+        }
+        let mut window = FoldWindow::new(self.input);
         
         // pos is the position of where the NEXT token goes
         #[allow(unused_assignments)] // Follows C implementation - pos initially 0, then set to 1 if real token found
@@ -364,15 +712,15 @@ impl<'a> SqliState<'a> {
         // Phase 1: Skip all initial comments, right-parens and unary operators (matches C lines 1366-1386)
         // This matches C's initial phase exactly - put tokens in tokenvec[0] and skip unwanted ones
         while more {
-            if let Some(token) = tokenizer.next_token() {
+            if let Some(token) = self.next_folding_token(&mut tokenizer) {
                 // Count all tokens processed for stats_tokens
                 self.stats_tokens += 1;
                 
-                self.token_vec[0] = token.clone();
+                window.tokens[0] = token;
                 if !(token.token_type == TokenType::Comment ||
                      token.token_type == TokenType::LeftParenthesis ||
                      token.token_type == TokenType::SqlType ||
-                     self.is_unary_op(&token)) {
+                     self.is_unary_op(&window, 0)) {
                     // Found a real token, keep it at position 0
                     break;
                 }
@@ -385,10 +733,7 @@ impl<'a> SqliState<'a> {
         if !more {
             // If input was only comments, unary or (, then exit (matches C lines 1380-1382)
             // But first copy tokenizer statistics so they're available for reparse detection
-            self.stats_comment_c = tokenizer.stats_comment_c;
-            self.stats_comment_ddw = tokenizer.stats_comment_ddw;
-            self.stats_comment_ddx = tokenizer.stats_comment_ddx;
-            self.stats_comment_hash = tokenizer.stats_comment_hash;
+            self.finish_fold(&tokenizer, more);
             return 0;
         } else {
             // it's some other token - first real token is now at position 0
@@ -399,31 +744,31 @@ impl<'a> SqliState<'a> {
         loop {
             // Do we have all the max number of tokens? If so, do some special cases for 5 tokens
             if pos >= LIBINJECTION_SQLI_MAX_TOKENS {
-                if (self.token_vec[0].token_type == TokenType::Number &&
-                    (self.token_vec[1].token_type == TokenType::Operator ||
-                     self.token_vec[1].token_type == TokenType::Comma) &&
-                    self.token_vec[2].token_type == TokenType::LeftParenthesis &&
-                    self.token_vec[3].token_type == TokenType::Number &&
-                    self.token_vec[4].token_type == TokenType::RightParenthesis) ||
-                   (self.token_vec[0].token_type == TokenType::Bareword &&
-                    self.token_vec[1].token_type == TokenType::Operator &&
-                    self.token_vec[2].token_type == TokenType::LeftParenthesis &&
-                    (self.token_vec[3].token_type == TokenType::Bareword ||
-                     self.token_vec[3].token_type == TokenType::Number) &&
-                    self.token_vec[4].token_type == TokenType::RightParenthesis) ||
-                   (self.token_vec[0].token_type == TokenType::Number &&
-                    self.token_vec[1].token_type == TokenType::RightParenthesis &&
-                    self.token_vec[2].token_type == TokenType::Comma &&
-                    self.token_vec[3].token_type == TokenType::LeftParenthesis &&
-                    self.token_vec[4].token_type == TokenType::Number) ||
-                   (self.token_vec[0].token_type == TokenType::Bareword &&
-                    self.token_vec[1].token_type == TokenType::RightParenthesis &&
-                    self.token_vec[2].token_type == TokenType::Operator &&
-                    self.token_vec[3].token_type == TokenType::LeftParenthesis &&
-                    self.token_vec[4].token_type == TokenType::Bareword) {
+                if (window.tokens[0].token_type == TokenType::Number &&
+                    (window.tokens[1].token_type == TokenType::Operator ||
+                     window.tokens[1].token_type == TokenType::Comma) &&
+                    window.tokens[2].token_type == TokenType::LeftParenthesis &&
+                    window.tokens[3].token_type == TokenType::Number &&
+                    window.tokens[4].token_type == TokenType::RightParenthesis) ||
+                   (window.tokens[0].token_type == TokenType::Bareword &&
+                    window.tokens[1].token_type == TokenType::Operator &&
+                    window.tokens[2].token_type == TokenType::LeftParenthesis &&
+                    (window.tokens[3].token_type == TokenType::Bareword ||
+                     window.tokens[3].token_type == TokenType::Number) &&
+                    window.tokens[4].token_type == TokenType::RightParenthesis) ||
+                   (window.tokens[0].token_type == TokenType::Number &&
+                    window.tokens[1].token_type == TokenType::RightParenthesis &&
+                    window.tokens[2].token_type == TokenType::Comma &&
+                    window.tokens[3].token_type == TokenType::LeftParenthesis &&
+                    window.tokens[4].token_type == TokenType::Number) ||
+                   (window.tokens[0].token_type == TokenType::Bareword &&
+                    window.tokens[1].token_type == TokenType::RightParenthesis &&
+                    window.tokens[2].token_type == TokenType::Operator &&
+                    window.tokens[3].token_type == TokenType::LeftParenthesis &&
+                    window.tokens[4].token_type == TokenType::Bareword) {
                     if pos > LIBINJECTION_SQLI_MAX_TOKENS {
                         // Copy token[5] to token[1], reset to position 2
-                        self.token_vec[1] = self.token_vec[LIBINJECTION_SQLI_MAX_TOKENS].clone();
+                        window.copy_slot(1, LIBINJECTION_SQLI_MAX_TOKENS);
                         pos = 2;
                         left = 0;
                     } else {
@@ -442,7 +787,7 @@ impl<'a> SqliState<'a> {
             
             // Get up to two tokens
             while more && pos <= LIBINJECTION_SQLI_MAX_TOKENS && (pos - left) < 2 {
-                if let Some(token) = tokenizer.next_token() {
+                if let Some(token) = self.next_folding_token(&mut tokenizer) {
                     // Count all tokens processed for stats_tokens
                     self.stats_tokens += 1;
                     
@@ -450,7 +795,7 @@ impl<'a> SqliState<'a> {
                         last_comment = token;
                     } else {
                         last_comment.token_type = TokenType::None;
-                        self.token_vec[pos] = token;
+                        window.tokens[pos] = token;
                         pos += 1;
                     }
                 } else {
@@ -468,33 +813,33 @@ impl<'a> SqliState<'a> {
             
             // FOLD: "ss" -> "s" - from apply_two_token_fold 
             // "foo" "bar" is valid SQL, just ignore second string
-            if self.token_vec[left].token_type == TokenType::String &&
-               self.token_vec[left + 1].token_type == TokenType::String {
+            if window.tokens[left].token_type == TokenType::String &&
+               window.tokens[left + 1].token_type == TokenType::String {
                 pos -= 1;
                 self.stats_folds += 1;
                 continue;
             
             // FOLD: ";;" -> ";" - from apply_two_token_fold
             // fold away repeated semicolons  
-            } else if self.token_vec[left].token_type == TokenType::Semicolon &&
-                      self.token_vec[left + 1].token_type == TokenType::Semicolon {
+            } else if window.tokens[left].token_type == TokenType::Semicolon &&
+                      window.tokens[left + 1].token_type == TokenType::Semicolon {
                 pos -= 1;
                 self.stats_folds += 1;
                 continue;
             
             // FOLD: (operator|logic_operator) + (unary_op|sqltype) -> operator - from apply_two_token_fold
-            } else if (self.token_vec[left].token_type == TokenType::Operator ||
-                       self.token_vec[left].token_type == TokenType::LogicOperator) &&
-                      (self.is_unary_op(&self.token_vec[left + 1]) ||
-                       self.token_vec[left + 1].token_type == TokenType::SqlType) {
+            } else if (window.tokens[left].token_type == TokenType::Operator ||
+                       window.tokens[left].token_type == TokenType::LogicOperator) &&
+                      (self.is_unary_op(&window, left + 1) ||
+                       window.tokens[left + 1].token_type == TokenType::SqlType) {
                 pos -= 1;
                 self.stats_folds += 1;
                 left = 0;
                 continue;
             
             // FOLD: leftparens + unary_op -> leftparens - from apply_two_token_fold
-            } else if self.token_vec[left].token_type == TokenType::LeftParenthesis &&
-                      self.is_unary_op(&self.token_vec[left + 1]) {
+            } else if window.tokens[left].token_type == TokenType::LeftParenthesis &&
+                      self.is_unary_op(&window, left + 1) {
                 pos -= 1;
                 self.stats_folds += 1;
                 if left > 0 {
@@ -505,8 +850,8 @@ impl<'a> SqliState<'a> {
             // FOLD: word merging - from syntax_merge_words inlined
             } else if {
                 // syntax_merge_words logic inlined
-                let a_type = self.token_vec[left].token_type;
-                let b_type = self.token_vec[left + 1].token_type;
+                let a_type = window.tokens[left].token_type;
+                let b_type = window.tokens[left + 1].token_type;
                 
                 // Check if token a is of right type
                 (a_type == TokenType::Keyword || a_type == TokenType::Bareword ||
@@ -522,27 +867,26 @@ impl<'a> SqliState<'a> {
                  b_type == TokenType::LogicOperator) &&
                 
                 {
-                    let sz1 = self.token_vec[left].len;
-                    let sz2 = self.token_vec[left + 1].len;
+                    let sz1 = window.tokens[left].len as usize;
+                    let sz2 = window.tokens[left + 1].len as usize;
                     let sz3 = sz1 + sz2 + 1; // +1 for space in the middle
                     
                     if sz3 < 32 { // make sure there is room for ending null
-                        // Create merged string: a.val + ' ' + b.val
-                        let a_val = self.token_vec[left].value_as_str();
-                        let b_val = self.token_vec[left + 1].value_as_str();
-                        let merged_original = format!("{} {}", a_val, b_val);
-                        let merged_upper = merged_original.to_ascii_uppercase();
+                        // Create merged string on the stack: a.val + ' ' + b.val
+                        let mut merged = [0u8; 32];
+                        merged[..sz1].copy_from_slice(window.value(left));
+                        merged[sz1] = b' ';
+                        merged[sz1 + 1..sz3].copy_from_slice(window.value(left + 1));
                         
-                        let lookup_result = sqli_data::lookup_word(&merged_upper);
+                        let lookup_result = overlay::lookup_word(self.rules, &merged[..sz3]);
                         
                         if lookup_result != TokenType::Bareword {
                             // Update the first token with merged value and new type
-                            self.token_vec[left].token_type = lookup_result;
+                            window.tokens[left].token_type = lookup_result;
                             // Update the value - store the original case version, not uppercase
-                            let merged_bytes = merged_original.as_bytes();
-                            let copy_len = merged_bytes.len().min(31); // Leave space for null terminator
-                            self.token_vec[left].val[..copy_len].copy_from_slice(&merged_bytes[..copy_len]);
-                            self.token_vec[left].len = copy_len;
+                            window.merged[left] = merged;
+                            window.tokens[left].merged = true;
+                            window.tokens[left].len = sz3 as u8;
                             true
                         } else {
                             false
@@ -560,22 +904,22 @@ impl<'a> SqliState<'a> {
                 continue;
             
             // FOLD: semicolon + function(IF) -> TSQL - from apply_two_token_fold  
-            } else if self.token_vec[left].token_type == TokenType::Semicolon &&
-                      self.token_vec[left + 1].token_type == TokenType::Function &&
-                      self.token_vec[left + 1].len >= 2 &&
-                      (self.token_vec[left + 1].val[0] == b'I' || self.token_vec[left + 1].val[0] == b'i') &&
-                      (self.token_vec[left + 1].val[1] == b'F' || self.token_vec[left + 1].val[1] == b'f') {
+            } else if window.tokens[left].token_type == TokenType::Semicolon &&
+                      window.tokens[left + 1].token_type == TokenType::Function &&
+                      window.tokens[left + 1].len >= 2 &&
+                      (window.byte(left + 1, 0) == b'I' || window.byte(left + 1, 0) == b'i') &&
+                      (window.byte(left + 1, 1) == b'F' || window.byte(left + 1, 1) == b'f') {
                 // IF is normally a function, except in Transact-SQL where it can be used as a standalone
                 // control flow operator, e.g. ; IF 1=1 ... if found after a semicolon, convert from 'f' type to 'T' type
-                self.token_vec[left + 1].token_type = TokenType::Tsql;
+                window.tokens[left + 1].token_type = TokenType::Tsql;
                 continue;
             
             // FOLD: (bareword|variable) + leftparens -> function (for specific functions) - from apply_two_token_fold
-            } else if (self.token_vec[left].token_type == TokenType::Bareword ||
-                       self.token_vec[left].token_type == TokenType::Variable) &&
-                      self.token_vec[left + 1].token_type == TokenType::LeftParenthesis &&
+            } else if (window.tokens[left].token_type == TokenType::Bareword ||
+                       window.tokens[left].token_type == TokenType::Variable) &&
+                      window.tokens[left + 1].token_type == TokenType::LeftParenthesis &&
                       {
-                          let val = self.token_vec[left].value_as_str();
+                          let val = window.value(left);
                           // TSQL functions but common enough to be column names
                           self.cstrcasecmp("USER_ID", val) == 0 ||
                           self.cstrcasecmp("USER_NAME", val) == 0 ||
@@ -594,21 +938,21 @@ impl<'a> SqliState<'a> {
                       } {
                 // pos is the same, other conversions need to go here... for instance
                 // password CAN be a function, coalesce CAN be a function
-                self.token_vec[left].token_type = TokenType::Function;
+                window.tokens[left].token_type = TokenType::Function;
                 continue;
             
             // FOLD: keyword IN/NOT_IN + leftparens -> operator, else -> bareword - from apply_two_token_fold
-            } else if self.token_vec[left].token_type == TokenType::Keyword &&
+            } else if window.tokens[left].token_type == TokenType::Keyword &&
                       {
-                          let val = self.token_vec[left].value_as_str();
+                          let val = window.value(left);
                           self.cstrcasecmp("IN", val) == 0 || self.cstrcasecmp("NOT IN", val) == 0
                       } {
-                if self.token_vec[left + 1].token_type == TokenType::LeftParenthesis {
+                if window.tokens[left + 1].token_type == TokenType::LeftParenthesis {
                     // got .... IN ( ... (or 'NOT IN') - it's an operator
-                    self.token_vec[left].token_type = TokenType::Operator;
+                    window.tokens[left].token_type = TokenType::Operator;
                 } else {
                     // it's a nothing
-                    self.token_vec[left].token_type = TokenType::Bareword;
+                    window.tokens[left].token_type = TokenType::Bareword;
                 }
                 // "IN" can be used as "IN BOOLEAN MODE" for mysql in which case merging of words can be done later
                 // otherwise it acts as an equality operator __ IN (values..)
@@ -621,27 +965,27 @@ impl<'a> SqliState<'a> {
             
             // FOLD: operator LIKE/NOT_LIKE + leftparens -> function - from apply_two_token_fold
             // NOTE: This rule falls through in C - no continue!
-            } else if self.token_vec[left].token_type == TokenType::Operator &&
+            } else if window.tokens[left].token_type == TokenType::Operator &&
                       {
-                          let val = self.token_vec[left].value_as_str();
+                          let val = window.value(left);
                           self.cstrcasecmp("LIKE", val) == 0 || self.cstrcasecmp("NOT LIKE", val) == 0
                       } {
-                if self.token_vec[left + 1].token_type == TokenType::LeftParenthesis {
+                if window.tokens[left + 1].token_type == TokenType::LeftParenthesis {
                     // SELECT LIKE(...  - it's a function
-                    self.token_vec[left].token_type = TokenType::Function;
+                    window.tokens[left].token_type = TokenType::Function;
                 }
                 // NO continue here - falls through to next rule like C does
             
             // FOLD: sqltype + X -> X (remove sqltype) - from apply_two_token_fold
-            } else if self.token_vec[left].token_type == TokenType::SqlType &&
-                      (self.token_vec[left + 1].token_type == TokenType::Bareword ||
-                       self.token_vec[left + 1].token_type == TokenType::Number ||
-                       self.token_vec[left + 1].token_type == TokenType::SqlType ||
-                       self.token_vec[left + 1].token_type == TokenType::LeftParenthesis ||
-                       self.token_vec[left + 1].token_type == TokenType::Function ||
-                       self.token_vec[left + 1].token_type == TokenType::Variable ||
-                       self.token_vec[left + 1].token_type == TokenType::String) {
-                self.token_vec[left] = self.token_vec[left + 1].clone();
+            } else if window.tokens[left].token_type == TokenType::SqlType &&
+                      (window.tokens[left + 1].token_type == TokenType::Bareword ||
+                       window.tokens[left + 1].token_type == TokenType::Number ||
+                       window.tokens[left + 1].token_type == TokenType::SqlType ||
+                       window.tokens[left + 1].token_type == TokenType::LeftParenthesis ||
+                       window.tokens[left + 1].token_type == TokenType::Function ||
+                       window.tokens[left + 1].token_type == TokenType::Variable ||
+                       window.tokens[left + 1].token_type == TokenType::String) {
+                window.copy_slot(left, left + 1);
                 pos -= 1;
                 self.stats_folds += 1;
                 left = 0;
@@ -649,24 +993,25 @@ impl<'a> SqliState<'a> {
             
             // FOLD: collate + bareword -> handle collation types - from apply_two_token_fold
             // NOTE: This rule falls through in C - no continue!
-            } else if self.token_vec[left].token_type == TokenType::Collate &&
-                      self.token_vec[left + 1].token_type == TokenType::Bareword {
+            } else if window.tokens[left].token_type == TokenType::Collate &&
+                      window.tokens[left + 1].token_type == TokenType::Bareword {
                 // there are too many collation types.. so if the bareword has a "_" then it's TYPE_SQLTYPE
-                let val = self.token_vec[left + 1].value_as_str();
-                if val.contains('_') {
-                    self.token_vec[left + 1].token_type = TokenType::SqlType;
+                // Values that are not UTF-8 never matched here
+                let val = window.value(left + 1);
+                if val.contains(&b'_') && core::str::from_utf8(val).is_ok() {
+                    window.tokens[left + 1].token_type = TokenType::SqlType;
                     left = 0;
                 }
                 // NO continue here - falls through like C does
             
             // FOLD: backslash + arithmetic_op -> number, else copy - from apply_two_token_fold
-            } else if self.token_vec[left].token_type == TokenType::Backslash {
-                if self.is_arithmetic_op(&self.token_vec[left + 1]) {
+            } else if window.tokens[left].token_type == TokenType::Backslash {
+                if self.is_arithmetic_op(&window, left + 1) {
                     // very weird case in TSQL where '\%1' is parsed as '0 % 1', etc
-                    self.token_vec[left].token_type = TokenType::Number;
+                    window.tokens[left].token_type = TokenType::Number;
                 } else {
                     // just ignore it.. Again T-SQL seems to parse \1 as "1"
-                    self.token_vec[left] = self.token_vec[left + 1].clone();
+                    window.copy_slot(left, left + 1);
                     pos -= 1;
                     self.stats_folds += 1;
                 }
@@ -674,24 +1019,24 @@ impl<'a> SqliState<'a> {
                 continue;
             
             // FOLD: leftparens + leftparens -> leftparens - from apply_two_token_fold
-            } else if self.token_vec[left].token_type == TokenType::LeftParenthesis &&
-                      self.token_vec[left + 1].token_type == TokenType::LeftParenthesis {
+            } else if window.tokens[left].token_type == TokenType::LeftParenthesis &&
+                      window.tokens[left + 1].token_type == TokenType::LeftParenthesis {
                 pos -= 1;
                 left = 0;
                 self.stats_folds += 1;
                 continue;
             
             // FOLD: rightparens + rightparens -> rightparens - from apply_two_token_fold
-            } else if self.token_vec[left].token_type == TokenType::RightParenthesis &&
-                      self.token_vec[left + 1].token_type == TokenType::RightParenthesis {
+            } else if window.tokens[left].token_type == TokenType::RightParenthesis &&
+                      window.tokens[left + 1].token_type == TokenType::RightParenthesis {
                 pos -= 1;
                 left = 0;
                 self.stats_folds += 1;
                 continue;
             
             // FOLD: leftbrace + bareword -> special handling - from apply_two_token_fold
-            } else if self.token_vec[left].token_type == TokenType::LeftBrace &&
-                      self.token_vec[left + 1].token_type == TokenType::Bareword {
+            } else if window.tokens[left].token_type == TokenType::LeftBrace &&
+                      window.tokens[left + 1].token_type == TokenType::Bareword {
                 // MySQL Degenerate case -- 
                 // select { ``.``.id };  -- valid !!!
                 // select { ``.``.``.id };  -- invalid
@@ -702,13 +1047,13 @@ impl<'a> SqliState<'a> {
                 // The folding code can't look at more than 3 tokens, and I don't want to make two passes.
                 // Since "{ ``" so rare, we are just going to blacklist it.
                 // Highly likely this will need revisiting!
-                if self.token_vec[left + 1].len == 0 {
-                    self.token_vec[left + 1].token_type = TokenType::Evil;
-                    // Copy tokens before early return
-                    self.tokens.clear();
+                if window.tokens[left + 1].len == 0 {
+                    window.tokens[left + 1].token_type = TokenType::Evil;
+                    // Keep tokens before early return
                     for i in 0..(left + 2) {
-                        self.tokens.push(self.token_vec[i].clone());
+                        self.keep_folded(window.tokens[i], window.value(i), keep_tokens);
                     }
+                    self.finish_fold(&tokenizer, more);
                     return left + 2;
                 }
                 // weird ODBC / MYSQL {foo expr} --> expr
@@ -719,7 +1064,7 @@ impl<'a> SqliState<'a> {
                 continue;
             
             // FOLD: X + rightbrace -> X - from apply_two_token_fold
-            } else if self.token_vec[left + 1].token_type == TokenType::RightBrace {
+            } else if window.tokens[left + 1].token_type == TokenType::RightBrace {
                 pos -= 1;
                 left = 0;
                 self.stats_folds += 1;
@@ -728,7 +1073,7 @@ impl<'a> SqliState<'a> {
             
             // all cases of handling 2 tokens is done and nothing matched. Get one more token
             while more && pos <= LIBINJECTION_SQLI_MAX_TOKENS && pos - left < 3 {
-                if let Some(token) = tokenizer.next_token() {
+                if let Some(token) = self.next_folding_token(&mut tokenizer) {
                     // Count all tokens processed for stats_tokens
                     self.stats_tokens += 1;
                     
@@ -736,7 +1081,7 @@ impl<'a> SqliState<'a> {
                         last_comment = token;
                     } else {
                         last_comment.token_type = TokenType::None;
-                        self.token_vec[pos] = token;
+                        window.tokens[pos] = token;
                         pos += 1;
                     }
                 } else {
@@ -753,115 +1098,115 @@ impl<'a> SqliState<'a> {
             /* ALL 3-TOKEN FOLDING RULES - exactly matching C implementation with else-if chain */
             
             // FOLD: number operator number -> number - from apply_three_token_fold
-            if self.token_vec[left].token_type == TokenType::Number &&
-               self.token_vec[left + 1].token_type == TokenType::Operator &&
-               self.token_vec[left + 2].token_type == TokenType::Number {
+            if window.tokens[left].token_type == TokenType::Number &&
+               window.tokens[left + 1].token_type == TokenType::Operator &&
+               window.tokens[left + 2].token_type == TokenType::Number {
                 pos -= 2;
                 left = 0;
                 continue;
             
             // FOLD: operator X operator -> operator (where X != leftparens) - from apply_three_token_fold
-            } else if self.token_vec[left].token_type == TokenType::Operator &&
-                      self.token_vec[left + 1].token_type != TokenType::LeftParenthesis &&
-                      self.token_vec[left + 2].token_type == TokenType::Operator {
+            } else if window.tokens[left].token_type == TokenType::Operator &&
+                      window.tokens[left + 1].token_type != TokenType::LeftParenthesis &&
+                      window.tokens[left + 2].token_type == TokenType::Operator {
                 left = 0;
                 pos -= 2;
                 continue;
             
             // FOLD: logic_operator X logic_operator -> logic_operator - from apply_three_token_fold
-            } else if self.token_vec[left].token_type == TokenType::LogicOperator &&
-                      self.token_vec[left + 2].token_type == TokenType::LogicOperator {
+            } else if window.tokens[left].token_type == TokenType::LogicOperator &&
+                      window.tokens[left + 2].token_type == TokenType::LogicOperator {
                 pos -= 2;
                 left = 0;
                 continue;
             
             // FOLD: variable operator (variable|number|bareword) -> variable - from apply_three_token_fold
-            } else if self.token_vec[left].token_type == TokenType::Variable &&
-                      self.token_vec[left + 1].token_type == TokenType::Operator &&
-                      (self.token_vec[left + 2].token_type == TokenType::Variable ||
-                       self.token_vec[left + 2].token_type == TokenType::Number ||
-                       self.token_vec[left + 2].token_type == TokenType::Bareword) {
+            } else if window.tokens[left].token_type == TokenType::Variable &&
+                      window.tokens[left + 1].token_type == TokenType::Operator &&
+                      (window.tokens[left + 2].token_type == TokenType::Variable ||
+                       window.tokens[left + 2].token_type == TokenType::Number ||
+                       window.tokens[left + 2].token_type == TokenType::Bareword) {
                 pos -= 2;
                 left = 0;
                 continue;
             
             // FOLD: (bareword|number) operator (number|bareword) -> first - from apply_three_token_fold
-            } else if (self.token_vec[left].token_type == TokenType::Bareword ||
-                       self.token_vec[left].token_type == TokenType::Number) &&
-                      self.token_vec[left + 1].token_type == TokenType::Operator &&
-                      (self.token_vec[left + 2].token_type == TokenType::Number ||
-                       self.token_vec[left + 2].token_type == TokenType::Bareword) {
+            } else if (window.tokens[left].token_type == TokenType::Bareword ||
+                       window.tokens[left].token_type == TokenType::Number) &&
+                      window.tokens[left + 1].token_type == TokenType::Operator &&
+                      (window.tokens[left + 2].token_type == TokenType::Number ||
+                       window.tokens[left + 2].token_type == TokenType::Bareword) {
                 pos -= 2;
                 left = 0;
                 continue;
             
             // FOLD: (bareword|number|string|variable) operator :: sqltype -> first (PostgreSQL casting) - from apply_three_token_fold
-            } else if (self.token_vec[left].token_type == TokenType::Bareword ||
-                       self.token_vec[left].token_type == TokenType::Number ||
-                       self.token_vec[left].token_type == TokenType::Variable ||
-                       self.token_vec[left].token_type == TokenType::String) &&
-                      self.token_vec[left + 1].token_type == TokenType::Operator &&
-                      self.token_vec[left + 1].len == 2 && 
-                      self.token_vec[left + 1].val[0] == b':' && 
-                      self.token_vec[left + 1].val[1] == b':' &&
-                      self.token_vec[left + 2].token_type == TokenType::SqlType {
+            } else if (window.tokens[left].token_type == TokenType::Bareword ||
+                       window.tokens[left].token_type == TokenType::Number ||
+                       window.tokens[left].token_type == TokenType::Variable ||
+                       window.tokens[left].token_type == TokenType::String) &&
+                      window.tokens[left + 1].token_type == TokenType::Operator &&
+                      window.tokens[left + 1].len == 2 && 
+                      window.byte(left + 1, 0) == b':' && 
+                      window.byte(left + 1, 1) == b':' &&
+                      window.tokens[left + 2].token_type == TokenType::SqlType {
                 pos -= 2;
                 left = 0;
                 self.stats_folds += 2; // Only this 3-token rule increments stats_folds (by 2)
                 continue;
             
             // FOLD: (bareword|number|string|variable) comma (number|bareword|string|variable) -> first_token - from apply_three_token_fold
-            } else if (self.token_vec[left].token_type == TokenType::Bareword ||
-                       self.token_vec[left].token_type == TokenType::Number ||
-                       self.token_vec[left].token_type == TokenType::String ||
-                       self.token_vec[left].token_type == TokenType::Variable) &&
-                      self.token_vec[left + 1].token_type == TokenType::Comma &&
-                      (self.token_vec[left + 2].token_type == TokenType::Number ||
-                       self.token_vec[left + 2].token_type == TokenType::Bareword ||
-                       self.token_vec[left + 2].token_type == TokenType::String ||
-                       self.token_vec[left + 2].token_type == TokenType::Variable) {
+            } else if (window.tokens[left].token_type == TokenType::Bareword ||
+                       window.tokens[left].token_type == TokenType::Number ||
+                       window.tokens[left].token_type == TokenType::String ||
+                       window.tokens[left].token_type == TokenType::Variable) &&
+                      window.tokens[left + 1].token_type == TokenType::Comma &&
+                      (window.tokens[left + 2].token_type == TokenType::Number ||
+                       window.tokens[left + 2].token_type == TokenType::Bareword ||
+                       window.tokens[left + 2].token_type == TokenType::String ||
+                       window.tokens[left + 2].token_type == TokenType::Variable) {
                 pos -= 2;
                 left = 0;
                 continue;
             
             // FOLD: (expression|group|comma) + unary_op + leftparens -> remove unary - from apply_three_token_fold
-            } else if (self.token_vec[left].token_type == TokenType::Expression ||
-                       self.token_vec[left].token_type == TokenType::Group ||
-                       self.token_vec[left].token_type == TokenType::Comma) &&
-                      self.is_unary_op(&self.token_vec[left + 1]) &&
-                      self.token_vec[left + 2].token_type == TokenType::LeftParenthesis {
+            } else if (window.tokens[left].token_type == TokenType::Expression ||
+                       window.tokens[left].token_type == TokenType::Group ||
+                       window.tokens[left].token_type == TokenType::Comma) &&
+                      self.is_unary_op(&window, left + 1) &&
+                      window.tokens[left + 2].token_type == TokenType::LeftParenthesis {
                 // got something like SELECT + (, LIMIT + ( - remove unary operator
-                self.token_vec[left + 1] = self.token_vec[left + 2].clone();
+                window.copy_slot(left + 1, left + 2);
                 pos -= 1;
                 left = 0;
                 continue;
             
             // FOLD: (keyword|expression|group) + unary_op + (number|bareword|variable|string|function) -> remove unary - from apply_three_token_fold
-            } else if (self.token_vec[left].token_type == TokenType::Keyword ||
-                       self.token_vec[left].token_type == TokenType::Expression ||
-                       self.token_vec[left].token_type == TokenType::Group) &&
-                      self.is_unary_op(&self.token_vec[left + 1]) &&
-                      (self.token_vec[left + 2].token_type == TokenType::Number ||
-                       self.token_vec[left + 2].token_type == TokenType::Bareword ||
-                       self.token_vec[left + 2].token_type == TokenType::Variable ||
-                       self.token_vec[left + 2].token_type == TokenType::String ||
-                       self.token_vec[left + 2].token_type == TokenType::Function) {
+            } else if (window.tokens[left].token_type == TokenType::Keyword ||
+                       window.tokens[left].token_type == TokenType::Expression ||
+                       window.tokens[left].token_type == TokenType::Group) &&
+                      self.is_unary_op(&window, left + 1) &&
+                      (window.tokens[left + 2].token_type == TokenType::Number ||
+                       window.tokens[left + 2].token_type == TokenType::Bareword ||
+                       window.tokens[left + 2].token_type == TokenType::Variable ||
+                       window.tokens[left + 2].token_type == TokenType::String ||
+                       window.tokens[left + 2].token_type == TokenType::Function) {
                 // remove unary operators - select - 1
-                self.token_vec[left + 1] = self.token_vec[left + 2].clone();
+                window.copy_slot(left + 1, left + 2);
                 pos -= 1;
                 left = 0;
                 continue;
             
             // FOLD: comma + unary_op + (number|bareword|variable|string) -> remove unary, backup - from apply_three_token_fold
-            } else if self.token_vec[left].token_type == TokenType::Comma &&
-                      self.is_unary_op(&self.token_vec[left + 1]) &&
-                      (self.token_vec[left + 2].token_type == TokenType::Number ||
-                       self.token_vec[left + 2].token_type == TokenType::Bareword ||
-                       self.token_vec[left + 2].token_type == TokenType::Variable ||
-                       self.token_vec[left + 2].token_type == TokenType::String) {
+            } else if window.tokens[left].token_type == TokenType::Comma &&
+                      self.is_unary_op(&window, left + 1) &&
+                      (window.tokens[left + 2].token_type == TokenType::Number ||
+                       window.tokens[left + 2].token_type == TokenType::Bareword ||
+                       window.tokens[left + 2].token_type == TokenType::Variable ||
+                       window.tokens[left + 2].token_type == TokenType::String) {
                 // interesting case turn ", -1" ->> ",1" PLUS we need to back up one token if possible 
                 // to see if more folding can be done - "1,-1" --> "1"
-                self.token_vec[left + 1] = self.token_vec[left + 2].clone();
+                window.copy_slot(left + 1, left + 2);
                 left = 0;
                 // pos is >= 3 so this is safe
                 if pos >= 3 {
@@ -870,49 +1215,49 @@ impl<'a> SqliState<'a> {
                 continue;
             
             // FOLD: comma + unary_op + function -> remove unary only - from apply_three_token_fold  
-            } else if self.token_vec[left].token_type == TokenType::Comma &&
-                      self.is_unary_op(&self.token_vec[left + 1]) &&
-                      self.token_vec[left + 2].token_type == TokenType::Function {
+            } else if window.tokens[left].token_type == TokenType::Comma &&
+                      self.is_unary_op(&window, left + 1) &&
+                      window.tokens[left + 2].token_type == TokenType::Function {
                 // Separate case from above since you end up with
                 // 1,-sin(1) --> 1 (1)
                 // Here, just do
                 // 1,-sin(1) --> 1,sin(1)
                 // just remove unary operator
-                self.token_vec[left + 1] = self.token_vec[left + 2].clone();
+                window.copy_slot(left + 1, left + 2);
                 pos -= 1;
                 left = 0;
                 continue;
             
             // FOLD: bareword . bareword -> bareword (database.table -> table) - from apply_three_token_fold
-            } else if self.token_vec[left].token_type == TokenType::Bareword &&
-                      self.token_vec[left + 1].token_type == TokenType::Dot &&
-                      self.token_vec[left + 2].token_type == TokenType::Bareword {
+            } else if window.tokens[left].token_type == TokenType::Bareword &&
+                      window.tokens[left + 1].token_type == TokenType::Dot &&
+                      window.tokens[left + 2].token_type == TokenType::Bareword {
                 // ignore the '.n' - typically is this databasename.table
                 pos -= 2;
                 left = 0;
                 continue;
             
             // FOLD: expression . bareword -> bareword (SELECT . `foo` -> SELECT `foo`) - from apply_three_token_fold
-            } else if self.token_vec[left].token_type == TokenType::Expression &&
-                      self.token_vec[left + 1].token_type == TokenType::Dot &&
-                      self.token_vec[left + 2].token_type == TokenType::Bareword {
+            } else if window.tokens[left].token_type == TokenType::Expression &&
+                      window.tokens[left + 1].token_type == TokenType::Dot &&
+                      window.tokens[left + 2].token_type == TokenType::Bareword {
                 // select . `foo` --> select `foo`
-                self.token_vec[left + 1] = self.token_vec[left + 2].clone();
+                window.copy_slot(left + 1, left + 2);
                 pos -= 1;
                 left = 0;
                 continue;
             
             // FOLD: function + leftparens + (not rightparens) -> handle special functions - from apply_three_token_fold
-            } else if self.token_vec[left].token_type == TokenType::Function &&
-                      self.token_vec[left + 1].token_type == TokenType::LeftParenthesis &&
-                      self.token_vec[left + 2].token_type != TokenType::RightParenthesis {
+            } else if window.tokens[left].token_type == TokenType::Function &&
+                      window.tokens[left + 1].token_type == TokenType::LeftParenthesis &&
+                      window.tokens[left + 2].token_type != TokenType::RightParenthesis {
                 // whats going on here
                 // Some SQL functions like USER() have 0 args
                 // if we get User(foo), then User is not a function
                 // This should be expanded since it eliminated a lot of false positives.
-                let val = self.token_vec[left].value_as_str();
+                let val = window.value(left);
                 if self.cstrcasecmp("USER", val) == 0 {
-                    self.token_vec[left].token_type = TokenType::Bareword;
+                    window.tokens[left].token_type = TokenType::Bareword;
                 }
                 // NOTE: C version falls through here - no continue
             }
@@ -936,7 +1281,7 @@ impl<'a> SqliState<'a> {
         // * And it's empty?
         // Then convert it to comment
         if left > 2 {
-            let last_token = &mut self.token_vec[left - 1];
+            let last_token = &mut window.tokens[left - 1];
             if last_token.token_type == TokenType::Bareword &&
                last_token.str_open == b'`' &&
                last_token.len == 0 &&
@@ -945,57 +1290,127 @@ impl<'a> SqliState<'a> {
             }
         }
         
-        // Copy final tokens to the tokens vector for fingerprinting
+        // Keep the final tokens for fingerprinting
         // Use left instead of pos to match C implementation exactly
-        self.tokens.clear();
         for i in 0..left.min(LIBINJECTION_SQLI_MAX_TOKENS) {
-            if self.token_vec[i].token_type != TokenType::None {
-                self.tokens.push(self.token_vec[i].clone());
+            if window.tokens[i].token_type != TokenType::None {
+                self.keep_folded(window.tokens[i], window.value(i), keep_tokens);
             }
         }
         
-        // Copy tokenizer statistics
-        self.stats_comment_c = tokenizer.stats_comment_c;
-        self.stats_comment_ddw = tokenizer.stats_comment_ddw;
-        self.stats_comment_ddx = tokenizer.stats_comment_ddx;
-        self.stats_comment_hash = tokenizer.stats_comment_hash;
+        self.finish_fold(&tokenizer, more);
         
         // Add last comment back to token array if there's space (matches C lines 1873-1877)
         if left < LIBINJECTION_SQLI_MAX_TOKENS && last_comment.token_type == TokenType::Comment {
-            self.tokens.push(last_comment);
+            self.keep_folded(last_comment, last_comment.span(self.input), keep_tokens);
             left += 1; // C line 1876: left += 1;
         }
         
         left
     }
     
-    fn is_unary_op(&self, token: &Token) -> bool {
-        if token.token_type != TokenType::Operator {
+    // Copies the tokenizer statistics and records how much input the fold
+    // depended on. Every exit from a fold goes through here, so neither is
+    // left over from an earlier pass.
+    fn finish_fold<const DIALECT: u32>(&mut self, tokenizer: &SqliTokenizer<'a, DIALECT>, more: bool) {
+        self.fold_reach = if more { Some(tokenizer.reach()) } else { None };
+        self.stats_comment_c = tokenizer.stats_comment_c;
+        self.stats_comment_ddw = tokenizer.stats_comment_ddw;
+        self.stats_comment_ddx = tokenizer.stats_comment_ddx;
+        self.stats_comment_hash = tokenizer.stats_comment_hash;
+    }
+    
+    /// Pulls the next token for folding, replaying it from an earlier pass
+    /// when that pass tokenized the same position under equivalent flags
+    fn next_folding_token<const DIALECT: u32>(&mut self, tokenizer: &mut SqliTokenizer<'a, DIALECT>) -> Option<SlimToken> {
+        if self.stats_tokens >= self.limits.max_tokens {
+            self.token_limit_hit = true;
+            return None;
+        }
+        
+        let start = tokenizer.position();
+        let shareable = self.shareable_step(start);
+        
+        if shareable {
+            if let Some((token, end, reach, stats)) = self.token_cache.get(start, self.dialect_bits()) {
+                tokenizer.skip_to(end, reach, &stats);
+                return token;
+            }
+        }
+        
+        if shareable {
+            self.tokenize_shared(tokenizer)
+        } else {
+            tokenizer.next_slim_token()
+        }
+    }
+    
+    /// Tokenizer for [`prefetch`](Self::prefetch), reading what the first
+    /// detection pass reads
+    #[cfg(feature = "batch")]
+    pub(crate) fn prefetch_tokenizer(&self) -> SqliTokenizer<'a> {
+        let tokenizer = SqliTokenizer::new(self.input, self.flags);
+        match self.rules {
+            Some(rules) => tokenizer.with_rules(rules),
+            None => tokenizer,
+        }
+    }
+    
+    /// Runs `tokenizer` one step ahead of the first detection pass, which
+    /// then replays the step from the token cache. Returns false once the
+    /// input is used up or the step would not be shared.
+    #[cfg(feature = "batch")]
+    pub(crate) fn prefetch(&mut self, tokenizer: &mut SqliTokenizer<'a>) -> bool {
+        self.shareable_step(tokenizer.position()) && self.tokenize_shared(tokenizer).is_some()
+    }
+    
+    // The quote context only changes the token at position 0
+    fn shareable_step(&self, start: usize) -> bool {
+        start != 0 || self.flags.quote_context() == CHAR_NULL
+    }
+    
+    fn dialect_bits(&self) -> u32 {
+        self.flags.0 & (SqliFlags::FLAG_SQL_ANSI.0 | SqliFlags::FLAG_SQL_MYSQL.0)
+    }
+    
+    // Tokenizes one step and remembers it for the passes after this one
+    fn tokenize_shared<const DIALECT: u32>(&mut self, tokenizer: &mut SqliTokenizer<'a, DIALECT>) -> Option<SlimToken> {
+        let start = tokenizer.position();
+        let before = tokenizer.comment_stats();
+        let token = tokenizer.next_slim_token();
+        let step_dialect = if tokenizer.last_token_dialect_dependent() { Some(self.dialect_bits()) } else { None };
+        let stats = tokenizer.comment_stats().delta_since(&before);
+        self.token_cache.insert(start, tokenizer.position(), tokenizer.reach(), step_dialect, token, stats);
+        token
+    }
+    
+    fn is_unary_op(&self, window: &FoldWindow<'_>, i: usize) -> bool {
+        if window.tokens[i].token_type != TokenType::Operator {
             return false;
         }
         
-        let val = token.value_as_str();
+        let val = window.value(i);
         match val.len() {
-            1 => matches!(val.chars().next(), Some('+' | '-' | '!' | '~')),
-            2 => val == "!!",
+            1 => matches!(val[0], b'+' | b'-' | b'!' | b'~'),
+            2 => val == b"!!",
             3 => self.cstrcasecmp("NOT", val) == 0,
             _ => false,
         }
     }
     
-    fn is_arithmetic_op(&self, token: &Token) -> bool {
-        if token.token_type != TokenType::Operator || token.len != 1 {
+    fn is_arithmetic_op(&self, window: &FoldWindow<'_>, i: usize) -> bool {
+        if window.tokens[i].token_type != TokenType::Operator || window.tokens[i].len != 1 {
             return false;
         }
         
-        let ch = token.val[0] as char;
+        let ch = window.byte(i, 0) as char;
         matches!(ch, '*' | '/' | '-' | '+' | '%')
     }
     
     /// Case-insensitive string comparison that matches C's cstrcasecmp exactly
-    fn cstrcasecmp(&self, a: &str, b: &str) -> i32 {
+    fn cstrcasecmp(&self, a: &str, b: &[u8]) -> i32 {
         let a_bytes = a.as_bytes();
-        let b_bytes = b.as_bytes();
+        let b_bytes = b;
         let n = a_bytes.len();
         
         if n != b_bytes.len() {
@@ -1017,15 +1432,15 @@ impl<'a> SqliState<'a> {
         if n == 0 { 0 } else { 0 }
     }
     
-    fn generate_fingerprint(&mut self, token_count: usize) {
+    fn generate_fingerprint(&mut self, token_count: usize, keep_tokens: bool) {
         let mut fp_idx = 0;
         
         for i in 0..token_count {
-            if fp_idx >= 8 || i >= self.tokens.len() {
+            if fp_idx >= 8 || i >= self.folded_len {
                 break;
             }
             
-            let token = &self.tokens[i];
+            let token = &self.folded[i].slim;
             let ch = match token.token_type {
                 TokenType::Keyword => b'k',
                 TokenType::Union => b'U',
@@ -1078,7 +1493,14 @@ impl<'a> SqliState<'a> {
             
             // Reset the token vector to contain just the Evil token
             // to match C's behavior of clearing tokenvec and setting first token to Evil
-            if !self.tokens.is_empty() {
+            if self.folded_len > 0 {
+                let mut evil = SlimToken::EMPTY;
+                evil.token_type = TokenType::Evil;
+                evil.len = 1;
+                self.folded[0] = FoldedToken::new(evil, b"X");
+                self.folded_len = 1;
+            }
+            if keep_tokens && !self.tokens.is_empty() {
                 self.tokens.clear();
                 let mut val = [0u8; 32];
                 val[0] = b'X';
@@ -1096,9 +1518,11 @@ impl<'a> SqliState<'a> {
     }
     
     pub(crate) fn check_is_sqli(&self, fingerprint: &Fingerprint) -> bool {
-        let is_bl = blacklist::is_blacklisted(fingerprint.as_str());
+        let is_bl = overlay::is_blacklisted_fingerprint(self.rules, &fingerprint.fingerprint);
         if is_bl {
             let result = self.is_not_whitelist();
+            #[cfg(feature = "metrics")]
+            crate::metrics::sqli_blacklisted(!result);
             result
         } else {
             false
@@ -1129,8 +1553,10 @@ impl<'a> SqliState<'a> {
     }
     
     fn contains_sp_password(&self) -> bool {
-        let input_str = core::str::from_utf8(self.input).unwrap_or("");
-        input_str.to_ascii_lowercase().contains("sp_password")
+        // Any case, and only in UTF-8 input, without lowercasing a copy
+        const NEEDLE: &[u8] = b"sp_password";
+        self.input.windows(NEEDLE.len()).any(|window| window.eq_ignore_ascii_case(NEEDLE))
+            && core::str::from_utf8(self.input).is_ok()
     }
     
     fn handle_two_token_whitelist(&self) -> bool {
@@ -1139,7 +1565,7 @@ impl<'a> SqliState<'a> {
             .trim_end_matches('\0');
             
             
-        if self.tokens.len() < 2 {
+        if self.folded_len < 2 {
             return true;
         }
         
@@ -1158,31 +1584,31 @@ impl<'a> SqliState<'a> {
         
         // If second token starts with '#' ignore - too many false positives
         // This matches C behavior at libinjection_sqli.c:2078
-        if !self.tokens[1].val.is_empty() && self.tokens[1].val[0] == b'#' {
+        if self.folded[1].head[0] == b'#' {
             return false;
         }
         
         // For fingerprint like 'nc', only comments of /* are treated as SQL
         // ending comments of "--" and "#" are not SQLi
         // Reference: libinjection_sqli.c:2084-2087
-        if self.tokens[0].token_type == TokenType::Bareword &&
-           self.tokens[1].token_type == TokenType::Comment &&
-           self.tokens[1].val[0] != b'/' {
+        if self.folded[0].slim.token_type == TokenType::Bareword &&
+           self.folded[1].slim.token_type == TokenType::Comment &&
+           self.folded[1].head[0] != b'/' {
             return false;
         }
         
         // If '1c' ends with '/*' then it's SQLi
         // Reference: libinjection_sqli.c:2059-2066
-        if self.tokens[0].token_type == TokenType::Number &&
-           self.tokens[1].token_type == TokenType::Comment &&
-           self.tokens[1].val[0] == b'/' {
+        if self.folded[0].slim.token_type == TokenType::Number &&
+           self.folded[1].slim.token_type == TokenType::Comment &&
+           self.folded[1].head[0] == b'/' {
             return true;
         }
         
         // Handle number followed by comment
         // Reference: libinjection_sqli.c:2115-2116
-        if self.tokens[0].token_type == TokenType::Number &&
-           self.tokens[1].token_type == TokenType::Comment {
+        if self.folded[0].slim.token_type == TokenType::Number &&
+           self.folded[1].slim.token_type == TokenType::Comment {
             
             if self.stats_tokens > 2 {
                 // We have some folding going on, highly likely SQLi
@@ -1197,8 +1623,8 @@ impl<'a> SqliState<'a> {
             // `sql_state->s[sql_state->tokenvec[0].pos + sql_state->tokenvec[0].len]`
             // This causes incorrect position calculation when the first token doesn't start at position 0.
             // We replicate this bug for exact C compatibility, though the correct logic would be:
-            // let token0_end = self.tokens[0].pos + self.tokens[0].len;
-            let token0_end = self.tokens[0].len;  // BUG: Should be pos + len, matches C bug
+            // let token0_end = self.folded[0].slim.pos + usize::from(self.folded[0].slim.len);
+            let token0_end = usize::from(self.folded[0].slim.len);  // BUG: Should be pos + len, matches C bug
             
             if token0_end < self.input.len() {
                 let ch = self.input[token0_end];
@@ -1229,7 +1655,7 @@ impl<'a> SqliState<'a> {
         // Detect obvious SQLi scans - only if comment is longer than "--"
         // so only detect if input ends with '--', e.g. 1-- but not 1-- foo
         // This matches C code at libinjection_sqli.c:2151-2155
-        if self.tokens[1].len > 2 && self.tokens[1].val[0] == b'-' {
+        if usize::from(self.folded[1].slim.len) > 2 && self.folded[1].head[0] == b'-' {
             return false;
         }
         
@@ -1242,15 +1668,15 @@ impl<'a> SqliState<'a> {
             .unwrap_or("")
             .trim_end_matches('\0');
             
-        if self.tokens.len() < 3 {
+        if self.folded_len < 3 {
             return true;
         }
         
         // String concatenation patterns: ...foo' + 'bar...
         if fingerprint_str == "sos" || fingerprint_str == "s&s" {
-            if self.tokens[0].str_open == CHAR_NULL &&
-               self.tokens[2].str_close == CHAR_NULL &&
-               self.tokens[0].str_close == self.tokens[2].str_open {
+            if self.folded[0].slim.str_open == CHAR_NULL &&
+               self.folded[2].slim.str_close == CHAR_NULL &&
+               self.folded[0].slim.str_close == self.folded[2].slim.str_open {
                 // Pattern like ....foo" + "bar....
                 // This matches C behavior at libinjection_sqli.c:2169-2177
                 return true;
@@ -1279,10 +1705,10 @@ impl<'a> SqliState<'a> {
         }
         
         // Check if middle token is a keyword (matching C behavior at libinjection_sqli.c:2201-2209)
-        if self.tokens.len() >= 2 && self.tokens[1].token_type == TokenType::Keyword {
+        if self.folded_len >= 2 && self.folded[1].slim.token_type == TokenType::Keyword {
             // If it's not "INTO OUTFILE" or "INTO DUMPFILE" (MySQL), then treat as safe
-            if self.tokens[1].len < 5 || 
-               !self.tokens[1].val.starts_with(b"INTO") {
+            if usize::from(self.folded[1].slim.len) < 5 || 
+               self.folded[1].head != *b"INTO" {
                 return false;
             }
         }
@@ -1294,14 +1720,19 @@ impl<'a> SqliState<'a> {
 }
 
 // Re-export tokenizer types
-pub use tokenizer::{Token, TokenType, SqliTokenizer};
+pub use tokenizer::{Token, TokenType, SqliTokenizer, DIALECT_ANSI, DIALECT_FROM_FLAGS, DIALECT_MYSQL};
 
 mod tokenizer;
+mod token_cache;
+pub(crate) mod scan;
 pub mod blacklist;
 pub mod sqli_data;
 
 // Import CHAR_NULL for internal use
-use tokenizer::CHAR_NULL;
+use tokenizer::{CHAR_NULL, MAX_LOOKAHEAD, SlimToken};
+use crate::overlay::{self, Rules};
+pub(crate) use tokenizer::LIBINJECTION_SQLI_TOKEN_SIZE;
+use token_cache::TokenCache;
 
 #[cfg(test)]
 mod tests;
\ No newline at end of file
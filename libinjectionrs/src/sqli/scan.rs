@@ -0,0 +1,144 @@
+// Byte scanning used by the SQL tokenizer (and the html5 one, see
+// `xss::scan`)
+//
+// Searches for single bytes and short needles (string terminators, end of
+// line, `*/`, `]`, `$$`) go through memchr when the `simd` feature is
+// enabled. memchr picks SSE2/AVX2 on x86_64 and NEON on aarch64 at runtime.
+// Without the feature they fall back to plain byte loops with identical
+// results.
+//
+// Byte-class scans (end of a word or variable name, runs of whitespace) use a
+// 256-entry class table and test eight bytes per step with a single branch,
+// only dropping to byte-at-a-time to locate the hit inside the chunk.
+
+use super::sqli_data::{CharType, CHAR_MAP};
+
+pub(crate) struct ByteClass([u8; 256]);
+
+impl ByteClass {
+    pub(crate) const fn from_bytes(set: &[u8]) -> Self {
+        let mut table = [0u8; 256];
+        let mut i = 0;
+        while i < set.len() {
+            table[set[i] as usize] = 1;
+            i += 1;
+        }
+        ByteClass(table)
+    }
+
+    const fn from_char_type(char_type: CharType) -> Self {
+        let mut table = [0u8; 256];
+        let mut i = 0;
+        while i < 256 {
+            table[i] = (CHAR_MAP[i] as u8 == char_type as u8) as u8;
+            i += 1;
+        }
+        ByteClass(table)
+    }
+
+    #[inline]
+    pub fn contains(&self, b: u8) -> bool {
+        self.0[b as usize] != 0
+    }
+
+    /// Index of the first byte in the class, or `haystack.len()`
+    #[inline]
+    pub fn find(&self, haystack: &[u8]) -> usize {
+        self.scan(haystack, 1)
+    }
+
+    /// Index of the first byte outside the class, or `haystack.len()`
+    #[inline]
+    pub fn find_not(&self, haystack: &[u8]) -> usize {
+        self.scan(haystack, 0)
+    }
+
+    #[inline]
+    fn scan(&self, haystack: &[u8], stop: u8) -> usize {
+        let table = &self.0;
+        let mut chunks = haystack.chunks_exact(8);
+        let mut offset = 0;
+        for chunk in &mut chunks {
+            let mut hit = 0;
+            for &b in chunk {
+                hit |= table[b as usize] ^ stop ^ 1;
+            }
+            if hit != 0 {
+                break;
+            }
+            offset += 8;
+        }
+        haystack[offset..]
+            .iter()
+            .position(|&b| table[b as usize] == stop)
+            .map_or(haystack.len(), |i| offset + i)
+    }
+}
+
+/// Bytes that end a word, the C `strlencspn` set in `parse_word`
+pub(crate) static WORD_DELIMITERS: ByteClass =
+    ByteClass::from_bytes(b" []{}<>:\\?=@!#~+-*/&|^%(),';\t\n\x0B\x0C\r\"\xA0\x00");
+
+/// Bytes that end a variable name, the C `strlencspn` set in `parse_var`
+pub(crate) static VARIABLE_DELIMITERS: ByteClass =
+    ByteClass::from_bytes(b" <>:\\?=@!#~+-*/&|^%(),;'\t\n\x0B\x0C\r'`\"");
+
+/// Bytes that the tokenizer skips as whitespace, taken from `CHAR_MAP`
+pub(crate) static WHITESPACE: ByteClass = ByteClass::from_char_type(CharType::White);
+
+/// Position of the first `needle` in `haystack`
+#[inline]
+pub(crate) fn find_byte(needle: u8, haystack: &[u8]) -> Option<usize> {
+    #[cfg(feature = "simd")]
+    {
+        memchr::memchr(needle, haystack)
+    }
+    #[cfg(not(feature = "simd"))]
+    {
+        haystack.iter().position(|&b| b == needle)
+    }
+}
+
+/// Position of the first byte equal to either `a` or `b`
+#[inline]
+pub(crate) fn find_either(a: u8, b: u8, haystack: &[u8]) -> Option<usize> {
+    #[cfg(feature = "simd")]
+    {
+        memchr::memchr2(a, b, haystack)
+    }
+    #[cfg(not(feature = "simd"))]
+    {
+        haystack.iter().position(|&x| x == a || x == b)
+    }
+}
+
+/// Position of the first `first` immediately followed by `second`
+#[inline]
+pub(crate) fn find_pair(first: u8, second: u8, haystack: &[u8]) -> Option<usize> {
+    let mut start = 0;
+    while let Some(i) = find_byte(first, &haystack[start..]) {
+        let at = start + i;
+        match haystack.get(at + 1) {
+            Some(&b) if b == second => return Some(at),
+            Some(_) => start = at + 1,
+            None => return None,
+        }
+    }
+    None
+}
+
+/// Position of the first occurrence of `needle` in `haystack`
+#[inline]
+pub(crate) fn find_bytes(needle: &[u8], haystack: &[u8]) -> Option<usize> {
+    #[cfg(feature = "simd")]
+    {
+        memchr::memmem::find(haystack, needle)
+    }
+    #[cfg(not(feature = "simd"))]
+    {
+        if needle.is_empty() {
+            return Some(0);
+        }
+        haystack.windows(needle.len()).position(|window| window == needle)
+    }
+}
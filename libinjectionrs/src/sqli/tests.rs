@@ -96,7 +96,297 @@ mod tests {
         assert!(!blacklist::is_blacklisted(""));
         assert!(!blacklist::is_blacklisted("safe"));
     }
-    
+
+    #[test]
+    fn test_fingerprint_set_matches_keyword_table() {
+        // The dedicated set must agree with the C-style '0'-prefixed keyword lookup
+        let alphabet = b"&()1;ABEFTUXcfknosv,";
+        let mut candidates: Vec<Vec<u8>> = Vec::new();
+        for &a in alphabet {
+            candidates.push(vec![a]);
+            for &b in alphabet {
+                candidates.push(vec![a, b]);
+                for &c in alphabet {
+                    candidates.push(vec![a, b, c]);
+                }
+            }
+        }
+        for keyword in sqli_data::SQL_KEYWORDS {
+            if keyword.token_type == b'F' {
+                candidates.push(keyword.word.as_bytes()[1..].to_ascii_lowercase());
+            }
+        }
+
+        for fp in candidates {
+            let mut prefixed = vec![b'0'];
+            prefixed.extend_from_slice(&fp);
+            let expected = sqli_data::lookup_word_bytes(&prefixed) == TokenType::Fingerprint;
+
+            let mut raw = [0u8; 8];
+            raw[..fp.len()].copy_from_slice(&fp);
+            assert_eq!(blacklist::is_blacklisted_fingerprint(&raw), expected, "{:?}", fp);
+            assert_eq!(blacklist::is_blacklisted(core::str::from_utf8(&fp).unwrap()), expected);
+        }
+        assert!(!blacklist::is_blacklisted_fingerprint(&[0u8; 8]));
+    }
+
+    #[test]
+    fn test_reparse_reuses_tokens_consistently() {
+        // Folding after earlier passes on the same state must match a fresh state
+        let inputs: &[&[u8]] = &[
+            b"1' OR '1'='1",
+            b"1 #comment\n union select 1",
+            b"admin'--x\nunion select",
+            b"\"a\" or 1=1 -- x",
+            b"a/* c */b' and 2>1 # \"",
+        ];
+        let passes = [
+            SqliFlags::new(SqliFlags::FLAG_QUOTE_NONE.0 | SqliFlags::FLAG_SQL_ANSI.0),
+            SqliFlags::new(SqliFlags::FLAG_QUOTE_NONE.0 | SqliFlags::FLAG_SQL_MYSQL.0),
+            SqliFlags::new(SqliFlags::FLAG_QUOTE_SINGLE.0 | SqliFlags::FLAG_SQL_ANSI.0),
+            SqliFlags::new(SqliFlags::FLAG_QUOTE_SINGLE.0 | SqliFlags::FLAG_SQL_MYSQL.0),
+            SqliFlags::new(SqliFlags::FLAG_QUOTE_DOUBLE.0 | SqliFlags::FLAG_SQL_MYSQL.0),
+        ];
+
+        for input in inputs {
+            let mut shared = SqliState::new(input, passes[0]);
+            for (i, &flags) in passes.iter().enumerate() {
+                if i > 0 {
+                    shared.reset(flags);
+                }
+                let mut fresh = SqliState::new(input, flags);
+                assert_eq!(shared.fingerprint().as_str(), fresh.fingerprint().as_str());
+                assert_eq!(shared.tokens.len(), fresh.tokens.len());
+                for (a, b) in shared.tokens.iter().zip(fresh.tokens.iter()) {
+                    assert_eq!(a.token_type, b.token_type);
+                    assert_eq!(a.pos, b.pos);
+                    assert_eq!(a.len, b.len);
+                    assert_eq!(a.val, b.val);
+                }
+                assert_eq!(shared.stats_comment_c, fresh.stats_comment_c);
+                assert_eq!(shared.stats_comment_ddx, fresh.stats_comment_ddx);
+                assert_eq!(shared.stats_comment_hash, fresh.stats_comment_hash);
+                assert_eq!(shared.stats_tokens, fresh.stats_tokens);
+            }
+        }
+    }
+
+    #[test]
+    fn test_slim_tokens_materialize_values() {
+        assert!(core::mem::size_of::<crate::sqli::tokenizer::SlimToken>() <= 16);
+
+        // Merged words are the one value that is not a span of the input
+        let mut state = SqliState::new(b"1 UNION   ALL SELECT 2", SqliFlags::FLAG_NONE);
+        state.fold_tokens();
+        let values: Vec<&[u8]> = state.tokens.iter().map(|t| &t.val[..t.len]).collect();
+        assert_eq!(values, vec![&b"1"[..], b"UNION ALL", b"SELECT", b"2"]);
+        assert!(state.tokens.iter().all(|t| t.val[t.len..].iter().all(|&b| b == 0)));
+
+        // Long values stay truncated to the C token size
+        let long = [b'a'; 40];
+        let mut state = SqliState::new(&long, SqliFlags::FLAG_NONE);
+        state.fold_tokens();
+        assert_eq!(state.tokens[0].len, 31);
+        assert_eq!(&state.tokens[0].val[..31], &long[..31]);
+    }
+
+    #[test]
+    fn test_byte_scanners_match_naive_search() {
+        use crate::sqli::scan::{self, WHITESPACE, WORD_DELIMITERS};
+        use crate::sqli::sqli_data::{get_char_type, CharType};
+
+        // Cover every offset around the 8-byte chunk boundary
+        let fill = b"abcdefghijklmnopqrstuvwx";
+        for len in 0..fill.len() {
+            for hit in 0..=len {
+                let mut input = fill[..len].to_vec();
+                if hit < len {
+                    input[hit] = b'*';
+                }
+                let expected = input.iter().position(|&b| b == b'*').unwrap_or(input.len());
+                assert_eq!(WORD_DELIMITERS.find(&input), expected);
+
+                let mut blank = vec![b' '; len];
+                if hit < len {
+                    blank[hit] = b'x';
+                }
+                let expected = blank.iter().position(|&b| get_char_type(b) != CharType::White).unwrap_or(len);
+                assert_eq!(WHITESPACE.find_not(&blank), expected);
+            }
+        }
+
+        for b in 0..=255u8 {
+            assert_eq!(WHITESPACE.contains(b), get_char_type(b) == CharType::White);
+        }
+
+        assert_eq!(scan::find_pair(b'*', b'/', b"/* ** x */"), Some(8));
+        assert_eq!(scan::find_pair(b'*', b'/', b"abc*"), None);
+        assert_eq!(scan::find_pair(b'$', b'$', b"$$"), Some(0));
+        assert_eq!(scan::find_either(b'.', b'`', b"ab`c.d"), Some(2));
+        assert_eq!(scan::find_bytes(b"$tag$", b"$ta $tag $tag$"), Some(9));
+        assert_eq!(scan::find_bytes(b"$tag$", b"$tag"), None);
+    }
+
+    #[test]
+    fn test_single_byte_fast_path_matches_char_map() {
+        use crate::sqli::sqli_data::{get_char_type, CharType};
+
+        for b in 0..=255u8 {
+            let expected = match get_char_type(b) {
+                CharType::Op1 | CharType::Unary => Some('o'),
+                CharType::LeftParens | CharType::RightParens | CharType::Comma |
+                CharType::Semicolon | CharType::LeftBrace | CharType::RightBrace => Some(b as char),
+                _ => None,
+            };
+            let Some(expected) = expected else { continue };
+
+            let input = [b, b'x'];
+            let mut tokenizer = SqliTokenizer::new(&input, SqliFlags::FLAG_NONE);
+            let token = tokenizer.next_token().unwrap();
+            assert_eq!(token.token_type.to_char(), expected, "byte {:#x}", b);
+            assert_eq!((token.pos, token.len, token.val[0]), (0, 1, b));
+            assert_eq!(tokenizer.next_token().unwrap().token_type, TokenType::Bareword);
+        }
+    }
+
+    #[test]
+    fn test_detected_fingerprint_matches_refold() {
+        let inputs: &[&[u8]] = &[
+            b"",
+            b"hello world",
+            b"1' OR '1'='1",
+            b"1 #comment\n union select 1",
+            b"\"a\" or 1=1 -- x",
+            b"admin'--",
+        ];
+        for input in inputs {
+            let mut state = SqliState::new(input, SqliFlags::FLAG_NONE);
+            state.detect();
+            let flags = state.detected_flags();
+            let recorded = state.detected_fingerprint();
+            assert_eq!(recorded.as_str(), state.get_fingerprint().as_str(), "{:?}", input);
+
+            let mut replay = SqliState::new(input, flags);
+            assert_eq!(recorded.as_str(), replay.get_fingerprint().as_str(), "{:?}", input);
+        }
+    }
+
+    #[test]
+    fn test_detect_keeps_tokens_out_of_the_hot_path() {
+        let inputs: &[&[u8]] = &[
+            b"1 UNION   ALL SELECT 2",
+            b"0{`",
+            b"{ `` x",
+            b"1 INTO OUTFILE 'x'",
+            b"1 -- comment",
+            b"foo' + 'bar",
+        ];
+        for input in inputs {
+            let mut state = SqliState::new(input, SqliFlags::FLAG_NONE);
+            state.detect();
+            assert!(state.tokens.is_empty(), "{:?}", input);
+
+            // The inspection calls fold the same tokens detection used
+            let fingerprint = state.detected_fingerprint();
+            let mut inspect = SqliState::new(input, state.detected_flags());
+            assert_eq!(inspect.get_fingerprint(), fingerprint, "{:?}", input);
+            let types: Vec<TokenType> = inspect.tokens.iter().map(|t| t.token_type).collect();
+            assert_eq!(types.len(), fingerprint.len(), "{:?}", input);
+            assert_eq!(inspect.is_sqli(), state.detect(), "{:?}", input);
+        }
+    }
+
+    #[test]
+    fn test_stage_entry_points() {
+        let inputs: &[&[u8]] = &[
+            b"1 UNION   ALL SELECT 2",
+            b"1 INTO OUTFILE 'x'",
+            b"1 -- comment",
+            b"foo' + 'bar",
+            b"hello world",
+            b"",
+        ];
+        for input in inputs {
+            let mut staged = SqliState::new(input, SqliFlags::FLAG_NONE);
+            let fingerprint = staged.detection_fingerprint();
+            assert!(staged.tokens.is_empty(), "{:?}", input);
+
+            let mut full = SqliState::new(input, SqliFlags::FLAG_NONE);
+            assert_eq!(full.get_fingerprint(), fingerprint, "{:?}", input);
+            let blacklisted = blacklist::is_blacklisted(fingerprint.as_str());
+            assert_eq!(blacklisted && staged.is_not_whitelisted(), full.is_sqli(), "{:?}", input);
+        }
+    }
+
+    #[test]
+    fn test_scan_limits() {
+        let inputs: &[&[u8]] = &[
+            b"hello world",
+            b"1' OR '1'='1",
+            b"1 UNION SELECT a, b FROM users WHERE id = 1 AND the rest keeps going",
+            b"admin'-- and a trailing comment that runs on for a while",
+            b"((((((((((((((((((((((((((((((((((((((((1 or 1=1",
+        ];
+        for input in inputs {
+            let expected = crate::detect_sqli(input);
+            // Limits the input stays within change nothing
+            let roomy = crate::detect_sqli_with_limits(input, SqliFlags::FLAG_NONE, ScanLimits::new(input.len(), 1000));
+            assert_eq!(roomy, expected, "{:?}", input);
+            assert!(!roomy.truncated);
+
+            for max_bytes in 0..input.len() {
+                let limits = ScanLimits::new(max_bytes, usize::MAX);
+                let result = crate::detect_sqli_with_limits(input, SqliFlags::FLAG_NONE, limits);
+                if result.truncated {
+                    assert_eq!(result.is_injection(), crate::detect_sqli(&input[..max_bytes]).is_injection());
+                } else {
+                    // Settled before the cut: exactly the full verdict
+                    assert_eq!(result, expected, "{:?} cut at {}", input, max_bytes);
+                }
+            }
+        }
+
+        // A cut right after `{` and a backtick, which a later pass folds to
+        // Evil; the verdict must not be settled on the reach of an earlier pass
+        let input: &[u8] = b"LIMIT=`a`allCASTuser%2utf8_bin<!--$$charxxmlns<!USER_ID--xE'%ZZ{`a`U&'";
+        assert_eq!(&input[63..65], b"{`");
+        let result = crate::detect_sqli_with_limits(input, SqliFlags::FLAG_NONE, ScanLimits::new(65, usize::MAX));
+        assert!(result.truncated);
+        assert_eq!(result.is_injection(), crate::detect_sqli(&input[..65]).is_injection());
+
+        // The fingerprint window is full long before the cut
+        let mut long = b"1 UNION SELECT a, b FROM users ".to_vec();
+        long.resize(1 << 16, b' ');
+        let result = crate::detect_sqli_with_limits(&long, SqliFlags::FLAG_NONE, ScanLimits::new(1024, 64));
+        assert!(result.is_injection());
+        assert!(!result.truncated);
+
+        // Leading parentheses are skipped one token at a time
+        let parens = [b'('; 4096];
+        let mut state = SqliState::new(&parens, SqliFlags::FLAG_NONE).with_limits(ScanLimits::new(usize::MAX, 100));
+        assert!(!state.detect());
+        assert!(state.truncated());
+        assert!(state.stats_tokens <= 100);
+    }
+
+    #[test]
+    fn test_keyword_perfect_hash() {
+        // Every table entry must be reachable through the perfect hash, in any case
+        for keyword in sqli_data::SQL_KEYWORDS {
+            let found = sqli_data::find_keyword(keyword.word.as_bytes()).unwrap();
+            assert_eq!(found.word, keyword.word);
+            let lower = keyword.word.to_ascii_lowercase();
+            assert_eq!(sqli_data::find_keyword(lower.as_bytes()).unwrap().word, keyword.word);
+        }
+
+        assert_eq!(sqli_data::lookup_word("select"), TokenType::Expression);
+        assert_eq!(sqli_data::lookup_word("UnIoN"), TokenType::Union);
+        assert_eq!(sqli_data::lookup_word("not_a_keyword"), TokenType::Bareword);
+        assert_eq!(sqli_data::lookup_word(""), TokenType::Bareword);
+        assert_eq!(sqli_data::lookup_word_bytes(b"SELEC\xff"), TokenType::Bareword);
+        assert_eq!(sqli_data::lookup_word_bytes(&[b'A'; 64]), TokenType::Bareword);
+    }
+
     #[test]
     fn test_variable_token_symbols_preserved() {
         use crate::sqli::tokenizer::{SqliTokenizer, TokenType};
@@ -622,7 +912,10 @@ mod tests {
         assert_eq!(state.stats_tokens, 2, "Should have stats_tokens = 2 (single tokenization pass)");
         assert_eq!(is_sqli, false, "Should return false due to C bug compatibility");
         
-        // Verify the token structure matches expectations
+        // Verify the token structure matches expectations; detect() does not
+        // keep tokens, so fold the deciding pass again to inspect them
+        let mut state = SqliState::new(input, state.detected_flags());
+        state.fold_tokens();
         assert_eq!(state.tokens.len(), 2, "Should have exactly 2 tokens");
         assert_eq!(state.tokens[0].token_type, TokenType::Number, "First token should be Number");
         assert_eq!(state.tokens[0].value_as_str(), "8", "First token value should be '8'");
@@ -990,4 +1283,78 @@ mod tests {
                     This test should fail initially until the differential is fixed.", 
                    is_sqli_rust);
     }
-}
\ No newline at end of file
+
+    const DIALECT_INPUTS: &[&[u8]] = &[
+        b"1' OR '1'='1",
+        b"1' OR '1'='1' #",
+        b"1 OR 1=1 -- x",
+        b"1 OR 1=1 --x",
+        b"admin\" OR \"1\"=\"1",
+        b"1; DROP TABLE users #comment",
+        b"x' UNION SELECT password FROM users --",
+        b"'; EXEC sp_password --",
+        b"SELECT * FROM t WHERE a=\"b\" AND c='d'",
+        b"1 /*! UNION */ SELECT 1",
+        b"hello world",
+        b"12345",
+        b"",
+    ];
+
+    #[test]
+    fn test_specialized_tokenizers_match_runtime_flags() {
+        use crate::sqli::tokenizer::SqliTokenizer;
+
+        fn tokens<const DIALECT: u32>(input: &[u8], flags: SqliFlags) -> Vec<(TokenType, usize, String)> {
+            let mut tokenizer = SqliTokenizer::<DIALECT>::specialized(input, flags);
+            let mut out = Vec::new();
+            while let Some(token) = tokenizer.next_token() {
+                out.push((token.token_type, token.pos, token.value_as_str().to_string()));
+            }
+            out
+        }
+
+        for &input in DIALECT_INPUTS {
+            for quote in [SqliFlags::FLAG_QUOTE_NONE, SqliFlags::FLAG_QUOTE_SINGLE, SqliFlags::FLAG_QUOTE_DOUBLE] {
+                let ansi = quote | SqliFlags::FLAG_SQL_ANSI;
+                let mysql = quote | SqliFlags::FLAG_SQL_MYSQL;
+                assert_eq!(tokens::<DIALECT_ANSI>(input, ansi), tokens::<DIALECT_FROM_FLAGS>(input, ansi));
+                assert_eq!(tokens::<DIALECT_MYSQL>(input, mysql), tokens::<DIALECT_FROM_FLAGS>(input, mysql));
+            }
+        }
+    }
+
+    #[test]
+    fn test_detect_dialect_runs_only_its_passes() {
+        for &input in DIALECT_INPUTS {
+            for dialect in [SqliFlags::FLAG_SQL_ANSI, SqliFlags::FLAG_SQL_MYSQL] {
+                let mut expected = false;
+                for (quote, byte) in [(SqliFlags::FLAG_QUOTE_NONE, None), (SqliFlags::FLAG_QUOTE_SINGLE, Some(b'\'')), (SqliFlags::FLAG_QUOTE_DOUBLE, Some(b'"'))] {
+                    let needed = match byte {
+                        None => !input.is_empty(),
+                        Some(byte) => input.contains(&byte),
+                    };
+                    if needed && SqliState::new(input, quote | dialect).is_sqli() {
+                        expected = true;
+                        break;
+                    }
+                }
+                let mut state = SqliState::new(input, SqliFlags::FLAG_NONE);
+                assert_eq!(state.detect_dialect(dialect), expected, "{:?} {:?}", String::from_utf8_lossy(input), dialect);
+            }
+        }
+    }
+
+    #[test]
+    fn test_dialect_entry_points() {
+        assert!(crate::detect_sqli_ansi(b"1' OR '1'='1").is_injection());
+        assert!(crate::detect_sqli_mysql(b"1' OR '1'='1").is_injection());
+        assert!(!crate::detect_sqli_ansi(b"hello world").is_injection());
+        assert!(!crate::detect_sqli_mysql(b"12345").is_injection());
+        for &input in DIALECT_INPUTS {
+            let mut state = SqliState::new(input, SqliFlags::FLAG_NONE);
+            assert_eq!(crate::detect_sqli_mysql(input).is_injection(), state.detect_dialect(SqliFlags::FLAG_SQL_MYSQL));
+            let mut state = SqliState::new(input, SqliFlags::FLAG_NONE);
+            assert_eq!(crate::detect_sqli_ansi(input).is_injection(), state.detect_dialect(SqliFlags::FLAG_SQL_ANSI));
+        }
+    }
+}
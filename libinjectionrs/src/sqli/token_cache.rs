@@ -0,0 +1,91 @@
+// Tokenizer results shared between the passes of SqliState::detect
+//
+// libinjection_is_sqli folds the same input up to five times with different
+// flags. A token depends only on where the tokenizer starts, plus:
+//   * the quote context, but only for the token at position 0
+//   * the ANSI/MySQL flags, but only for `#` and `--x` tokens
+// Everything else is identical between passes, so each tokenizer step is
+// remembered by start position and replayed when a later pass reaches the
+// same position, instead of being scanned again.
+//
+// The steps live in a fixed array inside the state, so caching never
+// allocates.
+
+use super::tokenizer::{CommentStats, SlimToken};
+
+// Enough for the tokens a handful of folding passes consume on typical input;
+// steps beyond this are simply not remembered
+const TOKEN_CACHE_SIZE: usize = 16;
+
+#[derive(Clone, Copy)]
+struct CachedStep {
+    // Tokenizer position before and after the step, and its reach
+    start: usize,
+    end: usize,
+    reach: usize,
+    // Dialect bits the step was produced under, if it depended on them
+    dialect: Option<u32>,
+    token: Option<SlimToken>,
+    stats: CommentStats,
+}
+
+const NO_STEP: CachedStep = CachedStep {
+    start: 0,
+    end: 0,
+    reach: 0,
+    dialect: None,
+    token: None,
+    stats: CommentStats { c: 0, ddw: 0, ddx: 0, hash: 0 },
+};
+
+pub(crate) struct TokenCache {
+    // Ordered by start position; only the first `len` are in use
+    steps: [CachedStep; TOKEN_CACHE_SIZE],
+    len: usize,
+}
+
+impl TokenCache {
+    pub fn new() -> Self {
+        TokenCache { steps: [NO_STEP; TOKEN_CACHE_SIZE], len: 0 }
+    }
+
+    /// Forgets every step
+    pub fn clear(&mut self) {
+        self.len = 0;
+    }
+
+    fn steps(&self) -> &[CachedStep] {
+        &self.steps[..self.len]
+    }
+
+    /// Looks up the step that started at `start`, valid under `dialect`.
+    /// Returns the token, the position after it, the tokenizer reach after it
+    /// and the comment counters it bumped.
+    pub fn get(&self, start: usize, dialect: u32) -> Option<(Option<SlimToken>, usize, usize, CommentStats)> {
+        let steps = self.steps();
+        let first = steps.partition_point(|step| step.start < start);
+        steps[first..]
+            .iter()
+            .take_while(|step| step.start == start)
+            .find(|step| step.dialect.is_none() || step.dialect == Some(dialect))
+            .map(|step| (step.token, step.end, step.reach, step.stats))
+    }
+
+    /// Remembers one tokenizer step, keeping steps ordered by start position
+    pub fn insert(&mut self, start: usize, end: usize, reach: usize, dialect: Option<u32>, token: Option<SlimToken>, stats: CommentStats) {
+        if self.len >= TOKEN_CACHE_SIZE {
+            return;
+        }
+        let at = self.steps().partition_point(|step| step.start <= start);
+        self.steps.copy_within(at..self.len, at + 1);
+        self.steps[at] = CachedStep {
+            start,
+            end,
+            reach,
+            dialect,
+            token,
+            stats,
+        };
+        self.len += 1;
+    }
+}
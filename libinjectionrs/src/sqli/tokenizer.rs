@@ -1,6 +1,9 @@
 // SQL tokenizer implementation matching libinjection C version
 
-use crate::sqli::{SqliFlags, sqli_data};
+use crate::overlay::{self, Rules};
+use crate::sqli::SqliFlags;
+use crate::sqli::sqli_data::{CharType, CHAR_MAP};
+use crate::sqli::scan::{self, VARIABLE_DELIMITERS, WHITESPACE, WORD_DELIMITERS};
 
 // Token type constants matching C version
 const TYPE_NONE: u8 = 0;
@@ -39,7 +42,7 @@ const CHAR_DOUBLE: u8 = b'"';
 const CHAR_TICK: u8 = b'`';
 
 // SQL injection limits
-const LIBINJECTION_SQLI_TOKEN_SIZE: usize = 32;
+pub(crate) const LIBINJECTION_SQLI_TOKEN_SIZE: usize = 32;
 
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum TokenType {
@@ -136,7 +139,7 @@ impl Token {
         let end = self.len.min(32);
         // For display purposes, show lossy conversion to handle 0xFF bytes
         // This won't affect tokenization logic, only debugging output
-        std::str::from_utf8(&self.val[..end]).unwrap_or("<binary>")
+        core::str::from_utf8(&self.val[..end]).unwrap_or("<binary>")
     }
     
     pub fn clear(&mut self) {
@@ -176,6 +179,72 @@ impl Token {
     }
 }
 
+/// Token as produced inside the tokenizer and the folder
+///
+/// The value of every token the tokenizer produces is the (truncated) span
+/// `input[pos..pos + len]`, so only the span is kept instead of a zero-filled
+/// copy. `merged` marks folded "word word" tokens, whose value is not a span
+/// and is kept by the fold window instead.
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) struct SlimToken {
+    pub pos: usize,
+    pub token_type: TokenType,
+    pub len: u8,
+    pub str_open: u8,
+    pub str_close: u8,
+    pub count: u8,
+    pub merged: bool,
+}
+
+impl SlimToken {
+    pub const EMPTY: SlimToken = SlimToken {
+        pos: 0,
+        token_type: TokenType::None,
+        len: 0,
+        str_open: CHAR_NULL,
+        str_close: CHAR_NULL,
+        count: 0,
+        merged: false,
+    };
+    
+    pub fn clear(&mut self) {
+        *self = Self::EMPTY;
+    }
+    
+    // Same truncation as Token::assign; `value` always starts at `pos`
+    pub fn assign(&mut self, token_type: u8, pos: usize, len: usize, value: &[u8]) {
+        let copy_len = len.min(LIBINJECTION_SQLI_TOKEN_SIZE - 1).min(value.len());
+        self.token_type = byte_to_token_type(token_type);
+        self.pos = pos;
+        self.len = copy_len as u8;
+    }
+    
+    pub fn assign_char(&mut self, token_type: u8, pos: usize) {
+        self.token_type = byte_to_token_type(token_type);
+        self.pos = pos;
+        self.len = 1;
+    }
+    
+    /// Value of a token that is not `merged`
+    #[inline]
+    pub fn span<'a>(&self, input: &'a [u8]) -> &'a [u8] {
+        input.get(self.pos..self.pos + self.len as usize).unwrap_or(&[])
+    }
+    
+    /// Builds the public representation, copying `value` into it
+    pub fn to_token(self, value: &[u8]) -> Token {
+        let mut token = Token::new();
+        token.token_type = self.token_type;
+        token.pos = self.pos;
+        token.len = value.len();
+        token.val[..value.len()].copy_from_slice(value);
+        token.str_open = self.str_open;
+        token.str_close = self.str_close;
+        token.count = i32::from(self.count);
+        token
+    }
+}
+
 fn byte_to_token_type(b: u8) -> TokenType {
     match b {
         TYPE_KEYWORD => TokenType::Keyword,
@@ -242,33 +311,152 @@ fn token_type_to_byte(t: TokenType) -> u8 {
     }
 }
 
+/// Furthest a parser peeks past the token it produces (`1f` suffixes and
+/// `--` checks look two bytes ahead). Scans that look further record it in
+/// the tokenizer's reach.
+pub(crate) const MAX_LOOKAHEAD: usize = 8;
+
 // Lookup function type
 type LookupFn = dyn Fn(&str) -> TokenType;
 
-pub struct SqliTokenizer<'a> {
+/// Comment counters kept by the tokenizer, used to decide MySQL reparses
+#[derive(Debug, Clone, Copy, Default, PartialEq, Eq)]
+pub(crate) struct CommentStats {
+    pub c: i32,
+    pub ddw: i32,
+    pub ddx: i32,
+    pub hash: i32,
+}
+
+impl CommentStats {
+    pub fn delta_since(&self, earlier: &CommentStats) -> CommentStats {
+        CommentStats {
+            c: self.c - earlier.c,
+            ddw: self.ddw - earlier.ddw,
+            ddx: self.ddx - earlier.ddx,
+            hash: self.hash - earlier.hash,
+        }
+    }
+}
+
+// Parser for the byte at the current position, returning the position after it
+type ParserFn<const DIALECT: u32> = fn(&mut SqliTokenizer<'_, DIALECT>) -> usize;
+
+/// Token type for bytes that always form a one-byte token on their own
+/// (what parse_operator1 and parse_char produce), or TYPE_NONE
+static SINGLE_BYTE_TOKENS: [u8; 256] = build_single_byte_tokens();
+
+const fn char_parser<const DIALECT: u32>(char_type: CharType) -> ParserFn<DIALECT> {
+    match char_type {
+        CharType::White => |t| t.parse_white(),
+        CharType::Bang => |t| t.parse_operator2(),
+        CharType::String => |t| t.parse_string(),
+        CharType::Hash => |t| t.parse_hash(),
+        CharType::Money => |t| t.parse_money(),
+        CharType::Op1 | CharType::Unary => |t| t.parse_operator1(),
+        CharType::Op2 => |t| t.parse_operator2(),
+        CharType::LeftParens | CharType::RightParens | CharType::Comma |
+        CharType::Semicolon | CharType::LeftBrace | CharType::RightBrace => |t| t.parse_char(),
+        CharType::Dash => |t| t.parse_dash(),
+        CharType::Number => |t| t.parse_number(),
+        CharType::Slash => |t| t.parse_slash(),
+        CharType::Variable => |t| t.parse_var(),
+        CharType::Word => |t| t.parse_word(),     // This now handles UTF-8 bytes 128-255!
+        CharType::BString => |t| t.parse_bstring(),
+        CharType::EString => |t| t.parse_estring(),
+        CharType::NQString => |t| t.parse_nqstring(),
+        CharType::QString => |t| t.parse_qstring(),
+        CharType::UString => |t| t.parse_ustring(),
+        CharType::XString => |t| t.parse_xstring(),
+        CharType::BWord => |t| t.parse_bword(),
+        CharType::Backslash => |t| t.parse_backslash(),
+        CharType::Tick => |t| t.parse_tick(),
+        CharType::Other => |t| t.parse_other(),
+    }
+}
+
+const fn build_char_parsers<const DIALECT: u32>() -> [ParserFn<DIALECT>; 256] {
+    let mut table: [ParserFn<DIALECT>; 256] = [char_parser(CharType::Other); 256];
+    let mut i = 0;
+    while i < 256 {
+        table[i] = char_parser(CHAR_MAP[i]);
+        i += 1;
+    }
+    table
+}
+
+const fn build_single_byte_tokens() -> [u8; 256] {
+    let mut table = [TYPE_NONE; 256];
+    let mut i = 0;
+    while i < 256 {
+        table[i] = match CHAR_MAP[i] {
+            CharType::Op1 | CharType::Unary => TYPE_OPERATOR,
+            CharType::LeftParens | CharType::RightParens | CharType::Comma |
+            CharType::Semicolon | CharType::LeftBrace | CharType::RightBrace => i as u8,
+            _ => TYPE_NONE,
+        };
+        i += 1;
+    }
+    table
+}
+
+/// `DIALECT` of a tokenizer that takes its dialect from its flags at run
+/// time, as `SqliTokenizer::new` makes
+pub const DIALECT_FROM_FLAGS: u32 = 0;
+/// `DIALECT` of a tokenizer built for ANSI SQL only, `FLAG_SQL_ANSI`
+pub const DIALECT_ANSI: u32 = SqliFlags::FLAG_SQL_ANSI.0;
+/// `DIALECT` of a tokenizer built for MySQL only, `FLAG_SQL_MYSQL`
+pub const DIALECT_MYSQL: u32 = SqliFlags::FLAG_SQL_MYSQL.0;
+
+/// SQL tokenizer, matching `libinjection_sqli_tokenize`
+///
+/// `DIALECT` fixes the dialect (how `#` and `--x` read) at compile time, so
+/// an instance built for one dialect carries no dialect checks at all;
+/// [`DIALECT_FROM_FLAGS`], the default, reads it from the flags instead.
+pub struct SqliTokenizer<'a, const DIALECT: u32 = DIALECT_FROM_FLAGS> {
     input: &'a [u8],
     flags: SqliFlags,
     pos: usize,
-    current: Token,
+    current: SlimToken,
     lookup_fn: Option<&'a LookupFn>,
+    rules: Option<&'a Rules<'a>>,
     pub stats_comment_c: i32,
     pub stats_comment_ddw: i32,
     pub stats_comment_ddx: i32,
     pub stats_comment_hash: i32,
+    // Set when the last token depended on the ANSI/MySQL flags
+    dialect_dependent: bool,
+    // End of the furthest scan past the current position, see reach()
+    reach: usize,
 }
 
 impl<'a> SqliTokenizer<'a> {
     pub fn new(input: &'a [u8], flags: SqliFlags) -> Self {
+        Self::specialized(input, flags)
+    }
+}
+
+impl<'a, const DIALECT: u32> SqliTokenizer<'a, DIALECT> {
+    /// One parser per byte, mirroring C's char_parse_map; derived from CHAR_MAP
+    const CHAR_PARSERS: [ParserFn<DIALECT>; 256] = build_char_parsers();
+
+    /// Creates a tokenizer for `DIALECT`. `flags` give the quote context,
+    /// and the dialect too if `DIALECT` is `DIALECT_FROM_FLAGS`; otherwise
+    /// their dialect bits are ignored.
+    pub fn specialized(input: &'a [u8], flags: SqliFlags) -> Self {
         Self {
             input,
             flags,
             pos: 0,
-            current: Token::new(),
+            current: SlimToken::EMPTY,
             lookup_fn: None,
+            rules: None,
             stats_comment_c: 0,
             stats_comment_ddw: 0,
             stats_comment_ddx: 0,
             stats_comment_hash: 0,
+            dialect_dependent: false,
+            reach: 0,
         }
     }
     
@@ -276,17 +464,55 @@ impl<'a> SqliTokenizer<'a> {
         self.lookup_fn = Some(lookup_fn);
         self
     }
+
+    /// Classifies words with `rules` on top of the built-in keyword table.
+    /// A lookup function, if also set, takes precedence.
+    pub fn with_rules(mut self, rules: &'a Rules<'a>) -> Self {
+        self.rules = Some(rules);
+        self
+    }
     
-    fn lookup_word(&self, word: &str) -> TokenType {
+    // The dialect, fixed at compile time unless DIALECT_FROM_FLAGS
+    #[inline(always)]
+    fn is_mysql(&self) -> bool {
+        if DIALECT == DIALECT_FROM_FLAGS {
+            self.flags.is_mysql()
+        } else {
+            DIALECT & DIALECT_MYSQL != 0
+        }
+    }
+
+    #[inline(always)]
+    fn is_ansi(&self) -> bool {
+        if DIALECT == DIALECT_FROM_FLAGS {
+            self.flags.is_ansi()
+        } else {
+            DIALECT & DIALECT_ANSI != 0
+        }
+    }
+
+    // Keywords are ASCII-only, so a word that is not valid UTF-8 can never
+    // match one and is classified as a bareword
+    fn lookup_word(&self, word: &[u8]) -> TokenType {
         if let Some(lookup_fn) = self.lookup_fn {
-            lookup_fn(word)
+            match core::str::from_utf8(word) {
+                Ok(word_str) => lookup_fn(word_str),
+                Err(_) => TokenType::Bareword,
+            }
         } else {
-            sqli_data::lookup_word(word)
+            overlay::lookup_word(self.rules, word)
         }
     }
     
     // Main tokenization function - matches libinjection_sqli_tokenize
     pub fn next_token(&mut self) -> Option<Token> {
+        let token = self.next_slim_token()?;
+        Some(token.to_token(token.span(self.input)))
+    }
+    
+    /// Same as `next_token`, without copying the value out of the input
+    pub(crate) fn next_slim_token(&mut self) -> Option<SlimToken> {
+        self.dialect_dependent = false;
         if self.input.is_empty() || self.pos >= self.input.len() {
             return None;
         }
@@ -294,26 +520,77 @@ impl<'a> SqliTokenizer<'a> {
         self.current.clear();
         
         // Handle quote context at start of string - matches C behavior
-        let quote_context = self.flags.quote_context();
-        if self.pos == 0 && quote_context != b'\0' {
-            // FIXED: Parse only first token as string like C does with parse_string_core
-            return self.parse_first_token_with_quote_context(quote_context);
+        if self.pos == 0 {
+            let quote_context = self.flags.quote_context();
+            if quote_context != b'\0' {
+                // FIXED: Parse only first token as string like C does with parse_string_core
+                return self.parse_first_token_with_quote_context(quote_context);
+            }
         }
         
         while self.pos < self.input.len() {
             let ch = self.input[self.pos];
+            if WHITESPACE.contains(ch) {
+                // Same as calling parse_white once per byte of the run
+                self.pos += WHITESPACE.find_not(&self.input[self.pos..]);
+                continue;
+            }
+            let single = SINGLE_BYTE_TOKENS[ch as usize];
+            if single != TYPE_NONE {
+                // Same as parse_operator1 / parse_char, without the indirect call
+                self.current.assign_char(single, self.pos);
+                self.pos += 1;
+                return Some(self.current);
+            }
             let new_pos = self.dispatch_char_parser(ch);
             self.pos = new_pos;
             
             if self.current.token_type != TokenType::None {
-                return Some(self.current.clone());
+                return Some(self.current);
             }
         }
         
         None
     }
     
-    fn parse_first_token_with_quote_context(&mut self, quote_char: u8) -> Option<Token> {
+    pub(crate) fn position(&self) -> usize {
+        self.pos
+    }
+
+    /// End of the input the tokens so far were decided on, give or take
+    /// `MAX_LOOKAHEAD` bytes. Appending to the input past this point cannot
+    /// change any of them.
+    pub(crate) fn reach(&self) -> usize {
+        self.reach.max(self.pos)
+    }
+
+    pub(crate) fn comment_stats(&self) -> CommentStats {
+        CommentStats {
+            c: self.stats_comment_c,
+            ddw: self.stats_comment_ddw,
+            ddx: self.stats_comment_ddx,
+            hash: self.stats_comment_hash,
+        }
+    }
+
+    /// True if the token last returned by `next_token` would differ between
+    /// ANSI and MySQL mode (`#` and `--x` handling)
+    pub(crate) fn last_token_dialect_dependent(&self) -> bool {
+        self.dialect_dependent
+    }
+
+    /// Fast-forwards over a token produced earlier from the same position,
+    /// applying the comment counters it bumped
+    pub(crate) fn skip_to(&mut self, pos: usize, reach: usize, stats: &CommentStats) {
+        self.pos = pos;
+        self.reach = self.reach.max(reach);
+        self.stats_comment_c += stats.c;
+        self.stats_comment_ddw += stats.ddw;
+        self.stats_comment_ddx += stats.ddx;
+        self.stats_comment_hash += stats.hash;
+    }
+    
+    fn parse_first_token_with_quote_context(&mut self, quote_char: u8) -> Option<SlimToken> {
         // FIXED: Implements exact C behavior from libinjection_sqli.c parse_string_core function
         // Called from libinjection_sqli.c:1216: parse_string_core(s, slen, 0, current, flag2delim(sf->flags), 0)
         // This handles FLAG_QUOTE_DOUBLE context where input is treated as if starting with a quote
@@ -326,15 +603,7 @@ impl<'a> SqliTokenizer<'a> {
         // Step 1: Find first quote occurrence
         // From libinjection_sqli.c:627-628: memchr(cs + pos + offset, delim, len - pos - offset)
         let search_start = pos + offset;
-        let search_len = len - pos - offset;
-        
-        let mut qpos_idx = None;
-        for i in search_start..(search_start + search_len) {
-            if self.input[i] == quote_char {
-                qpos_idx = Some(i);
-                break;
-            }
-        }
+        let mut qpos_idx = self.memchr(quote_char, &self.input[search_start..len]).map(|i| search_start + i);
         
         // From libinjection_sqli.c:638-643: Set str_open based on offset
         // offset = 0 means "simulated quote", so str_open = CHAR_NULL
@@ -404,7 +673,7 @@ impl<'a> SqliTokenizer<'a> {
             
             // libinjection_sqli.c:670: return (size_t)(qpos - cs + 1)
             self.pos = qpos + 1;
-            return Some(self.current.clone());
+            return Some(self.current);
         }
         
         // No closing quote found - libinjection_sqli.c:646-654
@@ -414,40 +683,13 @@ impl<'a> SqliTokenizer<'a> {
         self.current.str_close = CHAR_NULL; // libinjection_sqli.c:653
         self.pos = self.input.len(); // libinjection_sqli.c:654: return len
         
-        Some(self.current.clone())
+        Some(self.current)
     }
     
     // Character dispatch function - matches char_parse_map in C
+    #[inline]
     fn dispatch_char_parser(&mut self, ch: u8) -> usize {
-        use crate::sqli::sqli_data::{get_char_type, CharType};
-        
-        // Use the generated lookup table - same as C implementation
-        match get_char_type(ch) {
-            CharType::White => self.parse_white(),
-            CharType::Bang => self.parse_operator2(),
-            CharType::String => self.parse_string(),
-            CharType::Hash => self.parse_hash(),
-            CharType::Money => self.parse_money(),
-            CharType::Op1 | CharType::Unary => self.parse_operator1(),
-            CharType::Op2 => self.parse_operator2(),
-            CharType::LeftParens | CharType::RightParens | CharType::Comma | 
-            CharType::Semicolon | CharType::LeftBrace | CharType::RightBrace => self.parse_char(),
-            CharType::Dash => self.parse_dash(),
-            CharType::Number => self.parse_number(),
-            CharType::Slash => self.parse_slash(),
-            CharType::Variable => self.parse_var(),
-            CharType::Word => self.parse_word(),     // This now handles UTF-8 bytes 128-255!
-            CharType::BString => self.parse_bstring(),
-            CharType::EString => self.parse_estring(),
-            CharType::NQString => self.parse_nqstring(),
-            CharType::QString => self.parse_qstring(),
-            CharType::UString => self.parse_ustring(),
-            CharType::XString => self.parse_xstring(),
-            CharType::BWord => self.parse_bword(),
-            CharType::Backslash => self.parse_backslash(),
-            CharType::Tick => self.parse_tick(),
-            CharType::Other => self.parse_other(),
-        }
+        Self::CHAR_PARSERS[ch as usize](self)
     }
     
     // Parser implementations matching C version exactly
@@ -457,8 +699,7 @@ impl<'a> SqliTokenizer<'a> {
     }
     
     fn parse_operator1(&mut self) -> usize {
-        let ch = self.input[self.pos];
-        self.current.assign_char(TYPE_OPERATOR, self.pos, ch);
+        self.current.assign_char(TYPE_OPERATOR, self.pos);
         self.pos + 1
     }
     
@@ -480,27 +721,24 @@ impl<'a> SqliTokenizer<'a> {
         }
         
         // Try 2-character operator lookup using the comprehensive table
-        // Only attempt lookup if bytes form valid UTF-8, since operators are ASCII-only
         let two_char = &self.input[pos..pos + 2];
-        if let Ok(two_char_str) = std::str::from_utf8(two_char) {
-            let token_type = self.lookup_word(two_char_str);
-            if token_type != TokenType::None && token_type != TokenType::Bareword {
-                // Found a 2-character operator in the lookup table
-                let type_byte = match token_type {
-                    TokenType::Operator => TYPE_OPERATOR,
-                    TokenType::LogicOperator => TYPE_LOGIC_OPERATOR,
-                    _ => TYPE_OPERATOR, // Default fallback
-                };
-                self.current.assign(type_byte, pos, 2, two_char);
-                return pos + 2;
-            }
+        let token_type = self.lookup_word(two_char);
+        if token_type != TokenType::None && token_type != TokenType::Bareword {
+            // Found a 2-character operator in the lookup table
+            let type_byte = match token_type {
+                TokenType::Operator => TYPE_OPERATOR,
+                TokenType::LogicOperator => TYPE_LOGIC_OPERATOR,
+                _ => TYPE_OPERATOR, // Default fallback
+            };
+            self.current.assign(type_byte, pos, 2, two_char);
+            return pos + 2;
         }
         
         // No 2-character operator found, check for special single character cases
         let ch = self.input[pos];
         if ch == b':' {
             // Special case: ':' is not an operator, it's TYPE_COLON
-            self.current.assign_char(TYPE_COLON, pos, ch);
+            self.current.assign_char(TYPE_COLON, pos);
             return pos + 1;
         } else {
             // Must be a single char operator - delegate to parse_operator1
@@ -509,26 +747,26 @@ impl<'a> SqliTokenizer<'a> {
     }
     
     fn parse_other(&mut self) -> usize {
-        let ch = self.input[self.pos];
-        self.current.assign_char(TYPE_UNKNOWN, self.pos, ch);
+        self.current.assign_char(TYPE_UNKNOWN, self.pos);
         self.pos + 1
     }
     
     fn parse_char(&mut self) -> usize {
         let ch = self.input[self.pos];
-        self.current.assign_char(ch, self.pos, ch);
+        self.current.assign_char(ch, self.pos);
         self.pos + 1
     }
     
     fn parse_hash(&mut self) -> usize {
+        self.dialect_dependent = true;
         self.stats_comment_hash += 1;
-        if self.flags.is_mysql() {
+        if self.is_mysql() {
             // C version has a bug that increments stats_comment_hash twice in MySQL mode
             // We need to match this behavior exactly
             self.stats_comment_hash += 1;
             self.parse_eol_comment()
         } else {
-            self.current.assign_char(TYPE_OPERATOR, self.pos, b'#');
+            self.current.assign_char(TYPE_OPERATOR, self.pos);
             self.pos + 1
         }
     }
@@ -544,18 +782,19 @@ impl<'a> SqliTokenizer<'a> {
                 return self.parse_eol_comment();
             } else {
                 // "--" followed by non-whitespace: depends on SQL mode
+                self.dialect_dependent = true;
                 self.stats_comment_ddx += 1;
-                if self.flags.is_ansi() {
+                if self.is_ansi() {
                     return self.parse_eol_comment();
                 } else {
                     // MySQL treats as two unary operators
-                    self.current.assign_char(TYPE_OPERATOR, pos, b'-');
+                    self.current.assign_char(TYPE_OPERATOR, pos);
                     return pos + 1;
                 }
             }
         } else {
             // Single dash: operator
-            self.current.assign_char(TYPE_OPERATOR, pos, b'-');
+            self.current.assign_char(TYPE_OPERATOR, pos);
             pos + 1
         }
     }
@@ -567,7 +806,7 @@ impl<'a> SqliTokenizer<'a> {
         // Match C logic exactly: if (pos1 == slen || cs[pos1] != '*')
         if pos + 1 == slen || self.input[pos + 1] != b'*' {
             // Regular operator
-            self.current.assign_char(TYPE_OPERATOR, pos, b'/');
+            self.current.assign_char(TYPE_OPERATOR, pos);
             pos + 1
         } else {
             // C-style comment /* ... */
@@ -586,8 +825,7 @@ impl<'a> SqliTokenizer<'a> {
             self.current.assign(TYPE_NUMBER, pos, 2, content);
             pos + 2
         } else {
-            let ch = self.input[pos];
-            self.current.assign_char(TYPE_BACKSLASH, pos, ch);
+            self.current.assign_char(TYPE_BACKSLASH, pos);
             pos + 1
         }
     }
@@ -597,10 +835,7 @@ impl<'a> SqliTokenizer<'a> {
         let slen = self.input.len();
         
         // Find end of line or end of string
-        let mut end_pos = pos;
-        while end_pos < slen && self.input[end_pos] != b'\n' {
-            end_pos += 1;
-        }
+        let end_pos = self.memchr(b'\n', &self.input[pos..]).map_or(slen, |i| pos + i);
         
         let comment_slice = &self.input[pos..end_pos];
         self.current.assign(TYPE_COMMENT, pos, end_pos - pos, comment_slice);
@@ -614,16 +849,7 @@ impl<'a> SqliTokenizer<'a> {
     
     // Helper function equivalent to C memchr2: finds two consecutive characters
     fn memchr2(&self, haystack: &[u8], c0: u8, c1: u8) -> Option<usize> {
-        if haystack.len() < 2 {
-            return None;
-        }
-        
-        for i in 0..haystack.len() - 1 {
-            if haystack[i] == c0 && haystack[i + 1] == c1 {
-                return Some(i);
-            }
-        }
-        None
+        scan::find_pair(c0, c1, haystack)
     }
     
     // Helper function equivalent to C is_mysql_comment
@@ -856,6 +1082,7 @@ impl<'a> SqliTokenizer<'a> {
         }
         
         if content_end >= slen || self.input[content_end] != b'\'' {
+            self.reach = self.reach.max(content_end + 1);
             return self.parse_word();
         }
         
@@ -885,6 +1112,7 @@ impl<'a> SqliTokenizer<'a> {
         }
         
         if content_end >= slen || self.input[content_end] != b'\'' {
+            self.reach = self.reach.max(content_end + 1);
             return self.parse_word();
         }
         
@@ -914,12 +1142,7 @@ impl<'a> SqliTokenizer<'a> {
         let slen = self.input.len();
         
         // Find word boundary - matches C version's strlencspn character set
-        let word_chars = b" []{}<>:\\?=@!#~+-*/&|^%(),';	\n\x0B\x0C\r\"\xA0\x00";
-        let mut end_pos = pos;
-        
-        while end_pos < slen && !word_chars.contains(&self.input[end_pos]) {
-            end_pos += 1;
-        }
+        let end_pos = pos + WORD_DELIMITERS.find(&self.input[pos..slen]);
         
         let word_len = end_pos - pos;
         let word_slice = &self.input[pos..end_pos];
@@ -927,34 +1150,27 @@ impl<'a> SqliTokenizer<'a> {
         self.current.assign(TYPE_BAREWORD, pos, word_len, word_slice);
         
         // Check for special delimiters within word
-        for (i, &byte) in word_slice.iter().enumerate() {
-            if byte == b'.' || byte == b'`' {
-                // For delimiter detection, we only need to check if the first i bytes
-                // form a valid keyword. Since libinjection keywords are ASCII-only,
-                // if the slice contains any non-UTF8 bytes (like 0xFF), it can't be 
-                // a keyword anyway, so we can safely skip the lookup.
-                if let Ok(partial_word) = std::str::from_utf8(&word_slice[..i]) {
-                    let token_type = self.lookup_word(partial_word);
-                    if token_type != TokenType::None && token_type != TokenType::Bareword {
-                        self.current.clear();
-                        let type_byte = token_type_to_byte(token_type);
-                        self.current.assign(type_byte, pos, i, &word_slice[..i]);
-                        return pos + i;
-                    }
-                }
-                // If UTF-8 conversion fails, continue - can't be a keyword
+        let mut i = 0;
+        while let Some(found) = scan::find_either(b'.', b'`', &word_slice[i..]) {
+            i += found;
+            // For delimiter detection, we only need to check if the first i bytes
+            // form a valid keyword
+            let token_type = self.lookup_word(&word_slice[..i]);
+            if token_type != TokenType::None && token_type != TokenType::Bareword {
+                self.current.clear();
+                let type_byte = token_type_to_byte(token_type);
+                self.current.assign(type_byte, pos, i, &word_slice[..i]);
+                return pos + i;
             }
+            i += 1;
         }
         
-        // Do full word lookup - only for valid UTF-8 sequences since keywords are ASCII-only
+        // Do full word lookup
         if word_len < LIBINJECTION_SQLI_TOKEN_SIZE {
-            if let Ok(word_str) = std::str::from_utf8(word_slice) {
-                let token_type = self.lookup_word(word_str);
-                if token_type != TokenType::None {
-                    self.current.token_type = token_type;
-                }
+            let token_type = self.lookup_word(word_slice);
+            if token_type != TokenType::None {
+                self.current.token_type = token_type;
             }
-            // If UTF-8 conversion fails, leave as BAREWORD - bytes with 0xFF can't be keywords
         }
         
         end_pos
@@ -964,16 +1180,11 @@ impl<'a> SqliTokenizer<'a> {
         // MySQL backticks
         let pos = self.parse_string_core(self.pos, CHAR_TICK, 1);
         
-        // Check if backtick content is a keyword/function - only for valid UTF-8
-        if let Ok(word_str) = std::str::from_utf8(&self.current.val[..self.current.len]) {
-            let token_type = self.lookup_word(word_str);
-            if token_type == TokenType::Function {
-                self.current.token_type = TokenType::Function;
-            } else {
-                self.current.token_type = TokenType::Bareword;
-            }
+        // Check if backtick content is a keyword/function
+        let token_type = self.lookup_word(self.current.span(self.input));
+        if token_type == TokenType::Function {
+            self.current.token_type = TokenType::Function;
         } else {
-            // If UTF-8 conversion fails, default to bareword - 0xFF bytes can't be keywords
             self.current.token_type = TokenType::Bareword;
         }
         
@@ -1017,12 +1228,7 @@ impl<'a> SqliTokenizer<'a> {
         
         // Regular variable name - must exactly match C implementation
         // C: " <>:\\?=@!#~+-*/&|^%(),';\t\n\v\f\r'`\""
-        let var_chars = b" <>:\\?=@!#~+-*/&|^%(),;'\t\n\x0B\x0C\r'`\"";
-        let mut end_pos = new_pos;
-        
-        while end_pos < slen && !var_chars.contains(&self.input[end_pos]) {
-            end_pos += 1;
-        }
+        let end_pos = new_pos + VARIABLE_DELIMITERS.find(&self.input[new_pos.min(slen)..]);
         
         if end_pos == new_pos {
             // Empty variable name (just @ or @@ symbols)
@@ -1043,7 +1249,7 @@ impl<'a> SqliTokenizer<'a> {
         let slen = self.input.len();
         
         if pos + 1 == slen {
-            self.current.assign_char(TYPE_BAREWORD, pos, b'$');
+            self.current.assign_char(TYPE_BAREWORD, pos);
             return slen;
         }
         
@@ -1083,14 +1289,15 @@ impl<'a> SqliTokenizer<'a> {
         
         if tag_end == pos + 1 {
             // Just $ followed by non-alphanumeric
-            self.current.assign_char(TYPE_BAREWORD, pos, b'$');
+            self.current.assign_char(TYPE_BAREWORD, pos);
             pos + 1
         } else if tag_end < slen && self.input[tag_end] == b'$' {
             // Found $tag$ pattern
             self.parse_tagged_dollar_string(tag_end)
         } else {
             // $ followed by letters but no closing $
-            self.current.assign_char(TYPE_BAREWORD, pos, b'$');
+            self.reach = self.reach.max(tag_end + 1);
+            self.current.assign_char(TYPE_BAREWORD, pos);
             pos + 1
         }
     }
@@ -1162,7 +1369,7 @@ impl<'a> SqliTokenizer<'a> {
             
             if end_pos - start_pos == 1 {
                 // Only read '.', this is a dot token
-                self.current.assign_char(TYPE_DOT, start_pos, b'.');
+                self.current.assign_char(TYPE_DOT, start_pos);
                 return end_pos;
             }
         }
@@ -1230,7 +1437,7 @@ impl<'a> SqliTokenizer<'a> {
     }
     
     fn memchr(&self, needle: u8, haystack: &[u8]) -> Option<usize> {
-        haystack.iter().position(|&x| x == needle)
+        scan::find_byte(needle, haystack)
     }
     
     fn is_backslash_escaped(&self, pos: usize) -> bool {
@@ -1255,16 +1462,8 @@ impl<'a> SqliTokenizer<'a> {
     }
     
     fn find_qstring_end(&self, start: usize, end_delim: u8) -> Option<usize> {
-        let mut pos = start;
-        
-        while pos + 1 < self.input.len() {
-            if self.input[pos] == end_delim && self.input[pos + 1] == b'\'' {
-                return Some(pos);
-            }
-            pos += 1;
-        }
-        
-        None
+        let haystack = self.input.get(start..)?;
+        self.memchr2(haystack, end_delim, b'\'').map(|i| start + i)
     }
     
     fn parse_dollar_string(&mut self) -> usize {
@@ -1275,16 +1474,13 @@ impl<'a> SqliTokenizer<'a> {
         let content_start = pos + 2;
         
         // Find ending $$
-        let mut end_pos = content_start;
-        while end_pos + 1 < slen {
-            if self.input[end_pos] == b'$' && self.input[end_pos + 1] == b'$' {
-                let content = &self.input[content_start..end_pos];
-                self.current.assign(TYPE_STRING, content_start, end_pos - content_start, content);
-                self.current.str_open = b'$';
-                self.current.str_close = b'$';
-                return end_pos + 2;
-            }
-            end_pos += 1;
+        if let Some(i) = self.memchr2(&self.input[content_start..], b'$', b'$') {
+            let end_pos = content_start + i;
+            let content = &self.input[content_start..end_pos];
+            self.current.assign(TYPE_STRING, content_start, end_pos - content_start, content);
+            self.current.str_open = b'$';
+            self.current.str_close = b'$';
+            return end_pos + 2;
         }
         
         // No closing $$ found
@@ -1302,16 +1498,13 @@ impl<'a> SqliTokenizer<'a> {
         let content_start = tag_end + 1;
         
         // Find matching end tag
-        let mut search_pos = content_start;
-        while search_pos + tag.len() <= slen {
-            if &self.input[search_pos..search_pos + tag.len()] == tag {
-                let content = &self.input[content_start..search_pos];
-                self.current.assign(TYPE_STRING, content_start, search_pos - content_start, content);
-                self.current.str_open = b'$';
-                self.current.str_close = b'$';
-                return search_pos + tag.len();
-            }
-            search_pos += 1;
+        if let Some(i) = scan::find_bytes(tag, &self.input[content_start..]) {
+            let search_pos = content_start + i;
+            let content = &self.input[content_start..search_pos];
+            self.current.assign(TYPE_STRING, content_start, search_pos - content_start, content);
+            self.current.str_open = b'$';
+            self.current.str_close = b'$';
+            return search_pos + tag.len();
         }
         
         // No matching end tag
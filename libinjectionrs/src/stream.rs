@@ -0,0 +1,254 @@
+//! Chunked detection for values that arrive in pieces
+//!
+//! [`StreamingDetector`] takes an input chunk by chunk and reports an
+//! injection as soon as the data seen so far proves it, without waiting for
+//! the rest of the value. At the end it gives exactly the verdicts
+//! [`detect_sqli_with_flags`](crate::detect_sqli_with_flags) and
+//! [`detect_xss`](crate::detect_xss) give for the whole input.
+//!
+//! The chunks are collected into one buffer owned by the detector, so callers
+//! do not have to assemble the value themselves. The XSS tokenizers resume
+//! from where they stopped on the previous chunk. SQLi detection folds a
+//! handful of tokens after the start of the input and needs the whole input
+//! for the quote-context passes, so its early check re-runs on the buffered
+//! prefix, each time the buffer has doubled.
+//!
+//! An early verdict is only ever a positive one. It is given once the
+//! tokens behind it cannot change however the input continues: the SQLi
+//! fingerprint window (`LIBINJECTION_SQLI_MAX_TOKENS` tokens) is full, or an
+//! XSS-triggering HTML token is complete.
+
+#[cfg(not(feature = "std"))]
+use alloc::vec::Vec;
+
+use crate::sqli::{SqliFlags, SqliState};
+use crate::xss::{AttributeType, Html5Checkpoint, Html5Flags, Html5State, XssDetector, XssResult, MAX_LOOKAHEAD, XSS_CONTEXTS};
+use crate::{detect_sqli_with_flags, xss_result, DetectionResult, InjectionType};
+
+// Buffered length at which the first early SQLi check runs
+const SQLI_FIRST_CHECK: usize = 64;
+
+/// Final verdicts for a streamed input
+#[derive(Debug, Clone, PartialEq)]
+pub struct StreamVerdict {
+    /// Same as `detect_sqli_with_flags` on the whole input
+    pub sqli: DetectionResult,
+    /// Same as `detect_xss` on the whole input
+    pub xss: XssResult,
+}
+
+impl StreamVerdict {
+    /// Returns `true` if either detector found an injection
+    pub fn is_injection(&self) -> bool {
+        self.sqli.is_injection() || self.xss.is_injection()
+    }
+}
+
+/// Runs SQLi and XSS detection over an input fed in chunks
+///
+/// # Examples
+///
+/// ```
+/// use libinjectionrs::StreamingDetector;
+///
+/// let mut detector = StreamingDetector::new();
+/// assert!(detector.feed(b"<scr").is_none());
+/// // The tag name is only known once something follows it
+/// let early = detector.feed(b"ipt>alert(1)");
+/// assert!(early.is_some_and(|result| result.is_injection()));
+///
+/// let verdict = detector.finish();
+/// assert!(verdict.xss.is_injection());
+/// ```
+pub struct StreamingDetector {
+    buffer: Vec<u8>,
+    sqli_flags: SqliFlags,
+    sqli: Option<DetectionResult>,
+    sqli_next_check: usize,
+    xss: Option<XssResult>,
+    xss_contexts: [XssContext; 5],
+}
+
+impl StreamingDetector {
+    /// Creates a detector using the default SQLi flags, like `detect_sqli`
+    pub fn new() -> Self {
+        Self::with_sqli_flags(SqliFlags::FLAG_NONE)
+    }
+
+    /// Creates a detector whose SQLi verdict matches `detect_sqli_with_flags`
+    pub fn with_sqli_flags(flags: SqliFlags) -> Self {
+        StreamingDetector {
+            buffer: Vec::new(),
+            sqli_flags: flags,
+            sqli: None,
+            sqli_next_check: SQLI_FIRST_CHECK,
+            xss: None,
+            xss_contexts: XSS_CONTEXTS.map(XssContext::new),
+        }
+    }
+
+    /// Appends a chunk of input.
+    ///
+    /// Returns the injection found so far, if any. Once an injection has been
+    /// reported, every later call returns it again.
+    pub fn feed(&mut self, chunk: &[u8]) -> Option<DetectionResult> {
+        self.buffer.extend_from_slice(chunk);
+
+        if self.sqli.is_none() && self.buffer.len() >= self.sqli_next_check {
+            self.sqli = Self::early_sqli(&self.buffer, self.sqli_flags);
+            self.sqli_next_check = self.buffer.len() * 2;
+        }
+        if self.xss.is_none() {
+            self.xss = Self::advance_xss(&mut self.xss_contexts, &self.buffer, false);
+        }
+
+        self.injection()
+    }
+
+    /// The injection found so far, if any
+    pub fn injection(&self) -> Option<DetectionResult> {
+        if let Some(sqli) = self.sqli.as_ref().filter(|result| result.is_injection()) {
+            return Some(sqli.clone());
+        }
+        self.xss.as_ref().filter(|result| result.is_injection()).map(|_| xss_result())
+    }
+
+    /// The input fed so far
+    pub fn buffered(&self) -> &[u8] {
+        &self.buffer
+    }
+
+    /// Roughly the bytes the next `feed` of `chunk_len` bytes scans: the
+    /// chunk, or the whole buffer once the early SQLi check is due
+    #[cfg(feature = "async")]
+    pub(crate) fn feed_work(&self, chunk_len: usize) -> usize {
+        let len = self.buffer.len().saturating_add(chunk_len);
+        if self.sqli.is_none() && len >= self.sqli_next_check {
+            len
+        } else {
+            chunk_len
+        }
+    }
+
+    /// Roughly the bytes `finish` scans: the whole buffer unless SQLi is
+    /// already decided
+    #[cfg(feature = "async")]
+    pub(crate) fn finish_work(&self) -> usize {
+        if self.sqli.is_none() { self.buffer.len() } else { 0 }
+    }
+
+    /// Takes the input fed so far, leaving the detector reset with no buffer
+    #[cfg(feature = "async")]
+    pub(crate) fn take_buffer(&mut self) -> Vec<u8> {
+        let buffer = core::mem::take(&mut self.buffer);
+        self.reset();
+        buffer
+    }
+
+    /// Drops the input fed so far, keeping the buffer for the next one
+    pub fn reset(&mut self) {
+        self.buffer.clear();
+        self.sqli = None;
+        self.sqli_next_check = SQLI_FIRST_CHECK;
+        self.xss = None;
+        self.xss_contexts = XSS_CONTEXTS.map(XssContext::new);
+    }
+
+    /// Ends the input and returns the final verdicts
+    pub fn finish(&mut self) -> StreamVerdict {
+        let sqli = match &self.sqli {
+            Some(result) => result.clone(),
+            None => detect_sqli_with_flags(&self.buffer, self.sqli_flags),
+        };
+        let xss = match &self.xss {
+            Some(result) => result.clone(),
+            None => Self::advance_xss(&mut self.xss_contexts, &self.buffer, true).unwrap_or(XssResult::Safe),
+        };
+        self.sqli = Some(sqli.clone());
+        self.xss = Some(xss.clone());
+        StreamVerdict { sqli, xss }
+    }
+
+    fn early_sqli(input: &[u8], flags: SqliFlags) -> Option<DetectionResult> {
+        let mut state = SqliState::new(input, flags);
+        match state.detect_prefix() {
+            Some(true) => Some(DetectionResult {
+                injection_type: InjectionType::Sqli,
+                is_injection: true,
+                fingerprint: Some(state.detected_fingerprint()),
+                confidence: 1.0,
+                truncated: false,
+            }),
+            _ => None,
+        }
+    }
+
+    fn advance_xss(contexts: &mut [XssContext; 5], input: &[u8], complete: bool) -> Option<XssResult> {
+        let mut all_safe = true;
+        for context in contexts.iter_mut() {
+            match context.advance(input, complete) {
+                Some(true) => return Some(XssResult::Xss),
+                Some(false) => {}
+                None => all_safe = false,
+            }
+        }
+        if all_safe { Some(XssResult::Safe) } else { None }
+    }
+}
+
+impl Default for StreamingDetector {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+/// `XssDetector::is_xss` for one context, resumable between chunks
+struct XssContext {
+    checkpoint: Html5Checkpoint,
+    attr: AttributeType,
+    // Verdict once the context has finished
+    done: Option<bool>,
+    // Buffered length before which tokenizing again would stop at the same place
+    retry_at: usize,
+}
+
+impl XssContext {
+    fn new(flags: Html5Flags) -> Self {
+        XssContext {
+            checkpoint: Html5State::new(&[], flags).checkpoint(),
+            attr: AttributeType::None,
+            done: None,
+            retry_at: 0,
+        }
+    }
+
+    /// Tokenizes as far as `input` allows. `Some(verdict)` once the context
+    /// is decided, `None` if it needs more input.
+    fn advance(&mut self, input: &[u8], complete: bool) -> Option<bool> {
+        if self.done.is_some() || (!complete && input.len() < self.retry_at) {
+            return self.done;
+        }
+
+        let mut html5 = Html5State::resume(input, self.checkpoint);
+        loop {
+            let before = html5.checkpoint();
+            let more = html5.next();
+            // A token that runs into the end of the buffer, or a stop at it,
+            // may come out differently once the next chunk arrives
+            if !complete && (!more || html5.token_end() + MAX_LOOKAHEAD > input.len()) {
+                self.checkpoint = before;
+                // Wait for as much new input as this attempt scanned
+                self.retry_at = input.len() + (input.len() - before.position());
+                return None;
+            }
+            if !more {
+                self.done = Some(false);
+                return self.done;
+            }
+            if XssDetector::is_xss_token(&html5, &mut self.attr) {
+                self.done = Some(true);
+                return self.done;
+            }
+        }
+    }
+}
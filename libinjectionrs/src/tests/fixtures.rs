@@ -0,0 +1,39 @@
+//! Inputs shared by the tests of the detection front ends
+//!
+//! The scanner, batch, cache, request, streaming and async front ends all
+//! have to give the verdicts of the one-shot functions, so their tests run
+//! over this one mix of benign values, SQLi and XSS and add only the inputs
+//! their own feature needs. `tests/no_alloc.rs` includes this file by path,
+//! so it uses nothing from the crate.
+
+/// Benign values, SQLi in several dialects and quoting contexts, and XSS
+pub const INPUTS: &[&[u8]] = &[
+    b"",
+    b"hello world",
+    b"12345",
+    b"1' OR '1'='1",
+    b"1 UNION SELECT username, password FROM users WHERE 1=1 -- trailing text",
+    b"admin'--",
+    b"1 or 1=1 /* comment */ and more words",
+    b"x'0101010101010101",
+    b"$abcdefghijklmnopqrstuvwxyz",
+    b"1 and sleep(5) and 'a'='a' -- sp_password",
+    b"select @@version; drop table users; #",
+    b"1;-- ;/*!50000 union*/ select `a`.`b` from \"c\"",
+    b"1 # mysql comment\n union select 1",
+    b"1 --x\nunion select 1",
+    b"\" or \"\"=\"",
+    b"select select select select select select select select select select select",
+    b"<script>alert(1)</script>",
+    b"<img src=x onerror=alert(1)>",
+    b"<a href=\"javascript:alert(1)\">click</a>",
+    b"\" onmouseover=\"alert(1)",
+    b"javascript:alert(1)",
+    b"<!-- comment --><![CDATA[x]]><!DOCTYPE html><% x %>",
+    b"<p class=\"safe\">A paragraph with <b>bold</b> text.</p>",
+];
+
+/// `inputs`, then again in reverse, so each one also follows every other
+pub fn twice_reversed<'a>(inputs: &[&'a [u8]]) -> Vec<&'a [u8]> {
+    inputs.iter().chain(inputs.iter().rev()).copied().collect()
+}
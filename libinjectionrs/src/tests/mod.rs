@@ -1,4 +1,22 @@
+pub mod fixtures;
 pub mod test_folding;
 pub mod differential_tests;
 pub mod test_html5_files;
-pub mod test_tokens_files;
\ No newline at end of file
+pub mod test_tokens_files;
+pub mod test_streaming;
+pub mod test_scanner;
+pub mod test_records;
+pub mod test_prefilter;
+pub mod test_decode;
+pub mod test_request;
+pub mod test_overlay;
+#[cfg(feature = "parallel")]
+pub mod test_parallel;
+#[cfg(feature = "cache")]
+pub mod test_cache;
+#[cfg(feature = "metrics")]
+pub mod test_metrics;
+#[cfg(feature = "async")]
+pub mod test_middleware;
+#[cfg(feature = "batch")]
+pub mod test_batch;
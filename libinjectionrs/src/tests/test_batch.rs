@@ -0,0 +1,44 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use super::fixtures::{twice_reversed, INPUTS};
+use crate::batch::BatchScanner;
+use crate::{detect_sqli_with_limits, ScanLimits, SqliFlags};
+
+fn check_batch<const LANES: usize>(flags: SqliFlags, limits: ScanLimits) {
+    let inputs = twice_reversed(INPUTS);
+    let scanner = BatchScanner::<LANES>::with_sqli_flags(flags).with_limits(limits);
+    let results: Vec<_> = scanner.detect_sqli_many(&inputs).collect();
+    assert_eq!(results.len(), inputs.len());
+    for (input, result) in inputs.iter().zip(results) {
+        assert_eq!(result, detect_sqli_with_limits(input, flags, limits), "input {:?}", input);
+    }
+}
+
+#[test]
+fn test_batch_matches_free_function() {
+    for flags in [SqliFlags::FLAG_NONE, SqliFlags::FLAG_SQL_MYSQL, SqliFlags::FLAG_QUOTE_SINGLE | SqliFlags::FLAG_SQL_ANSI] {
+        check_batch::<1>(flags, ScanLimits::UNLIMITED);
+        check_batch::<4>(flags, ScanLimits::UNLIMITED);
+        check_batch::<8>(flags, ScanLimits::UNLIMITED);
+    }
+}
+
+#[test]
+fn test_batch_with_limits() {
+    for limits in [ScanLimits::new(16, 100), ScanLimits::new(1000, 3), ScanLimits::new(0, 0)] {
+        check_batch::<4>(SqliFlags::FLAG_NONE, limits);
+    }
+}
+
+#[test]
+fn test_batch_partial_group() {
+    let scanner = BatchScanner::<8>::new();
+    let inputs: &[&[u8]] = &[b"1' OR '1'='1", b"john"];
+    let flagged: Vec<bool> = scanner.detect_sqli_many(inputs).map(|result| result.is_injection()).collect();
+    assert_eq!(flagged, [true, false]);
+    assert_eq!(scanner.detect_sqli_many(&[]).count(), 0);
+}
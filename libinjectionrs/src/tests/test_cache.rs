@@ -0,0 +1,85 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use super::fixtures::INPUTS;
+use crate::cache::{CacheStats, VerdictCache};
+use crate::{detect_sqli_with_flags, detect_xss, SqliFlags};
+
+#[test]
+fn test_cached_verdicts_match_uncached() {
+    let cache = VerdictCache::new(1000);
+    let flags = SqliFlags::FLAG_QUOTE_SINGLE | SqliFlags::FLAG_SQL_ANSI;
+    for _ in 0..3 {
+        for input in INPUTS {
+            assert_eq!(cache.detect_sqli(input), detect_sqli_with_flags(input, SqliFlags::FLAG_NONE));
+            assert_eq!(cache.detect_sqli_with_flags(input, flags), detect_sqli_with_flags(input, flags));
+            assert_eq!(cache.detect_xss(input), detect_xss(input));
+        }
+    }
+
+    // Each input is cached once per mode and hit on the two later rounds
+    let lookups = 3 * INPUTS.len() as u64;
+    let stats = cache.stats();
+    assert_eq!(stats, CacheStats { hits: 2 * lookups, misses: lookups, evictions: 0, bypassed: 0 });
+    assert_eq!(cache.len(), 3 * INPUTS.len());
+}
+
+#[test]
+fn test_cache_stays_within_capacity() {
+    let cache = VerdictCache::with_shards(8, 1);
+    let inputs: Vec<Vec<u8>> = (0..100).map(|i| format!("{}' OR 1=1 --", i).into_bytes()).collect();
+    for input in &inputs {
+        assert_eq!(cache.detect_sqli(input), detect_sqli_with_flags(input, SqliFlags::FLAG_NONE));
+    }
+    assert_eq!(cache.len(), 8);
+    assert_eq!(cache.stats().evictions, 92);
+
+    // A value looked up again survives the next sweep
+    let hot = inputs[99].as_slice();
+    cache.detect_sqli(hot);
+    for input in &inputs[..7] {
+        cache.detect_sqli(input);
+    }
+    let hits = cache.stats().hits;
+    cache.detect_sqli(hot);
+    assert_eq!(cache.stats().hits, hits + 1);
+
+    cache.clear();
+    assert!(cache.is_empty());
+    assert!(VerdictCache::new(0).detect_sqli(b"1' OR '1'='1").is_injection());
+}
+
+#[test]
+fn test_large_inputs_bypass_the_cache() {
+    let cache = VerdictCache::new(16).with_max_input_len(8);
+    let long = b"1 UNION SELECT password FROM users";
+    for _ in 0..2 {
+        assert!(cache.detect_sqli(long).is_injection());
+        assert!(cache.detect_sqli(b"admin'--").is_injection());
+    }
+    let stats = cache.stats();
+    assert_eq!((stats.bypassed, stats.misses, stats.hits), (2, 1, 1));
+    assert_eq!(cache.len(), 1);
+}
+
+#[test]
+fn test_cache_shared_between_threads() {
+    let cache = VerdictCache::new(1000);
+    std::thread::scope(|scope| {
+        for _ in 0..4 {
+            scope.spawn(|| {
+                for _ in 0..50 {
+                    for input in INPUTS {
+                        assert_eq!(cache.detect_xss(input), detect_xss(input));
+                    }
+                }
+            });
+        }
+    });
+    let stats = cache.stats();
+    assert_eq!(stats.hits + stats.misses, 4 * 50 * INPUTS.len() as u64);
+    assert_eq!(cache.len(), INPUTS.len());
+}
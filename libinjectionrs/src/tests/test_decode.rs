@@ -0,0 +1,94 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use crate::decode::{UrlDecoder, UrlEncoding};
+use crate::Scanner;
+
+fn inputs() -> Vec<Vec<u8>> {
+    let mut inputs: Vec<Vec<u8>> = [
+        &b""[..],
+        b"plain",
+        b"%",
+        b"%4",
+        b"%41",
+        b"%4g%41",
+        b"%%41",
+        b"a+b%2Bc",
+        b"%e2%80%99%ZZ%fF",
+        b"1%27%20OR%20%271%27%3D%271",
+        b"%3Cscript%3Ealert(1)%3C/script%3E+",
+    ]
+    .iter()
+    .map(|input| input.to_vec())
+    .collect();
+    // Short strings over the bytes that matter to decoding
+    const ALPHABET: &[u8] = b"%+4aG\xff";
+    for len in 1..=4u32 {
+        for mut n in 0..ALPHABET.len().pow(len) {
+            let mut input = Vec::new();
+            for _ in 0..len {
+                input.push(ALPHABET[n % ALPHABET.len()]);
+                n /= ALPHABET.len();
+            }
+            inputs.push(input);
+        }
+    }
+    inputs
+}
+
+#[test]
+fn test_percent_decoding_matches_urlencoding() {
+    let mut decoder = UrlDecoder::with_encoding(UrlEncoding::Percent);
+    for input in inputs() {
+        let expected = urlencoding::decode_binary(&input);
+        assert_eq!(decoder.decode(&input), &*expected, "input {:?}", input);
+    }
+}
+
+#[test]
+fn test_form_decoding_reads_plus_as_space() {
+    let mut decoder = UrlDecoder::new();
+    assert_eq!(decoder.encoding(), UrlEncoding::Form);
+    for input in inputs() {
+        let spaced: Vec<u8> = input.iter().map(|&b| if b == b'+' { b' ' } else { b }).collect();
+        let expected = urlencoding::decode_binary(&spaced);
+        assert_eq!(decoder.decode(&input), &*expected, "input {:?}", input);
+    }
+}
+
+#[test]
+fn test_values_without_escapes_are_not_copied() {
+    let mut decoder = UrlDecoder::new();
+    let input = b"no escapes here";
+    assert!(std::ptr::eq(decoder.decode(input), &input[..]));
+
+    let mut decoder = UrlDecoder::with_encoding(UrlEncoding::Percent);
+    let input = b"a+b";
+    assert!(std::ptr::eq(decoder.decode(input), &input[..]));
+}
+
+#[test]
+fn test_scanner_detects_decoded_values() {
+    let mut scanner = Scanner::new();
+    let mut decoder = UrlDecoder::new();
+    let values: &[&[u8]] = &[
+        b"john",
+        b"1%27+OR+%271%27%3D%271",
+        b"%3Cscript%3Ealert(1)%3C%2Fscript%3E",
+        b"caf%C3%A9+au+lait",
+        b"100%",
+    ];
+    for value in values {
+        let expected = Scanner::new().detect(decoder.decode(value));
+        assert_eq!(scanner.detect_url_encoded(value), expected, "value {:?}", value);
+    }
+    assert!(scanner.detect_url_encoded(b"1%27+OR+%271%27%3D%271").is_injection());
+    assert!(!scanner.detect(b"1%27+OR+%271%27%3D%271").is_injection());
+
+    // `+` is only a space in form encoding
+    let mut scanner = Scanner::new().with_url_encoding(UrlEncoding::Percent);
+    assert_eq!(scanner.detect_url_encoded(b"1+OR+1"), Scanner::new().detect(b"1+OR+1"));
+}
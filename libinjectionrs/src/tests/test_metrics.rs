@@ -0,0 +1,134 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use crate::metrics::{snapshot, thread_snapshot, MetricsSnapshot, SQLI_DIALECTS, SQLI_QUOTES, XSS_RULES};
+use crate::{detect_sqli, detect_xss, Scanner};
+
+// Counts of running `f` on this thread; other tests run on other threads
+fn counted(f: impl FnOnce()) -> MetricsSnapshot {
+    let before = thread_snapshot();
+    f();
+    thread_snapshot().since(&before)
+}
+
+fn passes(m: &MetricsSnapshot) -> (u64, u64) {
+    let mut total = (0, 0);
+    for q in 0..SQLI_QUOTES.len() {
+        for d in 0..SQLI_DIALECTS.len() {
+            total.0 += m.sqli_passes(q, d);
+            total.1 += m.sqli_pass_hits(q, d);
+        }
+    }
+    total
+}
+
+#[test]
+fn test_sqli_passes_are_counted() {
+    let input = b"1' OR '1'='1";
+    let m = counted(|| assert!(detect_sqli(input).is_injection()));
+    assert_eq!(m.sqli_detections(), 1);
+    assert_eq!(m.sqli_prefiltered(), 0);
+    let (run, hits) = passes(&m);
+    assert_eq!(hits, 1);
+    assert!(run >= 1);
+    // The quote gives a single quote pass, which is the one that fires
+    assert_eq!(m.sqli_pass_hits(1, 0) + m.sqli_pass_hits(1, 1), 1);
+    assert_eq!(m.sqli_bytes(), run * input.len() as u64);
+    assert!(m.sqli_tokens() >= run);
+    assert!(m.sqli_blacklist_hits() >= 1);
+
+    let m = counted(|| assert!(!detect_sqli(b"SELECT a FROM b").is_injection()));
+    assert_eq!(m.sqli_detections(), 1);
+    assert_eq!(passes(&m), (1, 0));
+    assert_eq!(m.sqli_passes(0, 0), 1);
+}
+
+#[test]
+fn test_whitelist_overrides_are_counted() {
+    // Blacklisted fingerprints the two-token whitelist rules clear
+    for input in [&b"1 UNION"[..], b"foo --", b"1 or 1"] {
+        let m = counted(|| assert!(!detect_sqli(input).is_injection()));
+        assert!(m.sqli_blacklist_hits() >= 1, "{:?}", input);
+        assert_eq!(m.sqli_whitelist_overrides(), m.sqli_blacklist_hits(), "{:?}", input);
+    }
+
+    let m = counted(|| assert!(detect_sqli(b"1 UNION SELECT 2").is_injection()));
+    assert_eq!(m.sqli_whitelist_overrides(), 0);
+}
+
+#[test]
+fn test_prefiltered_inputs_are_counted() {
+    let m = counted(|| {
+        assert!(!detect_sqli(b"hello").is_injection());
+        assert!(!detect_xss(b"hello").is_injection());
+    });
+    assert_eq!((m.sqli_prefiltered(), m.sqli_detections()), (1, 0));
+    assert_eq!((m.xss_prefiltered(), m.xss_detections()), (1, 0));
+    assert_eq!(passes(&m), (0, 0));
+
+    let mut scanner = Scanner::new();
+    let m = counted(|| assert!(!scanner.detect(b"hello").is_injection()));
+    assert_eq!((m.sqli_prefiltered(), m.xss_prefiltered()), (1, 1));
+}
+
+#[test]
+fn test_xss_rules_are_counted() {
+    let cases: &[(&[u8], &str)] = &[
+        (b"<!DOCTYPE html>", "doctype"),
+        (b"<script>alert(1)</script>", "tag"),
+        (b"<img src=x onerror=alert(1)>", "attribute"),
+        (b"<a href=javascript:alert(1)>", "url"),
+        (b"<div style=color:red>", "style"),
+        (b"<!--[if IE]>x<![endif]-->", "comment"),
+    ];
+    for &(input, rule) in cases {
+        let m = counted(|| assert!(detect_xss(input).is_injection(), "{:?}", input));
+        let index = XSS_RULES.iter().position(|&r| r == rule).unwrap();
+        for r in 0..XSS_RULES.len() {
+            assert_eq!(m.xss_hits(r), u64::from(r == index), "{:?} {}", input, XSS_RULES[r]);
+        }
+        assert_eq!(m.xss_detections(), 1);
+        assert_eq!(m.xss_bytes(), input.len() as u64);
+        assert!(m.xss_contexts() >= 1 && m.xss_contexts() <= 5);
+        assert!(m.xss_tokens() >= 1);
+    }
+
+    let m = counted(|| assert!(!detect_xss(b"<b>bold</b> text").is_injection()));
+    assert_eq!(m.xss_detections(), 1);
+    assert!((0..XSS_RULES.len()).all(|r| m.xss_hits(r) == 0));
+    assert!(m.xss_contexts() >= 1);
+}
+
+#[test]
+fn test_snapshot_keeps_exited_threads() {
+    let before = snapshot();
+    std::thread::spawn(|| {
+        detect_sqli(b"1 UNION SELECT 2");
+    })
+    .join()
+    .unwrap();
+    let after = snapshot();
+    assert!(after.sqli_detections() > before.sqli_detections());
+    assert!(after.sqli_tokens() > before.sqli_tokens());
+}
+
+#[test]
+fn test_prometheus_export() {
+    let m = counted(|| {
+        detect_sqli(b"1' OR '1'='1");
+        detect_xss(b"<script>");
+    });
+    let text = m.to_prometheus("libinjection_");
+    assert!(text.contains("# TYPE libinjection_sqli_detections_total counter\n"));
+    assert!(text.contains("\nlibinjection_sqli_detections_total 1\n"));
+    assert!(text.contains("libinjection_sqli_passes_total{quote=\"double\",dialect=\"mysql\"} 0\n"));
+    assert!(text.contains("libinjection_xss_hits_total{rule=\"tag\"} 1\n"));
+    for line in text.lines().filter(|line| !line.starts_with('#')) {
+        let (name, value) = line.rsplit_once(' ').unwrap();
+        assert!(name.starts_with("libinjection_"), "{}", line);
+        value.parse::<u64>().unwrap();
+    }
+}
@@ -0,0 +1,233 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use std::collections::VecDeque;
+use std::convert::Infallible;
+use std::future::{poll_fn, Future};
+use std::pin::{pin, Pin};
+use std::sync::atomic::{AtomicUsize, Ordering};
+use std::sync::{Arc, Mutex};
+use std::task::{Context, Poll};
+
+use bytes::Bytes;
+use http::{Request, Response, StatusCode};
+use http_body::{Body, Frame};
+use http_body_util::{BodyExt, Full};
+use tower_layer::Layer;
+use tower_service::Service;
+
+use super::fixtures::INPUTS;
+use crate::middleware::{AsyncScanner, BodyScan, InjectionLayer};
+use crate::{DetectionResult, Scanner, StreamingDetector};
+
+fn block_on<F: Future>(future: F) -> F::Output {
+    tokio::runtime::Builder::new_current_thread().build().unwrap().block_on(future)
+}
+
+// Each input, and each input after padding that takes it past the inline limit
+fn inputs() -> Vec<Vec<u8>> {
+    INPUTS
+        .iter()
+        .flat_map(|input| [input.to_vec(), [&b"x ".repeat(300)[..], input].concat()])
+        .collect()
+}
+
+// A body that yields its chunks one frame at a time and counts the frames read
+struct Chunks {
+    chunks: VecDeque<Bytes>,
+    read: Arc<AtomicUsize>,
+}
+
+impl Chunks {
+    fn new(input: &[u8], size: usize) -> Self {
+        Chunks {
+            chunks: input.chunks(size).map(Bytes::copy_from_slice).collect(),
+            read: Arc::new(AtomicUsize::new(0)),
+        }
+    }
+}
+
+impl Body for Chunks {
+    type Data = Bytes;
+    type Error = Infallible;
+
+    fn poll_frame(mut self: Pin<&mut Self>, _cx: &mut Context<'_>) -> Poll<Option<Result<Frame<Bytes>, Infallible>>> {
+        self.read.fetch_add(1, Ordering::Relaxed);
+        Poll::Ready(self.chunks.pop_front().map(|chunk| Ok(Frame::data(chunk))))
+    }
+}
+
+// Records the bodies it is called with
+#[derive(Clone, Default)]
+struct Backend(Arc<Mutex<Vec<Bytes>>>);
+
+impl Service<Request<Full<Bytes>>> for Backend {
+    type Response = Response<String>;
+    type Error = Infallible;
+    type Future = Pin<Box<dyn Future<Output = Result<Response<String>, Infallible>> + Send>>;
+
+    fn poll_ready(&mut self, _cx: &mut Context<'_>) -> Poll<Result<(), Infallible>> {
+        Poll::Ready(Ok(()))
+    }
+
+    fn call(&mut self, request: Request<Full<Bytes>>) -> Self::Future {
+        let seen = Arc::clone(&self.0);
+        Box::pin(async move {
+            let body = request.into_body().collect().await.unwrap().to_bytes();
+            seen.lock().unwrap().push(body);
+            Ok(Response::new(String::from("ok")))
+        })
+    }
+}
+
+#[test]
+fn test_async_detect_matches_scanner() {
+    let scanner = AsyncScanner::new().with_inline_limit(64).with_blocking_jobs(2);
+    let mut expected = Scanner::new();
+    block_on(async {
+        for input in inputs() {
+            let result = scanner.detect(input.clone()).await.unwrap();
+            assert_eq!(result, expected.detect(&input), "{:?}", String::from_utf8_lossy(&input));
+        }
+    });
+}
+
+#[test]
+fn test_async_stream_matches_streaming_detector() {
+    let scanner = AsyncScanner::new().with_inline_limit(64);
+    block_on(async {
+        for input in inputs() {
+            for size in [1, 7, 100, 4096] {
+                let mut stream = scanner.stream();
+                let mut detector = StreamingDetector::new();
+                for chunk in input.chunks(size) {
+                    let found = stream.feed(Bytes::copy_from_slice(chunk)).await.unwrap();
+                    assert_eq!(found, detector.feed(chunk));
+                }
+                assert_eq!(stream.finish().await.unwrap(), detector.finish());
+            }
+        }
+    });
+}
+
+#[test]
+fn test_scan_body_stops_at_first_injection() {
+    let scanner = AsyncScanner::new().with_inline_limit(64);
+    let input = [&b"<script>alert(1)</script>"[..], &b"a".repeat(10_000)].concat();
+    let body = Chunks::new(&input, 100);
+    let read = Arc::clone(&body.read);
+    let scan = block_on(scanner.scan_body(body, usize::MAX)).unwrap();
+    assert!(matches!(scan, BodyScan::Injection(result) if result.is_injection()));
+    assert!(read.load(Ordering::Relaxed) < 10);
+
+    let input = b"q=hello ".repeat(1000);
+    let scan = block_on(scanner.scan_body(Chunks::new(&input, 100), usize::MAX)).unwrap();
+    assert_eq!(scan, BodyScan::Clean(Bytes::from(input.clone())));
+    let scan = block_on(scanner.scan_body(Chunks::new(&input, 100), 4000)).unwrap();
+    assert_eq!(scan, BodyScan::TooLarge);
+}
+
+async fn send<S>(service: &mut S, body: &[u8]) -> S::Response
+where
+    S: Service<Request<Chunks>>,
+    S::Error: std::fmt::Debug,
+{
+    poll_fn(|cx| service.poll_ready(cx)).await.unwrap();
+    service.call(Request::new(Chunks::new(body, 16))).await.unwrap()
+}
+
+#[test]
+fn test_injection_layer() {
+    let backend = Backend::default();
+    let mut service = InjectionLayer::new(AsyncScanner::new().with_inline_limit(64))
+        .with_max_body(1000)
+        .layer(backend.clone());
+    block_on(async {
+        let response = send(&mut service, b"name=john&id=42").await;
+        assert_eq!(response.status(), StatusCode::OK);
+
+        let response = send(&mut service, b"id=1' OR '1'='1").await;
+        assert_eq!(response.status(), StatusCode::FORBIDDEN);
+        assert!(response.extensions().get::<DetectionResult>().is_some_and(|result| result.is_injection()));
+
+        let response = send(&mut service, &b"a".repeat(2000)).await;
+        assert_eq!(response.status(), StatusCode::PAYLOAD_TOO_LARGE);
+    });
+    assert_eq!(*backend.0.lock().unwrap(), [Bytes::from_static(b"name=john&id=42")]);
+}
+
+#[test]
+fn test_dropped_check_gives_up_its_slot() {
+    let scanner = AsyncScanner::new().with_inline_limit(0).with_blocking_jobs(1);
+    let input = Bytes::from(b"q=hello ".repeat(100_000));
+    block_on(async {
+        let running = tokio::spawn({
+            let scanner = scanner.clone();
+            let input = input.clone();
+            async move { scanner.detect(input).await }
+        });
+        // Let it take the only slot, queue a check behind it, and drop that
+        // check while it waits
+        tokio::task::yield_now().await;
+        {
+            let mut queued = pin!(scanner.detect(input.clone()));
+            poll_fn(|cx| {
+                let _ = queued.as_mut().poll(cx);
+                Poll::Ready(())
+            })
+            .await;
+        }
+        assert!(!running.await.unwrap().unwrap().is_injection());
+        assert!(scanner.detect(&b"1' OR '1'='1"[..]).await.unwrap().is_injection());
+    });
+}
+
+#[test]
+fn test_feeds_scan_their_chunk_between_rechecks() {
+    let mut detector = StreamingDetector::new();
+    let mut rescans = Vec::new();
+    for _ in 0..1000 {
+        if detector.feed_work(10) > 10 {
+            rescans.push(detector.buffered().len() + 10);
+        }
+        assert_eq!(detector.feed(b"q=hello&x="), None);
+    }
+    // Only the doubling SQLi rechecks rescan the buffer
+    assert_eq!(rescans, [70, 140, 280, 560, 1120, 2240, 4480, 8960]);
+    assert_eq!(detector.finish_work(), 10_000);
+
+    let body = detector.buffered().to_vec();
+    assert_eq!(detector.take_buffer(), body);
+    assert!(detector.buffered().is_empty());
+}
+
+#[test]
+fn test_stream_dropped_while_queued_is_pooled() {
+    let scanner = AsyncScanner::new().with_inline_limit(0).with_blocking_jobs(1);
+    let input = Bytes::from(b"q=hello ".repeat(100_000));
+    block_on(async {
+        let mut stream = scanner.stream();
+        assert_eq!(stream.feed(&b"hello"[..]).await.unwrap(), None);
+
+        let running = tokio::spawn({
+            let scanner = scanner.clone();
+            async move { scanner.detect(input).await }
+        });
+        // Queue the finish behind the check holding the only slot, and drop
+        // it while it waits
+        tokio::task::yield_now().await;
+        {
+            let mut queued = pin!(stream.finish());
+            poll_fn(|cx| {
+                let _ = queued.as_mut().poll(cx);
+                Poll::Ready(())
+            })
+            .await;
+        }
+        assert!(!running.await.unwrap().unwrap().is_injection());
+    });
+    assert_eq!(scanner.idle_streams(), 1);
+}
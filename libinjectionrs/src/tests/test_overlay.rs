@@ -0,0 +1,175 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use crate::overlay::{RuleOverlay, Rules};
+use crate::sqli::sqli_data::lookup_word_bytes;
+use crate::sqli::{SqliTokenizer, TokenType};
+use crate::xss::AttributeType;
+use crate::{detect_sqli_with_flags, detect_xss, Error, Scanner, SqliFlags, SqliState};
+
+const INPUTS: &[&[u8]] = &[
+    b"",
+    b"hello",
+    b"select",
+    b"1' OR '1'='1",
+    b"1 UNION SELECT password FROM users",
+    b"admin'--",
+    b"1 and send_mail(5)",
+    b"<script>alert(1)</script>",
+    b"<img src=x onerror=alert(1)>",
+    b"<marquee onstart=x>",
+    b"<b data-x=\"javascript:alert(1)\">",
+    b"<p class=\"safe\">A paragraph.</p>",
+];
+
+fn blob(overlay: RuleOverlay) -> Vec<u8> {
+    overlay.to_bytes().unwrap()
+}
+
+fn sqli(rules: &Rules<'_>, input: &[u8]) -> bool {
+    SqliState::new(input, SqliFlags::FLAG_NONE).with_rules(rules).detect()
+}
+
+fn fingerprint(input: &[u8]) -> String {
+    SqliState::new(input, SqliFlags::FLAG_NONE).get_fingerprint().as_str().to_string()
+}
+
+#[test]
+fn test_empty_overlay_matches_builtin_tables() {
+    let blob = blob(RuleOverlay::new());
+    let rules = &Rules::from_bytes(&blob).unwrap();
+    let mut scanner = Scanner::new().with_rules(rules);
+    for input in INPUTS {
+        let expected = detect_sqli_with_flags(input, SqliFlags::FLAG_NONE);
+        assert_eq!(scanner.detect_sqli(input), expected, "input {:?}", input);
+        assert_eq!(scanner.detect_xss(input), detect_xss(input), "input {:?}", input);
+    }
+    for word in ["SELECT", "union", "sleep", "hello", "UNION ALL"] {
+        assert_eq!(rules.lookup_word(word.as_bytes()), lookup_word_bytes(word.as_bytes()));
+    }
+}
+
+#[test]
+fn test_blob_round_trip() {
+    let overlay = RuleOverlay::new()
+        .with_keyword("send_mail", TokenType::Function)
+        .with_fingerprint("1;f(1")
+        .with_xss_tag("marquee")
+        .with_xss_attribute("data-x", AttributeType::AttrUrl);
+    let blob = overlay.to_bytes().unwrap();
+    assert_eq!(overlay.to_bytes().unwrap(), blob);
+
+    let rules = Rules::from_bytes(&blob).unwrap();
+    assert_eq!(rules.as_bytes(), &blob[..]);
+    assert_eq!(rules.lookup_word(b"Send_Mail"), TokenType::Function);
+    assert!(rules.is_blacklisted_fingerprint(b"1;f(1\0\0\0"));
+
+    // A copy at another alignment reads the same
+    let shifted = [&[0u8][..], &blob].concat();
+    let rules = Rules::from_bytes(&shifted[1..]).unwrap();
+    assert_eq!(rules.lookup_word(b"SEND_MAIL"), TokenType::Function);
+}
+
+#[test]
+fn test_keywords() {
+    let blob = blob(
+        RuleOverlay::new()
+            .with_keyword("send_mail", TokenType::Function)
+            .without_keyword("sleep"),
+    );
+    let rules = &Rules::from_bytes(&blob).unwrap();
+    assert_eq!(rules.lookup_word(b"SEND_MAIL"), TokenType::Function);
+    assert_eq!(rules.lookup_word(b"SLEEP"), TokenType::Bareword);
+    assert_eq!(rules.lookup_word(b"SELECT"), lookup_word_bytes(b"SELECT"));
+
+    assert!(!detect_sqli_with_flags(b"1 and send_mail(5)", SqliFlags::FLAG_NONE).is_injection());
+    assert!(sqli(rules, b"1 and send_mail(5)"));
+
+    let input = b"1 and sleep(5)";
+    assert_ne!(lookup_word_bytes(b"SLEEP"), TokenType::Bareword);
+    assert_ne!(
+        SqliState::new(input, SqliFlags::FLAG_NONE).with_rules(rules).get_fingerprint(),
+        SqliState::new(input, SqliFlags::FLAG_NONE).get_fingerprint()
+    );
+
+    let overlay = RuleOverlay::new().with_keyword("x", TokenType::String);
+    assert!(matches!(overlay.to_bytes(), Err(Error::InvalidInput(_))));
+}
+
+#[test]
+fn test_fingerprints() {
+    let hello = fingerprint(b"hello");
+    let union = fingerprint(b"1 UNION SELECT password FROM users");
+    let blob = blob(RuleOverlay::new().with_fingerprint(&hello).without_fingerprint(&union));
+    let rules = &Rules::from_bytes(&blob).unwrap();
+    assert!(sqli(rules, b"hello"));
+    assert!(!sqli(rules, b"1 UNION SELECT password FROM users"));
+    assert!(sqli(rules, b"1' OR '1'='1"));
+
+    // The scanner's prefilter sees the overlay too
+    let mut scanner = Scanner::new().with_rules(rules);
+    assert!(scanner.detect_sqli(b"hello").is_injection());
+    assert!(!scanner.detect_sqli(b"1 UNION SELECT password FROM users").is_injection());
+}
+
+#[test]
+fn test_xss_names() {
+    let blob = blob(
+        RuleOverlay::new()
+            .with_xss_tag("marquee")
+            .without_xss_tag("script")
+            .with_xss_attribute("data-x", AttributeType::AttrUrl)
+            .without_xss_attribute("onerror"),
+    );
+    let rules = &Rules::from_bytes(&blob).unwrap();
+    let scanner = Scanner::new().with_rules(rules);
+    assert!(scanner.detect_xss(b"<marquee>").is_injection());
+    assert!(!scanner.detect_xss(b"<script>alert(1)</script>").is_injection());
+    assert!(scanner.detect_xss(b"<b data-x=\"javascript:alert(1)\">").is_injection());
+    assert!(!scanner.detect_xss(b"<img src=x onerror=alert(1)>").is_injection());
+
+    // Prefix rules stay
+    assert!(scanner.detect_xss(b"<svg>").is_injection());
+    assert!(scanner.detect_xss(b"<b xmlns=x>").is_injection());
+
+    let overlay = RuleOverlay::new().with_xss_tag(&"x".repeat(100));
+    assert!(matches!(overlay.to_bytes(), Err(Error::InvalidInput(_))));
+}
+
+#[test]
+fn test_from_bytes_rejects_bad_blobs() {
+    let blob = RuleOverlay::new().with_keyword("send_mail", TokenType::Function).to_bytes().unwrap();
+    assert!(Rules::from_bytes(&blob[..blob.len() - 1]).is_err());
+    assert!(Rules::from_bytes(&blob[..4]).is_err());
+    assert!(Rules::from_bytes(&[]).is_err());
+
+    let mut bad = blob.clone();
+    bad[0] = b'X';
+    assert!(matches!(Rules::from_bytes(&bad), Err(Error::ParseError(_))));
+    let mut bad = blob.clone();
+    bad[4] = 2;
+    assert!(matches!(Rules::from_bytes(&bad), Err(Error::ParseError(_))));
+}
+
+#[test]
+fn test_tokenizer_rules_match_lookup_fn() {
+    let blob = blob(RuleOverlay::new().with_keyword("send_mail", TokenType::Function));
+    let rules = &Rules::from_bytes(&blob).unwrap();
+    // A lookup fn is 'static, so this one opens its own copy of the blob
+    let owned = blob.clone();
+    let lookup = move |word: &str| Rules::from_bytes(&owned).unwrap().lookup_word(word.as_bytes());
+    for input in INPUTS {
+        let mut with_rules = SqliTokenizer::new(input, SqliFlags::FLAG_NONE).with_rules(rules);
+        let mut with_fn = SqliTokenizer::new(input, SqliFlags::FLAG_NONE).with_lookup_fn(&lookup);
+        loop {
+            let (a, b) = (with_rules.next_token(), with_fn.next_token());
+            assert_eq!(a.as_ref().map(|t| (t.token_type, t.pos, t.len)), b.as_ref().map(|t| (t.token_type, t.pos, t.len)));
+            if a.is_none() {
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use crate::parallel::ParallelScanner;
+use crate::{Scanner, SqliFlags};
+
+#[test]
+fn test_parallel_scan_keeps_input_order() {
+    let samples: &[&[u8]] = &[
+        b"hello",
+        b"1' OR '1'='1",
+        b"<script>alert(1)</script>",
+        b"1 UNION SELECT password FROM users",
+        b"plain text with 'quotes'",
+        b"<img src=x onerror=alert(1)>",
+        b"",
+    ];
+    // Uneven record lengths, so chunks finish out of order
+    let records: Vec<Vec<u8>> = (0..5000)
+        .map(|i| {
+            let mut record = samples[i % samples.len()].to_vec();
+            record.resize(record.len() + i % 97, b'a');
+            record
+        })
+        .collect();
+    let records: Vec<&[u8]> = records.iter().map(|record| record.as_slice()).collect();
+
+    let flags = SqliFlags::FLAG_QUOTE_SINGLE | SqliFlags::FLAG_SQL_ANSI;
+    let mut scanner = Scanner::with_sqli_flags(flags);
+    let expected: Vec<_> = records.iter().map(|record| scanner.detect(record)).collect();
+
+    for threads in [1, 2, 3, 8] {
+        let parallel = ParallelScanner::new().with_threads(threads).with_sqli_flags(flags);
+        assert_eq!(parallel.scan_records(&records), expected, "threads {}", threads);
+        // An iterator is handed out a chunk at a time as it is read
+        assert_eq!(parallel.scan(records.iter().copied()), expected, "threads {}", threads);
+    }
+    assert!(ParallelScanner::new().scan_records(&[]).is_empty());
+    assert!(ParallelScanner::new().with_threads(4).scan(std::iter::empty()).is_empty());
+}
@@ -0,0 +1,156 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use crate::prefilter::{classify, classify_fields};
+use crate::sqli::sqli_data::SQL_KEYWORDS;
+use crate::xss::XssResult;
+use crate::{detect_sqli_with_limits, detect_xss, sqli_result, ScanLimits, SqliFlags, SqliState, XssDetector};
+
+// Bytes on either side of every class boundary the prefilter relies on
+const ALPHABET: &[u8] = b"09aAbBeEnNqQuUxXzZ_ .`'\"<>=/\t\r\x0B\x00\x80\xA0\xFF$@#-+(*!&";
+
+const FLAGS: &[SqliFlags] = &[
+    SqliFlags::FLAG_NONE,
+    SqliFlags::FLAG_SQL_MYSQL,
+    SqliFlags::FLAG_QUOTE_SINGLE,
+    SqliFlags::FLAG_QUOTE_DOUBLE,
+];
+
+// Checks one input: whenever the prefilter claims a verdict, the full
+// detectors must agree, and the public entry points must not change
+fn check(input: &[u8], flags: SqliFlags, limits: ScanLimits) -> bool {
+    let proof = classify(input);
+    let mut state = SqliState::new(input, flags).with_limits(limits);
+    let full = sqli_result(&mut state);
+    let proven = proof.sqli_safe(input, flags, limits);
+    if let Some(fingerprint) = &proven {
+        assert!(!full.is_injection(), "{:?} proven safe but is SQLi", input);
+        assert!(!full.truncated, "{:?} proven safe but truncated", input);
+        assert_eq!(full.fingerprint.as_ref(), Some(fingerprint), "{:?}", input);
+    }
+    assert_eq!(detect_sqli_with_limits(input, flags, limits), full, "{:?}", input);
+
+    if proof.xss_safe() {
+        assert_eq!(XssDetector::new().detect_unfiltered(input), XssResult::Safe, "{:?}", input);
+    }
+    proven.is_some()
+}
+
+#[test]
+fn test_prefilter_exhaustive_short_inputs() {
+    // Every input of up to two bytes
+    let mut proven = 0;
+    for a in 0..=255u8 {
+        proven += usize::from(check(&[a], SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED));
+        for b in 0..=255u8 {
+            proven += usize::from(check(&[a, b], SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED));
+        }
+    }
+    assert!(proven > 10_000);
+
+    // Every input of three bytes from the boundary alphabet, under each flag
+    for &a in ALPHABET {
+        for &b in ALPHABET {
+            for &c in ALPHABET {
+                for &flags in FLAGS {
+                    check(&[a, b, c], flags, ScanLimits::UNLIMITED);
+                }
+            }
+        }
+    }
+    assert!(check(b"", SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED));
+}
+
+#[test]
+fn test_prefilter_every_keyword() {
+    // A word's token type comes from the keyword table, so every entry
+    // covers one way a lone word can be classified
+    for keyword in SQL_KEYWORDS {
+        let word = keyword.word.as_bytes();
+        let mut cased = Vec::new();
+        cased.push(word.to_vec());
+        cased.push(word.to_ascii_lowercase());
+        cased.push(word.iter().enumerate().map(|(i, b)| if i % 2 == 0 { b.to_ascii_lowercase() } else { *b }).collect());
+        for input in &cased {
+            for &flags in FLAGS {
+                check(input, flags, ScanLimits::UNLIMITED);
+            }
+            let mut longer = input.clone();
+            longer.extend_from_slice(b"_x1");
+            check(&longer, SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED);
+        }
+    }
+}
+
+#[test]
+fn test_prefilter_lengths_and_limits() {
+    // Around the token size, where words stop being looked up
+    for len in 1..=70 {
+        for fill in [b'1', b'a', b'_', 0x80] {
+            let mut input = vec![fill; len];
+            input[0] = if fill == b'1' { b'9' } else { b'u' };
+            for limits in [
+                ScanLimits::UNLIMITED,
+                ScanLimits::new(len, 2),
+                ScanLimits::new(len - 1, 64),
+                ScanLimits::new(len, 1),
+                ScanLimits::new(len, 0),
+            ] {
+                check(&input, SqliFlags::FLAG_NONE, limits);
+            }
+        }
+    }
+    let mut keyword_padded = b"SELECT".to_vec();
+    keyword_padded.resize(32, b'_');
+    check(&keyword_padded, SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED);
+}
+
+#[test]
+fn test_prefilter_typical_values() {
+    let values: &[&[u8]] = &[
+        b"12345",
+        b"hello",
+        b"john_smith",
+        b"dGhpcyBpcyBiYXNlNjQ",
+        b"550e8400e29b41d4a716446655440000",
+        b"550e8400-e29b-41d4-a716-446655440000",
+        b"dGhpcyBpcyBiYXNlNjQ=",
+        b"caf\xc3\xa9",
+        b"union",
+        b"or",
+    ];
+    for value in values {
+        check(value, SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED);
+        assert_eq!(detect_xss(value), XssDetector::new().detect_unfiltered(value));
+    }
+    assert!(classify(b"550e8400-e29b-41d4-a716-446655440000").xss_safe());
+    assert!(!classify(b"dGhpcyBpcyBiYXNlNjQ=").xss_safe());
+    assert!(classify(b"hello").sqli_safe(b"hello", SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED).is_some());
+}
+
+#[test]
+fn test_prefilter_fields_match_one_at_a_time() {
+    // Fields of every length around the step size, cleared and not, with
+    // empty ones between
+    let pieces: &[&[u8]] = &[b"", b"a", b"1234567", b"12345678", b"123456789", b"hello world", b"x<y", b"abcdefgh'", b"caf\xc3\xa9"];
+    let mut arena = Vec::new();
+    let mut ends = Vec::new();
+    for (i, piece) in pieces.iter().cycle().take(40).enumerate() {
+        arena.extend_from_slice(piece);
+        arena.extend(core::iter::repeat_n(b'z', i % 11));
+        ends.push(arena.len());
+    }
+
+    let mut proofs = Vec::new();
+    classify_fields(&arena, &ends, &mut proofs);
+    let starts = core::iter::once(0).chain(ends.iter().copied());
+    let expected: Vec<_> = starts.zip(&ends).map(|(start, &end)| classify(&arena[start..end])).collect();
+    assert_eq!(proofs, expected);
+
+    proofs.clear();
+    classify_fields(&[], &[], &mut proofs);
+    assert!(proofs.is_empty());
+}
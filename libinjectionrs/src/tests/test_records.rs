@@ -0,0 +1,54 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use crate::records::{records, split_lines, RecordFormat};
+
+#[test]
+fn test_split_lines_matches_buf_read_lines() {
+    use std::io::BufRead;
+
+    let inputs: &[&str] = &["", "\n", "a", "a\n", "a\r\nb", "a\n\nb\n", "\n\n", "a\rb\n", "x\r\n"];
+    for input in inputs {
+        let expected: Vec<String> = input.as_bytes().lines().map(|line| line.unwrap()).collect();
+        let lines: Vec<&[u8]> = split_lines(input.as_bytes()).collect();
+        let expected: Vec<&[u8]> = expected.iter().map(|line| line.as_bytes()).collect();
+        assert_eq!(lines, expected, "input {:?}", input);
+    }
+}
+
+#[test]
+fn test_nul_delimited_records() {
+    let cases: &[(&[u8], &[&[u8]])] = &[
+        (b"", &[]),
+        (b"\0", &[b""]),
+        (b"a\0b", &[b"a", b"b"]),
+        (b"a\0b\0", &[b"a", b"b"]),
+        (b"a\n\r\0\0b", &[b"a\n\r", b"", b"b"]),
+    ];
+    for (input, expected) in cases {
+        let split: Vec<&[u8]> = records(input, RecordFormat::Nul).map(Result::unwrap).collect();
+        assert_eq!(&split, expected, "input {:?}", input);
+    }
+}
+
+#[test]
+fn test_length_prefixed_records() {
+    let mut data = Vec::new();
+    let inputs: &[&[u8]] = &[b"1' OR '1'='1", b"", b"\0\n\xff", &[b'x'; 300]];
+    for input in inputs {
+        data.extend_from_slice(&(input.len() as u32).to_le_bytes());
+        data.extend_from_slice(input);
+    }
+    let split: Vec<&[u8]> = records(&data, RecordFormat::LengthPrefixed).map(Result::unwrap).collect();
+    assert_eq!(split, inputs);
+
+    // A record cut short ends the iteration with an error
+    for cut in [1, 3, 5, data.len() - 1] {
+        let results: Vec<_> = records(&data[..cut], RecordFormat::LengthPrefixed).collect();
+        assert!(results.last().unwrap().is_err(), "cut {}", cut);
+        assert!(results[..results.len() - 1].iter().all(Result::is_ok));
+    }
+}
@@ -0,0 +1,80 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use super::fixtures::INPUTS;
+use crate::decode::{UrlDecoder, UrlEncoding};
+use crate::request::RequestScanner;
+use crate::{ScanLimits, Scanner, SqliFlags};
+
+// Values of the shapes a request carries besides the shared inputs
+const HEADERS: &[&[u8]] = &[b"john", b"session_token_abcdef", b"en-US,en;q=0.9", b"x"];
+
+fn fields() -> Vec<&'static [u8]> {
+    HEADERS.iter().chain(INPUTS).copied().collect()
+}
+
+#[test]
+fn test_request_matches_scanner() {
+    let scanners = [
+        Scanner::new,
+        || Scanner::with_sqli_flags(SqliFlags::FLAG_QUOTE_SINGLE | SqliFlags::FLAG_SQL_MYSQL),
+        || Scanner::new().with_limits(ScanLimits::new(16, 4)),
+    ];
+    let fields = fields();
+    for scanner in scanners {
+        let mut request = RequestScanner::with_scanner(scanner());
+        // The buffers carry over between requests
+        for _ in 0..2 {
+            for (i, field) in fields.iter().enumerate() {
+                assert_eq!(request.push(field), i);
+            }
+            assert_eq!(request.len(), fields.len());
+            let results = request.scan().to_vec();
+            assert_eq!(results.len(), fields.len());
+            for (field, result) in fields.iter().zip(&results) {
+                assert_eq!(*result, scanner().detect(field), "field {:?}", field);
+            }
+            assert!(results.iter().any(|result| result.is_injection()));
+            request.clear();
+            assert!(request.is_empty());
+            assert!(request.scan().is_empty());
+        }
+    }
+}
+
+#[test]
+fn test_request_fields() {
+    let fields = fields();
+    let mut request = RequestScanner::new();
+    for field in &fields {
+        request.push(field);
+    }
+    assert_eq!(request.fields().collect::<Vec<_>>(), fields);
+    for (i, field) in fields.iter().enumerate() {
+        assert_eq!(request.field(i), Some(*field));
+    }
+    assert_eq!(request.field(fields.len()), None);
+}
+
+#[test]
+fn test_request_decodes_fields() {
+    let encoded: &[&[u8]] = &[b"1%27+OR+%271%27%3D%271", b"caf%C3%A9", b"", b"a+b", b"%3Cscript%3E"];
+    let mut request = RequestScanner::new();
+    for field in encoded {
+        request.push_url_encoded(field);
+    }
+    request.push_decoded(b"a+b%2B", UrlEncoding::Percent);
+
+    let mut decoder = UrlDecoder::new();
+    for (i, field) in encoded.iter().enumerate() {
+        assert_eq!(request.field(i), Some(decoder.decode(field)));
+    }
+    assert_eq!(request.field(encoded.len()), Some(&b"a+b+"[..]));
+
+    let results = request.scan();
+    assert!(results[0].is_injection());
+    assert!(!results[1].is_injection());
+}
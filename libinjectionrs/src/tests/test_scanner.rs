@@ -0,0 +1,62 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use super::fixtures::{twice_reversed, INPUTS};
+use crate::{detect_sqli_with_limits, detect_xss, InjectionType, ScanLimits, Scanner, SqliFlags};
+
+fn check_scanner(mut scanner: Scanner, flags: SqliFlags, limits: ScanLimits) {
+    let inputs = twice_reversed(INPUTS);
+    let results: Vec<_> = scanner.detect_many(&inputs).collect();
+    assert_eq!(results.len(), inputs.len());
+
+    for (input, result) in inputs.iter().zip(results) {
+        let sqli = detect_sqli_with_limits(input, flags, limits);
+        assert_eq!(scanner.detect_sqli(input), sqli, "input {:?}", input);
+        assert_eq!(scanner.detect_xss(input), detect_xss(input), "input {:?}", input);
+
+        if sqli.is_injection() {
+            assert_eq!(result, sqli, "input {:?}", input);
+        } else if detect_xss(input).is_injection() {
+            assert_eq!(result.injection_type, InjectionType::Xss, "input {:?}", input);
+            assert!(result.is_injection());
+        } else {
+            assert_eq!(result, sqli, "input {:?}", input);
+        }
+    }
+}
+
+#[test]
+fn test_scanner_matches_one_shot() {
+    check_scanner(Scanner::new(), SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED);
+}
+
+#[test]
+fn test_scanner_matches_one_shot_with_flags_and_limits() {
+    let flags = SqliFlags::FLAG_QUOTE_SINGLE | SqliFlags::FLAG_SQL_MYSQL;
+    check_scanner(Scanner::with_sqli_flags(flags), flags, ScanLimits::UNLIMITED);
+
+    let limits = ScanLimits::new(16, 4);
+    check_scanner(Scanner::new().with_limits(limits), SqliFlags::FLAG_NONE, limits);
+}
+
+#[test]
+fn test_scanner_state_does_not_leak_between_values() {
+    let mut scanner = Scanner::new();
+    // A long value that fills the token buffers, then short ones
+    let mut long = b"1 UNION SELECT ".to_vec();
+    for _ in 0..50 {
+        long.extend_from_slice(b"a, 'b', (c), ");
+    }
+    let inputs: [&[u8]; 4] = [&long, b"1", b"", b"1' OR 1=1 --"];
+    for input in inputs {
+        assert_eq!(
+            scanner.detect_sqli(input),
+            detect_sqli_with_limits(input, SqliFlags::FLAG_NONE, ScanLimits::UNLIMITED),
+            "input {:?}",
+            input
+        );
+    }
+}
@@ -0,0 +1,134 @@
+#![allow(clippy::unwrap_used)]
+#![allow(clippy::expect_used)]
+#![allow(clippy::indexing_slicing)]
+#![allow(clippy::disallowed_methods)]
+#![allow(clippy::panic)]
+
+use super::fixtures::INPUTS;
+use crate::{detect_sqli_with_flags, detect_xss, SqliFlags, StreamingDetector};
+
+// Inputs that run on past their verdict or leave a token open, so a chunk
+// boundary can fall on either side of where they settle
+const BOUNDARY_INPUTS: &[&[u8]] = &[
+    b"admin'-- followed by a long and harmless tail of text that keeps going",
+    b"1 or 1=1 /* comment */ and more words after the fingerprint window",
+    b"x'0101010101010101010101010101010101010101",
+    b"b'0101010101010101 and then some more input to make it longer",
+    b"$abcdefghijklmnopqrstuvwxyz and then some more input to make it longer",
+    b"1 and sleep(5) and 'a'='a' followed by sp_password in a comment --",
+    b"1e5 union all select null,null,null,version(),user(),database()",
+    b"normal 'quoted' text with \"double\" quotes, nothing to see here at all",
+    b"<img src=x onerror=alert(1)> with a long tail after the tag itself",
+    b"<!-- a comment that stays open for a while",
+    b"<!DOCTYPE html><html><body>ok</body></html>",
+    b"<![CDATA[ some data ]]><b>bold</b>",
+    b"<p class=\"safe\">A paragraph of perfectly normal and safe markup.</p>",
+    b"' style='color:red",
+    b"<?import namespace>",
+    b"<%= harmless %><div>",
+];
+
+fn check_chunked(input: &[u8], chunk: usize, flags: SqliFlags) {
+    let expected_sqli = detect_sqli_with_flags(input, flags);
+    let expected_xss = detect_xss(input);
+
+    let mut detector = StreamingDetector::with_sqli_flags(flags);
+    for piece in input.chunks(chunk) {
+        if let Some(early) = detector.feed(piece) {
+            // An early verdict must be the one the whole input gets
+            assert!(early.is_injection());
+            match early.injection_type {
+                crate::InjectionType::Sqli => assert_eq!(early, expected_sqli, "input {:?}", input),
+                crate::InjectionType::Xss => assert!(expected_xss.is_injection(), "input {:?}", input),
+            }
+        }
+    }
+
+    let verdict = detector.finish();
+    assert_eq!(verdict.sqli, expected_sqli, "input {:?} chunk {}", input, chunk);
+    assert_eq!(verdict.xss, expected_xss, "input {:?} chunk {}", input, chunk);
+}
+
+#[test]
+fn test_streaming_matches_one_shot() {
+    for input in INPUTS.iter().chain(BOUNDARY_INPUTS) {
+        for chunk in 1..=input.len().max(1) {
+            check_chunked(input, chunk, SqliFlags::FLAG_NONE);
+        }
+    }
+}
+
+#[test]
+fn test_streaming_matches_one_shot_with_flags() {
+    let flags = SqliFlags::FLAG_QUOTE_SINGLE | SqliFlags::FLAG_SQL_MYSQL;
+    for input in INPUTS.iter().chain(BOUNDARY_INPUTS) {
+        for chunk in [1, 3, 7, 64] {
+            check_chunked(input, chunk, flags);
+        }
+    }
+}
+
+#[test]
+fn test_streaming_long_input_every_split() {
+    let mut input = b"1 UNION SELECT password FROM users".to_vec();
+    input.extend_from_slice(&[b'a'; 300]);
+    let mut html = b"<div>".to_vec();
+    html.extend_from_slice(&[b'x'; 300]);
+    html.extend_from_slice(b"<svg onload=alert(1)>");
+
+    for input in [&input, &html] {
+        for split in 0..=input.len() {
+            let expected_sqli = detect_sqli_with_flags(input, SqliFlags::FLAG_NONE);
+            let mut detector = StreamingDetector::new();
+            detector.feed(&input[..split]);
+            detector.feed(&input[split..]);
+            let verdict = detector.finish();
+            assert_eq!(verdict.sqli, expected_sqli, "split {}", split);
+            assert_eq!(verdict.xss, detect_xss(input), "split {}", split);
+        }
+    }
+}
+
+#[test]
+fn test_streaming_reports_sqli_before_end_of_input() {
+    let head: &[u8] = b"1 UNION SELECT username, password ";
+    let tail: &[u8] = b"FROM users WHERE id = 1 AND the body keeps going";
+    let mut detector = StreamingDetector::new();
+    assert!(detector.feed(head).is_none());
+    // Nothing after the fifth token can change the fingerprint any more
+    let early = detector.feed(tail).expect("fingerprint window is full");
+    assert_eq!(early, detect_sqli_with_flags(&[head, tail].concat(), SqliFlags::FLAG_NONE));
+    assert!(early.is_injection());
+}
+
+#[test]
+fn test_streaming_reports_xss_before_end_of_input() {
+    let mut detector = StreamingDetector::new();
+    assert!(detector.feed(b"hello <scri").is_none());
+    // The tag name may still grow until something follows it
+    assert!(detector.feed(b"pt").is_none());
+    assert!(detector.feed(b"> and the rest of the body").is_some());
+}
+
+#[test]
+fn test_streaming_never_reports_unfinished_tokens() {
+    // An open comment only becomes an IE conditional comment at the end
+    let mut detector = StreamingDetector::new();
+    assert!(detector.feed(b"<!--[i").is_none());
+    assert!(detector.feed(b"f IE]> text").is_none());
+    assert!(detector.finish().xss.is_injection());
+}
+
+#[test]
+fn test_streaming_evil_brace_pass_does_not_settle_early() {
+    // A later pass folds `{` and an empty backtick word to Evil and leaves
+    // the fold early; it must not judge from the reach of the pass before
+    let input: &[u8] = b"LIMIT=`a`allCASTuser%2utf8_bin<!--$$charxxmlns<!USER_ID--xE'%ZZ{`a`U&'";
+    let expected = detect_sqli_with_flags(input, SqliFlags::FLAG_NONE);
+    let mut detector = StreamingDetector::new();
+    if let Some(early) = detector.feed(&input[..65]) {
+        assert_eq!(early, expected);
+    }
+    detector.feed(&input[65..]);
+    assert_eq!(detector.finish().sqli, expected);
+}
@@ -1,10 +1,16 @@
 pub use self::detector::{XssDetector, XssResult};
 pub use self::html5::{Html5State, Html5Flags, TokenType};
 pub use self::blacklists::AttributeType;
+pub(crate) use self::html5::{Html5Checkpoint, MAX_LOOKAHEAD};
+pub(crate) use self::detector::XSS_CONTEXTS;
+#[cfg(feature = "metrics")]
+pub(crate) use self::detector::XssRule;
 
 mod detector;
 mod html5;
 mod blacklists;
+mod scan;
+mod tables;
 
 #[cfg(test)]
 mod tests;
\ No newline at end of file
@@ -1,8 +1,9 @@
 use super::blacklists::{
-    AttributeType, BLACK_ATTR_EVENTS, BLACK_ATTRS, BLACK_TAGS, BLACK_URL_PROTOCOLS,
-    html_decode_char_at,
+    AttributeType, BLACK_URL_PROTOCOLS, MAX_URL_PROTOCOL_LEN,
+    find_black_attr, find_black_attr_event, find_black_tag, html_decode_char_at,
 };
 use super::html5::{Html5Flags, Html5State, TokenType};
+use crate::overlay::Rules;
 
 use core::fmt;
 
@@ -27,32 +28,117 @@ impl fmt::Display for XssResult {
     }
 }
 
-pub struct XssDetector {
-    // Currently stateless, but kept for future expansion
+/// The contexts `detect` tries, matching libinjection_xss
+pub(crate) const XSS_CONTEXTS: [Html5Flags; 5] = [
+    Html5Flags::DataState,
+    Html5Flags::ValueNoQuote,
+    Html5Flags::ValueSingleQuote,
+    Html5Flags::ValueDoubleQuote,
+    Html5Flags::ValueBackQuote,
+];
+
+pub struct XssDetector<'r> {
+    // Tag and attribute overlay, if any
+    rules: Option<&'r Rules<'r>>,
 }
 
-impl XssDetector {
+/// The rule an XSS token broke
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) enum XssRule {
+    Doctype,
+    Tag,
+    Attribute,
+    Url,
+    Style,
+    IndirectAttribute,
+    Comment,
+}
+
+// One context of a fused detect() sweep
+struct Lane<'a> {
+    html5: Html5State<'a>,
+    attr: AttributeType,
+    live: bool,
+}
+
+impl<'r> XssDetector<'r> {
     pub fn new() -> Self {
-        Self {}
+        Self { rules: None }
+    }
+
+    /// Checks tag and attribute names with `rules` on top of the built-in
+    /// blacklists, see [`overlay`](crate::overlay)
+    pub fn with_rules(mut self, rules: &'r Rules<'r>) -> Self {
+        self.rules = Some(rules);
+        self
     }
 
     pub fn detect(&self, input: &[u8]) -> XssResult {
-        // Test input across all 5 HTML parsing contexts
-        let contexts = [
-            Html5Flags::DataState,
-            Html5Flags::ValueNoQuote,
-            Html5Flags::ValueSingleQuote,
-            Html5Flags::ValueDoubleQuote,
-            Html5Flags::ValueBackQuote,
-        ];
-
-        for &context in &contexts {
-            if Self::is_xss(input, context) {
+        if crate::prefilter::classify(input).xss_safe() {
+            #[cfg(feature = "metrics")]
+            crate::metrics::xss_prefiltered();
+            return XssResult::Safe;
+        }
+        self.detect_unfiltered(input)
+    }
+
+    /// `detect` for an input the prefilter could not prove safe
+    pub(crate) fn detect_unfiltered(&self, input: &[u8]) -> XssResult {
+        // Test input across all 5 HTML parsing contexts in one sweep: always
+        // step the context that is furthest behind, and drop a context as
+        // soon as it reaches the exact tokenizer state another one is in,
+        // since from there on both produce the same tokens
+        let mut lanes = XSS_CONTEXTS.map(|flags| Lane {
+            html5: Html5State::new(input, flags),
+            attr: AttributeType::None,
+            live: true,
+        });
+        // Contexts finished and tokens checked, for the metrics
+        #[cfg(feature = "metrics")]
+        let mut counted = (0, 0);
+
+        loop {
+            let furthest_behind = lanes.iter()
+                .enumerate()
+                .filter(|(_, lane)| lane.live)
+                .min_by_key(|(_, lane)| lane.html5.position())
+                .map(|(i, _)| i);
+            let Some(i) = furthest_behind else {
+                #[cfg(feature = "metrics")]
+                crate::metrics::xss_detection(input.len(), counted.0, counted.1);
+                return XssResult::Safe;
+            };
+
+            let lane = &mut lanes[i];
+            if !lane.html5.next() {
+                lane.live = false;
+                #[cfg(feature = "metrics")]
+                {
+                    counted.0 += 1;
+                }
+                continue;
+            }
+            #[cfg(feature = "metrics")]
+            {
+                counted.1 += 1;
+            }
+            if let Some(_rule) = Self::xss_rule(self.rules, &lane.html5, &mut lane.attr) {
+                #[cfg(feature = "metrics")]
+                {
+                    crate::metrics::xss_detection(input.len(), counted.0 + 1, counted.1);
+                    crate::metrics::xss_hit(_rule);
+                }
                 return XssResult::Xss;
             }
-        }
 
-        XssResult::Safe
+            let (checkpoint, attr) = (lane.html5.checkpoint(), lane.attr);
+            let merged = lanes.iter().enumerate().any(|(j, other)| {
+                j != i && other.live && other.attr == attr && other.html5.checkpoint() == checkpoint
+            });
+            if merged {
+                lanes[i].live = false;
+            }
+        }
     }
 
     pub fn is_xss(input: &[u8], flags: Html5Flags) -> bool {
@@ -60,89 +146,107 @@ impl XssDetector {
         let mut attr = AttributeType::None;
 
         while html5.next() {
-            if html5.token_type != TokenType::AttrValue {
-                attr = AttributeType::None;
+            if Self::is_xss_token(&html5, &mut attr) {
+                return true;
             }
+        }
+        
+        false
+    }
 
-            if html5.token_type == TokenType::Doctype {
-                return true;
-            } else if html5.token_type == TokenType::TagNameOpen {
-                if Self::is_black_tag(&html5.token_start[..html5.token_len]) {
-                    return true;
+    /// Checks the token `html5` just produced. `attr` carries the type of the
+    /// preceding attribute name over to its value.
+    pub(crate) fn is_xss_token(html5: &Html5State<'_>, attr: &mut AttributeType) -> bool {
+        Self::xss_rule(None, html5, attr).is_some()
+    }
+
+    /// `is_xss_token` under `rules`, returning the rule the token broke
+    pub(crate) fn xss_rule(rules: Option<&Rules<'_>>, html5: &Html5State<'_>, attr: &mut AttributeType) -> Option<XssRule> {
+        if html5.token_type != TokenType::AttrValue {
+            *attr = AttributeType::None;
+        }
+
+        if html5.token_type == TokenType::Doctype {
+            return Some(XssRule::Doctype);
+        } else if html5.token_type == TokenType::TagNameOpen {
+            if Self::is_black_tag(rules, &html5.token_start[..html5.token_len]) {
+                return Some(XssRule::Tag);
+            }
+        } else if html5.token_type == TokenType::AttrName {
+            *attr = Self::is_black_attr(rules, &html5.token_start[..html5.token_len]);
+        } else if html5.token_type == TokenType::AttrValue {
+            match *attr {
+                AttributeType::None => {
+                    // break equivalent 
                 }
-            } else if html5.token_type == TokenType::AttrName {
-                attr = Self::is_black_attr(&html5.token_start[..html5.token_len]);
-            } else if html5.token_type == TokenType::AttrValue {
-                match attr {
-                    AttributeType::None => {
-                        // break equivalent 
-                    }
-                    AttributeType::Black => {
-                        return true;
-                    }
-                    AttributeType::AttrUrl => {
-                        if Self::is_black_url(&html5.token_start[..html5.token_len]) {
-                            return true;
-                        }
-                    }
-                    AttributeType::Style => {
-                        return true;
-                    }
-                    AttributeType::AttrIndirect => {
-                        // an attribute name is specified in a _value_
-                        if Self::is_black_attr(&html5.token_start[..html5.token_len]) != AttributeType::None {
-                            return true;
-                        }
+                AttributeType::Black => {
+                    return Some(XssRule::Attribute);
+                }
+                AttributeType::AttrUrl => {
+                    if Self::is_black_url(&html5.token_start[..html5.token_len]) {
+                        return Some(XssRule::Url);
                     }
                 }
-                attr = AttributeType::None;
-            } else if html5.token_type == TokenType::TagComment {
-                // IE uses a "`" as a tag ending char
-                if html5.token_start[..html5.token_len].contains(&b'`') {
-                    return true;
+                AttributeType::Style => {
+                    return Some(XssRule::Style);
                 }
-
-                // IE conditional comment
-                if html5.token_len > 3 {
-                    if html5.token_start[0] == b'[' &&
-                        (html5.token_start[1] == b'i' || html5.token_start[1] == b'I') &&
-                        (html5.token_start[2] == b'f' || html5.token_start[2] == b'F') {
-                        return true;
-                    }
-                    if (html5.token_start[0] == b'x' || html5.token_start[0] == b'X') &&
-                        (html5.token_start[1] == b'm' || html5.token_start[1] == b'M') &&
-                        (html5.token_start[2] == b'l' || html5.token_start[2] == b'L') {
-                        return true;
+                AttributeType::AttrIndirect => {
+                    // an attribute name is specified in a _value_
+                    if Self::is_black_attr(rules, &html5.token_start[..html5.token_len]) != AttributeType::None {
+                        return Some(XssRule::IndirectAttribute);
                     }
                 }
+            }
+            *attr = AttributeType::None;
+        } else if html5.token_type == TokenType::TagComment {
+            // IE uses a "`" as a tag ending char
+            if html5.token_start[..html5.token_len].contains(&b'`') {
+                return Some(XssRule::Comment);
+            }
 
-                if html5.token_len > 5 {
-                    // IE <?import pseudo-tag
-                    if Self::cstrcasecmp_with_null(b"IMPORT", &html5.token_start[..6]) {
-                        return true;
-                    }
+            // IE conditional comment
+            if html5.token_len > 3 {
+                if html5.token_start[0] == b'[' &&
+                    (html5.token_start[1] == b'i' || html5.token_start[1] == b'I') &&
+                    (html5.token_start[2] == b'f' || html5.token_start[2] == b'F') {
+                    return Some(XssRule::Comment);
+                }
+                if (html5.token_start[0] == b'x' || html5.token_start[0] == b'X') &&
+                    (html5.token_start[1] == b'm' || html5.token_start[1] == b'M') &&
+                    (html5.token_start[2] == b'l' || html5.token_start[2] == b'L') {
+                    return Some(XssRule::Comment);
+                }
+            }
 
-                    // XML Entity definition
-                    if Self::cstrcasecmp_with_null(b"ENTITY", &html5.token_start[..6]) {
-                        return true;
-                    }
+            if html5.token_len > 5 {
+                // IE <?import pseudo-tag
+                if Self::cstrcasecmp_with_null(b"IMPORT", &html5.token_start[..6]) {
+                    return Some(XssRule::Comment);
+                }
+
+                // XML Entity definition
+                if Self::cstrcasecmp_with_null(b"ENTITY", &html5.token_start[..6]) {
+                    return Some(XssRule::Comment);
                 }
             }
         }
         
-        false
+        None
     }
 
-    fn is_black_tag(tag_name: &[u8]) -> bool {
+    fn is_black_tag(rules: Option<&Rules<'_>>, tag_name: &[u8]) -> bool {
+        // The overlay's entry, if any, replaces the explicit blacklist
+        let listed = rules.and_then(|rules| rules.xss_tag(tag_name));
+        if listed == Some(true) {
+            return true;
+        }
         if tag_name.len() < 3 {
             return false;
         }
 
         // Check explicit blacklist
-        for &black_tag in BLACK_TAGS {
-            if Self::cstrcasecmp_with_null(black_tag.as_bytes(), tag_name) {
-                return true;
-            }
+        if listed.is_none() && find_black_tag(tag_name) {
+            return true;
         }
 
         // Check SVG tags (case insensitive) - match C's manual case checking exactly
@@ -166,20 +270,23 @@ impl XssDetector {
         false
     }
 
-    fn is_black_attr(attr_name: &[u8]) -> AttributeType {
+    fn is_black_attr(rules: Option<&Rules<'_>>, attr_name: &[u8]) -> AttributeType {
+        // The overlay's entry, if any, replaces the explicit blacklists
+        let listed = rules.and_then(|rules| rules.xss_attribute(attr_name));
+        if let Some(atype) = listed.filter(|&atype| atype != AttributeType::None) {
+            return atype;
+        }
         if attr_name.len() < 2 {
             return AttributeType::None;
         }
 
         // Check for event handlers (on* attributes) - match C's manual case checking exactly
         if attr_name.len() >= 5 {
-            if (attr_name[0] == b'o' || attr_name[0] == b'O') &&
+            if listed.is_none() &&
+               (attr_name[0] == b'o' || attr_name[0] == b'O') &&
                (attr_name[1] == b'n' || attr_name[1] == b'N') {
-                let event_name = &attr_name[2..];
-                for event in BLACK_ATTR_EVENTS {
-                    if Self::cstrcasecmp_with_null(event.name.as_bytes(), event_name) {
-                        return event.atype;
-                    }
+                if let Some(atype) = find_black_attr_event(&attr_name[2..]) {
+                    return atype;
                 }
             }
 
@@ -191,16 +298,13 @@ impl XssDetector {
         }
 
         // Check other blacklisted attributes
-        for attr in BLACK_ATTRS {
-            if Self::cstrcasecmp_with_null(attr.name.as_bytes(), attr_name) {
-                return attr.atype;
-            }
+        if listed.is_some() {
+            return AttributeType::None;
         }
-
-        AttributeType::None
+        find_black_attr(attr_name).unwrap_or(AttributeType::None)
     }
 
-    fn is_black_url(url: &[u8]) -> bool {
+    pub(crate) fn is_black_url(url: &[u8]) -> bool {
         if url.is_empty() {
             return false;
         }
@@ -222,14 +326,14 @@ impl XssDetector {
 
         let url_trimmed = &url[start..];
 
-        // Check dangerous protocols
-        for &protocol in BLACK_URL_PROTOCOLS {
-            if Self::htmlencode_startswith(protocol.as_bytes(), url_trimmed) {
-                return true;
-            }
-        }
-
-        false
+        // Check dangerous protocols. Every protocol reads the same decoded
+        // prefix, so decode it once and compare each protocol against it
+        let (decoded, decoded_len) = Self::htmlencode_prefix(url_trimmed);
+        let decoded = &decoded[..decoded_len];
+        BLACK_URL_PROTOCOLS.iter().any(|protocol| {
+            protocol.len() <= decoded.len()
+                && protocol.bytes().zip(decoded).all(|(p, &d)| i32::from(p) == d)
+        })
     }
 
     #[allow(dead_code)] // Follows C implementation - may be used in future XSS detection features
@@ -316,7 +420,7 @@ impl XssDetector {
 
     // Case-insensitive string comparison that ignores null bytes
     // Replicates the exact behavior of C's cstrcasecmp_with_null function
-    fn cstrcasecmp_with_null(pattern: &[u8], input: &[u8]) -> bool {
+    pub(crate) fn cstrcasecmp_with_null(pattern: &[u8], input: &[u8]) -> bool {
         let mut pattern_idx = 0;
         let mut input_idx = 0;
         
@@ -358,8 +462,46 @@ impl XssDetector {
         }
     }
 
+    // Decodes the start of `input` the way htmlencode_startswith reads it:
+    // leading whitespace and control characters dropped, NUL and newline
+    // always dropped, ASCII letters uppercased. Stops once the longest
+    // protocol's worth of characters is decoded.
+    fn htmlencode_prefix(input: &[u8]) -> ([i32; MAX_URL_PROTOCOL_LEN], usize) {
+        let mut decoded = [0i32; MAX_URL_PROTOCOL_LEN];
+        let mut len = 0;
+        let mut input_pos = 0;
+        let mut first = true;
+
+        while input_pos < input.len() && len < decoded.len() {
+            let mut consumed = 0;
+            let decoded_char = html_decode_char_at(&input[input_pos..], &mut consumed);
+
+            input_pos += consumed;
+
+            if first && decoded_char <= 32 {
+                continue;
+            }
+            first = false;
+
+            if decoded_char == 0 || decoded_char == 10 {
+                continue;
+            }
+
+            let mut char_to_compare = decoded_char;
+            if char_to_compare >= (b'a' as i32) && char_to_compare <= (b'z' as i32) {
+                char_to_compare -= 0x20;
+            }
+
+            decoded[len] = char_to_compare;
+            len += 1;
+        }
+
+        (decoded, len)
+    }
+
     // HTML-encoded string starts with pattern (case insensitive)
-    fn htmlencode_startswith(pattern: &[u8], input: &[u8]) -> bool {
+    #[cfg(test)]
+    pub(crate) fn htmlencode_startswith(pattern: &[u8], input: &[u8]) -> bool {
         let mut pattern_idx = 0;
         let mut input_pos = 0;
         let mut first = true;
@@ -403,7 +545,7 @@ impl XssDetector {
     }
 }
 
-impl Default for XssDetector {
+impl Default for XssDetector<'_> {
     fn default() -> Self {
         Self::new()
     }
@@ -1,5 +1,7 @@
 use core::fmt;
 
+use super::scan;
+
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
 pub enum Html5Flags {
     DataState = 0,
@@ -41,6 +43,33 @@ impl fmt::Display for TokenType {
     }
 }
 
+// Tokenizer states, one per h5_state_* function in libinjection_html5.c
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+enum State {
+    AfterAttributeName,
+    AfterAttributeValueQuoted,
+    AttributeName,
+    AttributeValueBackQuote,
+    AttributeValueDoubleQuote,
+    AttributeValueSingleQuote,
+    BeforeAttributeName,
+    BeforeAttributeValue,
+    BogusComment,
+    BogusComment2,
+    Cdata,
+    Comment,
+    Data,
+    Doctype,
+    EmitTagCloseChar,
+    EndTagOpen,
+    Eof,
+    MarkupDeclarationOpen,
+    SelfClosingStartTag,
+    TagName,
+    TagNameClose,
+    TagOpen,
+}
+
 pub struct Html5State<'a> {
     s: &'a [u8],
     len: usize,
@@ -48,18 +77,38 @@ pub struct Html5State<'a> {
     pub token_type: TokenType,
     pub token_start: &'a [u8],
     pub token_len: usize,
-    state_fn: fn(&mut Html5State<'a>) -> bool,
+    state: State,
+    is_close: bool,
+}
+
+/// Furthest any state looks past the token it emits: `<!` peeks at the next
+/// seven bytes for `DOCTYPE` / `[CDATA[`. A token that ends at least this far
+/// before the end of the input is the same however the input continues.
+pub(crate) const MAX_LOOKAHEAD: usize = 8;
+
+/// Where the tokenizer stands between two tokens, enough to resume it over a
+/// longer copy of the same input
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub(crate) struct Html5Checkpoint {
+    state: State,
+    pos: usize,
     is_close: bool,
 }
 
+impl Html5Checkpoint {
+    pub fn position(&self) -> usize {
+        self.pos
+    }
+}
+
 impl<'a> Html5State<'a> {
     pub fn new(input: &'a [u8], flags: Html5Flags) -> Self {
-        let state_fn = match flags {
-            Html5Flags::DataState => Self::state_data,
-            Html5Flags::ValueNoQuote => Self::state_before_attribute_name,
-            Html5Flags::ValueSingleQuote => Self::state_attribute_value_single_quote,
-            Html5Flags::ValueDoubleQuote => Self::state_attribute_value_double_quote,
-            Html5Flags::ValueBackQuote => Self::state_attribute_value_back_quote,
+        let state = match flags {
+            Html5Flags::DataState => State::Data,
+            Html5Flags::ValueNoQuote => State::BeforeAttributeName,
+            Html5Flags::ValueSingleQuote => State::AttributeValueSingleQuote,
+            Html5Flags::ValueDoubleQuote => State::AttributeValueDoubleQuote,
+            Html5Flags::ValueBackQuote => State::AttributeValueBackQuote,
         };
 
         Html5State {
@@ -69,18 +118,68 @@ impl<'a> Html5State<'a> {
             token_type: TokenType::DataText,
             token_start: input,
             token_len: 0,
-            state_fn,
+            state,
             is_close: false,
         }
     }
 
     pub fn next(&mut self) -> bool {
-        (self.state_fn)(self)
+        match self.state {
+            State::AfterAttributeName => self.state_after_attribute_name(),
+            State::AfterAttributeValueQuoted => self.state_after_attribute_value_quoted(),
+            State::AttributeName => self.state_attribute_name(),
+            State::AttributeValueBackQuote => self.state_attribute_value_back_quote(),
+            State::AttributeValueDoubleQuote => self.state_attribute_value_double_quote(),
+            State::AttributeValueSingleQuote => self.state_attribute_value_single_quote(),
+            State::BeforeAttributeName => self.state_before_attribute_name(),
+            State::BeforeAttributeValue => self.state_before_attribute_value(),
+            State::BogusComment => self.state_bogus_comment(),
+            State::BogusComment2 => self.state_bogus_comment2(),
+            State::Cdata => self.state_cdata(),
+            State::Comment => self.state_comment(),
+            State::Data => self.state_data(),
+            State::Doctype => self.state_doctype(),
+            State::EmitTagCloseChar => self.state_emit_tag_close_char(),
+            State::EndTagOpen => self.state_end_tag_open(),
+            State::Eof => self.state_eof(),
+            State::MarkupDeclarationOpen => self.state_markup_declaration_open(),
+            State::SelfClosingStartTag => self.state_self_closing_start_tag(),
+            State::TagName => self.state_tag_name(),
+            State::TagNameClose => self.state_tag_name_close(),
+            State::TagOpen => self.state_tag_open(),
+        }
     }
     
     pub fn position(&self) -> usize {
         self.pos
     }
+
+    pub(crate) fn checkpoint(&self) -> Html5Checkpoint {
+        Html5Checkpoint {
+            state: self.state,
+            pos: self.pos,
+            is_close: self.is_close,
+        }
+    }
+
+    /// Continues tokenizing `input` from a checkpoint taken over a prefix of it
+    pub(crate) fn resume(input: &'a [u8], checkpoint: Html5Checkpoint) -> Self {
+        Html5State {
+            s: input,
+            len: input.len(),
+            pos: checkpoint.pos,
+            token_type: TokenType::DataText,
+            token_start: input,
+            token_len: 0,
+            state: checkpoint.state,
+            is_close: checkpoint.is_close,
+        }
+    }
+
+    /// Offset just past the current token
+    pub(crate) fn token_end(&self) -> usize {
+        self.len - self.token_start.len() + self.token_len
+    }
     
     #[cfg(test)]
     pub fn debug_is_close(&self) -> bool {
@@ -168,74 +267,15 @@ impl<'a> Html5State<'a> {
     }
 
     fn find_byte(&self, byte: u8, start: usize) -> Option<usize> {
-        if start >= self.len {
-            return None;
-        }
-        
-        for i in start..self.len {
-            if self.s[i] == byte {
-                return Some(i);
-            }
-        }
-        None
+        scan::find_byte(byte, self.s.get(start..)?).map(|i| start + i)
     }
 
     fn find_comment_end(&self, start: usize) -> Option<(usize, usize)> {
-        if start + 2 >= self.len {
-            return None;
-        }
-        
-        let mut pos = start;
-        while pos <= self.len - 3 {
-            if let Some(dash_pos) = self.find_byte(b'-', pos) {
-                if dash_pos + 2 >= self.len {
-                    break;
-                }
-                
-                let mut offset = 1;
-                // Skip nulls (IE-ism)
-                while dash_pos + offset < self.len && self.s[dash_pos + offset] == 0 {
-                    offset += 1;
-                }
-                
-                if dash_pos + offset >= self.len {
-                    break;
-                }
-                
-                let next_char = self.s[dash_pos + offset];
-                if next_char != b'-' && next_char != b'!' {
-                    pos = dash_pos + 1;
-                    continue;
-                }
-                
-                offset += 1;
-                if dash_pos + offset >= self.len {
-                    break;
-                }
-                
-                if self.s[dash_pos + offset] == b'>' {
-                    return Some((dash_pos, offset + 1));
-                }
-                
-                pos = dash_pos + 1;
-            } else {
-                break;
-            }
-        }
-        None
+        scan::find_comment_end(self.s.get(start..)?).map(|(dash, len)| (start + dash, len))
     }
 
     fn find_cdata_end(&self, start: usize) -> Option<usize> {
-        if start + 2 >= self.len {
-            return None;
-        }
-        
-        for i in start..self.len - 2 {
-            if self.s[i] == b']' && self.s[i + 1] == b']' && self.s[i + 2] == b'>' {
-                return Some(i);
-            }
-        }
-        None
+        scan::find_cdata_end(self.s.get(start..)?).map(|i| start + i)
     }
 
     fn is_whitespace(ch: u8) -> bool {
@@ -269,14 +309,14 @@ impl<'a> Html5State<'a> {
                 return true;
             } else {
                 self.pos = lt_pos + 1;
-                self.state_fn = Self::state_tag_open;
+                self.state = State::TagOpen;
                 return self.next();
             }
         } else {
             if self.len > start {
                 self.set_token(TokenType::DataText, start, self.len - start);
                 self.pos = self.len;
-                self.state_fn = Self::state_eof;
+                self.state = State::Eof;
                 return true;
             } else {
                 return false;
@@ -292,43 +332,43 @@ impl<'a> Html5State<'a> {
         match self.current_char().unwrap_or(0) {
             b'!' => {
                 self.advance();
-                self.state_fn = Self::state_markup_declaration_open;
+                self.state = State::MarkupDeclarationOpen;
                 self.next()
             }
             b'/' => {
                 self.advance();
                 self.is_close = true;
-                self.state_fn = Self::state_end_tag_open;
+                self.state = State::EndTagOpen;
                 self.next()
             }
             b'?' => {
                 self.advance();
-                self.state_fn = Self::state_bogus_comment;
+                self.state = State::BogusComment;
                 self.next()
             }
             b'%' => {
                 // IE <= 9 and Safari < 4.0.3 alternative comment format
                 self.advance();
-                self.state_fn = Self::state_bogus_comment2;
+                self.state = State::BogusComment2;
                 self.next()
             }
             ch if Self::is_alphabetic_c_style(ch) => {
-                self.state_fn = Self::state_tag_name;
+                self.state = State::TagName;
                 self.next()
             }
             0 => {
                 // IE-ism: NULL characters are ignored
-                self.state_fn = Self::state_tag_name;
+                self.state = State::TagName;
                 self.next()
             }
             _ => {
                 // Invalid character after '<', return '<' as DATA_TEXT and continue from current pos
                 if self.pos == 0 {
-                    self.state_fn = Self::state_data;
+                    self.state = State::Data;
                     return self.next();
                 }
                 self.set_token(TokenType::DataText, self.pos - 1, 1); // The '<' character
-                self.state_fn = Self::state_data;
+                self.state = State::Data;
                 true
             }
         }
@@ -346,13 +386,13 @@ impl<'a> Html5State<'a> {
                 ch if Self::is_whitespace(ch) => {
                     self.set_token(TokenType::TagNameOpen, start, self.pos - start);
                     self.advance();
-                    self.state_fn = Self::state_before_attribute_name;
+                    self.state = State::BeforeAttributeName;
                     return true;
                 }
                 b'/' => {
                     self.set_token(TokenType::TagNameOpen, start, self.pos - start);
                     self.advance();
-                    self.state_fn = Self::state_self_closing_start_tag;
+                    self.state = State::SelfClosingStartTag;
                     return true;
                 }
                 b'>' => {
@@ -361,11 +401,11 @@ impl<'a> Html5State<'a> {
                         self.advance();
                         self.is_close = false;
                         self.token_type = TokenType::TagClose;
-                        self.state_fn = Self::state_data;
+                        self.state = State::Data;
                     } else {
                         // Match C logic exactly: don't advance pos, keep TagNameOpen, next state handles '>'
                         self.token_type = TokenType::TagNameOpen;
-                        self.state_fn = Self::state_tag_name_close;
+                        self.state = State::TagNameClose;
                     }
                     return true;
                 }
@@ -376,7 +416,7 @@ impl<'a> Html5State<'a> {
         }
 
         self.set_token(TokenType::TagNameOpen, start, self.len - start);
-        self.state_fn = Self::state_eof;
+        self.state = State::Eof;
         true
     }
 
@@ -387,16 +427,16 @@ impl<'a> Html5State<'a> {
 
         match self.current_char().unwrap_or(0) {
             b'>' => {
-                self.state_fn = Self::state_data;
+                self.state = State::Data;
                 self.next()
             }
             ch if Self::is_alphabetic_c_style(ch) => {
-                self.state_fn = Self::state_tag_name;
+                self.state = State::TagName;
                 self.next()
             }
             _ => {
                 self.is_close = false;
-                self.state_fn = Self::state_bogus_comment;
+                self.state = State::BogusComment;
                 self.next()
             }
         }
@@ -408,9 +448,9 @@ impl<'a> Html5State<'a> {
         self.set_token(TokenType::TagNameClose, self.pos, 1);   // token_start = hs->s + hs->pos; token_len = 1; token_type = TAG_NAME_CLOSE;
         self.advance();                                         // hs->pos += 1;
         if self.pos < self.len {                                // if (hs->pos < hs->len) {
-            self.state_fn = Self::state_data;                   //     hs->state = h5_state_data;
+            self.state = State::Data;                   //     hs->state = h5_state_data;
         } else {                                                // } else {
-            self.state_fn = Self::state_eof;                    //     hs->state = h5_state_eof;
+            self.state = State::Eof;                    //     hs->state = h5_state_eof;
         }                                                       // }
         
         true                                                    // return 1;
@@ -421,9 +461,9 @@ impl<'a> Html5State<'a> {
         self.set_token(TokenType::TagNameClose, self.pos, 1);
         self.advance();
         if self.pos < self.len {
-            self.state_fn = Self::state_data;
+            self.state = State::Data;
         } else {
-            self.state_fn = Self::state_eof;
+            self.state = State::Eof;
         }
         true
     }
@@ -439,10 +479,10 @@ impl<'a> Html5State<'a> {
             assert!(self.pos > 0);
             self.set_token(TokenType::TagNameSelfclose, self.pos - 1, 2);
             self.advance();
-            self.state_fn = Self::state_data;
+            self.state = State::Data;
             return true;
         } else {
-            self.state_fn = Self::state_before_attribute_name;
+            self.state = State::BeforeAttributeName;
             self.next()
         }
     }
@@ -463,11 +503,11 @@ impl<'a> Html5State<'a> {
                 Some(0x3e) => { // CHAR_GT (62 as i8)
                     self.set_token(TokenType::TagNameClose, self.pos, 1);
                     self.advance();
-                    self.state_fn = Self::state_data;
+                    self.state = State::Data;
                     return true;
                 }
                 Some(_) => {
-                    self.state_fn = Self::state_attribute_name;
+                    self.state = State::AttributeName;
                     return self.next();
                 }
                 None => return false, // Should not happen with new implementation
@@ -485,22 +525,22 @@ impl<'a> Html5State<'a> {
             
             if Self::h5_is_white(ch) {  // if (h5_is_white(ch))
                 self.set_token(TokenType::AttrName, start_pos, scan_pos - start_pos);
-                self.state_fn = Self::state_after_attribute_name;
+                self.state = State::AfterAttributeName;
                 self.pos = scan_pos + 1;  // hs->pos = pos + 1
                 return true;
             } else if ch == b'/' {  // ch == CHAR_SLASH
                 self.set_token(TokenType::AttrName, start_pos, scan_pos - start_pos);
-                self.state_fn = Self::state_self_closing_start_tag;
+                self.state = State::SelfClosingStartTag;
                 self.pos = scan_pos + 1;  // hs->pos = pos + 1
                 return true;
             } else if ch == b'=' {  // ch == CHAR_EQUALS
                 self.set_token(TokenType::AttrName, start_pos, scan_pos - start_pos);
-                self.state_fn = Self::state_before_attribute_value;
+                self.state = State::BeforeAttributeValue;
                 self.pos = scan_pos + 1;  // hs->pos = pos + 1
                 return true;
             } else if ch == b'>' {  // ch == CHAR_GT
                 self.set_token(TokenType::AttrName, start_pos, scan_pos - start_pos);
-                self.state_fn = Self::state_tag_name_close;  // Match C: hs->state = h5_state_tag_name_close;
+                self.state = State::TagNameClose;  // Match C: hs->state = h5_state_tag_name_close;
                 self.pos = scan_pos;  // hs->pos = pos (NOT pos + 1!)
                 return true;
             } else {
@@ -510,7 +550,7 @@ impl<'a> Html5State<'a> {
         
         // EOF - match C lines 393-398 exactly
         self.set_token(TokenType::AttrName, start_pos, self.len - start_pos);
-        self.state_fn = Self::state_eof;
+        self.state = State::Eof;
         self.pos = self.len;  // hs->pos = hs->len
         true  // return 1
     }
@@ -541,7 +581,7 @@ impl<'a> Html5State<'a> {
         // Match C implementation exactly: c = h5_skip_white(hs)
         match self.h5_skip_white() {
             Some(-1) => {  // case CHAR_EOF
-                self.state_fn = Self::state_eof;
+                self.state = State::Eof;
                 false
             }
             Some(0x22) => self.state_attribute_value_double_quote(),  // CHAR_DOUBLE (34)
@@ -549,7 +589,7 @@ impl<'a> Html5State<'a> {
             Some(0x60) => self.state_attribute_value_back_quote(),    // CHAR_TICK (96)
             Some(_) => self.state_attribute_value_no_quote(),         // default
             None => {  // Should not happen with new implementation
-                self.state_fn = Self::state_eof;
+                self.state = State::Eof;
                 false
             }
         }
@@ -565,11 +605,11 @@ impl<'a> Html5State<'a> {
         if let Some(quote_pos) = self.find_byte(b'"', self.pos) {
             self.set_token(TokenType::AttrValue, start, quote_pos - start);
             self.pos = quote_pos + 1;
-            self.state_fn = Self::state_after_attribute_value_quoted;
+            self.state = State::AfterAttributeValueQuoted;
         } else {
             self.set_token(TokenType::AttrValue, start, self.len - start);
             self.pos = self.len;
-            self.state_fn = Self::state_eof;
+            self.state = State::Eof;
         }
         true
     }
@@ -584,11 +624,11 @@ impl<'a> Html5State<'a> {
         if let Some(quote_pos) = self.find_byte(b'\'', self.pos) {
             self.set_token(TokenType::AttrValue, start, quote_pos - start);
             self.pos = quote_pos + 1;
-            self.state_fn = Self::state_after_attribute_value_quoted;
+            self.state = State::AfterAttributeValueQuoted;
         } else {
             self.set_token(TokenType::AttrValue, start, self.len - start);
             self.pos = self.len;
-            self.state_fn = Self::state_eof;
+            self.state = State::Eof;
         }
         true
     }
@@ -603,35 +643,32 @@ impl<'a> Html5State<'a> {
         if let Some(quote_pos) = self.find_byte(b'`', self.pos) {
             self.set_token(TokenType::AttrValue, start, quote_pos - start);
             self.pos = quote_pos + 1;
-            self.state_fn = Self::state_after_attribute_value_quoted;
+            self.state = State::AfterAttributeValueQuoted;
         } else {
             self.set_token(TokenType::AttrValue, start, self.len - start);
             self.pos = self.len;
-            self.state_fn = Self::state_eof;
+            self.state = State::Eof;
         }
         true
     }
 
     fn state_attribute_value_no_quote(&mut self) -> bool {
         let start = self.pos;
-        while self.pos < self.len {
-            let ch = self.s[self.pos];
-            if Self::is_whitespace(ch) {
-                self.set_token(TokenType::AttrValue, start, self.pos - start);
+        self.pos = start + scan::VALUE_NO_QUOTE_END.find(&self.s[start..]);
+        if let Some(ch) = self.current_char() {
+            self.set_token(TokenType::AttrValue, start, self.pos - start);
+            if ch == b'>' {
+                self.state = State::EmitTagCloseChar;
+            } else {
                 self.advance();
-                self.state_fn = Self::state_before_attribute_name;
-                return true;
-            } else if ch == b'>' {
-                self.set_token(TokenType::AttrValue, start, self.pos - start);
-                self.state_fn = Self::state_emit_tag_close_char;
-                return true;
+                self.state = State::BeforeAttributeName;
             }
-            self.pos += 1;
+            return true;
         }
-        
+
         // EOF
         self.set_token(TokenType::AttrValue, start, self.len - start);
-        self.state_fn = Self::state_eof;
+        self.state = State::Eof;
         true
     }
 
@@ -650,7 +687,7 @@ impl<'a> Html5State<'a> {
         } else if ch == b'>' {
             self.set_token(TokenType::TagNameClose, self.pos, 1);
             self.advance();
-            self.state_fn = Self::state_data;
+            self.state = State::Data;
             true
         } else {
             self.state_before_attribute_name()
@@ -660,23 +697,23 @@ impl<'a> Html5State<'a> {
     fn state_markup_declaration_open(&mut self) -> bool {
         if self.pos + 1 < self.len && self.s[self.pos] == b'-' && self.s[self.pos + 1] == b'-' {
             self.pos += 2;
-            self.state_fn = Self::state_comment;
+            self.state = State::Comment;
             self.next()
         } else if self.pos + 7 <= self.len {
             let slice = &self.s[self.pos..self.pos + 7];
             if slice.eq_ignore_ascii_case(b"DOCTYPE") {
-                self.state_fn = Self::state_doctype;
+                self.state = State::Doctype;
                 return self.next();
             } else if slice == b"[CDATA[" {
                 self.pos += 7;
-                self.state_fn = Self::state_cdata;
+                self.state = State::Cdata;
                 self.next()
             } else {
-                self.state_fn = Self::state_bogus_comment;
+                self.state = State::BogusComment;
                 self.next()
             }
         } else {
-            self.state_fn = Self::state_bogus_comment;
+            self.state = State::BogusComment;
             self.next()
         }
     }
@@ -688,46 +725,30 @@ impl<'a> Html5State<'a> {
         if let Some(gt_pos) = self.find_byte(b'>', self.pos) {
             self.set_token(TokenType::Doctype, start, gt_pos - start);
             self.pos = gt_pos + 1;
-            self.state_fn = Self::state_data;
+            self.state = State::Data;
         } else {
             self.set_token(TokenType::Doctype, start, self.len - start);
             self.pos = self.len;
-            self.state_fn = Self::state_eof;
+            self.state = State::Eof;
         }
         true
     }
 
     fn state_bogus_comment2(&mut self) -> bool {
         let start = self.pos;
-        let mut pos = self.pos;
-        
-        loop {
-            if let Some(percent_pos) = self.find_byte(b'%', pos) {
-                if percent_pos + 1 >= self.len {
-                    // No '>' after '%', consume to EOF
-                    self.set_token(TokenType::TagComment, start, self.len - start);
-                    self.pos = self.len;
-                    self.state_fn = Self::state_eof;
-                    return true;
-                }
-                
-                if self.s[percent_pos + 1] == b'>' {
-                    // Found "%>"
-                    self.set_token(TokenType::TagComment, start, percent_pos - start);
-                    self.pos = percent_pos + 2; // Skip "%>"
-                    self.state_fn = Self::state_data;
-                    return true;
-                }
-                
-                pos = percent_pos + 1;
-            } else {
-                // No more '%' found, consume to EOF
-                self.set_token(TokenType::TagComment, start, self.len - start);
-                self.pos = self.len;
-                self.state_fn = Self::state_eof;
-                return true;
-            }
+
+        if let Some(percent_pos) = scan::find_percent_gt(&self.s[start..]).map(|i| start + i) {
+            // Found "%>"
+            self.set_token(TokenType::TagComment, start, percent_pos - start);
+            self.pos = percent_pos + 2; // Skip "%>"
+            self.state = State::Data;
+        } else {
+            // No "%>", consume to EOF
+            self.set_token(TokenType::TagComment, start, self.len - start);
+            self.pos = self.len;
+            self.state = State::Eof;
         }
+        true
     }
 
     fn state_comment(&mut self) -> bool {
@@ -736,11 +757,11 @@ impl<'a> Html5State<'a> {
         if let Some((end_pos, offset)) = self.find_comment_end(self.pos) {
             self.set_token(TokenType::TagComment, start, end_pos - start);
             self.pos = end_pos + offset;
-            self.state_fn = Self::state_data;
+            self.state = State::Data;
         } else {
             self.set_token(TokenType::TagComment, start, self.len - start);
             self.pos = self.len;
-            self.state_fn = Self::state_eof;
+            self.state = State::Eof;
         }
         true
     }
@@ -751,11 +772,11 @@ impl<'a> Html5State<'a> {
         if let Some(gt_pos) = self.find_byte(b'>', self.pos) {
             self.set_token(TokenType::TagComment, start, gt_pos - start);
             self.pos = gt_pos + 1;
-            self.state_fn = Self::state_data;
+            self.state = State::Data;
         } else {
             self.set_token(TokenType::TagComment, start, self.len - start);
             self.pos = self.len;
-            self.state_fn = Self::state_eof;
+            self.state = State::Eof;
         }
         true
     }
@@ -766,11 +787,11 @@ impl<'a> Html5State<'a> {
         if let Some(end_pos) = self.find_cdata_end(self.pos) {
             self.set_token(TokenType::DataText, start, end_pos - start);
             self.pos = end_pos + 3; // Skip "]]>"
-            self.state_fn = Self::state_data;
+            self.state = State::Data;
         } else {
             self.set_token(TokenType::DataText, start, self.len - start);
             self.pos = self.len;
-            self.state_fn = Self::state_eof;
+            self.state = State::Eof;
         }
         true
     }
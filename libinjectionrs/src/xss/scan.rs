@@ -0,0 +1,65 @@
+// Terminator scans used by the html5 tokenizer
+//
+// The C states for comments, CDATA and `<% %>` blocks look for the first
+// byte of their terminator with memchr and check the bytes after it,
+// restarting one past it on a near miss. Runs like `-!-!-!` or `]]]]`
+// make that one memchr call plus a check per byte. All three terminators
+// end in `>`, so these scans look for that byte instead and check the few
+// bytes before it: a run without a `>` is a single memchr pass, and each
+// `>` is checked once. Every byte of the range is looked at a bounded
+// number of times, so each scan is O(n) in the bytes it covers; since the
+// tokenizer never moves backwards, so is tokenizing an input in any one
+// context.
+//
+// Each scan finds the same terminator as its C counterpart: two matches
+// cannot overlap, so the first `>` that completes one belongs to the
+// match the C loop reaches first, and every way the C loop gives up early
+// leaves no match in the rest of the input.
+
+use crate::sqli::scan::ByteClass;
+pub(crate) use crate::sqli::scan::find_byte;
+
+/// Bytes that end an unquoted attribute value: whitespace and `>`
+pub(crate) static VALUE_NO_QUOTE_END: ByteClass = ByteClass::from_bytes(b" \t\n\x0B\x0C\r>");
+
+/// End of a comment, the C `h5_state_comment`: `-`, any number of NULs
+/// (an IE-ism), `-` or `!`, then `>`. Returns the position of the first
+/// `-` and the length of the terminator.
+pub(crate) fn find_comment_end(s: &[u8]) -> Option<(usize, usize)> {
+    find_gt_after(s, |before| {
+        let (&last, rest) = before.split_last()?;
+        if last != b'-' && last != b'!' {
+            return None;
+        }
+        let dash = rest.iter().rposition(|&b| b != 0)?;
+        (rest[dash] == b'-').then_some(dash)
+    })
+    .map(|(dash, gt)| (dash, gt + 1 - dash))
+}
+
+/// Position of the first `]]>`, the C `h5_state_cdata`
+pub(crate) fn find_cdata_end(s: &[u8]) -> Option<usize> {
+    find_gt_after(s, |before| before.ends_with(b"]]").then(|| before.len() - 2)).map(|(at, _)| at)
+}
+
+/// Position of the first `%>`, the C `h5_state_bogus_comment2`
+pub(crate) fn find_percent_gt(s: &[u8]) -> Option<usize> {
+    find_gt_after(s, |before| before.ends_with(b"%").then(|| before.len() - 1)).map(|(at, _)| at)
+}
+
+// First `>` whose preceding bytes `opens` accepts, with the position
+// `opens` returns and that of the `>`. `opens` sees everything from the
+// start of `s` to the `>`, and has to look back no further than the
+// previous `>` for the scan to stay linear.
+#[inline]
+fn find_gt_after(s: &[u8], opens: impl Fn(&[u8]) -> Option<usize>) -> Option<(usize, usize)> {
+    let mut from = 0;
+    while let Some(i) = find_byte(b'>', &s[from..]) {
+        let gt = from + i;
+        if let Some(at) = opens(&s[..gt]) {
+            return Some((at, gt));
+        }
+        from = gt + 1;
+    }
+    None
+}
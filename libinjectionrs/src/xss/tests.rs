@@ -5,6 +5,7 @@
 #![allow(clippy::panic)]
 
 use super::detector::{XssDetector, XssResult};
+use super::html5::Html5Flags;
 
 #[test]
 fn test_safe_input() {
@@ -226,3 +227,210 @@ fn test_fuzz_differential_070fdf5c() {
     assert_eq!(detector.detect(input), XssResult::Xss);
 }
 
+
+#[test]
+fn test_fused_detect_matches_each_context() {
+    // detect() sweeps all contexts at once; it must agree with running
+    // is_xss per context and or-ing the results
+    let inputs: &[&[u8]] = &[
+        b"",
+        b"plain text",
+        b"x' onerror='alert(1)",
+        b"x\" onerror=\"alert(1)",
+        b"x` onerror=`alert(1)",
+        b"x onerror=alert(1)",
+        b"a' b=\"c\" d=`e` f=g><p>text</p>",
+        b"\"><script>alert(1)</script>",
+        b"'>text<!-- comment --><b>",
+        b"a=b c=d e=f g=h><i>safe</i>",
+        b"<div title='x' class=\"y\">z</div>",
+    ];
+    let contexts = [
+        Html5Flags::DataState,
+        Html5Flags::ValueNoQuote,
+        Html5Flags::ValueSingleQuote,
+        Html5Flags::ValueDoubleQuote,
+        Html5Flags::ValueBackQuote,
+    ];
+    let detector = XssDetector::new();
+    for input in inputs {
+        let expected = contexts.iter().any(|&flags| XssDetector::is_xss(input, flags));
+        assert_eq!(detector.detect(input).is_injection(), expected, "{:?}", input);
+    }
+}
+
+#[test]
+fn test_hashed_blacklists_match_linear_scan() {
+    use super::blacklists::{
+        find_black_attr, find_black_attr_event, find_black_tag, BLACK_ATTRS, BLACK_ATTR_EVENTS, BLACK_TAGS,
+    };
+
+    let linear = |names: &[&str], input: &[u8]| {
+        names.iter().position(|name| XssDetector::cstrcasecmp_with_null(name.as_bytes(), input))
+    };
+    let events: Vec<&str> = BLACK_ATTR_EVENTS.iter().map(|e| e.name).collect();
+    let attrs: Vec<&str> = BLACK_ATTRS.iter().map(|e| e.name).collect();
+
+    let names = BLACK_TAGS.iter().chain(&events).chain(&attrs);
+    let mut inputs: Vec<Vec<u8>> = vec![b"".to_vec(), b"\0".to_vec(), b"\0\0\0".to_vec(), vec![b'a'; 100]];
+    for name in names {
+        let upper = name.as_bytes().to_vec();
+        let lower = name.to_ascii_lowercase().into_bytes();
+        let mixed: Vec<u8> = upper
+            .iter()
+            .zip(&lower)
+            .enumerate()
+            .map(|(i, (&u, &l))| if i % 2 == 0 { l } else { u })
+            .collect();
+        let mut with_nuls = Vec::new();
+        for &b in &mixed {
+            with_nuls.extend_from_slice(&[0, b]);
+        }
+        with_nuls.push(0);
+        let mut padded = lower.clone();
+        padded.extend_from_slice(&[0; 64]);
+
+        inputs.extend([upper.clone(), lower.clone(), mixed, with_nuls, padded]);
+        inputs.push([&upper[..], b"X"].concat());
+        inputs.push([&lower[..], &[0xc0]].concat());
+        inputs.push(upper[..upper.len() - 1].to_vec());
+        inputs.push(upper[1..].to_vec());
+    }
+
+    for input in &inputs {
+        assert_eq!(find_black_tag(input), linear(BLACK_TAGS, input).is_some(), "{:?}", input);
+        assert_eq!(
+            find_black_attr_event(input),
+            linear(&events, input).map(|i| BLACK_ATTR_EVENTS[i].atype),
+            "{:?}",
+            input
+        );
+        assert_eq!(
+            find_black_attr(input),
+            linear(&attrs, input).map(|i| BLACK_ATTRS[i].atype),
+            "{:?}",
+            input
+        );
+    }
+}
+
+#[test]
+fn test_url_protocols_match_each_prefix_check() {
+    use super::blacklists::BLACK_URL_PROTOCOLS;
+
+    let inputs: &[&[u8]] = &[
+        b"javascript:alert(1)",
+        b"JaVaScRiPt:alert(1)",
+        b"java",
+        b"jav",
+        b"  \t javascript:",
+        b"&#106;&#97;&#118;&#97;script:",
+        b"&#x6A;ava\nscript:",
+        b"j\0a\0v\0a",
+        b"\x01\x02 vbscript:msgbox",
+        b"view-source:http://x",
+        b"view-sourc",
+        b"data:text/html,<b>",
+        b"dat&#x41;:",
+        b"http://example.com/",
+        b"&#0;&#10;data",
+        b"\xffjavascript",
+        b"&amp;javascript",
+    ];
+    for input in inputs {
+        let start = input.iter().position(|&b| b > 32 && b < 127);
+        let expected = start.is_some_and(|start| {
+            BLACK_URL_PROTOCOLS
+                .iter()
+                .any(|protocol| XssDetector::htmlencode_startswith(protocol.as_bytes(), &input[start..]))
+        });
+        assert_eq!(XssDetector::is_black_url(input), expected, "{:?}", input);
+    }
+}
+
+// The C comment, CDATA and `<% %>` loops, transcribed as they are
+mod c_loops {
+    pub fn comment_end(s: &[u8]) -> Option<(usize, usize)> {
+        let mut pos = 0;
+        loop {
+            let idx = pos + s[pos..].iter().position(|&b| b == b'-')?;
+            if idx + 3 > s.len() {
+                return None;
+            }
+            let mut offset = 1;
+            while idx + offset < s.len() && s[idx + offset] == 0 {
+                offset += 1;
+            }
+            if idx + offset == s.len() {
+                return None;
+            }
+            let ch = s[idx + offset];
+            offset += 1;
+            if ch == b'-' || ch == b'!' {
+                if idx + offset == s.len() {
+                    return None;
+                }
+                if s[idx + offset] == b'>' {
+                    return Some((idx, offset + 1));
+                }
+            }
+            pos = idx + 1;
+        }
+    }
+
+    pub fn cdata_end(s: &[u8]) -> Option<usize> {
+        let mut pos = 0;
+        loop {
+            let idx = pos + s[pos..].iter().position(|&b| b == b']')?;
+            if idx + 3 > s.len() {
+                return None;
+            }
+            if s[idx + 1] == b']' && s[idx + 2] == b'>' {
+                return Some(idx);
+            }
+            pos = idx + 1;
+        }
+    }
+
+    pub fn percent_gt(s: &[u8]) -> Option<usize> {
+        let mut pos = 0;
+        loop {
+            let idx = pos + s[pos..].iter().position(|&b| b == b'%')?;
+            if idx + 1 >= s.len() {
+                return None;
+            }
+            if s[idx + 1] == b'>' {
+                return Some(idx);
+            }
+            pos = idx + 1;
+        }
+    }
+}
+
+#[test]
+fn test_terminator_scans_match_c_loops() {
+    use super::scan;
+
+    // Every input of up to six bytes over the bytes the loops care about
+    const ALPHABET: &[u8] = b"-!\0>]%a";
+    let mut input = Vec::new();
+    for len in 0..=6u32 {
+        for mut n in 0..ALPHABET.len().pow(len) {
+            input.clear();
+            for _ in 0..len {
+                input.push(ALPHABET[n % ALPHABET.len()]);
+                n /= ALPHABET.len();
+            }
+            assert_eq!(scan::find_comment_end(&input), c_loops::comment_end(&input), "{:?}", input);
+            assert_eq!(scan::find_cdata_end(&input), c_loops::cdata_end(&input), "{:?}", input);
+            assert_eq!(scan::find_percent_gt(&input), c_loops::percent_gt(&input), "{:?}", input);
+        }
+    }
+
+    let mut long = b"-!".repeat(4096);
+    long.extend_from_slice(b"-\0\0->");
+    assert_eq!(scan::find_comment_end(&long), Some((8192, 5)));
+    let mut long = b"]".repeat(4096);
+    long.push(b'>');
+    assert_eq!(scan::find_cdata_end(&long), Some(4094));
+}
@@ -0,0 +1,145 @@
+//! Detection allocates nothing
+//!
+//! The global allocator here panics on any allocation made while a check is
+//! armed on the calling thread, so a heap allocation anywhere on the
+//! `detect_sqli` / `detect_xss` path fails the test at the allocation. With
+//! the `metrics` feature each thread registers its counters before its
+//! checks, the one allocation that feature makes.
+
+#![allow(unsafe_code)]
+#![allow(clippy::panic)]
+
+use std::alloc::{GlobalAlloc, Layout, System};
+use std::cell::Cell;
+
+#[cfg(feature = "batch")]
+use libinjectionrs::batch::BatchScanner;
+use libinjectionrs::request::RequestScanner;
+use libinjectionrs::{detect_sqli, detect_sqli_with_flags, detect_xss, Scanner, SqliFlags};
+
+// The inputs the in-crate front-end tests share
+#[allow(dead_code)]
+#[path = "../src/tests/fixtures.rs"]
+mod fixtures;
+
+use fixtures::INPUTS;
+
+struct PanickingAllocator;
+
+thread_local! {
+    static ARMED: Cell<bool> = const { Cell::new(false) };
+    // Allocations seen while counting, or `None` when not counting
+    static COUNTED: Cell<Option<usize>> = const { Cell::new(None) };
+}
+
+// SAFETY: forwards to the system allocator, only adding a check
+unsafe impl GlobalAlloc for PanickingAllocator {
+    unsafe fn alloc(&self, layout: Layout) -> *mut u8 {
+        // Disarm first; the panic itself allocates
+        if ARMED.with(|armed| armed.replace(false)) {
+            panic!("detection allocated {} bytes", layout.size());
+        }
+        COUNTED.with(|counted| counted.set(counted.get().map(|n| n.wrapping_add(1))));
+        unsafe { System.alloc(layout) }
+    }
+
+    unsafe fn dealloc(&self, ptr: *mut u8, layout: Layout) {
+        unsafe { System.dealloc(ptr, layout) }
+    }
+}
+
+#[global_allocator]
+static ALLOCATOR: PanickingAllocator = PanickingAllocator;
+
+fn without_allocating<T>(f: impl FnOnce() -> T) -> T {
+    #[cfg(feature = "metrics")]
+    libinjectionrs::metrics::register_thread();
+    ARMED.with(|armed| armed.set(true));
+    let result = f();
+    ARMED.with(|armed| armed.set(false));
+    result
+}
+
+#[cfg(feature = "metrics")]
+fn allocations(f: impl FnOnce()) -> usize {
+    COUNTED.with(|counted| counted.set(Some(0)));
+    f();
+    COUNTED.with(|counted| counted.take()).unwrap_or(0)
+}
+
+#[test]
+fn test_detection_does_not_allocate() {
+    let long: Vec<u8> = b"1 or 1=1 and 'a'='a' union select 2 -- ".repeat(100);
+    for input in INPUTS.iter().copied().chain([&long[..]]) {
+        without_allocating(|| {
+            detect_sqli(input);
+            detect_xss(input);
+            let flags = SqliFlags::FLAG_QUOTE_SINGLE | SqliFlags::FLAG_SQL_MYSQL;
+            detect_sqli_with_flags(input, flags);
+        });
+    }
+}
+
+#[test]
+fn test_warm_scanners_do_not_allocate() {
+    let mut scanner = Scanner::new();
+    let mut request = RequestScanner::new();
+    #[cfg(feature = "batch")]
+    let batch = BatchScanner::<4>::new();
+    for round in 0..2 {
+        // The first round sizes the buffers this request needs
+        let check = |f: &mut dyn FnMut()| if round == 0 { f() } else { without_allocating(f) };
+        check(&mut || {
+            for input in INPUTS {
+                scanner.detect(input);
+            }
+        });
+        check(&mut || {
+            request.clear();
+            for input in INPUTS {
+                request.push(input);
+            }
+            request.scan();
+        });
+        #[cfg(feature = "batch")]
+        check(&mut || {
+            for _ in batch.detect_sqli_many(INPUTS) {}
+        });
+    }
+}
+
+#[test]
+fn test_verdicts_are_unchanged() {
+    let verdicts: Vec<(bool, bool)> = INPUTS
+        .iter()
+        .map(|input| without_allocating(|| (detect_sqli(input).is_injection(), detect_xss(input).is_injection())))
+        .collect();
+    assert!(verdicts.iter().any(|&(sqli, _)| sqli));
+    assert!(verdicts.iter().any(|&(_, xss)| xss));
+}
+
+#[cfg(feature = "metrics")]
+#[test]
+fn test_metrics_allocate_once_per_thread() {
+    let first_detection = std::thread::spawn(|| {
+        let first = allocations(|| {
+            detect_sqli(b"1");
+        });
+        let second = allocations(|| {
+            detect_sqli(b"1' OR '1'='1");
+            detect_xss(b"<script>alert(1)</script>");
+        });
+        (first, second)
+    });
+    let Ok((first, second)) = first_detection.join() else { panic!("detection thread panicked") };
+    assert!(first > 0);
+    assert_eq!(second, 0);
+
+    let registered = std::thread::spawn(|| {
+        libinjectionrs::metrics::register_thread();
+        allocations(|| {
+            detect_sqli(b"1");
+        })
+    });
+    assert!(matches!(registered.join(), Ok(0)));
+}